@@ -0,0 +1,21 @@
+# Writes OUTPUT, a header defining CONTRACT_VALIDATOR_SOURCE_HASH: one SHA-256
+# over the content of every file in SOURCES ('|'-separated). The header is only
+# rewritten when the hash changes, so unchanged sources cause no recompile.
+#
+#   cmake -DOUTPUT=<header> -DSOURCES=<a|b|c> -P SourceHash.cmake
+
+cmake_minimum_required(VERSION 3.20)
+
+string(REPLACE "|" ";" source_list "${SOURCES}")
+set(digests "")
+foreach(source IN LISTS source_list)
+    file(SHA256 "${source}" digest)
+    string(APPEND digests "${digest}\n")
+endforeach()
+string(SHA256 CONTRACT_VALIDATOR_SOURCE_HASH "${digests}")
+
+file(CONFIGURE
+    OUTPUT "${OUTPUT}"
+    CONTENT "#pragma once\n\n// Generated by cmake/SourceHash.cmake; do not edit\n#define CONTRACT_VALIDATOR_SOURCE_HASH \"@CONTRACT_VALIDATOR_SOURCE_HASH@\"\n"
+    @ONLY
+)
@@ -0,0 +1,65 @@
+#ifndef CONTRACT_VALIDATOR_CONTRACTCACHE_HPP
+#define CONTRACT_VALIDATOR_CONTRACTCACHE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace contract_validator {
+
+/**
+ * @brief Content-hash cache of the last validation result
+ *
+ * Kept as one JSON file, normally in the service's build directory. The
+ * result is reused while the key computed from the rules version and every
+ * input's path and content hash is unchanged. A missing, unreadable or
+ * outdated cache file just starts empty.
+ */
+class ContractCache {
+public:
+    /**
+     * @brief Open the cache stored at path
+     * @param path Cache file; created by save() if it does not exist
+     */
+    explicit ContractCache(std::string path);
+
+    /**
+     * @brief Validation result stored under key, if any
+     */
+    std::optional<json> result(std::uint64_t key);
+
+    /**
+     * @brief Remember the validation result for key, replacing the previous one
+     */
+    void storeResult(std::uint64_t key, const json& value);
+
+    /**
+     * @brief Write the cache back
+     *
+     * Failures are logged, not thrown: validation never fails over its cache.
+     */
+    void save();
+
+    /**
+     * @brief 64-bit FNV-1a hash, stable across runs and platforms
+     * @param data Bytes to hash
+     * @param seed Previous hash, to chain several inputs
+     */
+    static std::uint64_t hash(std::string_view data, std::uint64_t seed = kHashSeed);
+
+    static constexpr std::uint64_t kHashSeed = 14695981039346656037ull;
+
+private:
+    std::string path_;
+    json result_;   // {"key", "value"}
+
+    static std::string toHex(std::uint64_t value);
+};
+
+} // namespace contract_validator
+
+#endif // CONTRACT_VALIDATOR_CONTRACTCACHE_HPP
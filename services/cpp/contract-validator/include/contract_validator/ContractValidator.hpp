@@ -1,9 +1,12 @@
 #ifndef CONTRACT_VALIDATOR_CONTRACTVALIDATOR_HPP
 #define CONTRACT_VALIDATOR_CONTRACTVALIDATOR_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <optional>
 #include <nlohmann/json.hpp>
@@ -12,6 +15,8 @@ using json = nlohmann::json;
 
 namespace contract_validator {
 
+class ContractCache;
+
 /**
  * @brief Validates service contracts against entity contracts and claims
  * 
@@ -21,6 +26,11 @@ namespace contract_validator {
  * 3. DTO basis matches service claims
  * 4. Request basis only includes fulfilled/referenced entities
  * 5. Naming conventions are followed (entity-prefixed fields)
+ *
+ * Contract files are read and parsed on worker threads and the checks run
+ * concurrently; results are merged in a fixed order, so output does not
+ * depend on scheduling. With a cache, an unchanged set of inputs is not
+ * re-validated.
  */
 class ContractValidator {
 public:
@@ -104,6 +114,11 @@ public:
         std::vector<ReferenceClaim> references;
     };
 
+    struct Options {
+        unsigned workers;        // threads for parsing and checks; 0 for one per core
+        std::string cachePath;   // ContractCache file; empty for no cache
+    };
+
     /**
      * @brief Construct a validator with paths to contracts and claims
      * @param contractsRootPath Path to global contracts directory
@@ -114,8 +129,21 @@ public:
                      const std::string& serviceContractsPath,
                      const std::string& claimsPath);
 
+    /**
+     * @brief Construct a validator with explicit parallelism and caching
+     * @param options Worker count and cache file
+     */
+    ContractValidator(const std::string& contractsRootPath,
+                     const std::string& serviceContractsPath,
+                     const std::string& claimsPath,
+                     const Options& options);
+
+    ~ContractValidator();
+
     /**
      * @brief Run all validation checks
+     *
+     * Returns the cached result instead when no input changed since it was stored.
      * @return Validation result with errors, warnings, and info
      */
     ValidationResult validate();
@@ -179,33 +207,60 @@ private:
     std::map<std::string, json> dtos_;
     std::map<std::string, json> requests_;
     std::vector<json> endpoints_;
+    std::mutex entityMutex_;         // checks run concurrently and may load entities
+
+    unsigned workers_;
+    std::unique_ptr<ContractCache> cache_;
+    std::uint64_t inputsKey_;        // hash over the validator's sources and the path and content of every input
     
     bool initialized_;
 
+    struct SourceFile {
+        std::string path;
+        std::uint64_t hash;          // of the raw content
+        json content;                // null if unreadable or invalid
+        std::string error;
+    };
+
     /**
      * @brief Load all necessary data
      */
     void initialize();
 
     /**
-     * @brief Load claims.json
+     * @brief Parse claims.json
+     */
+    ServiceClaims loadClaims(const json& j);
+
+    /**
+     * @brief Index DTOs from service contracts by name
+     */
+    std::map<std::string, json> loadDtos(const std::vector<SourceFile>& files);
+
+    /**
+     * @brief Index Requests from service contracts by name
+     */
+    std::map<std::string, json> loadRequests(const std::vector<SourceFile>& files);
+
+    /**
+     * @brief Collect Endpoints from service contracts
      */
-    ServiceClaims loadClaims();
+    std::vector<json> loadEndpoints(const std::vector<SourceFile>& files);
 
     /**
-     * @brief Load DTOs from service contracts
+     * @brief Paths of the .json files in directory, sorted; warns if it is missing
      */
-    std::map<std::string, json> loadDtos();
+    static std::vector<std::string> listJsonFiles(const std::string& directory, const std::string& kind);
 
     /**
-     * @brief Load Requests from service contracts
+     * @brief Read, hash and parse a file
      */
-    std::map<std::string, json> loadRequests();
+    SourceFile readSourceFile(const std::string& path);
 
     /**
-     * @brief Load Endpoints from service contracts
+     * @brief readSourceFile for each path on the worker threads, in path order
      */
-    std::vector<json> loadEndpoints();
+    std::vector<SourceFile> readSourceFiles(const std::vector<std::string>& paths);
 
     /**
      * @brief Parse entity contract JSON
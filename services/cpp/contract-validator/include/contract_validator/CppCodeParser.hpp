@@ -1,7 +1,9 @@
 #ifndef CONTRACT_VALIDATOR_CPPCODEPARSER_HPP
 #define CONTRACT_VALIDATOR_CPPCODEPARSER_HPP
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <set>
@@ -22,6 +24,9 @@ namespace contract_validator {
  * - fromJson() method implementations
  * 
  * This is a focused parser for contract validation, not a full C++ AST parser.
+ * Source is lexed once into tokens that know their brace depth and matching
+ * bracket; classes, members and methods are then found by linear scans over
+ * the tokens, so parsing time grows linearly with file size.
  */
 class CppCodeParser {
 public:
@@ -59,6 +64,33 @@ public:
         std::vector<std::string> inheritedClasses;
     };
 
+    struct Token {
+        enum class Kind {
+            Identifier,           // including keywords
+            Number,
+            String,               // with quotes and any prefix, raw strings included
+            Character,
+            Punctuation           // one character, except "::"
+        };
+
+        Kind kind;
+        std::string_view text;    // into the lexed source
+        size_t depth;             // brace depth; braces carry the depth outside them
+        size_t partner;           // matching bracket for ( ) [ ] { }, else npos
+
+        bool is(std::string_view value) const { return text == value; }
+    };
+
+    /**
+     * @brief Split C++ source into tokens in one pass
+     *
+     * Comments, whitespace and preprocessor lines are dropped. Tokens view
+     * code, which must outlive them.
+     * @param code C++ source code
+     * @return Tokens in source order
+     */
+    static std::vector<Token> tokenize(std::string_view code);
+
     /**
      * @brief Parse a C++ source or header file
      * @param filePath Path to the file to parse
@@ -146,29 +178,53 @@ public:
     static std::string normalizeType(const std::string& type);
 
 private:
+    struct ClassSpan {
+        std::string name;
+        std::string fullName;
+        std::vector<std::string> bases;
+        size_t open;              // token index of the body's braces
+        size_t close;
+    };
+
     /**
-     * @brief Find all class definitions in code
-     * @param code C++ code
-     * @return List of class definition strings
+     * @brief Find all class definitions, nested ones included, in source order
+     */
+    static std::vector<ClassSpan> findClassDefinitions(const std::vector<Token>& tokens);
+
+    /**
+     * @brief Data members declared directly in the class body between open and close
+     */
+    static std::vector<MemberVariable> extractMemberVariables(const std::vector<Token>& tokens,
+                                                              size_t open, size_t close);
+
+    /**
+     * @brief Token index of the opening brace of the first body of methodName in [begin, end)
+     */
+    static std::optional<size_t> findMethodBody(const std::vector<Token>& tokens,
+                                                size_t begin, size_t end,
+                                                std::string_view methodName);
+
+    static std::optional<ToJsonMethod> extractToJsonMethod(const std::vector<Token>& tokens,
+                                                           size_t begin, size_t end);
+
+    static std::optional<FromJsonMethod> extractFromJsonMethod(const std::vector<Token>& tokens,
+                                                               size_t begin, size_t end);
+
+    /**
+     * @brief JSON field mappings in the tokens strictly inside [begin, end)
      */
-    static std::vector<std::string> findClassDefinitions(const std::string& code);
+    static std::vector<JsonFieldMapping> parseJsonFieldMappings(const std::vector<Token>& tokens,
+                                                                size_t begin, size_t end);
 
     /**
-     * @brief Extract method body by name
-     * @param classCode Class code
-     * @param methodName Method name (e.g., "toJson")
-     * @return Method body if found
+     * @brief Source text from the start of first to the end of last
      */
-    static std::optional<std::string> extractMethodBody(const std::string& classCode,
-                                                        const std::string& methodName);
+    static std::string_view sourceBetween(const Token& first, const Token& last);
 
     /**
-     * @brief Find matching brace for a given open brace position
-     * @param code Code string
-     * @param openBracePos Position of opening brace
-     * @return Position of closing brace
+     * @brief Index of the ';' ending the statement starting at begin, skipping brackets; end if none
      */
-    static size_t findMatchingBrace(const std::string& code, size_t openBracePos);
+    static size_t statementEnd(const std::vector<Token>& tokens, size_t begin, size_t end);
 
 public:
     /**
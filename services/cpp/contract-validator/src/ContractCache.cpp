@@ -0,0 +1,98 @@
+#include "contract_validator/ContractCache.hpp"
+#include "contract_validator/Logger.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace contract_validator {
+
+namespace {
+
+// Bump when the layout of the cache file or of validation results changes
+constexpr int kFormatVersion = 2;
+
+} // namespace
+
+ContractCache::ContractCache(std::string path)
+    : path_(std::move(path)) {
+    std::ifstream file(path_);
+    if (!file.is_open()) {
+        return;
+    }
+
+    try {
+        json stored;
+        file >> stored;
+        if (stored.value("format", 0) != kFormatVersion) {
+            Logger::debug("Ignoring contract cache {} from another format", path_);
+            return;
+        }
+        result_ = stored.value("result", json());
+    } catch (const std::exception& e) {
+        Logger::warn("Ignoring unreadable contract cache {}: {}", path_, e.what());
+        result_ = json();
+    }
+}
+
+std::optional<json> ContractCache::result(std::uint64_t key) {
+    if (!result_.is_object() || result_.value("key", "") != toHex(key)) {
+        return std::nullopt;
+    }
+    return result_.value("value", json());
+}
+
+void ContractCache::storeResult(std::uint64_t key, const json& value) {
+    result_ = {
+        {"key", toHex(key)},
+        {"value", value}
+    };
+}
+
+void ContractCache::save() {
+    json stored = {
+        {"format", kFormatVersion},
+        {"result", result_}
+    };
+
+    // Write beside the cache and rename, so a concurrent reader never sees half a file
+    std::string temporary = path_ + ".tmp";
+    try {
+        auto parent = fs::path(path_).parent_path();
+        if (!parent.empty()) {
+            fs::create_directories(parent);
+        }
+        {
+            std::ofstream file(temporary, std::ios::trunc);
+            if (!file.is_open()) {
+                throw std::runtime_error("cannot open " + temporary);
+            }
+            file << stored.dump();
+            if (!file.good()) {
+                throw std::runtime_error("cannot write " + temporary);
+            }
+        }
+        fs::rename(temporary, path_);
+    } catch (const std::exception& e) {
+        std::remove(temporary.c_str());
+        Logger::warn("Could not save contract cache {}: {}", path_, e.what());
+    }
+}
+
+std::uint64_t ContractCache::hash(std::string_view data, std::uint64_t seed) {
+    std::uint64_t h = seed;
+    for (unsigned char c : data) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+std::string ContractCache::toHex(std::uint64_t value) {
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+} // namespace contract_validator
@@ -1,9 +1,14 @@
 #include "contract_validator/ContractValidator.hpp"
+#include "contract_validator/ContractCache.hpp"
 #include "contract_validator/Logger.hpp"
+#include "contract_validator/SourceHash.hpp"
 #include <fstream>
 #include <filesystem>
+#include <future>
+#include <iterator>
 #include <sstream>
 #include <algorithm>
+#include <thread>
 
 namespace fs = std::filesystem;
 
@@ -12,6 +17,74 @@ namespace contract_validator {
 using ValidationResult = ContractValidator::ValidationResult;
 using ValidationError = ContractValidator::ValidationError;
 
+namespace {
+
+const char* severityName(ValidationError::Severity severity) {
+    switch (severity) {
+        case ValidationError::Severity::ERROR: return "error";
+        case ValidationError::Severity::WARNING: return "warning";
+        case ValidationError::Severity::INFO: return "info";
+    }
+    return "info";
+}
+
+json resultToJson(const ValidationResult& result) {
+    json j = json::array();
+    for (const auto* group : {&result.errors, &result.warnings, &result.info}) {
+        for (const auto& error : *group) {
+            j.push_back({
+                {"severity", severityName(error.severity)},
+                {"category", error.category},
+                {"message", error.message},
+                {"location", error.location}
+            });
+        }
+    }
+    return j;
+}
+
+ValidationResult resultFromJson(const json& j) {
+    ValidationResult result;
+    for (const auto& item : j) {
+        std::string severity = item.at("severity").get<std::string>();
+        result.addError({
+            severity == "error" ? ValidationError::Severity::ERROR
+                : severity == "warning" ? ValidationError::Severity::WARNING
+                : ValidationError::Severity::INFO,
+            item.at("category").get<std::string>(),
+            item.at("message").get<std::string>(),
+            item.at("location").get<std::string>()
+        });
+    }
+    return result;
+}
+
+// Runs task(i) for i in [0, count) on up to workers threads, each taking every workers-th index
+template <typename Task>
+void runParallel(std::size_t count, unsigned workers, const Task& task) {
+    auto threads = std::min<std::size_t>(workers, count);
+    if (threads <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> tasks;
+    for (std::size_t t = 0; t < threads; ++t) {
+        tasks.push_back(std::async(std::launch::async, [&task, t, threads, count] {
+            for (std::size_t i = t; i < count; i += threads) {
+                task(i);
+            }
+        }));
+    }
+    for (auto& done : tasks) {
+        done.get();
+    }
+}
+
+} // namespace
+
 std::string ValidationError::toString() const {
     std::stringstream ss;
     ss << "[";
@@ -54,50 +127,65 @@ std::string ValidationResult::summary() const {
 ContractValidator::ContractValidator(const std::string& contractsRootPath,
                                     const std::string& serviceContractsPath,
                                     const std::string& claimsPath)
+    : ContractValidator(contractsRootPath, serviceContractsPath, claimsPath, Options{}) {
+}
+
+ContractValidator::ContractValidator(const std::string& contractsRootPath,
+                                    const std::string& serviceContractsPath,
+                                    const std::string& claimsPath,
+                                    const Options& options)
     : contractsRootPath_(contractsRootPath)
     , serviceContractsPath_(serviceContractsPath)
     , claimsPath_(claimsPath)
+    , workers_(options.workers != 0 ? options.workers : std::max(1u, std::thread::hardware_concurrency()))
+    , inputsKey_(0)
     , initialized_(false) {
+    if (!options.cachePath.empty()) {
+        cache_ = std::make_unique<ContractCache>(options.cachePath);
+    }
 }
 
+ContractValidator::~ContractValidator() = default;
+
 ValidationResult ContractValidator::validate() {
     if (!initialized_) {
         initialize();
     }
 
-    ValidationResult result;
-
-    // Run all validation checks
-    auto fieldExposureErrors = validateFieldExposure();
-    for (const auto& error : fieldExposureErrors) {
-        result.addError(error);
-    }
-
-    auto identityFieldErrors = validateIdentityFields();
-    for (const auto& error : identityFieldErrors) {
-        result.addError(error);
-    }
-
-    auto dtoBasisErrors = validateDtoBasis();
-    for (const auto& error : dtoBasisErrors) {
-        result.addError(error);
+    if (cache_) {
+        if (auto cached = cache_->result(inputsKey_)) {
+            Logger::info("Contracts unchanged, reusing cached validation result");
+            return resultFromJson(*cached);
+        }
     }
 
-    auto requestBasisErrors = validateRequestBasis();
-    for (const auto& error : requestBasisErrors) {
-        result.addError(error);
-    }
+    // The checks only read the loaded contracts, so they run side by side;
+    // merging in this order keeps the report stable
+    using Check = std::vector<ValidationError> (ContractValidator::*)();
+    const std::vector<Check> checks = {
+        &ContractValidator::validateFieldExposure,
+        &ContractValidator::validateIdentityFields,
+        &ContractValidator::validateDtoBasis,
+        &ContractValidator::validateRequestBasis,
+        &ContractValidator::validateNamingConventions,
+        &ContractValidator::validateEndpoints
+    };
+    std::vector<std::vector<ValidationError>> found(checks.size());
+    runParallel(checks.size(), workers_, [&](std::size_t i) {
+        found[i] = (this->*checks[i])();
+    });
 
-    auto namingErrors = validateNamingConventions();
-    for (const auto& error : namingErrors) {
-        result.addError(error);
+    ValidationResult result;
+    for (const auto& errors : found) {
+        for (const auto& error : errors) {
+            result.addError(error);
+        }
     }
 
-    auto endpointErrors = validateEndpoints();
-    for (const auto& error : endpointErrors) {
-        result.addError(error);
+    if (cache_) {
+        cache_->storeResult(inputsKey_, resultToJson(result));
+        cache_->save();
     }
-
     return result;
 }
 
@@ -447,6 +535,8 @@ std::vector<ContractValidator::ValidationError> ContractValidator::validateEndpo
 }
 
 std::optional<ContractValidator::EntityContract> ContractValidator::loadEntityContract(const std::string& entityName) {
+    std::lock_guard<std::mutex> lock(entityMutex_);
+
     // Check cache
     if (entityContracts_.find(entityName) != entityContracts_.end()) {
         return entityContracts_[entityName];
@@ -472,17 +562,67 @@ std::optional<ContractValidator::EntityContract> ContractValidator::loadEntityCo
 void ContractValidator::initialize() {
     Logger::info("Initializing ContractValidator");
     
-    claims_ = loadClaims();
-    dtos_ = loadDtos();
-    requests_ = loadRequests();
-    endpoints_ = loadEndpoints();
-    
-    // Preload entity contracts for all fulfilments and references
+    auto claimsFile = readSourceFile(claimsPath_);
+    if (!claimsFile.error.empty()) {
+        throw std::runtime_error(claimsFile.error);
+    }
+    claims_ = loadClaims(claimsFile.content);
+
+    // Every other input: service contracts, then the entities the claims name
+    auto dtoPaths = listJsonFiles(serviceContractsPath_ + "/dtos", "DTOs");
+    auto requestPaths = listJsonFiles(serviceContractsPath_ + "/requests", "Requests");
+    auto endpointPaths = listJsonFiles(serviceContractsPath_ + "/endpoints", "Endpoints");
+
+    std::set<std::string> entityNames;
     for (const auto& fulfilment : claims_.fulfilments) {
-        loadEntityContract(fulfilment.contract);
+        entityNames.insert(fulfilment.contract);
     }
     for (const auto& reference : claims_.references) {
-        loadEntityContract(reference.contract);
+        entityNames.insert(reference.contract);
+    }
+    std::vector<std::string> entityPaths;
+    std::vector<std::string> pathEntities;
+    for (const auto& name : entityNames) {
+        std::string path = contractsRootPath_ + "/entities/v1/" + name + ".json";
+        if (fs::exists(path)) {
+            entityPaths.push_back(path);
+            pathEntities.push_back(name);
+        }
+    }
+
+    std::vector<std::string> paths;
+    for (const auto* group : {&dtoPaths, &requestPaths, &endpointPaths, &entityPaths}) {
+        paths.insert(paths.end(), group->begin(), group->end());
+    }
+    auto files = readSourceFiles(paths);
+
+    // The validator's own source hash first: a rebuilt validator misses every old entry
+    inputsKey_ = ContractCache::hash(CONTRACT_VALIDATOR_SOURCE_HASH);
+    inputsKey_ = ContractCache::hash(claimsFile.path, inputsKey_);
+    inputsKey_ = ContractCache::hash(std::to_string(claimsFile.hash), inputsKey_);
+    for (const auto& file : files) {
+        inputsKey_ = ContractCache::hash(file.path, inputsKey_);
+        inputsKey_ = ContractCache::hash(std::to_string(file.hash), inputsKey_);
+    }
+
+    auto next = files.begin();
+    auto take = [&next](std::size_t count) {
+        std::vector<SourceFile> group(std::make_move_iterator(next), std::make_move_iterator(next + count));
+        next += count;
+        return group;
+    };
+    dtos_ = loadDtos(take(dtoPaths.size()));
+    requests_ = loadRequests(take(requestPaths.size()));
+    endpoints_ = loadEndpoints(take(endpointPaths.size()));
+
+    // Preload entity contracts for all fulfilments and references
+    auto entityFiles = take(entityPaths.size());
+    for (std::size_t i = 0; i < entityFiles.size(); ++i) {
+        if (!entityFiles[i].error.empty()) {
+            Logger::error("Failed to load entity contract {}: {}", pathEntities[i], entityFiles[i].error);
+            continue;
+        }
+        entityContracts_[pathEntities[i]] = parseEntityContract(entityFiles[i].content);
     }
     
     initialized_ = true;
@@ -491,9 +631,7 @@ void ContractValidator::initialize() {
                 requests_.size(), endpoints_.size());
 }
 
-ContractValidator::ServiceClaims ContractValidator::loadClaims() {
-    json j = loadJsonFile(claimsPath_);
-    
+ContractValidator::ServiceClaims ContractValidator::loadClaims(const json& j) {
     ServiceClaims claims;
     claims.service = j.value("service", "");
     claims.version = j.value("version", "");
@@ -565,79 +703,99 @@ ContractValidator::ServiceClaims ContractValidator::loadClaims() {
     return claims;
 }
 
-std::map<std::string, json> ContractValidator::loadDtos() {
+std::map<std::string, json> ContractValidator::loadDtos(const std::vector<SourceFile>& files) {
     std::map<std::string, json> dtos;
-    std::string dtosPath = serviceContractsPath_ + "/dtos";
-    
-    if (!fs::exists(dtosPath)) {
-        Logger::warn("DTOs directory not found: {}", dtosPath);
-        return dtos;
-    }
     
-    for (const auto& entry : fs::directory_iterator(dtosPath)) {
-        if (entry.path().extension() == ".json") {
-            try {
-                json dto = loadJsonFile(entry.path().string());
-                std::string name = dto.value("name", "");
-                if (!name.empty()) {
-                    dtos[name] = dto;
-                }
-            } catch (const std::exception& e) {
-                Logger::error("Failed to load DTO from {}: {}", entry.path().string(), e.what());
-            }
+    for (const auto& file : files) {
+        if (!file.error.empty()) {
+            Logger::error("Failed to load DTO from {}: {}", file.path, file.error);
+            continue;
+        }
+        std::string name = file.content.value("name", "");
+        if (!name.empty()) {
+            dtos[name] = file.content;
         }
     }
     
     return dtos;
 }
 
-std::map<std::string, json> ContractValidator::loadRequests() {
+std::map<std::string, json> ContractValidator::loadRequests(const std::vector<SourceFile>& files) {
     std::map<std::string, json> requests;
-    std::string requestsPath = serviceContractsPath_ + "/requests";
-    
-    if (!fs::exists(requestsPath)) {
-        Logger::warn("Requests directory not found: {}", requestsPath);
-        return requests;
-    }
     
-    for (const auto& entry : fs::directory_iterator(requestsPath)) {
-        if (entry.path().extension() == ".json") {
-            try {
-                json request = loadJsonFile(entry.path().string());
-                std::string name = request.value("name", "");
-                if (!name.empty()) {
-                    requests[name] = request;
-                }
-            } catch (const std::exception& e) {
-                Logger::error("Failed to load Request from {}: {}", entry.path().string(), e.what());
-            }
+    for (const auto& file : files) {
+        if (!file.error.empty()) {
+            Logger::error("Failed to load Request from {}: {}", file.path, file.error);
+            continue;
+        }
+        std::string name = file.content.value("name", "");
+        if (!name.empty()) {
+            requests[name] = file.content;
         }
     }
     
     return requests;
 }
 
-std::vector<json> ContractValidator::loadEndpoints() {
+std::vector<json> ContractValidator::loadEndpoints(const std::vector<SourceFile>& files) {
     std::vector<json> endpoints;
-    std::string endpointsPath = serviceContractsPath_ + "/endpoints";
     
-    if (!fs::exists(endpointsPath)) {
-        Logger::warn("Endpoints directory not found: {}", endpointsPath);
-        return endpoints;
+    for (const auto& file : files) {
+        if (!file.error.empty()) {
+            Logger::error("Failed to load Endpoint from {}: {}", file.path, file.error);
+            continue;
+        }
+        endpoints.push_back(file.content);
+    }
+    
+    return endpoints;
+}
+
+std::vector<std::string> ContractValidator::listJsonFiles(const std::string& directory, const std::string& kind) {
+    std::vector<std::string> paths;
+    
+    if (!fs::exists(directory)) {
+        Logger::warn("{} directory not found: {}", kind, directory);
+        return paths;
     }
     
-    for (const auto& entry : fs::directory_iterator(endpointsPath)) {
+    for (const auto& entry : fs::directory_iterator(directory)) {
         if (entry.path().extension() == ".json") {
-            try {
-                json endpoint = loadJsonFile(entry.path().string());
-                endpoints.push_back(endpoint);
-            } catch (const std::exception& e) {
-                Logger::error("Failed to load Endpoint from {}: {}", entry.path().string(), e.what());
-            }
+            paths.push_back(entry.path().string());
         }
     }
+    std::sort(paths.begin(), paths.end());
     
-    return endpoints;
+    return paths;
+}
+
+ContractValidator::SourceFile ContractValidator::readSourceFile(const std::string& path) {
+    SourceFile file{path, 0, json(), ""};
+    
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) {
+        file.error = "Cannot open file: " + path;
+        return file;
+    }
+    std::string raw((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    file.hash = ContractCache::hash(raw);
+    
+    try {
+        file.content = json::parse(raw);
+    } catch (const json::exception& e) {
+        file.error = "JSON parse error in " + path + ": " + e.what();
+        return file;
+    }
+    
+    return file;
+}
+
+std::vector<ContractValidator::SourceFile> ContractValidator::readSourceFiles(const std::vector<std::string>& paths) {
+    std::vector<SourceFile> files(paths.size());
+    runParallel(paths.size(), workers_, [&](std::size_t i) {
+        files[i] = readSourceFile(paths[i]);
+    });
+    return files;
 }
 
 ContractValidator::EntityContract ContractValidator::parseEntityContract(const json& j) {
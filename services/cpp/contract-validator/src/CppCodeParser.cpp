@@ -2,12 +2,58 @@
 #include "contract_validator/Logger.hpp"
 #include <fstream>
 #include <sstream>
-#include <regex>
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <set>
 
 namespace contract_validator {
 
+namespace {
+
+constexpr size_t npos = std::string::npos;
+
+using Token = CppCodeParser::Token;
+using Kind = CppCodeParser::Token::Kind;
+
+bool isIdentifierStart(char c) {
+    return std::isalpha(static_cast<unsigned char>(c)) || c == '_' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+bool isIdentifierChar(char c) {
+    return isIdentifierStart(c) || std::isdigit(static_cast<unsigned char>(c));
+}
+
+bool isStringPrefix(std::string_view word) {
+    return word == "R" || word == "L" || word == "u" || word == "U" || word == "u8" ||
+           word == "LR" || word == "uR" || word == "UR" || word == "u8R";
+}
+
+// Index just past the ')' matching tokens[open], or npos if it has none
+size_t afterParentheses(const std::vector<Token>& tokens, size_t open) {
+    return tokens[open].partner == npos ? npos : tokens[open].partner + 1;
+}
+
+bool hasQuestionMark(const std::vector<Token>& tokens, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        if (tokens[i].is("?")) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string unquote(std::string_view literal) {
+    auto first = literal.find('"');
+    auto last = literal.rfind('"');
+    if (first == std::string_view::npos || last <= first) {
+        return std::string(literal);
+    }
+    return std::string(literal.substr(first + 1, last - first - 1));
+}
+
+} // namespace
+
 std::vector<CppCodeParser::ClassInfo> CppCodeParser::parseFile(const std::string& filePath) {
     std::ifstream file(filePath);
     if (!file.is_open()) {
@@ -23,33 +69,170 @@ std::vector<CppCodeParser::ClassInfo> CppCodeParser::parseFile(const std::string
 std::vector<CppCodeParser::ClassInfo> CppCodeParser::parseCode(const std::string& code) {
     std::vector<ClassInfo> classes;
     
-    // Remove comments first
-    std::string cleanCode = removeComments(code);
-    
-    // Find all class definitions
-    std::vector<std::string> classDefinitions = findClassDefinitions(cleanCode);
+    auto tokens = tokenize(code);
     
-    for (const auto& classDef : classDefinitions) {
+    for (const auto& span : findClassDefinitions(tokens)) {
         ClassInfo info;
+        info.name = span.name;
+        info.fullName = span.fullName;
+        info.inheritedClasses = span.bases;
+        info.members = extractMemberVariables(tokens, span.open, span.close);
+        info.toJson = extractToJsonMethod(tokens, span.open + 1, span.close);
+        info.fromJson = extractFromJsonMethod(tokens, span.open + 1, span.close);
+        classes.push_back(std::move(info));
+    }
+    
+    return classes;
+}
+
+std::vector<CppCodeParser::Token> CppCodeParser::tokenize(std::string_view code) {
+    std::vector<Token> tokens;
+    tokens.reserve(code.size() / 4);
+    
+    std::vector<size_t> open;        // indexes of unmatched ( [ {
+    size_t depth = 0;
+    bool lineStart = true;           // only whitespace so far on this line
+    
+    auto push = [&](Kind kind, size_t start, size_t end) {
+        tokens.push_back({kind, code.substr(start, end - start), depth, npos});
+        lineStart = false;
+    };
+    
+    size_t i = 0;
+    const size_t n = code.size();
+    while (i < n) {
+        char c = code[i];
+        char next = i + 1 < n ? code[i + 1] : '\0';
         
-        // Extract class name
-        auto [className, fullName] = extractClassName(classDef);
-        info.name = className;
-        info.fullName = fullName;
+        if (c == '\n') {
+            lineStart = true;
+            ++i;
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+            continue;
+        }
         
-        // Extract member variables
-        info.members = extractMemberVariables(classDef);
+        // Comments
+        if (c == '/' && next == '/') {
+            while (i < n && code[i] != '\n') {
+                ++i;
+            }
+            continue;
+        }
+        if (c == '/' && next == '*') {
+            auto end = code.find("*/", i + 2);
+            i = end == std::string_view::npos ? n : end + 2;
+            continue;
+        }
         
-        // Extract toJson method
-        info.toJson = extractToJsonMethod(classDef);
+        // Preprocessor lines, with continuations
+        if (c == '#' && lineStart) {
+            while (i < n && code[i] != '\n') {
+                if (code[i] == '\\' && i + 1 < n && code[i + 1] == '\n') {
+                    ++i;
+                }
+                ++i;
+            }
+            continue;
+        }
+        
+        size_t start = i;
         
-        // Extract fromJson method
-        info.fromJson = extractFromJsonMethod(classDef);
+        if (isIdentifierStart(c)) {
+            while (i < n && isIdentifierChar(code[i])) {
+                ++i;
+            }
+            auto word = code.substr(start, i - start);
+            if (i < n && code[i] == '"' && isStringPrefix(word)) {
+                if (word.back() == 'R') {
+                    // R"delim( ... )delim"
+                    auto paren = code.find('(', i);
+                    if (paren == std::string_view::npos) {
+                        i = n;
+                    } else {
+                        std::string terminator = ")" + std::string(code.substr(i + 1, paren - i - 1)) + "\"";
+                        auto end = code.find(terminator, paren + 1);
+                        i = end == std::string_view::npos ? n : end + terminator.size();
+                    }
+                    push(Kind::String, start, i);
+                    continue;
+                }
+                c = '"';             // an ordinary literal with a prefix
+            } else {
+                push(Kind::Identifier, start, i);
+                continue;
+            }
+        }
         
-        classes.push_back(info);
+        if (c == '"' || c == '\'') {
+            char quote = c;
+            ++i;
+            while (i < n && code[i] != quote && code[i] != '\n') {
+                if (code[i] == '\\' && i + 1 < n) {
+                    ++i;
+                }
+                ++i;
+            }
+            if (i < n && code[i] == quote) {
+                ++i;
+            }
+            push(quote == '"' ? Kind::String : Kind::Character, start, i);
+            continue;
+        }
+        
+        if (std::isdigit(static_cast<unsigned char>(c)) || (c == '.' && std::isdigit(static_cast<unsigned char>(next)))) {
+            // Digits, letters, '.', digit separators and signed exponents
+            ++i;
+            while (i < n) {
+                char d = code[i];
+                if (isIdentifierChar(d) || d == '.' ||
+                    (d == '\'' && i + 1 < n && isIdentifierChar(code[i + 1]))) {
+                    ++i;
+                } else if ((d == '+' || d == '-') && std::strchr("eEpP", code[i - 1])) {
+                    ++i;
+                } else {
+                    break;
+                }
+            }
+            push(Kind::Number, start, i);
+            continue;
+        }
+        
+        if (c == ':' && next == ':') {
+            i += 2;
+            push(Kind::Punctuation, start, i);
+            continue;
+        }
+        
+        ++i;
+        if (c == '}') {
+            depth = depth > 0 ? depth - 1 : 0;
+        }
+        push(Kind::Punctuation, start, i);
+        
+        if (c == '(' || c == '[' || c == '{') {
+            open.push_back(tokens.size() - 1);
+            if (c == '{') {
+                ++depth;
+            }
+        } else if (c == ')' || c == ']' || c == '}') {
+            char opener = c == ')' ? '(' : c == ']' ? '[' : '{';
+            // Drop unmatched openers of other kinds, so one stray bracket can't pair up the rest
+            while (!open.empty() && tokens[open.back()].text[0] != opener &&
+                   (opener == '{' || tokens[open.back()].text[0] != '{')) {
+                open.pop_back();
+            }
+            if (!open.empty() && tokens[open.back()].text[0] == opener) {
+                tokens[open.back()].partner = tokens.size() - 1;
+                tokens.back().partner = open.back();
+                open.pop_back();
+            }
+        }
     }
     
-    return classes;
+    return tokens;
 }
 
 std::optional<CppCodeParser::ClassInfo> CppCodeParser::findClass(
@@ -125,262 +308,384 @@ std::string CppCodeParser::removeComments(const std::string& code) {
     return result;
 }
 
-std::vector<std::string> CppCodeParser::findClassDefinitions(const std::string& code) {
-    std::vector<std::string> definitions;
-    
-    // Regex to match: class ClassName { ... }
-    // This is a simplified approach - we'll extract the full class body
-    std::regex classRegex(R"(class\s+(\w+)\s*(?::\s*[^{]*)?\{)");
-    
-    std::sregex_iterator iter(code.begin(), code.end(), classRegex);
-    std::sregex_iterator end;
+std::vector<CppCodeParser::ClassSpan> CppCodeParser::findClassDefinitions(const std::vector<Token>& tokens) {
+    std::vector<ClassSpan> classes;
+    
+    // Enclosing namespaces and classes, for qualified names
+    struct Scope {
+        std::string name;
+        size_t close;
+    };
+    std::vector<Scope> scopes;
+    auto qualified = [&scopes](const std::string& name) {
+        std::string full;
+        for (const auto& scope : scopes) {
+            if (!scope.name.empty()) {
+                full += scope.name + "::";
+            }
+        }
+        return full + name;
+    };
     
-    for (; iter != end; ++iter) {
-        size_t classStart = iter->position();
-        size_t bracePos = iter->position() + iter->str().size() - 1; // Position of '{'
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        while (!scopes.empty() && i > scopes.back().close) {
+            scopes.pop_back();
+        }
         
-        size_t braceEnd = findMatchingBrace(code, bracePos);
-        if (braceEnd != std::string::npos) {
-            std::string classDef = code.substr(classStart, braceEnd - classStart + 1);
-            definitions.push_back(classDef);
+        const auto& token = tokens[i];
+        if (token.kind != Kind::Identifier) {
+            continue;
         }
-    }
-    
-    return definitions;
-}
-
-size_t CppCodeParser::findMatchingBrace(const std::string& code, size_t openBracePos) {
-    int braceCount = 1;
-    bool inString = false;
-    bool escaped = false;
-    
-    for (size_t i = openBracePos + 1; i < code.size(); ++i) {
-        char c = code[i];
         
-        if (inString) {
-            if (c == '"' && !escaped) {
-                inString = false;
+        if (token.is("namespace")) {
+            // namespace a::b {  /  namespace {  /  namespace x = y;
+            std::string name;
+            size_t j = i + 1;
+            while (j < tokens.size() && (tokens[j].kind == Kind::Identifier || tokens[j].is("::"))) {
+                name += tokens[j].text;
+                ++j;
+            }
+            if (j < tokens.size() && tokens[j].is("{") && tokens[j].partner != npos) {
+                scopes.push_back({name, tokens[j].partner});
+                i = j;
             }
-            escaped = (c == '\\' && !escaped);
             continue;
         }
         
-        if (c == '"') {
-            inString = true;
+        if (!token.is("class") || (i > 0 && tokens[i - 1].is("enum"))) {
             continue;
         }
         
-        if (c == '{') {
-            ++braceCount;
-        } else if (c == '}') {
-            --braceCount;
-            if (braceCount == 0) {
-                return i;
+        // class [MACRO] [Outer::]Name [final] [: bases] {
+        std::string name;
+        std::string qualifier;
+        size_t j = i + 1;
+        while (j < tokens.size() && (tokens[j].kind == Kind::Identifier || tokens[j].is("::"))) {
+            if (tokens[j].is("::")) {
+                qualifier += name + "::";
+            } else if (!tokens[j].is("final")) {
+                name = std::string(tokens[j].text);
             }
+            ++j;
+        }
+        if (name.empty() || j >= tokens.size()) {
+            continue;
         }
+        
+        std::vector<std::string> bases;
+        if (tokens[j].is(":")) {
+            size_t baseStart = j + 1;
+            int angles = 0;
+            for (++j; j < tokens.size() && !tokens[j].is("{") && !tokens[j].is(";"); ++j) {
+                if (tokens[j].is("<")) {
+                    ++angles;
+                } else if (tokens[j].is(">")) {
+                    --angles;
+                } else if (tokens[j].is(",") && angles == 0) {
+                    if (j > baseStart) {
+                        bases.emplace_back(sourceBetween(tokens[baseStart], tokens[j - 1]));
+                    }
+                    baseStart = j + 1;
+                } else if (j == baseStart && (tokens[j].is("public") || tokens[j].is("protected") ||
+                                              tokens[j].is("private") || tokens[j].is("virtual"))) {
+                    baseStart = j + 1;
+                }
+            }
+            if (j < tokens.size() && tokens[j].is("{") && j > baseStart) {
+                bases.emplace_back(sourceBetween(tokens[baseStart], tokens[j - 1]));
+            }
+        }
+        
+        if (j >= tokens.size() || !tokens[j].is("{") || tokens[j].partner == npos) {
+            continue;
+        }
+        
+        classes.push_back({name, qualified(qualifier + name), std::move(bases), j, tokens[j].partner});
+        scopes.push_back({name, tokens[j].partner});
+        i = j;
     }
     
-    return std::string::npos;
+    return classes;
 }
 
 std::pair<std::string, std::string> CppCodeParser::extractClassName(const std::string& classDefinition) {
-    // Extract: class ClassName [: inheritance] {
-    std::regex classRegex(R"(class\s+(\w+))");
-    std::smatch match;
-    
-    if (std::regex_search(classDefinition, match, classRegex)) {
-        std::string className = match[1].str();
-        
-        // Try to find namespace (look backwards from class definition)
-        // For now, just return className
-        return {className, className};
+    auto tokens = tokenize(classDefinition);
+    auto classes = findClassDefinitions(tokens);
+    if (classes.empty()) {
+        return {"", ""};
     }
-    
-    return {"", ""};
+    return {classes.front().name, classes.front().fullName};
 }
 
 std::vector<CppCodeParser::MemberVariable> CppCodeParser::extractMemberVariables(const std::string& classCode) {
+    auto tokens = tokenize(classCode);
+    auto classes = findClassDefinitions(tokens);
+    if (classes.empty()) {
+        return {};
+    }
+    return extractMemberVariables(tokens, classes.front().open, classes.front().close);
+}
+
+std::vector<CppCodeParser::MemberVariable> CppCodeParser::extractMemberVariables(const std::vector<Token>& tokens,
+                                                                                 size_t open, size_t close) {
     std::vector<MemberVariable> members;
-    
-    // Find private section (most member variables are private)
-    std::regex privateRegex(R"(private\s*:)");
-    std::smatch match;
-    
-    std::string searchCode = classCode;
-    size_t privateStart = 0;
-    
-    if (std::regex_search(classCode, match, privateRegex)) {
-        privateStart = match.position() + match.str().size();
-        searchCode = classCode.substr(privateStart);
+    const size_t bodyDepth = tokens[open].depth + 1;
+    
+    // Members are conventionally private; start at the first private section if there is one
+    size_t start = open + 1;
+    for (size_t i = open + 1; i + 1 < close; ++i) {
+        if (tokens[i].depth == bodyDepth && tokens[i].is("private") && tokens[i + 1].is(":")) {
+            start = i + 2;
+            break;
+        }
+        if (tokens[i].is("{") && tokens[i].partner != npos) {
+            i = tokens[i].partner;
+        }
     }
     
-    // Match member variables: type name_;
-    // Handles: std::string id_;
-    //          std::optional<std::string> batchNumber_;
-    //          int quantity_ = 0;
-    std::regex memberRegex(R"((?:^|\n)\s*((?:std::)?(?:\w+(?:::\w+)*(?:<[^>]+>)?)\s+(\w+_)\s*(?:=\s*([^;]+))?\s*;))");
-    
-    std::sregex_iterator iter(searchCode.begin(), searchCode.end(), memberRegex);
-    std::sregex_iterator end;
-    
-    for (; iter != end; ++iter) {
-        MemberVariable member;
-        std::string fullType = (*iter)[1].str();
-        member.name = (*iter)[2].str();
+    // A declaration: [mutable] Type name_ [= value | {value}] ;
+    auto declaration = [&](size_t begin, size_t end) {
+        if (begin >= end || tokens[begin].kind != Kind::Identifier) {
+            return;
+        }
+        static const std::set<std::string_view> skipped = {
+            "static", "constexpr", "using", "typedef", "friend", "template",
+            "class", "struct", "enum", "union", "public", "protected", "private"
+        };
+        if (skipped.count(tokens[begin].text)) {
+            return;
+        }
+        if (tokens[begin].is("mutable")) {
+            ++begin;
+        }
         
-        // Extract just the type part (before the variable name)
-        size_t varNamePos = fullType.find(member.name);
-        if (varNamePos != std::string::npos) {
-            member.type = trim(fullType.substr(0, varNamePos));
-        } else {
-            member.type = fullType;
+        // The name ends the declarator: before '=', a brace initialiser or ';'
+        size_t nameEnd = end;
+        int angles = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const auto& token = tokens[i];
+            if (token.is("<")) {
+                ++angles;
+            } else if (token.is(">")) {
+                --angles;
+            } else if (angles == 0 && (token.is("(") || token.is(","))) {
+                return;              // a function, or several declarators
+            } else if (token.is("=") || token.is("{")) {
+                nameEnd = i;
+                break;
+            }
+        }
+        if (nameEnd < begin + 2) {
+            return;
+        }
+        const auto& nameToken = tokens[nameEnd - 1];
+        if (nameToken.kind != Kind::Identifier || nameToken.text.back() != '_') {
+            return;
         }
         
+        MemberVariable member;
+        member.name = std::string(nameToken.text);
+        member.type = trim(std::string(sourceBetween(tokens[begin], tokens[nameEnd - 2])));
         member.isOptional = isOptionalType(member.type);
-        
-        if (iter->size() > 3) {
-            member.defaultValue = trim((*iter)[3].str());
+        if (nameEnd < end && tokens[nameEnd].is("=") && nameEnd + 1 < end) {
+            member.defaultValue = trim(std::string(sourceBetween(tokens[nameEnd + 1], tokens[end - 1])));
+        } else if (nameEnd < end && tokens[nameEnd].is("{") && tokens[nameEnd].partner > nameEnd + 1 &&
+                   tokens[nameEnd].partner != npos) {
+            member.defaultValue = trim(std::string(sourceBetween(tokens[nameEnd + 1],
+                                                                 tokens[tokens[nameEnd].partner - 1])));
+        }
+        members.push_back(std::move(member));
+    };
+    
+    size_t statement = start;
+    for (size_t i = start; i < close; ++i) {
+        const auto& token = tokens[i];
+        if ((token.is("public") || token.is("protected") || token.is("private")) &&
+            i + 1 < close && tokens[i + 1].is(":")) {
+            statement = i + 2;
+            ++i;
+        } else if (token.is(";")) {
+            declaration(statement, i);
+            statement = i + 1;
+        } else if (token.is("{") || token.is("(") || token.is("[")) {
+            if (token.partner == npos || token.partner >= close) {
+                break;
+            }
+            i = token.partner;
+            // A function body ends its declaration; a brace initialiser is followed by ';'
+            if (token.is("{") && !(i + 1 < close && tokens[i + 1].is(";"))) {
+                statement = i + 1;
+            }
         }
-        
-        members.push_back(member);
     }
     
     return members;
 }
 
 std::optional<CppCodeParser::ToJsonMethod> CppCodeParser::extractToJsonMethod(const std::string& classCode) {
-    auto methodBody = extractMethodBody(classCode, "toJson");
-    if (!methodBody) {
+    auto tokens = tokenize(classCode);
+    return extractToJsonMethod(tokens, 0, tokens.size());
+}
+
+std::optional<CppCodeParser::ToJsonMethod> CppCodeParser::extractToJsonMethod(const std::vector<Token>& tokens,
+                                                                              size_t begin, size_t end) {
+    auto open = findMethodBody(tokens, begin, end, "toJson");
+    if (!open) {
         return std::nullopt;
     }
+    size_t close = tokens[*open].partner;
     
     ToJsonMethod method;
-    method.rawCode = *methodBody;
-    method.fields = parseJsonFieldMappings(*methodBody);
-    
-    // Check if uses return { ... } style
-    method.usesReturn = (methodBody->find("return") != std::string::npos &&
-                         methodBody->find("json j") == std::string::npos);
+    method.rawCode = std::string(tokens[*open].text.data() + 1, tokens[close].text.data());
+    method.fields = parseJsonFieldMappings(tokens, *open + 1, close);
+    
+    // return { ... } rather than building a json j and returning it
+    bool returns = false;
+    bool buildsJ = false;
+    for (size_t i = *open + 1; i < close; ++i) {
+        returns = returns || tokens[i].is("return");
+        buildsJ = buildsJ || (tokens[i].is("json") && i + 1 < close && tokens[i + 1].is("j"));
+    }
+    method.usesReturn = returns && !buildsJ;
     
     return method;
 }
 
 std::optional<CppCodeParser::FromJsonMethod> CppCodeParser::extractFromJsonMethod(const std::string& classCode) {
-    auto methodBody = extractMethodBody(classCode, "fromJson");
-    if (!methodBody) {
+    auto tokens = tokenize(classCode);
+    return extractFromJsonMethod(tokens, 0, tokens.size());
+}
+
+std::optional<CppCodeParser::FromJsonMethod> CppCodeParser::extractFromJsonMethod(const std::vector<Token>& tokens,
+                                                                                  size_t begin, size_t end) {
+    auto open = findMethodBody(tokens, begin, end, "fromJson");
+    if (!open) {
         return std::nullopt;
     }
+    size_t close = tokens[*open].partner;
     
     FromJsonMethod method;
-    method.rawCode = *methodBody;
+    method.rawCode = std::string(tokens[*open].text.data() + 1, tokens[close].text.data());
     // fromJson parsing can be added later if needed
     
     return method;
 }
 
-std::optional<std::string> CppCodeParser::extractMethodBody(const std::string& classCode,
-                                                            const std::string& methodName) {
-    // Match: json toJson() const {
-    //        json toJson() {
-    //        static Type fromJson(const json& j) {
-    std::string pattern = methodName + R"(\s*\([^)]*\)\s*(?:const)?\s*\{)";
-    std::regex methodRegex(pattern);
-    std::smatch match;
-    
-    if (std::regex_search(classCode, match, methodRegex)) {
-        size_t methodStart = match.position();
-        size_t bracePos = match.position() + match.str().size() - 1;
-        
-        size_t braceEnd = findMatchingBrace(classCode, bracePos);
-        if (braceEnd != std::string::npos) {
-            // Extract just the body (without the opening brace)
-            return classCode.substr(bracePos + 1, braceEnd - bracePos - 1);
+std::optional<size_t> CppCodeParser::findMethodBody(const std::vector<Token>& tokens,
+                                                    size_t begin, size_t end,
+                                                    std::string_view methodName) {
+    // name ( params ) [const] [noexcept] [override] [final] {
+    for (size_t i = begin; i + 1 < end; ++i) {
+        if (!tokens[i].is(methodName) || !tokens[i + 1].is("(")) {
+            continue;
+        }
+        size_t j = afterParentheses(tokens, i + 1);
+        while (j < end && (tokens[j].is("const") || tokens[j].is("noexcept") ||
+                           tokens[j].is("override") || tokens[j].is("final"))) {
+            ++j;
+        }
+        if (j < end && tokens[j].is("{") && tokens[j].partner != npos && tokens[j].partner < end) {
+            return j;
         }
     }
-    
     return std::nullopt;
 }
 
 std::vector<CppCodeParser::JsonFieldMapping> CppCodeParser::parseJsonFieldMappings(const std::string& methodBody) {
+    auto tokens = tokenize(methodBody);
+    return parseJsonFieldMappings(tokens, 0, tokens.size());
+}
+
+std::vector<CppCodeParser::JsonFieldMapping> CppCodeParser::parseJsonFieldMappings(const std::vector<Token>& tokens,
+                                                                                   size_t begin, size_t end) {
     std::vector<JsonFieldMapping> mappings;
     
-    // Pattern 1: return { {"key", value}, ... }
-    // Pattern 2: json j = { {"key", value}, ... }
-    // Pattern 3: j["key"] = value;
-    
-    // Try to find return statement with initializer list
-    std::regex returnRegex(R"regex(return\s*\{([^}]+)\})regex");
-    std::smatch returnMatch;
-    
-    if (std::regex_search(methodBody, returnMatch, returnRegex)) {
-        std::string initList = returnMatch[1].str();
-        
-        // Parse {"key", value} pairs
-        std::regex pairRegex(R"regex(\{\s*"([^"]+)"\s*,\s*([^}]+)\s*\})regex");
-        std::sregex_iterator iter(initList.begin(), initList.end(), pairRegex);
-        std::sregex_iterator end;
-        
-        for (; iter != end; ++iter) {
-            JsonFieldMapping mapping;
-            mapping.jsonKey = (*iter)[1].str();
-            mapping.expression = trim((*iter)[2].str());
-            
-            // Extract member variable name
-            mapping.memberVar = extractMemberVarFromExpression(mapping.expression);
-            mapping.isOptional = (mapping.expression.find("if") != std::string::npos ||
-                                  mapping.expression.find("?") != std::string::npos);
-            
-            mappings.push_back(mapping);
-        }
-    } else {
-        // Try j["key"] = value; pattern
-        std::regex assignRegex(R"regex(j\s*\[\s*"([^"]+)"\s*\]\s*=\s*([^;]+)\s*;)regex");
-        std::sregex_iterator iter(methodBody.begin(), methodBody.end(), assignRegex);
-        std::sregex_iterator end;
-        
-        for (; iter != end; ++iter) {
-            JsonFieldMapping mapping;
-            mapping.jsonKey = (*iter)[1].str();
-            mapping.expression = trim((*iter)[2].str());
-            mapping.memberVar = extractMemberVarFromExpression(mapping.expression);
-            mapping.isOptional = false;
-            
-            mappings.push_back(mapping);
+    // Tokens under an if or else may not be serialised: mark them
+    std::vector<int> conditional(end - begin + 1, 0);
+    auto markConditional = [&](size_t from, size_t to) {
+        if (from < to) {
+            ++conditional[from - begin];
+            --conditional[to - begin];
+        }
+    };
+    for (size_t i = begin; i < end; ++i) {
+        size_t branch = npos;
+        if (tokens[i].is("if")) {
+            size_t j = i + 1;
+            if (j < end && tokens[j].is("constexpr")) {
+                ++j;
+            }
+            if (j < end && tokens[j].is("(")) {
+                branch = afterParentheses(tokens, j);
+            }
+        } else if (tokens[i].is("else") && i + 1 < end && !tokens[i + 1].is("if")) {
+            branch = i + 1;
+        }
+        if (branch == npos || branch >= end) {
+            continue;
+        }
+        if (tokens[branch].is("{") && tokens[branch].partner != npos && tokens[branch].partner < end) {
+            markConditional(branch, tokens[branch].partner + 1);
+        } else {
+            markConditional(branch, std::min(statementEnd(tokens, branch, end) + 1, end));
         }
     }
+    for (size_t i = 1; i < conditional.size(); ++i) {
+        conditional[i] += conditional[i - 1];
+    }
     
-    // Handle optional fields: if (field_) j["key"] = *field_;
-    std::regex optionalRegex(R"regex(if\s*\(\s*(\w+_)\s*\)\s*(?:j\s*\[\s*"([^"]+)"\s*\]\s*=\s*\*(\w+_)|.*\{\s*"([^"]+)"\s*,\s*\*(\w+_)\s*\}))regex");
-    std::sregex_iterator optIter(methodBody.begin(), methodBody.end(), optionalRegex);
-    std::sregex_iterator optEnd;
-    
-    for (; optIter != optEnd; ++optIter) {
+    auto add = [&](std::string key, size_t exprBegin, size_t exprEnd, bool optional) {
+        if (exprBegin >= exprEnd) {
+            return;
+        }
+        for (auto& existing : mappings) {
+            if (existing.jsonKey == key) {
+                existing.isOptional = existing.isOptional || optional;
+                return;
+            }
+        }
         JsonFieldMapping mapping;
-        mapping.memberVar = (*optIter)[1].str();
+        mapping.jsonKey = std::move(key);
+        mapping.expression = trim(std::string(sourceBetween(tokens[exprBegin], tokens[exprEnd - 1])));
+        mapping.memberVar = extractMemberVarFromExpression(mapping.expression);
+        mapping.isOptional = optional || hasQuestionMark(tokens, exprBegin, exprEnd);
+        mappings.push_back(std::move(mapping));
+    };
+    
+    // Initialiser lists are those opened after return, =, ( or json
+    std::vector<size_t> braces;
+    for (size_t i = begin; i < end; ++i) {
+        const auto& token = tokens[i];
         
-        if ((*optIter)[2].matched) {
-            // j["key"] = *field_ pattern
-            mapping.jsonKey = (*optIter)[2].str();
-        } else if ((*optIter)[4].matched) {
-            // {"key", *field_} pattern
-            mapping.jsonKey = (*optIter)[4].str();
+        if (token.is("}")) {
+            if (!braces.empty()) {
+                braces.pop_back();
+            }
+            continue;
         }
         
-        mapping.expression = "*" + mapping.memberVar;
-        mapping.isOptional = true;
-        
-        // Check if we already have this mapping
-        bool found = false;
-        for (auto& existing : mappings) {
-            if (existing.jsonKey == mapping.jsonKey) {
-                existing.isOptional = true;
-                found = true;
-                break;
+        if (token.is("{")) {
+            bool pair = i + 3 < end && tokens[i + 1].kind == Kind::String && tokens[i + 2].is(",") &&
+                        token.partner != npos && token.partner < end;
+            if (pair && !braces.empty()) {
+                size_t list = braces.back();
+                const Token* before = list > 0 ? &tokens[list - 1] : nullptr;
+                if (before && (before->is("return") || before->is("=") || before->is("(") || before->is("json"))) {
+                    // {"key", expression}
+                    add(unquote(tokens[i + 1].text), i + 3, token.partner, conditional[i - begin] > 0);
+                }
             }
+            braces.push_back(i);
+            continue;
         }
         
-        if (!found) {
-            mappings.push_back(mapping);
+        // name["key"] = expression;
+        if (token.kind == Kind::Identifier && i + 5 < end && tokens[i + 1].is("[") &&
+            tokens[i + 2].kind == Kind::String && tokens[i + 3].is("]") &&
+            tokens[i + 4].is("=") && !tokens[i + 5].is("=")) {
+            size_t exprEnd = statementEnd(tokens, i + 5, end);
+            add(unquote(tokens[i + 2].text), i + 5, exprEnd, conditional[i - begin] > 0);
+            i += 4;
         }
     }
     
@@ -399,12 +704,15 @@ std::string CppCodeParser::extractMemberVarFromExpression(const std::string& exp
     // Trim whitespace
     expr = trim(expr);
     
-    // If it's a function call, extract the argument
+    // If it's a function call, take its member argument: f(member_)
     if (expr.find('(') != std::string::npos) {
-        std::regex funcRegex(R"(\w+\s*\(\s*(\w+_)\s*\))");
-        std::smatch match;
-        if (std::regex_search(expr, match, funcRegex)) {
-            return match[1].str();
+        auto tokens = tokenize(expr);
+        for (size_t i = 0; i + 3 < tokens.size(); ++i) {
+            if (tokens[i].kind == Kind::Identifier && tokens[i + 1].is("(") &&
+                tokens[i + 2].kind == Kind::Identifier && tokens[i + 2].text.back() == '_' &&
+                tokens[i + 3].is(")")) {
+                return std::string(tokens[i + 2].text);
+            }
         }
         return ""; // Unknown pattern
     }
@@ -417,17 +725,52 @@ std::string CppCodeParser::extractMemberVarFromExpression(const std::string& exp
     return "";
 }
 
+std::string_view CppCodeParser::sourceBetween(const Token& first, const Token& last) {
+    const char* begin = first.text.data();
+    const char* end = last.text.data() + last.text.size();
+    return std::string_view(begin, static_cast<size_t>(end - begin));
+}
+
+size_t CppCodeParser::statementEnd(const std::vector<Token>& tokens, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        const auto& token = tokens[i];
+        if (token.is(";")) {
+            return i;
+        }
+        if (token.is("}") || token.is(")") || token.is("]")) {
+            return i;                // the enclosing block ends first
+        }
+        if ((token.is("{") || token.is("(") || token.is("[")) && token.partner != npos) {
+            i = token.partner;
+        }
+    }
+    return end;
+}
+
 bool CppCodeParser::isOptionalType(const std::string& type) {
     return type.find("std::optional") != std::string::npos ||
            type.find("optional<") != std::string::npos;
 }
 
 std::string CppCodeParser::unwrapOptionalType(const std::string& type) {
-    std::regex optionalRegex(R"((?:std::)?optional\s*<\s*([^>]+)\s*>)");
-    std::smatch match;
-    
-    if (std::regex_search(type, match, optionalRegex)) {
-        return trim(match[1].str());
+    // optional<T>, with T possibly a template itself
+    auto at = type.find("optional");
+    while (at != std::string::npos) {
+        size_t open = at + std::string("optional").size();
+        while (open < type.size() && std::isspace(static_cast<unsigned char>(type[open]))) {
+            ++open;
+        }
+        if (open < type.size() && type[open] == '<') {
+            int angles = 1;
+            for (size_t i = open + 1; i < type.size(); ++i) {
+                if (type[i] == '<') {
+                    ++angles;
+                } else if (type[i] == '>' && --angles == 0) {
+                    return trim(type.substr(open + 1, i - open - 1));
+                }
+            }
+        }
+        at = type.find("optional", at + 1);
     }
     
     return type;
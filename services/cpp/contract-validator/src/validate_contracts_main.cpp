@@ -8,6 +8,8 @@
  *   --contracts-root <path>    Path to global contracts directory
  *   --service-contracts <path>  Path to service contracts directory (default: contracts)
  *   --claims <path>             Path to claims.json (default: claims.json)
+ *   --cache <path>              Content-hash cache file, e.g. in the build directory
+ *   --jobs <n>                  Worker threads (default: one per core)
  *   --fail-on-warnings         Exit with error code if warnings are found
  *   --json                     Output results in JSON format
  *   --verbose                  Enable verbose output
@@ -23,6 +25,8 @@ struct Args {
     std::string contractsRoot;
     std::string serviceContracts = "contracts";
     std::string claims = "claims.json";
+    std::string cache;
+    unsigned jobs = 0;
     bool failOnWarnings = false;
     bool json = false;
     bool verbose = false;
@@ -34,6 +38,8 @@ void printUsage(const char* progName) {
     std::cout << "  --contracts-root <path>     Path to global contracts directory (REQUIRED)\n";
     std::cout << "  --service-contracts <path>  Path to service contracts directory (default: contracts)\n";
     std::cout << "  --claims <path>             Path to claims.json (default: claims.json)\n";
+    std::cout << "  --cache <path>              Cache file; unchanged contracts are not re-validated\n";
+    std::cout << "  --jobs <n>                  Worker threads (default: one per core)\n";
     std::cout << "  --fail-on-warnings          Exit with error code if warnings are found\n";
     std::cout << "  --json                      Output results in JSON format\n";
     std::cout << "  --verbose                   Enable verbose output\n";
@@ -55,6 +61,15 @@ Args parseArgs(int argc, char* argv[]) {
             args.serviceContracts = argv[++i];
         } else if (arg == "--claims" && i + 1 < argc) {
             args.claims = argv[++i];
+        } else if (arg == "--cache" && i + 1 < argc) {
+            args.cache = argv[++i];
+        } else if (arg == "--jobs" && i + 1 < argc) {
+            try {
+                args.jobs = static_cast<unsigned>(std::stoul(argv[++i]));
+            } catch (const std::exception&) {
+                std::cerr << "Invalid value for --jobs: " << argv[i] << "\n";
+                exit(1);
+            }
         } else if (arg == "--fail-on-warnings") {
             args.failOnWarnings = true;
         } else if (arg == "--json") {
@@ -130,13 +145,17 @@ int main(int argc, char* argv[]) {
         contract_validator::Logger::info("Contracts root: {}", args.contractsRoot);
         contract_validator::Logger::info("Service contracts: {}", args.serviceContracts);
         contract_validator::Logger::info("Claims file: {}", args.claims);
+        if (!args.cache.empty()) {
+            contract_validator::Logger::info("Cache file: {}", args.cache);
+        }
     }
     
     try {
         contract_validator::ContractValidator validator(
             args.contractsRoot,
             args.serviceContracts,
-            args.claims
+            args.claims,
+            contract_validator::ContractValidator::Options{args.jobs, args.cache}
         );
         
         auto result = validator.validate();
@@ -3,7 +3,10 @@
 #include "inventory/controllers/InventoryController.hpp"
 #include "inventory/services/InventoryService.hpp"
 #include "inventory/repositories/InventoryRepository.hpp"
+#include "inventory/utils/AtpTable.hpp"
+#include "inventory/utils/IdempotencyStore.hpp"
 #include "inventory/utils/MessageBus.hpp"
+#include "inventory/utils/RabbitMqMessageConsumer.hpp"
 #include <memory>
 #include <string>
 
@@ -28,12 +31,17 @@ private:
     std::shared_ptr<repositories::InventoryRepository> inventoryRepository_;
     std::shared_ptr<services::InventoryService> inventoryService_;
     std::shared_ptr<utils::MessageBus> messageBus_;
+    std::shared_ptr<utils::IdempotencyStore> idempotencyStore_;
+    std::shared_ptr<utils::AtpTable> atpTable_;
+    std::unique_ptr<utils::RabbitMqMessageConsumer> reservationConsumer_;
     
     // Configuration
     std::string dbConnectionString_;
     int serverPort_;
     std::string logLevel_;
+    int idempotencyTtlHours_;
     utils::MessageBus::Config messageBusConfig_;
+    std::string reservationQueue_;
     
     bool initialized_;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "inventory/services/InventoryService.hpp"
+#include "inventory/utils/IdempotencyStore.hpp"
 #include <Poco/Net/HTTPServer.h>
 #include <memory>
 #include <string>
@@ -35,6 +36,7 @@ public:
     ~Server();
     
     void setInventoryService(std::shared_ptr<services::InventoryService> service);
+    void setIdempotencyStore(std::shared_ptr<utils::IdempotencyStore> store);
     void start();
     void stop();
     
@@ -42,6 +44,7 @@ private:
     int port_;
     std::unique_ptr<Poco::Net::HTTPServer> httpServer_;
     std::shared_ptr<services::InventoryService> inventoryService_;
+    std::shared_ptr<utils::IdempotencyStore> idempotency_;
 };
 
 } // namespace inventory
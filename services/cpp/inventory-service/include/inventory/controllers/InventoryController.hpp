@@ -1,24 +1,39 @@
 #pragma once
 
 #include "inventory/services/InventoryService.hpp"
+#include "inventory/utils/IdempotencyStore.hpp"
 #include <Poco/Net/HTTPRequestHandler.h>
 #include <Poco/Net/HTTPServerRequest.h>
 #include <Poco/Net/HTTPServerResponse.h>
 #include <Poco/Net/HTTPResponse.h>
+#include <Poco/URI.h>
 #include <memory>
 
 namespace inventory {
 namespace controllers {
 
+/**
+ * POST /api/v1/inventory/:id/reserve honours an Idempotency-Key header, so a
+ * client retrying after a timeout cannot reserve the same stock twice.
+ *
+ * GET /api/v1/inventory/atp?productIds=a,b[&date=YYYY-MM-DD] answers from an
+ * in-memory table, without touching the database.
+ *
+ * GET /api/v1/inventory/export streams stock rows and their valuation as CSV
+ * or NDJSON with chunked transfer encoding, straight from a database cursor.
+ */
 class InventoryController : public Poco::Net::HTTPRequestHandler {
 public:
-    explicit InventoryController(std::shared_ptr<services::InventoryService> service);
+    // idempotency may be null, which ignores Idempotency-Key headers
+    InventoryController(std::shared_ptr<services::InventoryService> service,
+                        std::shared_ptr<utils::IdempotencyStore> idempotency = nullptr);
     
     void handleRequest(Poco::Net::HTTPServerRequest& request,
                       Poco::Net::HTTPServerResponse& response) override;
     
 private:
     std::shared_ptr<services::InventoryService> service_;
+    std::shared_ptr<utils::IdempotencyStore> idempotency_;
     
     void handleGetAll(Poco::Net::HTTPServerResponse& response);
     void handleGetById(const std::string& id, Poco::Net::HTTPServerResponse& response);
@@ -27,12 +42,18 @@ private:
     void handleGetByLocation(const std::string& locationId, Poco::Net::HTTPServerResponse& response);
     void handleGetLowStock(int threshold, Poco::Net::HTTPServerResponse& response);
     void handleGetExpired(Poco::Net::HTTPServerResponse& response);
+    void handleGetAvailableToPromise(const Poco::URI::QueryParameters& queryParams,
+                                     Poco::Net::HTTPServerResponse& response);
+    void handleExport(const Poco::URI::QueryParameters& queryParams,
+                      Poco::Net::HTTPServerResponse& response);
     void handleCreate(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response);
     void handleUpdate(const std::string& id, Poco::Net::HTTPServerRequest& request, 
                      Poco::Net::HTTPServerResponse& response);
     void handleDelete(const std::string& id, Poco::Net::HTTPServerResponse& response);
     void handleReserve(const std::string& id, Poco::Net::HTTPServerRequest& request,
                       Poco::Net::HTTPServerResponse& response);
+    // Runs the reservation and renders its outcome, errors included
+    utils::IdempotentResponse reserve(const std::string& id, const std::string& body);
     void handleRelease(const std::string& id, Poco::Net::HTTPServerRequest& request,
                       Poco::Net::HTTPServerResponse& response);
     void handleAllocate(const std::string& id, Poco::Net::HTTPServerRequest& request,
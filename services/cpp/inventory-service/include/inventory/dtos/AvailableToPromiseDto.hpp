@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace inventory {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Available-to-promise quantities of a product in one warehouse
+ *
+ * Conforms to WarehouseAtpDto contract v1.0
+ */
+class WarehouseAtpDto {
+public:
+    /**
+     * @param warehouseId Warehouse identifier (UUID)
+     * @param available Units that can be promised on the date (NonNegativeInteger)
+     * @param reserved Units reserved for orders (NonNegativeInteger)
+     * @param incoming Units in quarantine awaiting inspection (NonNegativeInteger)
+     */
+    WarehouseAtpDto(const std::string& warehouseId, int available, int reserved, int incoming);
+
+    std::string getWarehouseId() const { return warehouseId_; }
+    int getAvailable() const { return available_; }
+    int getReserved() const { return reserved_; }
+    int getIncoming() const { return incoming_; }
+
+    json toJson() const;
+
+private:
+    std::string warehouseId_;
+    int available_;
+    int reserved_;
+    int incoming_;
+};
+
+/**
+ * @brief Available-to-promise quantities of a product across warehouses
+ *
+ * Conforms to ProductAtpDto contract v1.0
+ * Totals are the sums over warehouses.
+ */
+class ProductAtpDto {
+public:
+    /**
+     * @param productId Product identifier (UUID)
+     * @param warehouses Per-warehouse quantities; empty if no warehouse stocks the product
+     */
+    ProductAtpDto(const std::string& productId, const std::vector<WarehouseAtpDto>& warehouses);
+
+    std::string getProductId() const { return productId_; }
+    const std::vector<WarehouseAtpDto>& getWarehouses() const { return warehouses_; }
+    int getAvailable() const { return available_; }
+    int getReserved() const { return reserved_; }
+    int getIncoming() const { return incoming_; }
+
+    json toJson() const;
+
+private:
+    std::string productId_;
+    std::vector<WarehouseAtpDto> warehouses_;
+    int available_ = 0;
+    int reserved_ = 0;
+    int incoming_ = 0;
+};
+
+/**
+ * @brief Answer to "what can be promised by this date" for a batch of products
+ *
+ * Conforms to AvailableToPromiseDto contract v1.0
+ */
+class AvailableToPromiseDto {
+public:
+    /**
+     * @param date Date the quantities hold for (YYYY-MM-DD)
+     * @param products One entry per product asked about, in request order
+     */
+    AvailableToPromiseDto(const std::string& date, const std::vector<ProductAtpDto>& products);
+
+    std::string getDate() const { return date_; }
+    const std::vector<ProductAtpDto>& getProducts() const { return products_; }
+
+    json toJson() const;
+
+private:
+    std::string date_;
+    std::vector<ProductAtpDto> products_;
+};
+
+} // namespace dtos
+} // namespace inventory
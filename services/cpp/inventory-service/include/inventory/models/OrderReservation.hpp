@@ -0,0 +1,82 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+namespace inventory {
+namespace models {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Command from order-service to reserve stock for every line of an order
+ *
+ * Consumed from order.inventory.reserve. All lines are reserved in one
+ * transaction: either the whole order is covered or nothing is reserved.
+ * Conforms to order-service's StockReservationRequestDto contract v1.0
+ */
+struct OrderReservationRequest {
+    struct Line {
+        std::string lineItemId;
+        std::string productId;
+        int quantity = 0;
+    };
+
+    std::string orderId;
+    std::string warehouseId;
+    std::vector<Line> lines;
+
+    /**
+     * @throws std::invalid_argument if ids are missing, there are no lines,
+     *         or a line quantity is not positive
+     */
+    static OrderReservationRequest fromJson(const json& j);
+};
+
+// A stock row that can be reserved from, in the order it should be drained
+struct StockCandidate {
+    std::string inventoryId;
+    std::string productId;
+    int available = 0;
+};
+
+// Quantity of one order line taken from one stock row
+struct ReservationAllocation {
+    std::string lineItemId;
+    std::string inventoryId;
+    std::string productId;
+    int quantity = 0;
+
+    json toJson() const;
+};
+
+// A product the order needs more of than the warehouse has available
+struct ReservationShortage {
+    std::string productId;
+    int requested = 0;
+    int available = 0;
+
+    json toJson() const;
+};
+
+struct ReservationPlan {
+    std::vector<ReservationAllocation> allocations;
+    std::vector<ReservationShortage> shortages;
+
+    bool complete() const { return shortages.empty(); }
+};
+
+/**
+ * @brief Decide which stock rows cover each order line
+ *
+ * Candidates are drained in the order given (the repository sorts them
+ * first-expiry-first-out), and a row shared by several lines of the same
+ * product is drawn down progressively. If any product is short the plan has
+ * no allocations, only the shortages, one per product.
+ */
+ReservationPlan planReservation(const std::vector<OrderReservationRequest::Line>& lines,
+                                const std::vector<StockCandidate>& candidates);
+
+} // namespace models
+} // namespace inventory
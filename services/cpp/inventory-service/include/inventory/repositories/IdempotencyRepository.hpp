@@ -0,0 +1,37 @@
+#pragma once
+
+#include "inventory/utils/IdempotencyStore.hpp"
+#include <pqxx/pqxx>
+#include <memory>
+#include <mutex>
+
+namespace inventory {
+namespace repositories {
+
+/**
+ * @brief idempotency_keys table, the durable ledger behind IdempotencyStore
+ *
+ * Owns its own connection so key checks never queue behind stock queries.
+ * A claim inserts the key with no response; an expired key may be taken
+ * over by the next claim.
+ */
+class IdempotencyRepository : public utils::IdempotencyLedger {
+public:
+    explicit IdempotencyRepository(std::shared_ptr<pqxx::connection> db);
+
+    std::optional<utils::IdempotencyRecord> claim(const std::string& scope,
+                                                  const std::string& key,
+                                                  const std::string& fingerprint,
+                                                  std::chrono::milliseconds ttl) override;
+    void complete(const std::string& scope, const std::string& key,
+                  const utils::IdempotentResponse& response) override;
+    void release(const std::string& scope, const std::string& key) override;
+    std::size_t purgeExpired() override;
+
+private:
+    std::shared_ptr<pqxx::connection> db_;
+    std::mutex mutex_;   // pqxx connections are not safe to share between threads
+};
+
+} // namespace repositories
+} // namespace inventory
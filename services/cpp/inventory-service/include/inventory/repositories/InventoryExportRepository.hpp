@@ -0,0 +1,54 @@
+#pragma once
+
+#include "inventory/utils/ExportWriter.hpp"
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace inventory {
+namespace repositories {
+
+// Optional filters for inventory exports; unset fields match every row
+struct InventoryExportFilter {
+    std::optional<std::string> warehouseId;
+    std::optional<std::string> productId;
+    std::optional<std::string> status;
+};
+
+/**
+ * @brief Reads stock rows for valuation exports through a server-side cursor
+ *
+ * Each export opens its own connection for as long as the client keeps
+ * reading, so a long download never holds the shared connection. Rows come
+ * kFetchSize at a time and the next FETCH waits for the handler to return,
+ * so a slow client slows the cursor instead of filling memory.
+ */
+class InventoryExportRepository {
+public:
+    using Row = std::vector<std::optional<std::string>>;
+    // Called once per fetch, at least once even when nothing matches
+    using BatchHandler = std::function<void(const std::vector<Row>& rows)>;
+
+    static constexpr std::size_t kFetchSize = 500;
+
+    explicit InventoryExportRepository(std::string connectionString);
+
+    // Every column an inventory export can project; value is quantity * costPerUnit
+    static const std::vector<utils::ExportColumn>& columns();
+
+    /**
+     * @brief Stock rows matching filter by warehouse then product, projected onto columns
+     * @throws std::invalid_argument for a malformed warehouse or product id
+     */
+    void exportRows(const InventoryExportFilter& filter,
+                    const std::vector<utils::ExportColumn>& columns,
+                    const BatchHandler& onBatch);
+
+private:
+    std::string connectionString_;
+};
+
+} // namespace repositories
+} // namespace inventory
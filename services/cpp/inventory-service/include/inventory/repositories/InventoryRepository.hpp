@@ -1,6 +1,7 @@
 #pragma once
 
 #include "inventory/models/Inventory.hpp"
+#include "inventory/models/OrderReservation.hpp"
 #include <pqxx/pqxx>
 #include <memory>
 #include <vector>
@@ -34,6 +35,24 @@ public:
     // Aggregate queries
     int getTotalQuantityByProduct(const std::string& productId);
     int getAvailableQuantityByProduct(const std::string& productId);
+
+    // Order reservations: every line of an order in one transaction
+
+    /**
+     * @brief Reserve stock for all lines of an order, or for none of them
+     *
+     * Rows are drawn first-expiry-first-out from available, unexpired stock in
+     * the order's warehouse. Replaying a request for an order that already
+     * holds reservations returns them without reserving again.
+     * @return The allocations made, or the shortages if the order cannot be covered
+     */
+    models::ReservationPlan reserveForOrder(const models::OrderReservationRequest& request);
+
+    /**
+     * @brief Return an order's reserved stock to available
+     * @return Ids of the stock rows released; empty if the order held none
+     */
+    std::vector<std::string> releaseForOrder(const std::string& orderId);
     
 private:
     std::shared_ptr<pqxx::connection> db_;
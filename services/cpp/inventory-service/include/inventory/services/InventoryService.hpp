@@ -1,11 +1,18 @@
 #pragma once
 
 #include "inventory/models/Inventory.hpp"
+#include "inventory/models/OrderReservation.hpp"
 #include "inventory/repositories/InventoryRepository.hpp"
+#include "inventory/repositories/InventoryExportRepository.hpp"
 #include "inventory/utils/MessageBus.hpp"
+#include "inventory/utils/AtpTable.hpp"
+#include "inventory/utils/ExportWriter.hpp"
+#include "inventory/dtos/AvailableToPromiseDto.hpp"
 #include "inventory/dtos/InventoryItemDto.hpp"
 #include "inventory/dtos/InventoryOperationResultDto.hpp"
+#include <functional>
 #include <memory>
+#include <ostream>
 #include <vector>
 #include <string>
 #include <optional>
@@ -15,8 +22,12 @@ namespace services {
 
 class InventoryService {
 public:
+    // atp may be null, in which case available-to-promise queries are not
+    // served; likewise exports without an export repository
     explicit InventoryService(std::shared_ptr<repositories::InventoryRepository> repository,
-                             std::shared_ptr<utils::MessageBus> messageBus);
+                             std::shared_ptr<utils::MessageBus> messageBus,
+                             std::shared_ptr<utils::AtpTable> atp = nullptr,
+                             std::shared_ptr<repositories::InventoryExportRepository> exports = nullptr);
     
     // Inventory operations - return DTOs, not domain models
     std::optional<dtos::InventoryItemDto> getById(const std::string& id);
@@ -44,11 +55,54 @@ public:
     // Aggregate queries
     int getTotalQuantityForProduct(const std::string& productId);
     int getAvailableQuantityForProduct(const std::string& productId);
+
+    static constexpr std::size_t kMaxAtpProducts = 100;
+
+    /**
+     * @brief What can be promised per warehouse, from the in-memory ATP table
+     * @param productIds 1 to kMaxAtpProducts product ids
+     * @param date YYYY-MM-DD the promise is for; today when absent or earlier
+     * @throws std::invalid_argument for a bad product id list or date
+     * @throws std::runtime_error if no ATP table is configured
+     */
+    dtos::AvailableToPromiseDto getAvailableToPromise(const std::vector<std::string>& productIds,
+                                                      const std::optional<std::string>& date);
+
+    // Rebuild the ATP table from every stock row
+    void loadAvailableToPromise();
+
+    /**
+     * @brief Stream stock rows with their valuation as CSV or NDJSON
+     *
+     * Everything is validated before open is called, so a bad request can
+     * still get an error response. Rows then go out one cursor fetch at a
+     * time, flushed after each, so a slow reader holds the cursor back.
+     * @param columns Column names to project, in order; empty exports every column
+     * @param open Called once, just before the first row, for the stream to write to
+     * @return Rows written
+     * @throws std::invalid_argument for a bad id, status or column
+     * @throws std::runtime_error if no export repository is configured
+     */
+    std::size_t exportInventory(const repositories::InventoryExportFilter& filter,
+                                utils::ExportFormat format,
+                                const std::vector<std::string>& columns,
+                                const std::function<std::ostream&()>& open);
+    
+    // Order reservation saga - driven by order-service over the message bus.
+    // Replies are published as order.reserved / order.reservation-failed.
+    bool reserveForOrder(const models::OrderReservationRequest& request);
+    void releaseForOrder(const std::string& orderId);
     
 private:
     std::shared_ptr<repositories::InventoryRepository> repository_;
     std::shared_ptr<utils::MessageBus> messageBus_;
+    std::shared_ptr<utils::AtpTable> atp_;
+    std::shared_ptr<repositories::InventoryExportRepository> exports_;
     
+    void publish(const std::string& routingKey, const nlohmann::json& payload);
+    // Keep the ATP table in step with rows changed by this service
+    void track(const models::Inventory& inventory);
+    void trackRows(const std::vector<std::string>& inventoryIds);
     void validateQuantities(int quantity, int available, int reserved, int allocated) const;
     
     // DTO conversion helpers
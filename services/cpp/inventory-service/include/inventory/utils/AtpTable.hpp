@@ -0,0 +1,94 @@
+#pragma once
+
+#include "inventory/models/Inventory.hpp"
+#include <cstddef>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace inventory {
+namespace utils {
+
+// Available-to-promise figures for one product in one warehouse
+struct WarehouseAtp {
+    std::string warehouseId;
+    int available = 0;   // promisable on the date asked about
+    int reserved = 0;
+    int incoming = 0;    // received into quarantine, awaiting inspection
+};
+
+struct ProductAtp {
+    std::string productId;
+    std::vector<WarehouseAtp> warehouses;   // by warehouse id
+    int available = 0;
+    int reserved = 0;
+    int incoming = 0;
+};
+
+/**
+ * @brief In-memory available-to-promise totals per product and warehouse
+ *
+ * Loaded once from every stock row, then kept current row by row: the table
+ * remembers what each row contributed, so applying a changed row replaces
+ * that contribution instead of rescanning. A query touches only the asked
+ * product's warehouses, whatever the size of the table.
+ *
+ * Only rows with status available can be promised. Batches that expire on
+ * or before the date asked about are left out, as the order reservation
+ * query leaves out batches expiring today; the few dated quantities are
+ * kept per expiry date so that exclusion is a walk over the earliest ones.
+ * Quarantined stock that has not failed inspection is reported as incoming
+ * and never promised.
+ *
+ * Safe to share between threads; queries take a shared lock.
+ */
+class AtpTable {
+public:
+    // Replace the contents with these rows
+    void load(const std::vector<models::Inventory>& rows);
+
+    // Add a row, or replace what it contributed before
+    void apply(const models::Inventory& row);
+
+    void remove(const std::string& inventoryId);
+
+    /**
+     * @param date YYYY-MM-DD; batches expiring on or before it are excluded
+     */
+    ProductAtp query(const std::string& productId, const std::string& date) const;
+    std::vector<ProductAtp> query(const std::vector<std::string>& productIds, const std::string& date) const;
+
+    // Stock rows contributing to the table
+    std::size_t rowCount() const;
+
+private:
+    struct Contribution {
+        std::string productId;
+        std::string warehouseId;
+        std::string expiry;   // YYYY-MM-DD, empty when the batch does not expire
+        int available = 0;
+        int reserved = 0;
+        int incoming = 0;
+    };
+
+    struct Bucket {
+        int available = 0;                      // dated and undated
+        std::map<std::string, int> expiring;    // dated available by expiry date
+        int reserved = 0;
+        int incoming = 0;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::map<std::string, Bucket>> products_;
+    std::unordered_map<std::string, Contribution> rows_;
+
+    static Contribution contributionOf(const models::Inventory& row);
+    void addLocked(const Contribution& contribution, int sign);
+    void removeLocked(const std::string& inventoryId);
+    ProductAtp queryLocked(const std::string& productId, const std::string& date) const;
+};
+
+} // namespace utils
+} // namespace inventory
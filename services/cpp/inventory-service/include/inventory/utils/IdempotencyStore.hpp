@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace inventory {
+namespace utils {
+
+/**
+ * @brief HTTP status and body produced by a mutating request
+ */
+struct IdempotentResponse {
+    int status = 0;
+    std::string body;
+};
+
+/**
+ * @brief What the ledger already holds for a key
+ */
+struct IdempotencyRecord {
+    std::string fingerprint;
+    std::optional<IdempotentResponse> response;   // empty while the original is still running
+
+    // A request with this fingerprint holds the key and has not finished
+    static IdempotencyRecord inProgress(std::string fingerprint) {
+        return IdempotencyRecord{std::move(fingerprint), std::nullopt};
+    }
+};
+
+/**
+ * @brief Durable record of idempotency keys, shared by every replica
+ */
+class IdempotencyLedger {
+public:
+    virtual ~IdempotencyLedger() = default;
+
+    /**
+     * @brief Claim (scope, key) for a request about to run
+     * @return std::nullopt when this caller now owns the key (it was free or
+     *         had expired), otherwise the record of whoever holds it
+     */
+    virtual std::optional<IdempotencyRecord> claim(const std::string& scope,
+                                                   const std::string& key,
+                                                   const std::string& fingerprint,
+                                                   std::chrono::milliseconds ttl) = 0;
+
+    // Store the response of a claimed key
+    virtual void complete(const std::string& scope, const std::string& key,
+                          const IdempotentResponse& response) = 0;
+
+    // Give up a claimed key so the request can be retried
+    virtual void release(const std::string& scope, const std::string& key) = 0;
+
+    virtual std::size_t purgeExpired() = 0;
+};
+
+// The key was first used with a different request body (422)
+class IdempotencyKeyReused : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Another replica is still running the original request (409)
+class IdempotencyKeyInProgress : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Runs each mutating request at most once per Idempotency-Key
+ *
+ * Recent keys and their responses are held in a sharded in-memory map, one
+ * mutex per shard, so unrelated keys never contend. A duplicate of a
+ * finished request is answered from the map; a duplicate arriving while the
+ * original is still running waits on it and receives the same response. The
+ * ledger makes keys durable across restarts and replicas: a key is claimed
+ * there before the request runs, and its response stored afterwards.
+ *
+ * Requests are told apart by a fingerprint of their body; reusing a key with
+ * a different body throws IdempotencyKeyReused. Responses with a 5xx status
+ * are not kept, so a failed request can be retried with the same key.
+ *
+ * Safe to share between threads.
+ */
+class IdempotencyStore {
+public:
+    struct Result {
+        IdempotentResponse response;
+        bool replayed = false;   // answered from an earlier request
+    };
+
+    static constexpr std::chrono::milliseconds kDefaultTtl = std::chrono::hours(24);
+    static constexpr std::size_t kMaxKeyLength = 255;
+
+    // ledger may be null, in which case keys only live in this process
+    explicit IdempotencyStore(std::shared_ptr<IdempotencyLedger> ledger,
+                              std::chrono::milliseconds ttl = kDefaultTtl);
+
+    /**
+     * @brief Run handler once for (scope, key), or replay its response
+     * @param scope Endpoint the key belongs to, e.g. "POST /api/v1/inventory/{id}/reserve"
+     * @throws std::invalid_argument if key is not 1-255 printable ASCII characters
+     * @throws IdempotencyKeyReused, IdempotencyKeyInProgress
+     */
+    Result execute(const std::string& scope, const std::string& key, std::string_view requestBody,
+                   const std::function<IdempotentResponse()>& handler);
+
+    static bool isValidKey(std::string_view key);
+
+    // 64-bit FNV-1a of the body as 16 hex digits; stable across processes
+    static std::string fingerprint(std::string_view requestBody);
+
+    // Keys currently held in memory, finished or in flight
+    std::size_t size() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t kShardCount = 16;
+    static constexpr std::size_t kMinSweepSize = 64;
+    static constexpr std::chrono::minutes kLedgerPurgeInterval{15};
+
+    struct Entry {
+        std::string fingerprint;
+        std::shared_future<IdempotentResponse> response;
+        Clock::time_point expiresAt;   // time_point::max() while in flight
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+        std::size_t nextSweep = kMinSweepSize;
+    };
+
+    std::shared_ptr<IdempotencyLedger> ledger_;
+    std::chrono::milliseconds ttl_;
+    std::array<Shard, kShardCount> shards_;
+    std::mutex purgeMutex_;
+    Clock::time_point nextLedgerPurge_;
+
+    Shard& shardFor(const std::string& id);
+    void sweepLocked(Shard& shard, Clock::time_point now);
+    void forget(const std::string& id);
+    void purgeLedgerIfDue(Clock::time_point now);
+};
+
+} // namespace utils
+} // namespace inventory
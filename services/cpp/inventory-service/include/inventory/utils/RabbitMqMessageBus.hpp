@@ -4,6 +4,7 @@
 
 #include <amqp.h>
 #include <amqp_tcp_socket.h>
+#include <mutex>
 
 namespace inventory {
 namespace utils {
@@ -26,6 +27,7 @@ private:
     amqp_connection_state_t connection_;
     amqp_socket_t* socket_;
     amqp_channel_t channel_;
+    std::mutex publishMutex_;   // a channel must not be used from several threads at once
 };
 
 } // namespace utils
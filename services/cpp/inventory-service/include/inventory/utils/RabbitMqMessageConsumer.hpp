@@ -0,0 +1,63 @@
+#pragma once
+
+#include "inventory/utils/MessageBus.hpp"
+
+#include <amqp.h>
+#include <amqp_tcp_socket.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace inventory {
+namespace utils {
+
+/**
+ * @brief Consumes JSON messages from a durable queue bound to the exchange
+ *
+ * Runs on a thread of its own with a connection of its own; rabbitmq-c
+ * connections cannot be shared with the publisher. Up to kPrefetch messages
+ * are in flight at once, and each is acknowledged once the handler returns.
+ * A message whose handler throws is requeued once; if it fails again on
+ * redelivery it is rejected, so a poison message cannot block the queue.
+ * A lost connection is re-established with backoff.
+ */
+class RabbitMqMessageConsumer {
+public:
+    using Handler = std::function<void(const std::string& routingKey, const nlohmann::json& payload)>;
+
+    /**
+     * @param queue Durable queue to declare and consume
+     * @param bindingKeys Full routing keys (or topic patterns) the queue is bound to
+     */
+    RabbitMqMessageConsumer(const MessageBus::Config& config,
+                            std::string queue,
+                            std::vector<std::string> bindingKeys,
+                            Handler handler);
+    ~RabbitMqMessageConsumer();
+
+    void start();
+    void stop();
+
+private:
+    static constexpr std::uint16_t kPrefetch = 64;
+
+    void run();
+    void connect();
+    void close();
+    void dispatch(const amqp_envelope_t& envelope);
+
+    MessageBus::Config config_;
+    std::string queue_;
+    std::vector<std::string> bindingKeys_;
+    Handler handler_;
+    amqp_connection_state_t connection_;
+    amqp_channel_t channel_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+} // namespace utils
+} // namespace inventory
@@ -0,0 +1,22 @@
+-- Deploy inventory-service:002_idempotency_keys to pg
+-- requires: 001_initial_schema
+
+BEGIN;
+
+-- Idempotency-Key ledger shared by every replica. A row with no status is a
+-- claim whose request is still running; expired rows are taken over by the
+-- next claim and purged periodically.
+CREATE TABLE idempotency_keys (
+    scope VARCHAR(255) NOT NULL,
+    idempotency_key VARCHAR(255) NOT NULL,
+    fingerprint CHAR(16) NOT NULL,
+    status INTEGER,
+    body TEXT,
+    created_at TIMESTAMP NOT NULL DEFAULT CURRENT_TIMESTAMP,
+    expires_at TIMESTAMP NOT NULL,
+    PRIMARY KEY (scope, idempotency_key)
+);
+
+CREATE INDEX idx_idempotency_keys_expires ON idempotency_keys(expires_at);
+
+COMMIT;
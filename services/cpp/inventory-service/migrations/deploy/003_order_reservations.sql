@@ -0,0 +1,22 @@
+-- Deploy inventory-service:003_order_reservations to pg
+-- requires: 001_initial_schema
+
+BEGIN;
+
+-- Stock held for an order line, one row per inventory row it was drawn from.
+-- Written when order-service asks for a reservation and deleted again when
+-- the order is cancelled, so a release returns exactly what was taken.
+CREATE TABLE order_reservations (
+    id UUID PRIMARY KEY DEFAULT uuid_generate_v4(),
+    order_id UUID NOT NULL,
+    line_item_id UUID NOT NULL,
+    inventory_id UUID NOT NULL REFERENCES inventory(id) ON DELETE CASCADE,
+    product_id UUID NOT NULL,
+    quantity INTEGER NOT NULL CHECK (quantity > 0),
+    created_at TIMESTAMP NOT NULL DEFAULT CURRENT_TIMESTAMP
+);
+
+CREATE INDEX idx_order_reservations_order ON order_reservations(order_id);
+CREATE INDEX idx_order_reservations_inventory ON order_reservations(inventory_id);
+
+COMMIT;
@@ -0,0 +1,7 @@
+-- Revert inventory-service:002_idempotency_keys from pg
+
+BEGIN;
+
+DROP TABLE IF EXISTS idempotency_keys;
+
+COMMIT;
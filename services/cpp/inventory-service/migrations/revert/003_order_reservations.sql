@@ -0,0 +1,7 @@
+-- Revert inventory-service:003_order_reservations from pg
+
+BEGIN;
+
+DROP TABLE IF EXISTS order_reservations;
+
+COMMIT;
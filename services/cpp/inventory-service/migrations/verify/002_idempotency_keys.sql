@@ -0,0 +1,9 @@
+-- Verify inventory-service:002_idempotency_keys on pg
+
+BEGIN;
+
+SELECT scope, idempotency_key, fingerprint, status, body, created_at, expires_at
+FROM idempotency_keys
+WHERE FALSE;
+
+ROLLBACK;
@@ -0,0 +1,9 @@
+-- Verify inventory-service:003_order_reservations on pg
+
+BEGIN;
+
+SELECT id, order_id, line_item_id, inventory_id, product_id, quantity, created_at
+FROM order_reservations
+WHERE FALSE;
+
+ROLLBACK;
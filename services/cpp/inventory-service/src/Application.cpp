@@ -4,12 +4,14 @@
 #include "inventory/utils/Database.hpp"
 #include "inventory/utils/MessageBus.hpp"
 #include "inventory/utils/RabbitMqMessageBus.hpp"
+#include "inventory/repositories/IdempotencyRepository.hpp"
+#include "inventory/repositories/InventoryExportRepository.hpp"
 #include "inventory/Server.hpp"
 #include <stdexcept>
 
 namespace inventory {
 
-Application::Application() : initialized_(false), serverPort_(8080) {}
+Application::Application() : serverPort_(8080), idempotencyTtlHours_(24), initialized_(false) {}
 
 Application::~Application() {
     shutdown();
@@ -38,6 +40,8 @@ void Application::run() {
     
     Server server(serverPort_);
     server.setInventoryService(inventoryService_);
+    server.setIdempotencyStore(idempotencyStore_);
+    reservationConsumer_->start();
     server.start();
     
     utils::Logger::info("Inventory Service stopped");
@@ -49,6 +53,9 @@ void Application::shutdown() {
     }
     
     utils::Logger::info("Shutting down Inventory Service");
+    if (reservationConsumer_) {
+        reservationConsumer_->stop();
+    }
     utils::Database::disconnect();
     initialized_ = false;
 }
@@ -64,6 +71,9 @@ void Application::loadConfiguration(const std::string& configPath) {
     // Load server configuration
     serverPort_ = utils::Config::getInt("server.port", 8080);
     
+    // Hours a reserve Idempotency-Key keeps its response
+    idempotencyTtlHours_ = utils::Config::getInt("idempotency.ttlHours", 24);
+    
     // Load logging configuration
     logLevel_ = utils::Config::getString("logging.level", "info");
 
@@ -79,6 +89,7 @@ void Application::loadConfiguration(const std::string& configPath) {
         utils::Config::getString("messageBus.password", "warehouse_dev"));
     messageBusConfig_.exchange = utils::Config::getString("messageBus.exchange", "warehouse.events");
     messageBusConfig_.routing_key_prefix = utils::Config::getString("messageBus.routingKeyPrefix", "inventory.");
+    reservationQueue_ = utils::Config::getString("messageBus.reservationQueue", "inventory-service.order-reservations");
     
     utils::Logger::info("Configuration loaded from {}", configPath);
 }
@@ -103,8 +114,39 @@ void Application::initializeServices() {
     utils::Logger::info("Initializing RabbitMQ message bus...");
     messageBus_ = std::make_shared<utils::RabbitMqMessageBus>(messageBusConfig_);
 
-    // Initialize services (message bus may be null if initialization failed)
-    inventoryService_ = std::make_shared<services::InventoryService>(inventoryRepository_, messageBus_);
+    // Initialize services (message bus may be null if initialization failed).
+    // Both the request handlers and the reservation consumer keep one ATP table current.
+    atpTable_ = std::make_shared<utils::AtpTable>();
+    // Each export opens a connection of its own for as long as it streams
+    inventoryService_ = std::make_shared<services::InventoryService>(
+        inventoryRepository_, messageBus_, atpTable_,
+        std::make_shared<repositories::InventoryExportRepository>(dbConnectionString_));
+    inventoryService_->loadAvailableToPromise();
+
+    // Idempotency keys get their own connection so they never wait on stock queries
+    idempotencyStore_ = std::make_shared<utils::IdempotencyStore>(
+        std::make_shared<repositories::IdempotencyRepository>(
+            std::make_shared<pqxx::connection>(dbConnectionString_)),
+        std::chrono::hours(idempotencyTtlHours_));
+
+    // Order reservation commands are consumed on a thread of their own, so they
+    // get their own connection rather than sharing the request handlers'
+    auto reservationService = std::make_shared<services::InventoryService>(
+        std::make_shared<repositories::InventoryRepository>(
+            std::make_shared<pqxx::connection>(dbConnectionString_)),
+        messageBus_,
+        atpTable_);
+    reservationConsumer_ = std::make_unique<utils::RabbitMqMessageConsumer>(
+        messageBusConfig_,
+        reservationQueue_,
+        std::vector<std::string>{"order.inventory.reserve", "order.inventory.release"},
+        [reservationService](const std::string& routingKey, const nlohmann::json& payload) {
+            if (routingKey == "order.inventory.reserve") {
+                reservationService->reserveForOrder(models::OrderReservationRequest::fromJson(payload));
+            } else {
+                reservationService->releaseForOrder(payload.at("orderId").get<std::string>());
+            }
+        });
     
     utils::Logger::info("Services initialized");
 }
@@ -36,8 +36,9 @@ void waitForTerminationRequest() {
 
 class RequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory {
 public:
-    explicit RequestHandlerFactory(std::shared_ptr<services::InventoryService> inventoryService)
-        : inventoryService_(inventoryService) {}
+    RequestHandlerFactory(std::shared_ptr<services::InventoryService> inventoryService,
+                          std::shared_ptr<utils::IdempotencyStore> idempotency)
+        : inventoryService_(inventoryService), idempotency_(idempotency) {}
     
     Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest& request) override {
         utils::Logger::info("Incoming request: {} {}", request.getMethod(), request.getURI());
@@ -57,12 +58,13 @@ public:
             default:
                 // TODO: Implement more complete routing
                 // Default: route to InventoryController
-                return new controllers::InventoryController(inventoryService_);
+                return new controllers::InventoryController(inventoryService_, idempotency_);
         }
     }
     
 private:
     std::shared_ptr<services::InventoryService> inventoryService_;
+    std::shared_ptr<utils::IdempotencyStore> idempotency_;
 };
 
 Server::Server(int port) : port_(port) {}
@@ -75,6 +77,10 @@ void Server::setInventoryService(std::shared_ptr<services::InventoryService> ser
     inventoryService_ = service;
 }
 
+void Server::setIdempotencyStore(std::shared_ptr<utils::IdempotencyStore> store) {
+    idempotency_ = store;
+}
+
 void Server::start() {
     Poco::Net::ServerSocket socket(port_);
     Poco::Net::HTTPServerParams* params = new Poco::Net::HTTPServerParams;
@@ -82,7 +88,7 @@ void Server::start() {
     params->setMaxThreads(16);
     
     httpServer_ = std::make_unique<Poco::Net::HTTPServer>(
-        new RequestHandlerFactory(inventoryService_),
+        new RequestHandlerFactory(inventoryService_, idempotency_),
         socket,
         params
     );
@@ -1,9 +1,12 @@
 #include "inventory/controllers/InventoryController.hpp"
 #include "inventory/utils/Auth.hpp"
+#include "inventory/utils/Logger.hpp"
 #include "inventory/models/Inventory.hpp"
 #include <Poco/URI.h>
 #include <Poco/StringTokenizer.h>
 #include <nlohmann/json.hpp>
+#include <iterator>
+#include <optional>
 #include <sstream>
 
 using json = nlohmann::json;
@@ -11,8 +14,15 @@ using json = nlohmann::json;
 namespace inventory {
 namespace controllers {
 
-InventoryController::InventoryController(std::shared_ptr<services::InventoryService> service)
-    : service_(service) {}
+namespace {
+
+const std::string kIdempotencyKeyHeader = "Idempotency-Key";
+
+} // namespace
+
+InventoryController::InventoryController(std::shared_ptr<services::InventoryService> service,
+                                         std::shared_ptr<utils::IdempotencyStore> idempotency)
+    : service_(service), idempotency_(idempotency) {}
 
 void InventoryController::handleRequest(Poco::Net::HTTPServerRequest& request,
                                        Poco::Net::HTTPServerResponse& response) {
@@ -73,6 +83,18 @@ void InventoryController::handleRequest(Poco::Net::HTTPServerRequest& request,
                 return;
             }
 
+            // GET /api/v1/inventory/export?format=csv|ndjson&columns=a,b
+            if (method == "GET" && segments.size() == 4 && segments[3] == "export") {
+                handleExport(queryParams, response);
+                return;
+            }
+
+            // GET /api/v1/inventory/atp?productIds=a,b&date=YYYY-MM-DD
+            if (method == "GET" && segments.size() == 4 && segments[3] == "atp") {
+                handleGetAvailableToPromise(queryParams, response);
+                return;
+            }
+
             // GET /api/v1/inventory/product/:productId
             if (method == "GET" && segments.size() == 5 && segments[3] == "product") {
                 handleGetByProduct(segments[4], response);
@@ -211,6 +233,77 @@ void InventoryController::handleGetExpired(Poco::Net::HTTPServerResponse& respon
     sendJsonResponse(response, j.dump());
 }
 
+void InventoryController::handleGetAvailableToPromise(const Poco::URI::QueryParameters& queryParams,
+                                                      Poco::Net::HTTPServerResponse& response) {
+    try {
+        std::vector<std::string> productIds;
+        std::optional<std::string> date;
+        for (const auto& param : queryParams) {
+            if (param.first == "productIds") {
+                // Comma-separated, and the parameter may repeat
+                Poco::StringTokenizer ids(param.second, ",",
+                                          Poco::StringTokenizer::TOK_IGNORE_EMPTY | Poco::StringTokenizer::TOK_TRIM);
+                productIds.insert(productIds.end(), ids.begin(), ids.end());
+            } else if (param.first == "date") {
+                date = param.second;
+            }
+        }
+
+        auto atp = service_->getAvailableToPromise(productIds, date);
+        sendJsonResponse(response, atp.toJson().dump());
+    } catch (const std::invalid_argument& e) {
+        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+    } catch (const std::exception& e) {
+        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+    }
+}
+
+void InventoryController::handleExport(const Poco::URI::QueryParameters& queryParams,
+                                       Poco::Net::HTTPServerResponse& response) {
+    bool streaming = false;
+    try {
+        repositories::InventoryExportFilter filter;
+        auto format = utils::ExportFormat::Csv;
+        std::vector<std::string> columns;
+        for (const auto& param : queryParams) {
+            if (param.first == "warehouseId") {
+                filter.warehouseId = param.second;
+            } else if (param.first == "productId") {
+                filter.productId = param.second;
+            } else if (param.first == "status") {
+                filter.status = param.second;
+            } else if (param.first == "format") {
+                format = utils::exportFormatFromString(param.second);
+            } else if (param.first == "columns") {
+                Poco::StringTokenizer names(param.second, ",",
+                                            Poco::StringTokenizer::TOK_IGNORE_EMPTY | Poco::StringTokenizer::TOK_TRIM);
+                columns.insert(columns.end(), names.begin(), names.end());
+            }
+        }
+
+        auto extension = utils::ExportWriter::fileExtension(format);
+        service_->exportInventory(filter, format, columns, [&]() -> std::ostream& {
+            // Length unknown up front: chunked, so the client sees rows as they are fetched
+            streaming = true;
+            response.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
+            response.setChunkedTransferEncoding(true);
+            response.setContentType(utils::ExportWriter::contentType(format));
+            response.set("Content-Disposition", "attachment; filename=\"inventory." + extension + "\"");
+            return response.send();
+        });
+    } catch (const std::invalid_argument& e) {
+        if (!streaming) {
+            sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+        }
+    } catch (const std::exception& e) {
+        // Once rows have gone out the status is sent; the client sees a truncated transfer
+        utils::Logger::error("Inventory export failed: {}", e.what());
+        if (!streaming) {
+            sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+        }
+    }
+}
+
 void InventoryController::handleCreate(Poco::Net::HTTPServerRequest& request, 
                                       Poco::Net::HTTPServerResponse& response) {
     try {
@@ -294,31 +387,58 @@ void InventoryController::handleDelete(const std::string& id, Poco::Net::HTTPSer
 void InventoryController::handleReserve(const std::string& id,
                                        Poco::Net::HTTPServerRequest& request,
                                        Poco::Net::HTTPServerResponse& response) {
+    std::string body(std::istreambuf_iterator<char>(request.stream()), {});
+
+    if (!idempotency_ || !request.has(kIdempotencyKeyHeader)) {
+        auto result = reserve(id, body);
+        sendJsonResponse(response, result.body, static_cast<Poco::Net::HTTPResponse::HTTPStatus>(result.status));
+        return;
+    }
+
     try {
-        std::istream& bodyStream = request.stream();
-        json body;
-        bodyStream >> body;
+        auto result = idempotency_->execute("POST /api/v1/inventory/" + id + "/reserve",
+                                            request.get(kIdempotencyKeyHeader), body,
+                                            [this, &id, &body]() { return reserve(id, body); });
+        if (result.replayed) {
+            response.set("Idempotent-Replayed", "true");
+        }
+        sendJsonResponse(response, result.response.body,
+                         static_cast<Poco::Net::HTTPResponse::HTTPStatus>(result.response.status));
+    } catch (const utils::IdempotencyKeyReused& e) {
+        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_UNPROCESSABLE_ENTITY);
+    } catch (const utils::IdempotencyKeyInProgress& e) {
+        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_CONFLICT);
+    } catch (const std::invalid_argument& e) {
+        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+    } catch (const std::exception& e) {
+        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+    }
+}
 
-        if (!body.contains("quantity") || !body["quantity"].is_number_integer()) {
-            sendErrorResponse(response, "Missing or invalid 'quantity' field",
-                              Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
-            return;
+utils::IdempotentResponse InventoryController::reserve(const std::string& id, const std::string& body) {
+    auto error = [](int status, const std::string& message) {
+        return utils::IdempotentResponse{status, json{{"error", message}, {"status", status}}.dump()};
+    };
+
+    try {
+        json request = json::parse(body);
+
+        if (!request.contains("quantity") || !request["quantity"].is_number_integer()) {
+            return error(Poco::Net::HTTPResponse::HTTP_BAD_REQUEST, "Missing or invalid 'quantity' field");
         }
 
-        int quantity = body["quantity"].get<int>();
+        int quantity = request["quantity"].get<int>();
         auto result = service_->reserve(id, quantity);
 
-        sendJsonResponse(response, result.toJson().dump(),
-                         Poco::Net::HTTPResponse::HTTP_OK);
+        return {Poco::Net::HTTPResponse::HTTP_OK, result.toJson().dump()};
     } catch (const json::exception& e) {
-        sendErrorResponse(response, std::string("Invalid JSON body: ") + e.what(),
-                          Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+        return error(Poco::Net::HTTPResponse::HTTP_BAD_REQUEST, std::string("Invalid JSON body: ") + e.what());
     } catch (const std::invalid_argument& e) {
-        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+        return error(Poco::Net::HTTPResponse::HTTP_BAD_REQUEST, e.what());
     } catch (const std::runtime_error& e) {
-        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+        return error(Poco::Net::HTTPResponse::HTTP_BAD_REQUEST, e.what());
     } catch (const std::exception& e) {
-        sendErrorResponse(response, e.what(), Poco::Net::HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+        return error(Poco::Net::HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, e.what());
     }
 }
 
@@ -0,0 +1,81 @@
+#include "inventory/dtos/AvailableToPromiseDto.hpp"
+#include <stdexcept>
+
+namespace inventory {
+namespace dtos {
+
+WarehouseAtpDto::WarehouseAtpDto(const std::string& warehouseId, int available, int reserved, int incoming)
+    : warehouseId_(warehouseId)
+    , available_(available)
+    , reserved_(reserved)
+    , incoming_(incoming) {
+
+    if (warehouseId_.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+    if (available_ < 0 || reserved_ < 0 || incoming_ < 0) {
+        throw std::invalid_argument("Available-to-promise quantities must be non-negative");
+    }
+}
+
+json WarehouseAtpDto::toJson() const {
+    return {
+        {"warehouseId", warehouseId_},
+        {"available", available_},
+        {"reserved", reserved_},
+        {"incoming", incoming_}
+    };
+}
+
+ProductAtpDto::ProductAtpDto(const std::string& productId, const std::vector<WarehouseAtpDto>& warehouses)
+    : productId_(productId)
+    , warehouses_(warehouses) {
+
+    if (productId_.empty()) {
+        throw std::invalid_argument("productId is required");
+    }
+    for (const auto& warehouse : warehouses_) {
+        available_ += warehouse.getAvailable();
+        reserved_ += warehouse.getReserved();
+        incoming_ += warehouse.getIncoming();
+    }
+}
+
+json ProductAtpDto::toJson() const {
+    json warehousesJson = json::array();
+    for (const auto& warehouse : warehouses_) {
+        warehousesJson.push_back(warehouse.toJson());
+    }
+
+    return {
+        {"productId", productId_},
+        {"available", available_},
+        {"reserved", reserved_},
+        {"incoming", incoming_},
+        {"warehouses", warehousesJson}
+    };
+}
+
+AvailableToPromiseDto::AvailableToPromiseDto(const std::string& date, const std::vector<ProductAtpDto>& products)
+    : date_(date)
+    , products_(products) {
+
+    if (date_.empty()) {
+        throw std::invalid_argument("date is required");
+    }
+}
+
+json AvailableToPromiseDto::toJson() const {
+    json productsJson = json::array();
+    for (const auto& product : products_) {
+        productsJson.push_back(product.toJson());
+    }
+
+    return {
+        {"date", date_},
+        {"products", productsJson}
+    };
+}
+
+} // namespace dtos
+} // namespace inventory
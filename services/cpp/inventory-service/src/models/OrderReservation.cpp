@@ -0,0 +1,120 @@
+#include "inventory/models/OrderReservation.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace inventory {
+namespace models {
+
+namespace {
+
+std::string requireString(const json& j, const char* field) {
+    if (!j.contains(field) || !j[field].is_string() || j[field].get<std::string>().empty()) {
+        throw std::invalid_argument(std::string("Reservation request is missing ") + field);
+    }
+    return j[field].get<std::string>();
+}
+
+} // namespace
+
+OrderReservationRequest OrderReservationRequest::fromJson(const json& j) {
+    OrderReservationRequest request;
+    request.orderId = requireString(j, "orderId");
+    request.warehouseId = requireString(j, "warehouseId");
+
+    if (!j.contains("lines") || !j["lines"].is_array() || j["lines"].empty()) {
+        throw std::invalid_argument("Reservation request has no lines");
+    }
+    request.lines.reserve(j["lines"].size());
+    for (const auto& item : j["lines"]) {
+        Line line;
+        line.lineItemId = requireString(item, "lineItemId");
+        line.productId = requireString(item, "productId");
+        if (!item.contains("quantity") || !item["quantity"].is_number_integer() ||
+            item["quantity"].get<int>() <= 0) {
+            throw std::invalid_argument("Reservation line quantity must be positive");
+        }
+        line.quantity = item["quantity"].get<int>();
+        request.lines.push_back(std::move(line));
+    }
+    return request;
+}
+
+json ReservationAllocation::toJson() const {
+    return {
+        {"lineItemId", lineItemId},
+        {"inventoryId", inventoryId},
+        {"productId", productId},
+        {"quantity", quantity}
+    };
+}
+
+json ReservationShortage::toJson() const {
+    return {
+        {"productId", productId},
+        {"requested", requested},
+        {"available", available}
+    };
+}
+
+ReservationPlan planReservation(const std::vector<OrderReservationRequest::Line>& lines,
+                                const std::vector<StockCandidate>& candidates) {
+    struct ProductStock {
+        std::vector<std::size_t> rows;   // indexes into candidates, drain order
+        std::size_t next = 0;
+        int requested = 0;
+        int available = 0;
+    };
+
+    std::unordered_map<std::string, ProductStock> stock;
+    std::vector<std::string> products;   // first appearance in the order, for stable output
+    for (const auto& line : lines) {
+        auto [it, inserted] = stock.try_emplace(line.productId);
+        if (inserted) {
+            products.push_back(line.productId);
+        }
+        it->second.requested += line.quantity;
+    }
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        auto it = stock.find(candidates[i].productId);
+        if (it != stock.end() && candidates[i].available > 0) {
+            it->second.rows.push_back(i);
+            it->second.available += candidates[i].available;
+        }
+    }
+
+    ReservationPlan plan;
+    for (const auto& productId : products) {
+        const auto& product = stock.at(productId);
+        if (product.requested > product.available) {
+            plan.shortages.push_back({productId, product.requested, product.available});
+        }
+    }
+    if (!plan.complete()) {
+        return plan;
+    }
+
+    std::vector<int> remaining(candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        remaining[i] = candidates[i].available;
+    }
+    for (const auto& line : lines) {
+        auto& product = stock.at(line.productId);
+        int needed = line.quantity;
+        while (needed > 0) {
+            auto row = product.rows[product.next];
+            int taken = std::min(needed, remaining[row]);
+            plan.allocations.push_back({line.lineItemId, candidates[row].inventoryId, line.productId, taken});
+            remaining[row] -= taken;
+            needed -= taken;
+            if (remaining[row] == 0) {
+                ++product.next;
+            }
+        }
+    }
+    return plan;
+}
+
+} // namespace models
+} // namespace inventory
@@ -0,0 +1,90 @@
+#include "inventory/repositories/IdempotencyRepository.hpp"
+
+namespace inventory {
+namespace repositories {
+
+IdempotencyRepository::IdempotencyRepository(std::shared_ptr<pqxx::connection> db)
+    : db_(db) {}
+
+std::optional<utils::IdempotencyRecord> IdempotencyRepository::claim(
+    const std::string& scope,
+    const std::string& key,
+    const std::string& fingerprint,
+    std::chrono::milliseconds ttl
+) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+
+    // Inserts a fresh claim, or takes over one that has expired; no row back
+    // means somebody else holds the key
+    auto claimed = txn.exec_params(
+        "INSERT INTO idempotency_keys (scope, idempotency_key, fingerprint, expires_at) "
+        "VALUES ($1, $2, $3, CURRENT_TIMESTAMP + make_interval(secs => $4::double precision)) "
+        "ON CONFLICT (scope, idempotency_key) DO UPDATE "
+        "SET fingerprint = EXCLUDED.fingerprint, status = NULL, body = NULL, "
+        "created_at = CURRENT_TIMESTAMP, expires_at = EXCLUDED.expires_at "
+        "WHERE idempotency_keys.expires_at <= CURRENT_TIMESTAMP "
+        "RETURNING 1",
+        scope, key, fingerprint, std::chrono::duration<double>(ttl).count()
+    );
+    if (!claimed.empty()) {
+        txn.commit();
+        return std::nullopt;
+    }
+
+    // Read committed: this statement sees the claim we conflicted with
+    auto result = txn.exec_params(
+        "SELECT fingerprint, status, body FROM idempotency_keys "
+        "WHERE scope = $1 AND idempotency_key = $2",
+        scope, key
+    );
+    txn.commit();
+
+    if (result.empty()) {
+        // Released between the two statements; report it as still running.
+        // The holder's fingerprint is gone, so match the caller's rather than
+        // have the store mistake the race for a reused key.
+        return utils::IdempotencyRecord::inProgress(fingerprint);
+    }
+    utils::IdempotencyRecord record;
+    record.fingerprint = result[0]["fingerprint"].as<std::string>();
+    if (!result[0]["status"].is_null()) {
+        record.response = utils::IdempotentResponse{
+            result[0]["status"].as<int>(), result[0]["body"].as<std::string>()};
+    }
+    return record;
+}
+
+void IdempotencyRepository::complete(const std::string& scope,
+                                     const std::string& key,
+                                     const utils::IdempotentResponse& response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+    txn.exec_params(
+        "UPDATE idempotency_keys SET status = $3, body = $4 "
+        "WHERE scope = $1 AND idempotency_key = $2",
+        scope, key, response.status, response.body
+    );
+    txn.commit();
+}
+
+void IdempotencyRepository::release(const std::string& scope, const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+    txn.exec_params(
+        "DELETE FROM idempotency_keys WHERE scope = $1 AND idempotency_key = $2",
+        scope, key
+    );
+    txn.commit();
+}
+
+std::size_t IdempotencyRepository::purgeExpired() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+    auto result = txn.exec("DELETE FROM idempotency_keys WHERE expires_at <= CURRENT_TIMESTAMP");
+    txn.commit();
+    return static_cast<std::size_t>(result.affected_rows());
+}
+
+} // namespace repositories
+} // namespace inventory
@@ -0,0 +1,97 @@
+#include "inventory/repositories/InventoryExportRepository.hpp"
+#include "inventory/utils/Logger.hpp"
+#include <pqxx/pqxx>
+#include <regex>
+#include <stdexcept>
+
+namespace inventory {
+namespace repositories {
+
+namespace {
+
+bool isValidUuid(const std::string& id) {
+    static const std::regex uuid_regex(
+        R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}$)"
+    );
+    return std::regex_match(id, uuid_regex);
+}
+
+} // namespace
+
+InventoryExportRepository::InventoryExportRepository(std::string connectionString)
+    : connectionString_(std::move(connectionString)) {}
+
+const std::vector<utils::ExportColumn>& InventoryExportRepository::columns() {
+    static const std::vector<utils::ExportColumn> catalogue = {
+        {"id", "id::text"},
+        {"productId", "product_id::text"},
+        {"warehouseId", "warehouse_id::text"},
+        {"locationId", "location_id::text"},
+        {"batchNumber", "batch_number"},
+        {"serialNumber", "serial_number"},
+        {"expirationDate", "to_char(expiration_date, 'YYYY-MM-DD')"},
+        {"status", "status"},
+        {"qualityStatus", "quality_status"},
+        {"quantity", "quantity::text", true},
+        {"availableQuantity", "available_quantity::text", true},
+        {"reservedQuantity", "reserved_quantity::text", true},
+        {"allocatedQuantity", "allocated_quantity::text", true},
+        {"costPerUnit", "cost_per_unit::text", true},
+        {"value", "(quantity * cost_per_unit)::text", true},
+    };
+    return catalogue;
+}
+
+void InventoryExportRepository::exportRows(const InventoryExportFilter& filter,
+                                           const std::vector<utils::ExportColumn>& columns,
+                                           const BatchHandler& onBatch) {
+    if (filter.warehouseId && !isValidUuid(*filter.warehouseId)) {
+        throw std::invalid_argument("Invalid warehouse id format");
+    }
+    if (filter.productId && !isValidUuid(*filter.productId)) {
+        throw std::invalid_argument("Invalid product id format");
+    }
+
+    std::string select;
+    for (const auto& column : columns) {
+        select += (select.empty() ? "" : ", ") + column.expression;
+    }
+
+    // Unset filters are passed as NULL and match every row
+    std::string sql = "SELECT " + select + " FROM inventory "
+                      "WHERE ($1::uuid IS NULL OR warehouse_id = $1) "
+                      "AND ($2::uuid IS NULL OR product_id = $2) "
+                      "AND ($3::text IS NULL OR status = $3) "
+                      "ORDER BY warehouse_id, product_id, id";
+
+    pqxx::connection db(connectionString_);
+    pqxx::read_transaction txn(db);
+    txn.exec_params("DECLARE inventory_export NO SCROLL CURSOR FOR " + sql,
+                    filter.warehouseId, filter.productId, filter.status);
+
+    const std::string fetch = "FETCH " + std::to_string(kFetchSize) + " FROM inventory_export";
+    std::size_t total = 0;
+    std::vector<Row> batch;
+    while (true) {
+        auto result = txn.exec(fetch);
+        batch.clear();
+        batch.reserve(result.size());
+        for (const auto& row : result) {
+            Row values;
+            values.reserve(columns.size());
+            for (std::size_t i = 0; i < columns.size(); ++i) {
+                values.push_back(row[i].is_null() ? std::nullopt : std::optional<std::string>(row[i].c_str()));
+            }
+            batch.push_back(std::move(values));
+        }
+        onBatch(batch);
+        total += batch.size();
+        if (result.size() < kFetchSize) {
+            break;
+        }
+    }
+    utils::Logger::info("Exported {} inventory rows", total);
+}
+
+} // namespace repositories
+} // namespace inventory
@@ -475,5 +475,150 @@ int InventoryRepository::getAvailableQuantityByProduct(const std::string& produc
     return result[0]["total"].as<int>();
 }
 
+models::ReservationPlan InventoryRepository::reserveForOrder(const models::OrderReservationRequest& request) {
+    if (!isValidUuid(request.orderId)) {
+        throw std::invalid_argument("Invalid order id format");
+    }
+    if (!isValidUuid(request.warehouseId)) {
+        throw std::invalid_argument("Invalid warehouse id format");
+    }
+    std::vector<std::string> productIds;
+    productIds.reserve(request.lines.size());
+    for (const auto& line : request.lines) {
+        if (!isValidUuid(line.productId) || !isValidUuid(line.lineItemId)) {
+            throw std::invalid_argument("Invalid order line id format");
+        }
+        productIds.push_back(line.productId);
+    }
+
+    pqxx::work txn(*db_);
+
+    // Serialises redeliveries of the same order across consumers
+    txn.exec_params("SELECT pg_advisory_xact_lock(hashtext($1))", request.orderId);
+
+    models::ReservationPlan plan;
+    auto existing = txn.exec_params(
+        "SELECT line_item_id::text, inventory_id::text, product_id::text, quantity "
+        "FROM order_reservations WHERE order_id = $1 ORDER BY created_at, id",
+        request.orderId
+    );
+    if (!existing.empty()) {
+        txn.commit();
+        for (const auto& row : existing) {
+            plan.allocations.push_back({row[0].as<std::string>(), row[1].as<std::string>(),
+                                        row[2].as<std::string>(), row[3].as<int>()});
+        }
+        return plan;
+    }
+
+    // Locked in a fixed order so concurrent orders for the same products cannot deadlock
+    auto rows = txn.exec_params(
+        "SELECT id::text, product_id::text, available_quantity FROM inventory "
+        "WHERE warehouse_id = $1 AND product_id = ANY($2::uuid[]) "
+        "AND status = 'available' AND available_quantity > 0 "
+        "AND (expiration_date IS NULL OR expiration_date > CURRENT_DATE) "
+        "ORDER BY product_id, expiration_date NULLS LAST, received_date NULLS LAST, id "
+        "FOR UPDATE",
+        request.warehouseId,
+        productIds
+    );
+
+    std::vector<models::StockCandidate> candidates;
+    candidates.reserve(rows.size());
+    for (const auto& row : rows) {
+        candidates.push_back({row[0].as<std::string>(), row[1].as<std::string>(), row[2].as<int>()});
+    }
+
+    plan = models::planReservation(request.lines, candidates);
+    if (!plan.complete()) {
+        txn.abort();
+        return plan;
+    }
+
+    std::vector<std::string> lineItemIds, inventoryIds, allocatedProductIds;
+    std::vector<int> quantities;
+    for (const auto& allocation : plan.allocations) {
+        lineItemIds.push_back(allocation.lineItemId);
+        inventoryIds.push_back(allocation.inventoryId);
+        allocatedProductIds.push_back(allocation.productId);
+        quantities.push_back(allocation.quantity);
+    }
+
+    txn.exec_params(
+        "WITH taken AS ("
+        "  SELECT id, SUM(qty)::int AS qty FROM unnest($2::uuid[], $3::int[]) AS t(id, qty) GROUP BY id"
+        "), updated AS ("
+        "  UPDATE inventory i SET available_quantity = i.available_quantity - t.qty, "
+        "  reserved_quantity = i.reserved_quantity + t.qty "
+        "  FROM taken t WHERE i.id = t.id "
+        "  RETURNING i.id, i.quantity, t.qty"
+        ") "
+        "INSERT INTO inventory_movements (inventory_id, movement_type, quantity_change, quantity_before, "
+        "quantity_after, reference_type, reference_id, reason) "
+        "SELECT id, 'reserve', qty, quantity, quantity, 'order', $1::uuid, 'Order reservation' FROM updated",
+        request.orderId,
+        inventoryIds,
+        quantities
+    );
+
+    txn.exec_params(
+        "INSERT INTO order_reservations (order_id, line_item_id, inventory_id, product_id, quantity) "
+        "SELECT $1::uuid, l, i, p, q FROM unnest($2::uuid[], $3::uuid[], $4::uuid[], $5::int[]) AS t(l, i, p, q)",
+        request.orderId,
+        lineItemIds,
+        inventoryIds,
+        allocatedProductIds,
+        quantities
+    );
+
+    txn.commit();
+    return plan;
+}
+
+std::vector<std::string> InventoryRepository::releaseForOrder(const std::string& orderId) {
+    if (!isValidUuid(orderId)) {
+        throw std::invalid_argument("Invalid order id format");
+    }
+
+    pqxx::work txn(*db_);
+    txn.exec_params("SELECT pg_advisory_xact_lock(hashtext($1))", orderId);
+
+    // Lock first so the release below reads current reserved quantities
+    txn.exec_params(
+        "SELECT id FROM inventory WHERE id IN "
+        "(SELECT inventory_id FROM order_reservations WHERE order_id = $1) "
+        "ORDER BY id FOR UPDATE",
+        orderId
+    );
+
+    // Stock may have moved on to allocated since; never release more than is still reserved
+    auto result = txn.exec_params(
+        "WITH released AS ("
+        "  DELETE FROM order_reservations WHERE order_id = $1 RETURNING inventory_id, quantity"
+        "), totals AS ("
+        "  SELECT r.inventory_id AS id, LEAST(SUM(r.quantity)::int, MIN(i.reserved_quantity)) AS qty "
+        "  FROM released r JOIN inventory i ON i.id = r.inventory_id GROUP BY r.inventory_id"
+        "), updated AS ("
+        "  UPDATE inventory i SET reserved_quantity = i.reserved_quantity - t.qty, "
+        "  available_quantity = i.available_quantity + t.qty "
+        "  FROM totals t WHERE i.id = t.id AND t.qty > 0 "
+        "  RETURNING i.id, i.quantity, t.qty"
+        ") "
+        "INSERT INTO inventory_movements (inventory_id, movement_type, quantity_change, quantity_before, "
+        "quantity_after, reference_type, reference_id, reason) "
+        "SELECT id, 'release', qty, quantity, quantity, 'order', $1::uuid, 'Order cancelled' FROM updated "
+        "RETURNING inventory_id::text",
+        orderId
+    );
+    txn.commit();
+
+    std::vector<std::string> released;
+    released.reserve(result.size());
+    for (const auto& row : result) {
+        released.push_back(row[0].as<std::string>());
+    }
+    return released;
+}
+
 } // namespace repositories
 } // namespace inventory
@@ -2,14 +2,41 @@
 #include "inventory/utils/Logger.hpp"
 #include "inventory/utils/DtoMapper.hpp"
 #include <nlohmann/json.hpp>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 
 namespace inventory {
 namespace services {
 
+namespace {
+
+std::string today() {
+    auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm now_tm = *std::gmtime(&now);
+    std::ostringstream oss;
+    oss << std::put_time(&now_tm, "%Y-%m-%d");
+    return oss.str();
+}
+
+bool isIsoDate(const std::string& date) {
+    std::tm parsed{};
+    std::istringstream iss(date);
+    iss >> std::get_time(&parsed, "%Y-%m-%d");
+    return date.size() == 10 && !iss.fail() && iss.peek() == std::char_traits<char>::eof();
+}
+
+} // namespace
+
 InventoryService::InventoryService(std::shared_ptr<repositories::InventoryRepository> repository,
-                                   std::shared_ptr<utils::MessageBus> messageBus)
-    : repository_(repository), messageBus_(std::move(messageBus)) {}
+                                   std::shared_ptr<utils::MessageBus> messageBus,
+                                   std::shared_ptr<utils::AtpTable> atp,
+                                   std::shared_ptr<repositories::InventoryExportRepository> exports)
+    : repository_(repository), messageBus_(std::move(messageBus)), atp_(std::move(atp)),
+      exports_(std::move(exports)) {}
 
 std::optional<dtos::InventoryItemDto> InventoryService::getById(const std::string& id) {
     auto inventory = repository_->findById(id);
@@ -51,6 +78,7 @@ dtos::InventoryItemDto InventoryService::create(const models::Inventory& invento
         throw std::invalid_argument("Invalid inventory data");
     }
     auto created = repository_->create(inventory);
+    track(created);
 
     if (messageBus_) {
         try {
@@ -74,6 +102,7 @@ dtos::InventoryItemDto InventoryService::update(const models::Inventory& invento
     }
 
     auto updated = repository_->update(inventory);
+    track(updated);
 
     if (messageBus_) {
         try {
@@ -98,6 +127,9 @@ bool InventoryService::remove(const std::string& id) {
     }
 
     bool deleted = repository_->deleteById(id);
+    if (deleted && atp_) {
+        atp_->remove(id);
+    }
 
     if (deleted && messageBus_) {
         try {
@@ -122,6 +154,7 @@ dtos::InventoryOperationResultDto InventoryService::reserve(const std::string& i
     
     inventory->reserve(quantity);
     auto updated = repository_->update(*inventory);
+    track(updated);
 
     if (messageBus_) {
         try {
@@ -147,6 +180,7 @@ dtos::InventoryOperationResultDto InventoryService::release(const std::string& i
     
     inventory->release(quantity);
     auto updated = repository_->update(*inventory);
+    track(updated);
 
     if (messageBus_) {
         try {
@@ -172,6 +206,7 @@ dtos::InventoryOperationResultDto InventoryService::allocate(const std::string&
     
     inventory->allocate(quantity);
     auto updated = repository_->update(*inventory);
+    track(updated);
 
     if (messageBus_) {
         try {
@@ -197,6 +232,7 @@ dtos::InventoryOperationResultDto InventoryService::deallocate(const std::string
     
     inventory->deallocate(quantity);
     auto updated = repository_->update(*inventory);
+    track(updated);
 
     if (messageBus_) {
         try {
@@ -226,6 +262,7 @@ dtos::InventoryOperationResultDto InventoryService::adjust(const std::string& id
     
     inventory->adjust(quantityChange, reason);
     auto updated = repository_->update(*inventory);
+    track(updated);
 
     if (messageBus_) {
         try {
@@ -275,6 +312,155 @@ int InventoryService::getAvailableQuantityForProduct(const std::string& productI
     return repository_->getAvailableQuantityByProduct(productId);
 }
 
+dtos::AvailableToPromiseDto InventoryService::getAvailableToPromise(const std::vector<std::string>& productIds,
+                                                                    const std::optional<std::string>& date) {
+    if (!atp_) {
+        throw std::runtime_error("Available-to-promise table is not configured");
+    }
+    if (productIds.empty() || productIds.size() > kMaxAtpProducts) {
+        throw std::invalid_argument("Between 1 and " + std::to_string(kMaxAtpProducts) + " product ids are required");
+    }
+    if (date && !isIsoDate(*date)) {
+        throw std::invalid_argument("date must be YYYY-MM-DD");
+    }
+
+    // Stock that has already expired can never be promised, whatever date is asked about
+    auto promiseDate = today();
+    if (date && *date > promiseDate) {
+        promiseDate = *date;
+    }
+
+    std::vector<dtos::ProductAtpDto> products;
+    products.reserve(productIds.size());
+    for (const auto& product : atp_->query(productIds, promiseDate)) {
+        std::vector<dtos::WarehouseAtpDto> warehouses;
+        warehouses.reserve(product.warehouses.size());
+        for (const auto& warehouse : product.warehouses) {
+            warehouses.emplace_back(warehouse.warehouseId, warehouse.available, warehouse.reserved, warehouse.incoming);
+        }
+        products.emplace_back(product.productId, warehouses);
+    }
+    return dtos::AvailableToPromiseDto(promiseDate, products);
+}
+
+std::size_t InventoryService::exportInventory(const repositories::InventoryExportFilter& filter,
+                                              utils::ExportFormat format,
+                                              const std::vector<std::string>& columns,
+                                              const std::function<std::ostream&()>& open) {
+    if (!exports_) {
+        throw std::runtime_error("Inventory exports are not configured");
+    }
+    if (filter.status) {
+        models::inventoryStatusFromString(*filter.status);
+    }
+    auto projected = utils::ExportWriter::project(repositories::InventoryExportRepository::columns(), columns);
+
+    std::optional<utils::ExportWriter> writer;
+    std::ostream* out = nullptr;
+    exports_->exportRows(filter, projected, [&](const std::vector<repositories::InventoryExportRepository::Row>& rows) {
+        if (!writer) {
+            out = &open();
+            writer.emplace(*out, format, projected);
+            writer->begin();
+        }
+        for (const auto& row : rows) {
+            writer->row(row);
+        }
+        // Blocks while the client is behind, which holds back the next fetch
+        out->flush();
+        if (!*out) {
+            throw std::runtime_error("Export client went away after " + std::to_string(writer->rows()) + " rows");
+        }
+    });
+    return writer ? writer->rows() : 0;
+}
+
+void InventoryService::loadAvailableToPromise() {
+    if (!atp_) {
+        return;
+    }
+    atp_->load(repository_->findAll());
+    utils::Logger::info("Available-to-promise table loaded from {} stock rows", atp_->rowCount());
+}
+
+bool InventoryService::reserveForOrder(const models::OrderReservationRequest& request) {
+    auto plan = repository_->reserveForOrder(request);
+
+    if (!plan.complete()) {
+        nlohmann::json shortages = nlohmann::json::array();
+        for (const auto& shortage : plan.shortages) {
+            shortages.push_back(shortage.toJson());
+        }
+        utils::Logger::info("Order {} cannot be reserved: {} product(s) short", request.orderId, plan.shortages.size());
+        publish("order.reservation-failed", {
+            {"orderId", request.orderId},
+            {"warehouseId", request.warehouseId},
+            {"reason", std::to_string(plan.shortages.size()) + " product(s) short in warehouse"},
+            {"shortages", shortages}
+        });
+        return false;
+    }
+
+    nlohmann::json reservations = nlohmann::json::array();
+    std::vector<std::string> reserved;
+    for (const auto& allocation : plan.allocations) {
+        reservations.push_back(allocation.toJson());
+        reserved.push_back(allocation.inventoryId);
+    }
+    trackRows(reserved);
+    publish("order.reserved", {
+        {"orderId", request.orderId},
+        {"warehouseId", request.warehouseId},
+        {"reservations", reservations}
+    });
+    return true;
+}
+
+void InventoryService::releaseForOrder(const std::string& orderId) {
+    auto released = repository_->releaseForOrder(orderId);
+    if (released.empty()) {
+        // Never reserved, or already released by an earlier delivery
+        return;
+    }
+    trackRows(released);
+    publish("order.released", {{"orderId", orderId}, {"releasedRows", released.size()}});
+}
+
+void InventoryService::publish(const std::string& routingKey, const nlohmann::json& payload) {
+    if (!messageBus_) {
+        return;
+    }
+    try {
+        messageBus_->publish(routingKey, payload);
+    } catch (const std::exception& ex) {
+        utils::Logger::warn("Failed to publish inventory.{} event: {}", routingKey, ex.what());
+    }
+}
+
+void InventoryService::track(const models::Inventory& inventory) {
+    if (atp_) {
+        atp_->apply(inventory);
+    }
+}
+
+void InventoryService::trackRows(const std::vector<std::string>& inventoryIds) {
+    if (!atp_) {
+        return;
+    }
+    // An order may draw several lines from one row; read each row once
+    for (const auto& id : std::set<std::string>(inventoryIds.begin(), inventoryIds.end())) {
+        try {
+            if (auto inventory = repository_->findById(id)) {
+                atp_->apply(*inventory);
+            } else {
+                atp_->remove(id);
+            }
+        } catch (const std::exception& ex) {
+            utils::Logger::warn("Failed to refresh available-to-promise for inventory {}: {}", id, ex.what());
+        }
+    }
+}
+
 void InventoryService::validateQuantities(int quantity, int available, int reserved, int allocated) const {
     if (quantity < 0) {
         throw std::invalid_argument("Quantity cannot be negative");
@@ -0,0 +1,126 @@
+#include "inventory/utils/AtpTable.hpp"
+#include <mutex>
+
+namespace inventory {
+namespace utils {
+
+AtpTable::Contribution AtpTable::contributionOf(const models::Inventory& row) {
+    Contribution contribution;
+    contribution.productId = row.getProductId();
+    contribution.warehouseId = row.getWarehouseId();
+    contribution.reserved = row.getReservedQuantity();
+
+    if (row.getStatus() == models::InventoryStatus::AVAILABLE) {
+        contribution.available = row.getAvailableQuantity();
+        if (auto expiry = row.getExpirationDate()) {
+            // Dates may arrive as timestamps; only the day matters
+            contribution.expiry = expiry->substr(0, 10);
+        }
+    } else if (row.getStatus() == models::InventoryStatus::QUARANTINE &&
+               row.getQualityStatus() != models::QualityStatus::FAILED) {
+        contribution.incoming = row.getQuantity();
+    }
+    return contribution;
+}
+
+void AtpTable::load(const std::vector<models::Inventory>& rows) {
+    std::unique_lock lock(mutex_);
+    products_.clear();
+    rows_.clear();
+    for (const auto& row : rows) {
+        auto contribution = contributionOf(row);
+        addLocked(contribution, 1);
+        rows_[row.getId()] = std::move(contribution);
+    }
+}
+
+void AtpTable::apply(const models::Inventory& row) {
+    auto contribution = contributionOf(row);
+    std::unique_lock lock(mutex_);
+    removeLocked(row.getId());
+    addLocked(contribution, 1);
+    rows_[row.getId()] = std::move(contribution);
+}
+
+void AtpTable::remove(const std::string& inventoryId) {
+    std::unique_lock lock(mutex_);
+    removeLocked(inventoryId);
+}
+
+ProductAtp AtpTable::query(const std::string& productId, const std::string& date) const {
+    std::shared_lock lock(mutex_);
+    return queryLocked(productId, date);
+}
+
+std::vector<ProductAtp> AtpTable::query(const std::vector<std::string>& productIds,
+                                        const std::string& date) const {
+    std::vector<ProductAtp> results;
+    results.reserve(productIds.size());
+    std::shared_lock lock(mutex_);
+    for (const auto& productId : productIds) {
+        results.push_back(queryLocked(productId, date));
+    }
+    return results;
+}
+
+std::size_t AtpTable::rowCount() const {
+    std::shared_lock lock(mutex_);
+    return rows_.size();
+}
+
+void AtpTable::addLocked(const Contribution& contribution, int sign) {
+    auto& warehouses = products_[contribution.productId];
+    auto& bucket = warehouses[contribution.warehouseId];
+    bucket.available += sign * contribution.available;
+    bucket.reserved += sign * contribution.reserved;
+    bucket.incoming += sign * contribution.incoming;
+    if (!contribution.expiry.empty() && contribution.available != 0) {
+        auto it = bucket.expiring.try_emplace(contribution.expiry, 0).first;
+        it->second += sign * contribution.available;
+        if (it->second == 0) {
+            bucket.expiring.erase(it);
+        }
+    }
+
+    // Drop what no longer holds anything so stale warehouses do not linger
+    if (bucket.available == 0 && bucket.reserved == 0 && bucket.incoming == 0 && bucket.expiring.empty()) {
+        warehouses.erase(contribution.warehouseId);
+        if (warehouses.empty()) {
+            products_.erase(contribution.productId);
+        }
+    }
+}
+
+void AtpTable::removeLocked(const std::string& inventoryId) {
+    auto it = rows_.find(inventoryId);
+    if (it == rows_.end()) {
+        return;
+    }
+    addLocked(it->second, -1);
+    rows_.erase(it);
+}
+
+ProductAtp AtpTable::queryLocked(const std::string& productId, const std::string& date) const {
+    ProductAtp result;
+    result.productId = productId;
+    auto product = products_.find(productId);
+    if (product == products_.end()) {
+        return result;
+    }
+
+    result.warehouses.reserve(product->second.size());
+    for (const auto& [warehouseId, bucket] : product->second) {
+        WarehouseAtp atp{warehouseId, bucket.available, bucket.reserved, bucket.incoming};
+        for (auto it = bucket.expiring.begin(); it != bucket.expiring.end() && it->first <= date; ++it) {
+            atp.available -= it->second;
+        }
+        result.available += atp.available;
+        result.reserved += atp.reserved;
+        result.incoming += atp.incoming;
+        result.warehouses.push_back(std::move(atp));
+    }
+    return result;
+}
+
+} // namespace utils
+} // namespace inventory
@@ -124,6 +124,7 @@ void RabbitMqMessageBus::publish(const std::string& routingKey,
     props.content_type = amqp_cstring_bytes("application/json");
     props.delivery_mode = 2; // persistent
 
+    std::lock_guard<std::mutex> lock(publishMutex_);
     int status = amqp_basic_publish(
         connection_,
         channel_,
@@ -0,0 +1,201 @@
+#include "inventory/utils/RabbitMqMessageConsumer.hpp"
+#include "inventory/utils/Logger.hpp"
+
+#include <sys/time.h>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace inventory {
+namespace utils {
+
+namespace {
+
+void checkAmqpStatus(const char* context, int status) {
+    if (status < 0) {
+        throw std::runtime_error(std::string(context) + ": " + amqp_error_string2(status));
+    }
+}
+
+void checkAmqpReply(const char* context, const amqp_rpc_reply_t& reply) {
+    if (reply.reply_type == AMQP_RESPONSE_NORMAL) {
+        return;
+    }
+    std::string message = context;
+    message += ": AMQP error";
+    throw std::runtime_error(message);
+}
+
+std::string toString(const amqp_bytes_t& bytes) {
+    return std::string(static_cast<const char*>(bytes.bytes), bytes.len);
+}
+
+} // namespace
+
+RabbitMqMessageConsumer::RabbitMqMessageConsumer(const MessageBus::Config& config,
+                                                 std::string queue,
+                                                 std::vector<std::string> bindingKeys,
+                                                 Handler handler)
+    : config_(config)
+    , queue_(std::move(queue))
+    , bindingKeys_(std::move(bindingKeys))
+    , handler_(std::move(handler))
+    , connection_(nullptr)
+    , channel_(1) {}
+
+RabbitMqMessageConsumer::~RabbitMqMessageConsumer() {
+    stop();
+}
+
+void RabbitMqMessageConsumer::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    thread_ = std::thread(&RabbitMqMessageConsumer::run, this);
+}
+
+void RabbitMqMessageConsumer::stop() {
+    running_ = false;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void RabbitMqMessageConsumer::connect() {
+    connection_ = amqp_new_connection();
+    amqp_socket_t* socket = amqp_tcp_socket_new(connection_);
+    if (!socket) {
+        throw std::runtime_error("Failed to create AMQP TCP socket");
+    }
+
+    checkAmqpStatus("Opening TCP socket", amqp_socket_open(socket, config_.host.c_str(), config_.port));
+    checkAmqpReply("Logging in to RabbitMQ", amqp_login(
+        connection_,
+        config_.virtual_host.c_str(),
+        0,
+        131072,
+        0,
+        AMQP_SASL_METHOD_PLAIN,
+        config_.username.c_str(),
+        config_.password.c_str()));
+
+    amqp_channel_open(connection_, channel_);
+    checkAmqpReply("Opening channel", amqp_get_rpc_reply(connection_));
+
+    // Same declaration as the publisher, so whichever starts first creates it
+    amqp_exchange_declare(
+        connection_,
+        channel_,
+        amqp_cstring_bytes(config_.exchange.c_str()),
+        amqp_cstring_bytes("topic"),
+        0,    // passive
+        0,    // durable
+        0,    // auto_delete
+        0,    // internal
+        amqp_empty_table);
+    checkAmqpReply("Declaring exchange", amqp_get_rpc_reply(connection_));
+
+    // Durable and shared: replicas of this service compete for its messages
+    amqp_queue_declare(
+        connection_,
+        channel_,
+        amqp_cstring_bytes(queue_.c_str()),
+        0,    // passive
+        1,    // durable
+        0,    // exclusive
+        0,    // auto_delete
+        amqp_empty_table);
+    checkAmqpReply("Declaring queue", amqp_get_rpc_reply(connection_));
+
+    for (const auto& key : bindingKeys_) {
+        amqp_queue_bind(
+            connection_,
+            channel_,
+            amqp_cstring_bytes(queue_.c_str()),
+            amqp_cstring_bytes(config_.exchange.c_str()),
+            amqp_cstring_bytes(key.c_str()),
+            amqp_empty_table);
+        checkAmqpReply("Binding queue", amqp_get_rpc_reply(connection_));
+    }
+
+    amqp_basic_qos(connection_, channel_, 0, kPrefetch, 0);
+    checkAmqpReply("Setting prefetch", amqp_get_rpc_reply(connection_));
+
+    amqp_basic_consume(
+        connection_,
+        channel_,
+        amqp_cstring_bytes(queue_.c_str()),
+        amqp_empty_bytes,
+        0,    // no_local
+        0,    // no_ack
+        0,    // exclusive
+        amqp_empty_table);
+    checkAmqpReply("Starting consumer", amqp_get_rpc_reply(connection_));
+}
+
+void RabbitMqMessageConsumer::close() {
+    if (!connection_) {
+        return;
+    }
+    amqp_channel_close(connection_, channel_, AMQP_REPLY_SUCCESS);
+    amqp_connection_close(connection_, AMQP_REPLY_SUCCESS);
+    amqp_destroy_connection(connection_);
+    connection_ = nullptr;
+}
+
+void RabbitMqMessageConsumer::dispatch(const amqp_envelope_t& envelope) {
+    const auto routingKey = toString(envelope.routing_key);
+    try {
+        handler_(routingKey, nlohmann::json::parse(toString(envelope.message.body)));
+        amqp_basic_ack(connection_, channel_, envelope.delivery_tag, 0);
+    } catch (const std::exception& e) {
+        const bool requeue = !envelope.redelivered;
+        utils::Logger::error("Failed to handle message {} from {}{}: {}", routingKey, queue_,
+                             requeue ? "; requeueing" : "; rejecting", e.what());
+        amqp_basic_reject(connection_, channel_, envelope.delivery_tag, requeue ? 1 : 0);
+    }
+}
+
+void RabbitMqMessageConsumer::run() {
+    auto backoff = std::chrono::seconds(1);
+    constexpr auto kMaxBackoff = std::chrono::seconds(30);
+
+    while (running_) {
+        try {
+            connect();
+            utils::Logger::info("Consuming {} from exchange {}", queue_, config_.exchange);
+            backoff = std::chrono::seconds(1);
+
+            while (running_) {
+                amqp_maybe_release_buffers(connection_);
+
+                // Wake up every second to notice stop()
+                timeval timeout{1, 0};
+                amqp_envelope_t envelope;
+                auto reply = amqp_consume_message(connection_, &envelope, &timeout, 0);
+                if (reply.reply_type == AMQP_RESPONSE_LIBRARY_EXCEPTION &&
+                    reply.library_error == AMQP_STATUS_TIMEOUT) {
+                    continue;
+                }
+                checkAmqpReply("Consuming message", reply);
+
+                dispatch(envelope);
+                amqp_destroy_envelope(&envelope);
+            }
+        } catch (const std::exception& e) {
+            utils::Logger::error("RabbitMQ consumer for {} failed: {}; retrying in {}s",
+                                 queue_, e.what(), backoff.count());
+        }
+
+        close();
+        for (auto waited = std::chrono::seconds(0); running_ && waited < backoff; waited += std::chrono::seconds(1)) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+        backoff = std::min(backoff * 2, kMaxBackoff);
+    }
+
+    close();
+}
+
+} // namespace utils
+} // namespace inventory
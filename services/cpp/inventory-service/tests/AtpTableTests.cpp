@@ -0,0 +1,169 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "inventory/utils/AtpTable.hpp"
+#include <chrono>
+#include <string>
+
+using inventory::models::Inventory;
+using inventory::models::InventoryStatus;
+using inventory::models::QualityStatus;
+using inventory::utils::AtpTable;
+
+namespace {
+
+Inventory row(const std::string& id, const std::string& product, const std::string& warehouse,
+              int available, int reserved = 0, std::optional<std::string> expiry = std::nullopt) {
+    Inventory inventory(id, product, warehouse, "loc-1", available + reserved);
+    inventory.setAvailableQuantity(available);
+    inventory.setReservedQuantity(reserved);
+    inventory.setExpirationDate(expiry);
+    return inventory;
+}
+
+} // namespace
+
+TEST_CASE("AtpTable totals available and reserved stock per warehouse", "[atp]") {
+    AtpTable table;
+    table.load({
+        row("inv-1", "p-1", "wh-a", 10, 2),
+        row("inv-2", "p-1", "wh-a", 5),
+        row("inv-3", "p-1", "wh-b", 7, 1),
+        row("inv-4", "p-2", "wh-a", 3),
+    });
+
+    auto atp = table.query("p-1", "2026-01-01");
+
+    REQUIRE(atp.available == 22);
+    REQUIRE(atp.reserved == 3);
+    REQUIRE(atp.warehouses.size() == 2);
+    REQUIRE(atp.warehouses[0].warehouseId == "wh-a");
+    REQUIRE(atp.warehouses[0].available == 15);
+    REQUIRE(atp.warehouses[0].reserved == 2);
+    REQUIRE(atp.warehouses[1].available == 7);
+    REQUIRE(table.rowCount() == 4);
+
+    SECTION("unknown products have nothing to promise") {
+        auto none = table.query("p-missing", "2026-01-01");
+        REQUIRE(none.warehouses.empty());
+        REQUIRE(none.available == 0);
+    }
+}
+
+TEST_CASE("AtpTable leaves out batches expiring by the promise date", "[atp]") {
+    AtpTable table;
+    table.load({
+        row("inv-1", "p-1", "wh-a", 4, 0, std::string("2026-03-01")),
+        row("inv-2", "p-1", "wh-a", 6, 0, std::string("2026-06-01T00:00:00Z")),
+        row("inv-3", "p-1", "wh-a", 5),
+    });
+
+    REQUIRE(table.query("p-1", "2026-02-28").available == 15);
+    // A batch expiring on the day cannot be promised for it
+    REQUIRE(table.query("p-1", "2026-03-01").available == 11);
+    REQUIRE(table.query("p-1", "2026-06-01").available == 5);
+    REQUIRE(table.query("p-1", "2027-01-01").available == 5);
+}
+
+TEST_CASE("AtpTable reports quarantined stock as incoming, not available", "[atp]") {
+    auto inspecting = row("inv-q", "p-1", "wh-a", 0);
+    inspecting.setQuantity(8);
+    inspecting.setStatus(InventoryStatus::QUARANTINE);
+    inspecting.setQualityStatus(QualityStatus::PENDING);
+    auto rejected = row("inv-f", "p-1", "wh-a", 0);
+    rejected.setQuantity(3);
+    rejected.setStatus(InventoryStatus::QUARANTINE);
+    rejected.setQualityStatus(QualityStatus::FAILED);
+    auto damaged = row("inv-d", "p-1", "wh-a", 9);
+    damaged.setStatus(InventoryStatus::DAMAGED);
+
+    AtpTable table;
+    table.load({row("inv-1", "p-1", "wh-a", 2), inspecting, rejected, damaged});
+
+    auto atp = table.query("p-1", "2026-01-01");
+    REQUIRE(atp.available == 2);
+    REQUIRE(atp.incoming == 8);
+}
+
+TEST_CASE("AtpTable replaces a row's contribution when it changes", "[atp]") {
+    AtpTable table;
+    table.load({row("inv-1", "p-1", "wh-a", 10, 0, std::string("2026-03-01")), row("inv-2", "p-1", "wh-b", 4)});
+
+    // Reserve 6 from inv-1
+    table.apply(row("inv-1", "p-1", "wh-a", 4, 6, std::string("2026-03-01")));
+    auto atp = table.query("p-1", "2026-01-01");
+    REQUIRE(atp.available == 8);
+    REQUIRE(atp.reserved == 6);
+    REQUIRE(table.query("p-1", "2026-03-01").available == 4);
+
+    SECTION("moved to another warehouse") {
+        table.apply(row("inv-2", "p-1", "wh-a", 4));
+        auto moved = table.query("p-1", "2026-01-01");
+        REQUIRE(moved.warehouses.size() == 1);
+        REQUIRE(moved.warehouses[0].available == 8);
+    }
+
+    SECTION("removed") {
+        table.remove("inv-1");
+        table.remove("inv-unknown");
+        auto removed = table.query("p-1", "2026-01-01");
+        REQUIRE(removed.warehouses.size() == 1);
+        REQUIRE(removed.warehouses[0].warehouseId == "wh-b");
+        REQUIRE(table.rowCount() == 1);
+    }
+}
+
+TEST_CASE("AtpTable query cost does not grow with the table", "[atp]") {
+    // 200k rows over 20k products; a batch of 100 stays well inside a checkout budget
+    std::vector<Inventory> rows;
+    rows.reserve(200000);
+    for (int i = 0; i < 200000; ++i) {
+        std::optional<std::string> expiry;
+        if (i % 3 == 0) {
+            expiry = "2026-" + std::string(i % 2 ? "04" : "09") + "-15";
+        }
+        rows.push_back(row("inv-" + std::to_string(i), "p-" + std::to_string(i % 20000),
+                           "wh-" + std::to_string(i % 8), 5, 1, expiry));
+    }
+    AtpTable table;
+    table.load(rows);
+
+    std::vector<std::string> products;
+    for (int i = 0; i < 100; ++i) {
+        products.push_back("p-" + std::to_string(i * 97));
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    auto results = table.query(products, "2026-05-01");
+    auto elapsed = std::chrono::steady_clock::now() - started;
+
+    REQUIRE(results.size() == 100);
+    REQUIRE(results[0].reserved == 10);
+    REQUIRE(elapsed < std::chrono::milliseconds(20));   // generous for debug builds; see benchmark
+}
+
+TEST_CASE("AtpTable throughput", "[atp][!benchmark]") {
+    std::vector<Inventory> rows;
+    for (int i = 0; i < 100000; ++i) {
+        rows.push_back(row("inv-" + std::to_string(i), "p-" + std::to_string(i % 10000),
+                           "wh-" + std::to_string(i % 8), 5, 0,
+                           i % 2 ? std::optional<std::string>("2026-04-15") : std::nullopt));
+    }
+    AtpTable table;
+    table.load(rows);
+    std::vector<std::string> products;
+    for (int i = 0; i < 100; ++i) {
+        products.push_back("p-" + std::to_string(i * 31));
+    }
+    int next = 0;
+
+    BENCHMARK("query one product") {
+        return table.query("p-42", "2026-05-01");
+    };
+    BENCHMARK("query 100 products") {
+        return table.query(products, "2026-05-01");
+    };
+    BENCHMARK("apply a changed row") {
+        table.apply(row("inv-7", "p-7", "wh-7", next++ % 5, 0));
+    };
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch_all.hpp>
 #include "contract_validator/CppCodeParser.hpp"
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
 using namespace contract_validator;
 
@@ -361,6 +363,113 @@ TEST_CASE("CppCodeParser parses actual Inventory model", "[parser][integration]"
     }
 }
 
+TEST_CASE("CppCodeParser tokenizes in one pass", "[parser][tokens]") {
+    std::string code = R"code(
+        #include <string>
+        #define BRACE {
+        // class Commented {
+        /* class Blocked { */
+        auto s = R"x(class Raw { ")x";
+        char q = '"';
+        int n = 1'000'000;
+        void f() { if (a::b) { x[0] = "}"; } }
+    )code";
+    
+    auto tokens = CppCodeParser::tokenize(code);
+    
+    std::vector<std::string> texts;
+    for (const auto& token : tokens) {
+        texts.emplace_back(token.text);
+    }
+    REQUIRE(std::find(texts.begin(), texts.end(), "BRACE") == texts.end());
+    REQUIRE(std::find(texts.begin(), texts.end(), "Commented") == texts.end());
+    REQUIRE(std::find(texts.begin(), texts.end(), "Blocked") == texts.end());
+    REQUIRE(std::find(texts.begin(), texts.end(), "R\"x(class Raw { \")x\"") != texts.end());
+    REQUIRE(std::find(texts.begin(), texts.end(), "'\"'") != texts.end());
+    REQUIRE(std::find(texts.begin(), texts.end(), "1'000'000") != texts.end());
+    REQUIRE(std::find(texts.begin(), texts.end(), "::") != texts.end());
+    
+    // Brackets pair up and braces carry their depth
+    auto body = std::find(texts.begin(), texts.end(), "{") - texts.begin();
+    const auto& open = tokens[static_cast<size_t>(body)];
+    REQUIRE(open.depth == 0);
+    REQUIRE(open.partner == tokens.size() - 1);
+    REQUIRE(tokens[open.partner].depth == 0);
+    REQUIRE(tokens[static_cast<size_t>(body) + 1].depth == 1);
+    
+    REQUIRE(CppCodeParser::parseCode(code).empty());
+}
+
+TEST_CASE("CppCodeParser names classes and their bases", "[parser][class]") {
+    std::string code = R"(
+        namespace inventory::models {
+        enum class InventoryStatus { AVAILABLE, RESERVED };
+        template <class T> class Box final : public Base<T>, private Other {
+        public:
+            class Handle { int id_ = 0; };
+        private:
+            std::map<std::string, std::vector<int>> index_;
+            mutable std::mutex mutex_;
+            std::array<char, 3> code_{'A', 'B', 'C'};
+            static constexpr int kLimit_ = 3;
+            int first_, second_;
+        };
+        }
+        class Server::Factory : public Poco::Net::HTTPRequestHandlerFactory {};
+    )";
+    
+    auto classes = CppCodeParser::parseCode(code);
+    REQUIRE(classes.size() == 3);
+    
+    REQUIRE(classes[0].name == "Box");
+    REQUIRE(classes[0].fullName == "inventory::models::Box");
+    REQUIRE(classes[0].inheritedClasses == std::vector<std::string>{"Base<T>", "Other"});
+    REQUIRE(classes[0].members.size() == 3);
+    REQUIRE(classes[0].members[0].type == "std::map<std::string, std::vector<int>>");
+    REQUIRE(classes[0].members[1].type == "std::mutex");
+    REQUIRE(classes[0].members[2].name == "code_");
+    REQUIRE(classes[0].members[2].defaultValue == "'A', 'B', 'C'");
+    
+    REQUIRE(classes[1].fullName == "inventory::models::Box::Handle");
+    REQUIRE(classes[2].name == "Factory");
+    REQUIRE(classes[2].fullName == "Server::Factory");
+    REQUIRE(classes[2].inheritedClasses == std::vector<std::string>{"Poco::Net::HTTPRequestHandlerFactory"});
+}
+
+TEST_CASE("CppCodeParser on the largest sources", "[parser][!benchmark]") {
+    auto read = [](const std::string& path) {
+        std::ifstream file(path);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    };
+    auto controller = read(INVENTORY_SOURCE_DIR "/src/controllers/InventoryController.cpp");
+    auto validator = read(INVENTORY_SOURCE_DIR "/../contract-validator/src/ContractValidator.cpp");
+    auto model = read(INVENTORY_SOURCE_DIR "/include/inventory/models/Inventory.hpp");
+    REQUIRE_FALSE(controller.empty());
+    REQUIRE_FALSE(validator.empty());
+    REQUIRE(CppCodeParser::parseCode(model).size() == 1);
+    
+    // Many classes in one file is where per-class copying and regex rescans cost most
+    std::string models;
+    for (int i = 0; i < 32; ++i) {
+        models += model;
+    }
+    
+    BENCHMARK("InventoryController.cpp") {
+        return CppCodeParser::parseCode(controller);
+    };
+    BENCHMARK("ContractValidator.cpp") {
+        return CppCodeParser::parseCode(validator);
+    };
+    BENCHMARK("Inventory.hpp") {
+        return CppCodeParser::parseCode(model);
+    };
+    BENCHMARK("Inventory.hpp x32") {
+        return CppCodeParser::parseCode(models);
+    };
+}
+
 TEST_CASE("CppCodeParser utility functions", "[parser][utils]") {
     SECTION("isOptionalType") {
         REQUIRE(CppCodeParser::isOptionalType("std::optional<std::string>"));
@@ -373,6 +482,7 @@ TEST_CASE("CppCodeParser utility functions", "[parser][utils]") {
         REQUIRE(CppCodeParser::unwrapOptionalType("std::optional<std::string>") == "std::string");
         REQUIRE(CppCodeParser::unwrapOptionalType("optional<int>") == "int");
         REQUIRE(CppCodeParser::unwrapOptionalType("std::string") == "std::string");
+        REQUIRE(CppCodeParser::unwrapOptionalType("std::optional<std::vector<int>>") == "std::vector<int>");
     }
     
     SECTION("normalizeType") {
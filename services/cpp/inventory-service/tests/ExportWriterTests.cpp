@@ -0,0 +1,49 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "inventory/repositories/InventoryExportRepository.hpp"
+#include "inventory/utils/ExportWriter.hpp"
+#include <sstream>
+#include <stdexcept>
+
+using inventory::repositories::InventoryExportRepository;
+using inventory::utils::ExportFormat;
+using inventory::utils::ExportWriter;
+
+TEST_CASE("Inventory exports write valuation rows as CSV", "[export]") {
+    auto columns = ExportWriter::project(InventoryExportRepository::columns(),
+                                         {"batchNumber", "quantity", "costPerUnit", "value"});
+    std::ostringstream out;
+    ExportWriter writer(out, ExportFormat::Csv, columns);
+    writer.begin();
+    writer.row({std::string("LOT-1"), std::string("10"), std::string("2.50"), std::string("25.00")});
+    writer.row({std::string("LOT \"A\", 2"), std::string("4"), std::nullopt, std::nullopt});
+
+    REQUIRE(out.str() ==
+            "batchNumber,quantity,costPerUnit,value\r\n"
+            "LOT-1,10,2.50,25.00\r\n"
+            "\"LOT \"\"A\"\", 2\",4,,\r\n");
+    REQUIRE(writer.rows() == 2);
+}
+
+TEST_CASE("Inventory exports write NDJSON with numbers unquoted", "[export]") {
+    auto columns = ExportWriter::project(InventoryExportRepository::columns(), {"id", "value"});
+    std::ostringstream out;
+    ExportWriter writer(out, ExportFormat::Ndjson, columns);
+    writer.begin();
+    writer.row({std::string("inv-1"), std::string("25.00")});
+    writer.row({std::string("inv-2"), std::nullopt});
+
+    REQUIRE(out.str() ==
+            "{\"id\":\"inv-1\",\"value\":25.00}\n"
+            "{\"id\":\"inv-2\",\"value\":null}\n");
+}
+
+TEST_CASE("Inventory exports only project catalogued columns", "[export]") {
+    REQUIRE(ExportWriter::project(InventoryExportRepository::columns(), {}).size() ==
+            InventoryExportRepository::columns().size());
+    REQUIRE_THROWS_AS(ExportWriter::project(InventoryExportRepository::columns(), {"notes"}),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(ExportWriter::project(InventoryExportRepository::columns(), {"id", "id"}),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(inventory::utils::exportFormatFromString("json"), std::invalid_argument);
+}
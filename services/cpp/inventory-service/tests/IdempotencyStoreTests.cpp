@@ -0,0 +1,223 @@
+#include <catch2/catch_test_macros.hpp>
+#include "inventory/utils/IdempotencyStore.hpp"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
+
+using inventory::utils::IdempotencyLedger;
+using inventory::utils::IdempotencyRecord;
+using inventory::utils::IdempotencyStore;
+using inventory::utils::IdempotentResponse;
+
+namespace {
+
+// Ledger as another replica would see it: keys outlive the store
+class FakeLedger : public IdempotencyLedger {
+public:
+    std::map<std::pair<std::string, std::string>, IdempotencyRecord> records;
+    int released = 0;
+
+    std::optional<IdempotencyRecord> claim(const std::string& scope, const std::string& key,
+                                           const std::string& fingerprint,
+                                           std::chrono::milliseconds) override {
+        auto [it, inserted] = records.try_emplace({scope, key}, IdempotencyRecord{fingerprint, std::nullopt});
+        if (inserted) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void complete(const std::string& scope, const std::string& key,
+                  const IdempotentResponse& response) override {
+        records[{scope, key}].response = response;
+    }
+
+    void release(const std::string& scope, const std::string& key) override {
+        records.erase({scope, key});
+        ++released;
+    }
+
+    std::size_t purgeExpired() override { return 0; }
+};
+
+const std::string kScope = "POST /api/v1/inventory/3f2c9a1e-5b7d-4c8e-9f00-112233445566/reserve";
+
+} // namespace
+
+TEST_CASE("IdempotencyStore replays the response of a repeated request", "[idempotency]") {
+    IdempotencyStore store(nullptr);
+    int runs = 0;
+    auto handler = [&runs]() {
+        ++runs;
+        return IdempotentResponse{200, R"({"success":true,"reservedQuantity":5})"};
+    };
+
+    auto first = store.execute(kScope, "key-1", R"({"quantity":5})", handler);
+    auto retry = store.execute(kScope, "key-1", R"({"quantity":5})", handler);
+
+    REQUIRE(runs == 1);
+    REQUIRE_FALSE(first.replayed);
+    REQUIRE(retry.replayed);
+    REQUIRE(retry.response.status == 200);
+    REQUIRE(retry.response.body == first.response.body);
+
+    SECTION("keys are scoped per endpoint") {
+        auto other = store.execute("POST /api/v1/inventory/7a41d0c2-9e3b-4f6a-8d15-2c0b9e7f4a33/reserve", "key-1", R"({"quantity":5})", handler);
+        REQUIRE_FALSE(other.replayed);
+        REQUIRE(runs == 2);
+    }
+
+    SECTION("a different body under the same key is rejected") {
+        REQUIRE_THROWS_AS(store.execute(kScope, "key-1", R"({"quantity":6})", handler),
+                          inventory::utils::IdempotencyKeyReused);
+        REQUIRE(runs == 1);
+    }
+}
+
+TEST_CASE("IdempotencyStore validates keys", "[idempotency]") {
+    IdempotencyStore store(nullptr);
+    auto handler = []() { return IdempotentResponse{200, "{}"}; };
+
+    REQUIRE(IdempotencyStore::isValidKey("3f2c9a1e-5b7d-4c8e-9f00-112233445566"));
+    REQUIRE_FALSE(IdempotencyStore::isValidKey(""));
+    REQUIRE_FALSE(IdempotencyStore::isValidKey("has space"));
+    REQUIRE_FALSE(IdempotencyStore::isValidKey(std::string(256, 'k')));
+    REQUIRE_THROWS_AS(store.execute(kScope, "", "{}", handler), std::invalid_argument);
+}
+
+TEST_CASE("IdempotencyStore does not keep server errors", "[idempotency]") {
+    auto ledger = std::make_shared<FakeLedger>();
+    IdempotencyStore store(ledger);
+    int runs = 0;
+
+    auto failed = store.execute(kScope, "key-1", "{}", [&runs]() {
+        ++runs;
+        return IdempotentResponse{500, R"({"error":"Database unavailable"})"};
+    });
+    REQUIRE(failed.response.status == 500);
+    REQUIRE(ledger->records.empty());
+
+    auto retried = store.execute(kScope, "key-1", "{}", [&runs]() {
+        ++runs;
+        return IdempotentResponse{200, "{}"};
+    });
+    REQUIRE(runs == 2);
+    REQUIRE_FALSE(retried.replayed);
+    REQUIRE(ledger->records.at({kScope, "key-1"}).response->status == 200);
+
+    SECTION("nor requests whose handler throws") {
+        REQUIRE_THROWS_AS(store.execute(kScope, "key-2", "{}", []() -> IdempotentResponse {
+            throw std::runtime_error("connection lost");
+        }), std::runtime_error);
+        REQUIRE(ledger->released == 2);
+        REQUIRE(ledger->records.count({kScope, "key-2"}) == 0);
+    }
+}
+
+TEST_CASE("IdempotencyStore answers from the ledger after a restart", "[idempotency]") {
+    auto ledger = std::make_shared<FakeLedger>();
+    {
+        IdempotencyStore before(ledger);
+        before.execute(kScope, "key-1", "{}", []() { return IdempotentResponse{200, R"({"id":"a"})"}; });
+    }
+
+    IdempotencyStore after(ledger);
+    int runs = 0;
+    auto result = after.execute(kScope, "key-1", "{}", [&runs]() {
+        ++runs;
+        return IdempotentResponse{200, R"({"id":"b"})"};
+    });
+    REQUIRE(runs == 0);
+    REQUIRE(result.replayed);
+    REQUIRE(result.response.body == R"({"id":"a"})");
+
+    SECTION("while another replica still runs the request") {
+        ledger->records[{kScope, "key-2"}] = IdempotencyRecord{IdempotencyStore::fingerprint("{}"), std::nullopt};
+        REQUIRE_THROWS_AS(after.execute(kScope, "key-2", "{}", []() { return IdempotentResponse{200, "{}"}; }),
+                          inventory::utils::IdempotencyKeyInProgress);
+    }
+}
+
+TEST_CASE("IdempotencyStore reports a key released mid-claim as in progress", "[idempotency]") {
+    // The claim conflicts, then the holder releases before the ledger reads
+    // its row back; the ledger answers as the repository does in that race
+    class RacingLedger : public FakeLedger {
+    public:
+        bool raced = false;
+
+        std::optional<IdempotencyRecord> claim(const std::string& scope, const std::string& key,
+                                               const std::string& fingerprint,
+                                               std::chrono::milliseconds ttl) override {
+            if (!raced) {
+                raced = true;
+                return IdempotencyRecord::inProgress(fingerprint);
+            }
+            return FakeLedger::claim(scope, key, fingerprint, ttl);
+        }
+    };
+
+    auto ledger = std::make_shared<RacingLedger>();
+    IdempotencyStore store(ledger);
+    int runs = 0;
+    auto handler = [&runs]() {
+        ++runs;
+        return IdempotentResponse{200, "{}"};
+    };
+
+    REQUIRE_THROWS_AS(store.execute(kScope, "key-1", R"({"a":1})", handler),
+                      inventory::utils::IdempotencyKeyInProgress);
+    REQUIRE(runs == 0);
+    REQUIRE(ledger->released == 0);
+
+    // The key is free now, so the retry runs
+    auto retry = store.execute(kScope, "key-1", R"({"a":1})", handler);
+    REQUIRE(runs == 1);
+    REQUIRE_FALSE(retry.replayed);
+}
+
+TEST_CASE("IdempotencyStore collapses concurrent duplicates onto one run", "[idempotency]") {
+    IdempotencyStore store(nullptr);
+    std::atomic<int> runs{0};
+    std::vector<IdempotencyStore::Result> results(8);
+
+    // Assertions stay on the test thread; Catch2 is not thread-safe
+    std::vector<std::thread> clients;
+    for (auto& result : results) {
+        clients.emplace_back([&store, &runs, &result]() {
+            result = store.execute(kScope, "key-1", "{}", [&runs]() {
+                ++runs;
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                return IdempotentResponse{200, R"({"success":true,"reservedQuantity":5})"};
+            });
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    REQUIRE(runs == 1);
+    int replayed = 0;
+    for (const auto& result : results) {
+        REQUIRE(result.response.body == R"({"success":true,"reservedQuantity":5})");
+        replayed += result.replayed ? 1 : 0;
+    }
+    REQUIRE(replayed == 7);
+}
+
+TEST_CASE("IdempotencyStore forgets keys after their TTL", "[idempotency]") {
+    IdempotencyStore store(nullptr, std::chrono::milliseconds(20));
+    int runs = 0;
+    auto handler = [&runs]() {
+        ++runs;
+        return IdempotentResponse{200, "{}"};
+    };
+
+    store.execute(kScope, "key-1", "{}", handler);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    auto again = store.execute(kScope, "key-1", "{}", handler);
+
+    REQUIRE(runs == 2);
+    REQUIRE_FALSE(again.replayed);
+}
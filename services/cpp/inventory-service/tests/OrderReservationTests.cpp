@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "inventory/models/OrderReservation.hpp"
+
+using inventory::models::OrderReservationRequest;
+using inventory::models::StockCandidate;
+using inventory::models::planReservation;
+
+using Line = OrderReservationRequest::Line;
+
+TEST_CASE("planReservation drains stock rows in the order given", "[reservation]") {
+    // Rows arrive sorted first-expiry-first-out
+    std::vector<StockCandidate> stock{
+        {"inv-early", "p-1", 4},
+        {"inv-late", "p-1", 10},
+        {"inv-b", "p-2", 5},
+    };
+
+    auto plan = planReservation({{"line-1", "p-1", 6}, {"line-2", "p-2", 5}}, stock);
+
+    REQUIRE(plan.complete());
+    REQUIRE(plan.allocations.size() == 3);
+    REQUIRE(plan.allocations[0].inventoryId == "inv-early");
+    REQUIRE(plan.allocations[0].quantity == 4);
+    REQUIRE(plan.allocations[1].inventoryId == "inv-late");
+    REQUIRE(plan.allocations[1].quantity == 2);
+    REQUIRE(plan.allocations[2].lineItemId == "line-2");
+    REQUIRE(plan.allocations[2].quantity == 5);
+
+    SECTION("lines of the same product share rows without double counting") {
+        auto shared = planReservation({{"line-1", "p-1", 3}, {"line-3", "p-1", 3}}, stock);
+        REQUIRE(shared.complete());
+        REQUIRE(shared.allocations.size() == 3);
+        REQUIRE(shared.allocations[1].lineItemId == "line-3");
+        REQUIRE(shared.allocations[1].inventoryId == "inv-early");
+        REQUIRE(shared.allocations[1].quantity == 1);
+        REQUIRE(shared.allocations[2].inventoryId == "inv-late");
+        REQUIRE(shared.allocations[2].quantity == 2);
+    }
+}
+
+TEST_CASE("planReservation reserves nothing when any product is short", "[reservation]") {
+    std::vector<StockCandidate> stock{{"inv-a", "p-1", 10}, {"inv-b", "p-2", 2}};
+
+    auto plan = planReservation({{"line-1", "p-1", 4}, {"line-2", "p-2", 2}, {"line-3", "p-2", 1},
+                                 {"line-4", "p-3", 1}}, stock);
+
+    REQUIRE_FALSE(plan.complete());
+    REQUIRE(plan.allocations.empty());
+    REQUIRE(plan.shortages.size() == 2);
+    REQUIRE(plan.shortages[0].productId == "p-2");
+    REQUIRE(plan.shortages[0].requested == 3);
+    REQUIRE(plan.shortages[0].available == 2);
+    REQUIRE(plan.shortages[1].productId == "p-3");
+    REQUIRE(plan.shortages[1].available == 0);
+}
+
+TEST_CASE("OrderReservationRequest validates the command", "[reservation]") {
+    nlohmann::json command = {
+        {"orderId", "o-1"},
+        {"warehouseId", "wh-1"},
+        {"lines", {{{"lineItemId", "line-1"}, {"productId", "p-1"}, {"quantity", 2}}}}
+    };
+
+    auto request = OrderReservationRequest::fromJson(command);
+    REQUIRE(request.orderId == "o-1");
+    REQUIRE(request.lines.size() == 1);
+    REQUIRE(request.lines[0].quantity == 2);
+
+    SECTION("rejects a command without lines") {
+        command["lines"] = nlohmann::json::array();
+        REQUIRE_THROWS_AS(OrderReservationRequest::fromJson(command), std::invalid_argument);
+    }
+    SECTION("rejects a non-positive quantity") {
+        command["lines"][0]["quantity"] = 0;
+        REQUIRE_THROWS_AS(OrderReservationRequest::fromJson(command), std::invalid_argument);
+    }
+}
+
+TEST_CASE("planReservation throughput", "[reservation][!benchmark]") {
+    // A large B2B order: 200 lines over 50 products, 20 lots each
+    std::vector<Line> lines;
+    for (int i = 0; i < 200; ++i) {
+        lines.push_back({"line-" + std::to_string(i), "p-" + std::to_string(i % 50), 7});
+    }
+    std::vector<StockCandidate> stock;
+    for (int p = 0; p < 50; ++p) {
+        for (int lot = 0; lot < 20; ++lot) {
+            stock.push_back({"inv-" + std::to_string(p) + "-" + std::to_string(lot), "p-" + std::to_string(p), 5});
+        }
+    }
+
+    BENCHMARK("plan 200 lines against 1000 rows") {
+        return planReservation(lines, stock);
+    };
+}
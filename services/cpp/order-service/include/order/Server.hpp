@@ -6,6 +6,11 @@
 
 namespace order::services {
     class OrderService;
+    class WaveService;
+}
+
+namespace order::utils {
+    class IdempotencyStore;
 }
 
 namespace order {
@@ -19,7 +24,10 @@ struct Config {
 
 class Server {
 public:
-    Server(const Config& config, std::shared_ptr<services::OrderService> orderService);
+    Server(const Config& config,
+           std::shared_ptr<services::OrderService> orderService,
+           std::shared_ptr<services::WaveService> waveService,
+           std::shared_ptr<utils::IdempotencyStore> idempotency);
     ~Server();
     
     void start();
@@ -31,6 +39,8 @@ private:
     
     Config config_;
     std::shared_ptr<services::OrderService> orderService_;
+    std::shared_ptr<services::WaveService> waveService_;
+    std::shared_ptr<utils::IdempotencyStore> idempotency_;
     std::unique_ptr<Poco::Net::HTTPServer> httpServer_;
     bool running_ = false;
 };
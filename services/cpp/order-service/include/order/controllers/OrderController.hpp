@@ -1,5 +1,6 @@
 #pragma once
 
+#include "order/utils/IdempotencyStore.hpp"
 #include <Poco/Net/HTTPRequestHandler.h>
 #include <Poco/Net/HTTPServerRequest.h>
 #include <Poco/Net/HTTPServerResponse.h>
@@ -17,14 +18,25 @@ namespace order::controllers {
  * 
  * Handles:
  * - GET /api/v1/orders - List orders
+ * - GET /api/v1/orders/next - Next orders to release for a warehouse
+ * - GET /api/v1/orders/search - Combined criteria search with keyset pagination
+ * - GET /api/v1/orders/suggest - Order number type-ahead
+ * - GET /api/v1/orders/export - Stream matching order lines as CSV or NDJSON
  * - GET /api/v1/orders/:id - Get order by ID
  * - POST /api/v1/orders - Create new order
+ * - POST /api/v1/orders/bulk - Create orders from an NDJSON body
  * - PUT /api/v1/orders/:id - Update order
  * - POST /api/v1/orders/:id/cancel - Cancel order
+ * - POST /api/v1/orders/:id/sourcing - Plan a multi-warehouse split
+ *
+ * POST /api/v1/orders honours an Idempotency-Key header: a retry with the
+ * same key and body gets the first response back instead of a second order.
  */
 class OrderController : public Poco::Net::HTTPRequestHandler {
 public:
-    explicit OrderController(std::shared_ptr<services::OrderService> service);
+    // idempotency may be null, which ignores Idempotency-Key headers
+    OrderController(std::shared_ptr<services::OrderService> service,
+                    std::shared_ptr<utils::IdempotencyStore> idempotency);
     
     void handleRequest(Poco::Net::HTTPServerRequest& request,
                       Poco::Net::HTTPServerResponse& response) override;
@@ -33,6 +45,18 @@ private:
     void handleGetAll(Poco::Net::HTTPServerRequest& request,
                      Poco::Net::HTTPServerResponse& response);
     
+    void handleGetNext(Poco::Net::HTTPServerRequest& request,
+                      Poco::Net::HTTPServerResponse& response);
+    
+    void handleSearch(Poco::Net::HTTPServerRequest& request,
+                     Poco::Net::HTTPServerResponse& response);
+    
+    void handleSuggest(Poco::Net::HTTPServerRequest& request,
+                      Poco::Net::HTTPServerResponse& response);
+    
+    void handleExport(Poco::Net::HTTPServerRequest& request,
+                     Poco::Net::HTTPServerResponse& response);
+    
     void handleGetById(const std::string& id,
                       Poco::Net::HTTPServerRequest& request,
                       Poco::Net::HTTPServerResponse& response);
@@ -40,6 +64,12 @@ private:
     void handleCreate(Poco::Net::HTTPServerRequest& request,
                      Poco::Net::HTTPServerResponse& response);
     
+    // Runs the create and renders its outcome, errors included
+    utils::IdempotentResponse createOrder(const std::string& body);
+    
+    void handleBulkCreate(Poco::Net::HTTPServerRequest& request,
+                          Poco::Net::HTTPServerResponse& response);
+    
     void handleUpdate(const std::string& id,
                      Poco::Net::HTTPServerRequest& request,
                      Poco::Net::HTTPServerResponse& response);
@@ -48,6 +78,10 @@ private:
                      Poco::Net::HTTPServerRequest& request,
                      Poco::Net::HTTPServerResponse& response);
     
+    void handleSourcing(const std::string& id,
+                       Poco::Net::HTTPServerRequest& request,
+                       Poco::Net::HTTPServerResponse& response);
+    
     void sendJsonResponse(Poco::Net::HTTPServerResponse& response,
                          int status,
                          const std::string& body);
@@ -56,9 +90,8 @@ private:
                           int status,
                           const std::string& message);
     
-    std::string extractIdFromPath(const std::string& path);
-
     std::shared_ptr<services::OrderService> service_;
+    std::shared_ptr<utils::IdempotencyStore> idempotency_;
 };
 
 } // namespace order::controllers
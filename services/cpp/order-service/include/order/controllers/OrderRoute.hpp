@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+namespace order::controllers {
+
+/**
+ * @brief Order endpoint addressed by a request path, with the order id it names
+ *
+ * Matching looks at the path only (no query string, no method), so it can
+ * be tested without a server.
+ */
+struct OrderRoute {
+    enum class Endpoint {
+        Collection,   // /api/v1/orders
+        Next,         // /api/v1/orders/next
+        Search,       // /api/v1/orders/search
+        Suggest,      // /api/v1/orders/suggest
+        Export,       // /api/v1/orders/export
+        Bulk,         // /api/v1/orders/bulk
+        Order,        // /api/v1/orders/{id}
+        Cancel,       // /api/v1/orders/{id}/cancel
+        Sourcing,     // /api/v1/orders/{id}/sourcing
+        NotFound
+    };
+
+    Endpoint endpoint = Endpoint::NotFound;
+    std::string id;   // set for Order, Cancel and Sourcing
+
+    static OrderRoute match(const std::string& path);
+};
+
+} // namespace order::controllers
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <memory>
+#include <string>
+
+namespace order::services {
+    class WaveService; // Forward declaration
+}
+
+namespace order::controllers {
+
+/**
+ * @brief HTTP controller for wave planning
+ * 
+ * Handles:
+ * - POST /api/v1/warehouses/:id/waves/plan - Plan pick waves over pending orders
+ */
+class WaveController : public Poco::Net::HTTPRequestHandler {
+public:
+    explicit WaveController(std::shared_ptr<services::WaveService> service);
+    
+    void handleRequest(Poco::Net::HTTPServerRequest& request,
+                      Poco::Net::HTTPServerResponse& response) override;
+
+private:
+    void handlePlan(const std::string& warehouseId,
+                   Poco::Net::HTTPServerRequest& request,
+                   Poco::Net::HTTPServerResponse& response);
+    
+    void sendJsonResponse(Poco::Net::HTTPServerResponse& response,
+                         int status,
+                         const std::string& body);
+    
+    void sendErrorResponse(Poco::Net::HTTPServerResponse& response,
+                          int status,
+                          const std::string& message);
+    
+    // Warehouse id from /api/v1/warehouses/{id}/waves/plan, or empty if the path does not match
+    static std::string extractWarehouseIdFromPath(const std::string& path);
+
+    std::shared_ptr<services::WaveService> service_;
+};
+
+} // namespace order::controllers
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace order {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Outcome of one line of a bulk order upload
+ * 
+ * Conforms to BulkOrderItemResultDto contract v1.0
+ */
+class BulkOrderItemResultDto {
+public:
+    /**
+     * @param line Line number in the uploaded body (PositiveInteger)
+     * @param status created, rejected or failed
+     * @param orderNumber Order number on the line, when it could be read
+     * @param orderId Id of the created order; required when status is created
+     * @param message Why the line was not created
+     */
+    BulkOrderItemResultDto(int line,
+                           const std::string& status,
+                           const std::optional<std::string>& orderNumber,
+                           const std::optional<std::string>& orderId,
+                           const std::optional<std::string>& message);
+
+    int getLine() const { return line_; }
+    std::string getStatus() const { return status_; }
+    std::optional<std::string> getOrderNumber() const { return orderNumber_; }
+    std::optional<std::string> getOrderId() const { return orderId_; }
+    std::optional<std::string> getMessage() const { return message_; }
+
+    json toJson() const;
+
+private:
+    int line_;
+    std::string status_;
+    std::optional<std::string> orderNumber_;
+    std::optional<std::string> orderId_;
+    std::optional<std::string> message_;
+};
+
+/**
+ * @brief Outcome of a bulk order upload, one result per non-empty line
+ * 
+ * Conforms to BulkOrderResultDto contract v1.0
+ */
+class BulkOrderResultDto {
+public:
+    /**
+     * @param received Non-empty lines read (NonNegativeInteger)
+     * @param created Orders stored (NonNegativeInteger)
+     * @param rejected Lines that failed validation or duplicated an order number (NonNegativeInteger)
+     * @param failed Valid orders lost to a failed insert (NonNegativeInteger)
+     * @param results Per-line outcomes in input order
+     */
+    BulkOrderResultDto(int received,
+                       int created,
+                       int rejected,
+                       int failed,
+                       const std::vector<BulkOrderItemResultDto>& results);
+
+    int getReceived() const { return received_; }
+    int getCreated() const { return created_; }
+    int getRejected() const { return rejected_; }
+    int getFailed() const { return failed_; }
+    const std::vector<BulkOrderItemResultDto>& getResults() const { return results_; }
+
+    json toJson() const;
+
+private:
+    int received_;
+    int created_;
+    int rejected_;
+    int failed_;
+    std::vector<BulkOrderItemResultDto> results_;
+
+    void validateNonNegativeInteger(int value, const std::string& fieldName) const;
+};
+
+} // namespace dtos
+} // namespace order
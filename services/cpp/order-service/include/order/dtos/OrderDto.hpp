@@ -1,5 +1,6 @@
 #pragma once
 
+#include "order/models/Money.hpp"
 #include <string>
 #include <optional>
 #include <vector>
@@ -31,6 +32,7 @@ public:
      * @param status Order status
      * @param totalItems Total number of line items (NonNegativeInteger)
      * @param totalQuantity Total quantity across all items (NonNegativeInteger)
+     * @param total Order total; its currency is emitted alongside
      * @param createdAt Created timestamp (ISO 8601)
      * @param updatedAt Last updated timestamp (ISO 8601)
      * @param customerName Optional customer name
@@ -55,6 +57,7 @@ public:
              const std::string& status,
              int totalItems,
              int totalQuantity,
+             const models::Money& total,
              const std::string& createdAt,
              const std::string& updatedAt,
              const std::optional<std::string>& customerName = std::nullopt,
@@ -80,6 +83,7 @@ public:
     std::string getStatus() const { return status_; }
     int getTotalItems() const { return totalItems_; }
     int getTotalQuantity() const { return totalQuantity_; }
+    const models::Money& getTotal() const { return total_; }
     std::string getCreatedAt() const { return createdAt_; }
     std::string getUpdatedAt() const { return updatedAt_; }
     std::optional<std::string> getCustomerName() const { return customerName_; }
@@ -109,6 +113,7 @@ private:
     std::string status_;
     int totalItems_;
     int totalQuantity_;
+    models::Money total_;
     std::string createdAt_;
     std::string updatedAt_;
     
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace order {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Order numbers completing a type-ahead prefix
+ * 
+ * Conforms to OrderNumberSuggestionsDto contract v1.0
+ */
+class OrderNumberSuggestionsDto {
+public:
+    /**
+     * @param prefix Prefix the suggestions start with
+     * @param orderNumbers Matching order numbers in lexicographic order
+     * @param orderIds Order identifiers (UUID), parallel to orderNumbers
+     */
+    OrderNumberSuggestionsDto(const std::string& prefix,
+                              const std::vector<std::string>& orderNumbers,
+                              const std::vector<std::string>& orderIds);
+
+    std::string getPrefix() const { return prefix_; }
+    const std::vector<std::string>& getOrderNumbers() const { return orderNumbers_; }
+    const std::vector<std::string>& getOrderIds() const { return orderIds_; }
+
+    json toJson() const;
+
+private:
+    std::string prefix_;
+    std::vector<std::string> orderNumbers_;
+    std::vector<std::string> orderIds_;
+};
+
+} // namespace dtos
+} // namespace order
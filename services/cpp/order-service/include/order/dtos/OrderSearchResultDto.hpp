@@ -0,0 +1,43 @@
+#pragma once
+
+#include "order/dtos/OrderDto.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace order {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief One keyset page of order search results
+ * 
+ * Conforms to OrderSearchResultDto contract v1.0
+ */
+class OrderSearchResultDto {
+public:
+    /**
+     * @param items Matching orders, newest first
+     * @param limit Page size requested (PositiveInteger)
+     * @param nextCursor Opaque cursor for the following page; absent on the last page
+     */
+    OrderSearchResultDto(const std::vector<OrderDto>& items,
+                         int limit,
+                         const std::optional<std::string>& nextCursor);
+
+    const std::vector<OrderDto>& getItems() const { return items_; }
+    int getLimit() const { return limit_; }
+    std::optional<std::string> getNextCursor() const { return nextCursor_; }
+
+    json toJson() const;
+
+private:
+    std::vector<OrderDto> items_;
+    int limit_;
+    std::optional<std::string> nextCursor_;
+};
+
+} // namespace dtos
+} // namespace order
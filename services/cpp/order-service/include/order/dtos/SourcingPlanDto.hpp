@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace order {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Quantity of one order line in a shipment, or backordered
+ * 
+ * Conforms to SourcedLineDto contract v1.0
+ */
+class SourcedLineDto {
+public:
+    /**
+     * @param lineItemId Order line (UUID)
+     * @param productId Product on the line (UUID)
+     * @param quantity Units (PositiveInteger)
+     */
+    SourcedLineDto(const std::string& lineItemId, const std::string& productId, int quantity);
+
+    std::string getLineItemId() const { return lineItemId_; }
+    std::string getProductId() const { return productId_; }
+    int getQuantity() const { return quantity_; }
+
+    json toJson() const;
+
+private:
+    std::string lineItemId_;
+    std::string productId_;
+    int quantity_;
+};
+
+/**
+ * @brief A child shipment: the part of an order one warehouse fulfils
+ * 
+ * Conforms to ShipmentDto contract v1.0
+ */
+class ShipmentDto {
+public:
+    /**
+     * @param warehouseId Warehouse shipping these lines (UUID)
+     * @param lines Lines and quantities shipped (non-empty)
+     */
+    ShipmentDto(const std::string& warehouseId, const std::vector<SourcedLineDto>& lines);
+
+    std::string getWarehouseId() const { return warehouseId_; }
+    const std::vector<SourcedLineDto>& getLines() const { return lines_; }
+
+    json toJson() const;
+
+private:
+    std::string warehouseId_;
+    std::vector<SourcedLineDto> lines_;
+};
+
+/**
+ * @brief How an order is split across warehouses
+ * 
+ * Conforms to SourcingPlanDto contract v1.0
+ */
+class SourcingPlanDto {
+public:
+    /**
+     * @param orderId Order the plan is for (UUID)
+     * @param shipments Child shipments, most units first
+     * @param backordered Quantities no warehouse can promise
+     * @param cost Total shipment and unit cost (NonNegativeInteger)
+     * @param exact Whether the fewest shipments are proven, not just greedy
+     */
+    SourcingPlanDto(const std::string& orderId,
+                    const std::vector<ShipmentDto>& shipments,
+                    const std::vector<SourcedLineDto>& backordered,
+                    std::int64_t cost,
+                    bool exact);
+
+    std::string getOrderId() const { return orderId_; }
+    const std::vector<ShipmentDto>& getShipments() const { return shipments_; }
+    const std::vector<SourcedLineDto>& getBackordered() const { return backordered_; }
+    std::int64_t getCost() const { return cost_; }
+    bool isExact() const { return exact_; }
+
+    json toJson() const;
+
+private:
+    std::string orderId_;
+    std::vector<ShipmentDto> shipments_;
+    std::vector<SourcedLineDto> backordered_;
+    std::int64_t cost_;
+    bool exact_;
+};
+
+} // namespace dtos
+} // namespace order
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace order {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief One planned pick wave
+ * 
+ * Conforms to WaveDto contract v1.0
+ */
+class WaveDto {
+public:
+    /**
+     * @param waveNumber Position in pick order, from 1 (PositiveInteger)
+     * @param priority Priority shared by every order in the wave
+     * @param dueByCutoff Whether the orders ship at or before the requested cut-off
+     * @param earliestShipBy Earliest ship-by date in the wave (ISO 8601)
+     * @param orderIds Orders in the wave (non-empty)
+     * @param orderNumbers Order numbers, parallel to orderIds
+     * @param lineCount Line items across the wave (PositiveInteger)
+     * @param stopCount Distinct SKUs, i.e. pick stops (PositiveInteger)
+     */
+    WaveDto(int waveNumber,
+            const std::string& priority,
+            bool dueByCutoff,
+            const std::optional<std::string>& earliestShipBy,
+            const std::vector<std::string>& orderIds,
+            const std::vector<std::string>& orderNumbers,
+            int lineCount,
+            int stopCount);
+
+    int getWaveNumber() const { return waveNumber_; }
+    std::string getPriority() const { return priority_; }
+    bool isDueByCutoff() const { return dueByCutoff_; }
+    std::optional<std::string> getEarliestShipBy() const { return earliestShipBy_; }
+    const std::vector<std::string>& getOrderIds() const { return orderIds_; }
+    const std::vector<std::string>& getOrderNumbers() const { return orderNumbers_; }
+    int getLineCount() const { return lineCount_; }
+    int getStopCount() const { return stopCount_; }
+
+    json toJson() const;
+
+private:
+    int waveNumber_;
+    std::string priority_;
+    bool dueByCutoff_;
+    std::optional<std::string> earliestShipBy_;
+    std::vector<std::string> orderIds_;
+    std::vector<std::string> orderNumbers_;
+    int lineCount_;
+    int stopCount_;
+};
+
+/**
+ * @brief Waves planned for one warehouse's pending orders
+ * 
+ * Conforms to WavePlanDto contract v1.0
+ */
+class WavePlanDto {
+public:
+    /**
+     * @param warehouseId Warehouse the plan is for (UUID)
+     * @param orderCount Pending orders planned (NonNegativeInteger)
+     * @param waves Waves in pick order
+     */
+    WavePlanDto(const std::string& warehouseId,
+                int orderCount,
+                const std::vector<WaveDto>& waves);
+
+    std::string getWarehouseId() const { return warehouseId_; }
+    int getOrderCount() const { return orderCount_; }
+    const std::vector<WaveDto>& getWaves() const { return waves_; }
+
+    json toJson() const;
+
+private:
+    std::string warehouseId_;
+    int orderCount_;
+    std::vector<WaveDto> waves_;
+};
+
+} // namespace dtos
+} // namespace order
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+using json = nlohmann::json;
+
+namespace order {
+namespace models {
+
+/**
+ * @brief Exact monetary amount in minor units (cents) of an ISO 4217 currency
+ *
+ * Amounts are whole int64 counts of 1/100ths, matching the DECIMAL(12, 2)
+ * columns they are stored in, so sums and products never drift. Arithmetic
+ * between different currencies and results outside int64 throw
+ * std::invalid_argument. Text goes through std::from_chars / std::to_chars;
+ * no value read from or written to the database passes through a double.
+ */
+class Money {
+public:
+    static constexpr int kScale = 2;
+    static constexpr std::int64_t kMinorPerMajor = 100;
+    static constexpr std::string_view kDefaultCurrency = "USD";
+
+    // Longest format() output: sign, 17 integer digits, point, 2 decimals
+    static constexpr std::size_t kMaxFormattedLength = 21;
+
+    Money() = default;
+    explicit Money(std::int64_t minorUnits, std::string_view currency = kDefaultCurrency);
+
+    /**
+     * @brief Parse a plain decimal such as "12.5", "-0.07" or "1200"
+     * @throws std::invalid_argument on anything else, or more than kScale decimals
+     */
+    static Money parse(std::string_view amount, std::string_view currency = kDefaultCurrency);
+
+    // Nearest minor unit; for JSON request bodies, which carry amounts as numbers
+    static Money fromDouble(double amount, std::string_view currency = kDefaultCurrency);
+
+    // Accepts a JSON number (major units) or a decimal string, which is parsed exactly
+    static Money fromJson(const json& j, std::string_view currency = kDefaultCurrency);
+
+    std::int64_t minorUnits() const { return minor_; }
+    std::string_view currency() const { return {currency_.data(), currency_.size()}; }
+    bool isNegative() const { return minor_ < 0; }
+
+    // Closest double; exact to the cent below 2^53 minor units
+    double toDouble() const;
+
+    /**
+     * @brief Write the amount as a plain decimal with exactly kScale decimals
+     * @return One past the last character written; [first, last) must hold
+     *         kMaxFormattedLength characters
+     */
+    char* format(char* first, char* last) const;
+    std::string toString() const;
+
+    Money& operator+=(const Money& other);
+    Money& operator-=(const Money& other);
+    Money operator+(const Money& other) const;
+    Money operator-(const Money& other) const;
+    Money operator*(std::int64_t quantity) const;
+
+    bool operator==(const Money& other) const = default;
+
+    static bool isValidCurrency(std::string_view currency);
+
+private:
+    std::int64_t minor_ = 0;
+    std::array<char, 3> currency_{'U', 'S', 'D'};
+
+    void requireSameCurrency(const Money& other) const;
+};
+
+} // namespace models
+} // namespace order
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "order/models/Money.hpp"
 #include <nlohmann/json.hpp>
 #include <string>
 #include <optional>
@@ -56,17 +57,18 @@ struct OrderLineItem {
     std::string productSku;
     std::string productName;
     int quantity;
-    double unitPrice;
-    double lineTotal;
+    Money unitPrice;
+    Money lineTotal;    // unitPrice * quantity
     std::optional<std::string> notes;
 
     OrderLineItem() = default;
     OrderLineItem(const std::string& id, const std::string& productId, 
                   const std::string& productSku, const std::string& productName,
-                  int quantity, double unitPrice);
+                  int quantity, const Money& unitPrice);
 
     json toJson() const;
-    static OrderLineItem fromJson(const json& j);
+    // Prices carry the currency of their order
+    static OrderLineItem fromJson(const json& j, std::string_view currency = Money::kDefaultCurrency);
 };
 
 class Order {
@@ -83,7 +85,8 @@ public:
     std::string getWarehouseId() const { return warehouseId_; }
     OrderStatus getStatus() const { return status_; }
     std::string getOrderDate() const { return orderDate_; }
-    double getTotal() const { return total_; }
+    const Money& getTotal() const { return total_; }
+    std::string_view getCurrency() const { return total_.currency(); }
     OrderPriority getPriority() const { return priority_; }
     
     std::optional<std::string> getWarehouseCode() const { return warehouseCode_; }
@@ -103,7 +106,7 @@ public:
     void setWarehouseId(const std::string& warehouseId) { warehouseId_ = warehouseId; }
     void setStatus(OrderStatus status) { status_ = status; }
     void setOrderDate(const std::string& orderDate) { orderDate_ = orderDate; }
-    void setTotal(double total) { total_ = total; }
+    void setTotal(const Money& total) { total_ = total; }
     void setPriority(OrderPriority priority) { priority_ = priority; }
     
     void setWarehouseCode(const std::optional<std::string>& code) { warehouseCode_ = code; }
@@ -118,6 +121,7 @@ public:
     void addLineItem(const OrderLineItem& item) { lineItems_.push_back(item); }
 
     // Business methods
+    // Exact sum of line totals; throws std::invalid_argument if a line's currency differs
     void calculateTotal();
     bool canBeCancelled() const;
     void cancel(const std::string& reason);
@@ -133,7 +137,7 @@ private:
     std::string warehouseId_;
     OrderStatus status_ = OrderStatus::PENDING;
     std::string orderDate_;
-    double total_ = 0.0;
+    Money total_;
     OrderPriority priority_ = OrderPriority::NORMAL;
     
     std::optional<std::string> warehouseCode_;
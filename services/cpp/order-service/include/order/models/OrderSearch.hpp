@@ -0,0 +1,44 @@
+#pragma once
+
+#include "order/models/Order.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace order {
+namespace models {
+
+/**
+ * @brief Composable order search; unset criteria match every order
+ *
+ * Results are always newest first, ordered by (orderDate, id) descending,
+ * which is also the keyset the search pages on.
+ */
+struct OrderSearchCriteria {
+    std::vector<OrderStatus> statuses;                // any of these
+    std::optional<std::string> customerId;
+    std::optional<std::string> warehouseId;
+    std::optional<OrderPriority> priority;
+    std::optional<std::string> orderDateFrom;         // inclusive, ISO 8601
+    std::optional<std::string> orderDateTo;           // exclusive, ISO 8601
+    std::optional<std::string> orderNumberPrefix;
+};
+
+/**
+ * @brief Position after the last order of a page
+ *
+ * orderDate keeps microseconds so orders placed within the same second
+ * still page strictly.
+ */
+struct OrderCursor {
+    std::string orderDate;   // YYYY-MM-DDTHH:MM:SS.ffffff
+    std::string id;
+};
+
+struct OrderSearchPage {
+    std::vector<Order> items;
+    std::optional<OrderCursor> next;   // absent on the last page
+};
+
+} // namespace models
+} // namespace order
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace order {
+namespace models {
+
+// One order line to source
+struct SourcingLine {
+    std::string lineItemId;
+    std::string productId;
+    int quantity = 0;
+};
+
+// Available-to-promise quantity of one product in one warehouse
+struct WarehouseStock {
+    std::string warehouseId;
+    std::string productId;
+    int available = 0;
+};
+
+/**
+ * @brief What shipping from a warehouse costs, in whole cost units
+ *
+ * Warehouses without an entry use SourcingOptions' defaults.
+ */
+struct WarehouseCost {
+    std::string warehouseId;
+    std::int64_t shipmentCost = 0;   // per shipment, e.g. handling and carrier base rate
+    std::int64_t unitCost = 0;       // per unit shipped, e.g. distance to the customer
+};
+
+struct SourcingOptions {
+    std::int64_t defaultShipmentCost = 100;
+    std::int64_t defaultUnitCost = 1;
+    // Up to this many candidate warehouses the fewest-shipment plan is found exactly
+    std::size_t maxExactWarehouses = 12;
+};
+
+// Quantity of one order line, by index into the planner's input
+struct SourcedLine {
+    std::size_t line = 0;
+    int quantity = 0;
+};
+
+// A child shipment: the part of the order one warehouse fulfils
+struct Shipment {
+    std::string warehouseId;
+    std::vector<SourcedLine> lines;
+    int units = 0;
+};
+
+struct SourcingPlan {
+    std::vector<Shipment> shipments;       // most units first
+    std::vector<SourcedLine> backordered;  // quantities no warehouse can promise
+    std::int64_t cost = 0;
+    bool exact = false;                    // false when only the greedy pass ran
+};
+
+} // namespace models
+} // namespace order
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "order/models/Order.hpp"
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace order {
+namespace models {
+
+/**
+ * @brief Command asking inventory-service to reserve stock for a whole order
+ *
+ * Published as order.inventory.reserve when an order is created. Every line
+ * travels in one message and inventory-service applies them in one
+ * transaction, so an order is either fully reserved or not at all.
+ * Conforms to StockReservationRequestDto contract v1.0
+ */
+struct StockReservationRequest {
+    struct Line {
+        std::string lineItemId;
+        std::string productId;
+        int quantity = 0;
+    };
+
+    std::string orderId;
+    std::string warehouseId;
+    std::vector<Line> lines;
+
+    static StockReservationRequest fromOrder(const Order& order);
+    json toJson() const;
+};
+
+/**
+ * @brief Reply to a reservation request, consumed from inventory-service
+ *
+ * inventory.order.reserved carries reserved = true; on
+ * inventory.order.reservation-failed, reason says what was short.
+ */
+struct StockReservationReply {
+    std::string orderId;
+    bool reserved = false;
+    std::optional<std::string> reason;
+
+    /**
+     * @throws std::invalid_argument if orderId is missing
+     */
+    static StockReservationReply fromJson(const json& j, bool reserved);
+};
+
+} // namespace models
+} // namespace order
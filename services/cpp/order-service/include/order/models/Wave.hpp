@@ -0,0 +1,50 @@
+#pragma once
+
+#include "order/models/Order.hpp"
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace order {
+namespace models {
+
+/**
+ * @brief What the wave planner needs to know about one open order
+ *
+ * A lean projection of Order: one SKU per line item, in line order.
+ */
+struct WaveOrder {
+    std::string id;
+    std::string orderNumber;
+    OrderPriority priority = OrderPriority::NORMAL;
+    std::optional<std::chrono::system_clock::time_point> shipByDate;
+    std::vector<std::string> skus;
+};
+
+/**
+ * @brief Limits every planned wave must respect
+ *
+ * Pick stops are counted as distinct SKUs in the wave, the closest
+ * measure of pick-route length available to order-service.
+ */
+struct WaveConstraints {
+    // Orders due to ship at or before the cut-off are never mixed with later ones
+    std::optional<std::chrono::system_clock::time_point> cutoff;
+    std::size_t maxLinesPerWave = 200;
+    std::size_t maxStopsPerWave = 60;
+    std::size_t maxOrdersPerWave = 50;
+};
+
+struct Wave {
+    OrderPriority priority = OrderPriority::NORMAL;
+    bool dueByCutoff = false;
+    std::optional<std::chrono::system_clock::time_point> earliestShipBy;
+    std::vector<std::size_t> orders;   // indexes into the planner's input
+    std::size_t lineCount = 0;
+    std::size_t stopCount = 0;
+};
+
+} // namespace models
+} // namespace order
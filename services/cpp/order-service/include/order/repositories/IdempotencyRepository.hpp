@@ -0,0 +1,37 @@
+#pragma once
+
+#include "order/utils/IdempotencyStore.hpp"
+#include <pqxx/pqxx>
+#include <memory>
+#include <mutex>
+
+namespace order::repositories {
+
+/**
+ * @brief idempotency_keys table, the durable ledger behind IdempotencyStore
+ *
+ * Owns its own connection so key checks never queue behind order queries.
+ * A claim inserts the key with no response; an expired key may be taken
+ * over by the next claim. All statements are prepared once on the connection.
+ */
+class IdempotencyRepository : public utils::IdempotencyLedger {
+public:
+    explicit IdempotencyRepository(std::shared_ptr<pqxx::connection> db);
+
+    std::optional<utils::IdempotencyRecord> claim(const std::string& scope,
+                                                  const std::string& key,
+                                                  const std::string& fingerprint,
+                                                  std::chrono::milliseconds ttl) override;
+    void complete(const std::string& scope, const std::string& key,
+                  const utils::IdempotentResponse& response) override;
+    void release(const std::string& scope, const std::string& key) override;
+    std::size_t purgeExpired() override;
+
+private:
+    std::shared_ptr<pqxx::connection> db_;
+    std::mutex mutex_;   // pqxx connections are not safe to share between threads
+
+    void prepareStatements();
+};
+
+} // namespace order::repositories
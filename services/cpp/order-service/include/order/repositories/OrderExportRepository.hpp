@@ -0,0 +1,52 @@
+#pragma once
+
+#include "order/models/OrderSearch.hpp"
+#include "order/utils/ExportWriter.hpp"
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace order::repositories {
+
+/**
+ * @brief Reads order lines for exports through a server-side cursor
+ *
+ * Each export opens its own connection and holds it for as long as the
+ * client keeps reading, so a long download never blocks order queries on
+ * the shared connection. Rows come kFetchSize at a time; the next FETCH is
+ * only issued once the handler has returned, so a slow client slows the
+ * cursor down instead of the rows piling up in memory.
+ */
+class OrderExportRepository {
+public:
+    using Row = std::vector<std::optional<std::string>>;
+    // Called once per fetch, at least once even when nothing matches
+    using BatchHandler = std::function<void(const std::vector<Row>& rows)>;
+
+    static constexpr std::size_t kFetchSize = 500;
+
+    explicit OrderExportRepository(std::string connectionString);
+
+    /**
+     * @brief Every column an order export can project
+     *
+     * One row per line item; header columns repeat on each line, and an
+     * order without lines gives one row with the line columns null.
+     */
+    static const std::vector<utils::ExportColumn>& columns();
+
+    /**
+     * @brief Order lines matching criteria, oldest order first, projected onto columns
+     * @throws std::invalid_argument for a malformed warehouse id
+     */
+    void exportLines(const models::OrderSearchCriteria& criteria,
+                     const std::vector<utils::ExportColumn>& columns,
+                     const BatchHandler& onBatch);
+
+private:
+    std::string connectionString_;
+};
+
+} // namespace order::repositories
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "order/utils/OrderNumberAllocator.hpp"
+#include <pqxx/pqxx>
+#include <memory>
+#include <mutex>
+
+namespace order::repositories {
+
+/**
+ * @brief order_number_blocks table, the durable high-water mark behind OrderNumberAllocator
+ *
+ * Reserving a block is one UPDATE ... RETURNING on a single row, whose row
+ * lock serialises replicas. Blocks may differ in size between replicas.
+ * Owns its own connection so a reservation never queues behind order queries.
+ */
+class OrderNumberBlockRepository : public utils::OrderNumberBlockSource {
+public:
+    explicit OrderNumberBlockRepository(std::shared_ptr<pqxx::connection> db);
+
+    std::int64_t reserveBlock(std::size_t size) override;
+
+private:
+    std::shared_ptr<pqxx::connection> db_;
+    std::mutex mutex_;   // pqxx connections are not safe to share between threads
+};
+
+} // namespace order::repositories
@@ -1,30 +1,132 @@
 #pragma once
 
 #include "order/models/Order.hpp"
+#include "order/models/OrderSearch.hpp"
+#include "order/models/Wave.hpp"
+#include <pqxx/pqxx>
+#include <cstdint>
+#include <mutex>
 #include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 #include <memory>
 
 namespace order::repositories {
 
+// create hit the order_number unique constraint; a client error unless the number was allocated
+class OrderNumberTaken : public std::invalid_argument {
+public:
+    using std::invalid_argument::invalid_argument;
+};
+
+/**
+ * @brief Optional filters for order list queries; unset fields match everything
+ */
+struct OrderFilter {
+    std::optional<std::string> status;
+    std::optional<std::string> customerId;
+    std::optional<std::string> warehouseId;
+};
+
+/**
+ * @brief One page of orders plus the total number matching the filter
+ */
+struct OrderPage {
+    std::vector<models::Order> items;
+    std::int64_t totalCount = 0;
+};
+
 /**
  * @brief Repository for order data access
+ *
+ * An order and its line items are always read together: single orders in
+ * one query with the lines aggregated by json_agg, lists as one query for
+ * the page of orders plus one batched query for all of their lines. Line
+ * items are written with a single multi-row INSERT. All statements are
+ * prepared once on the connection. Bulk loads bypass the prepared inserts
+ * and COPY orders and lines in a single transaction.
  */
 class OrderRepository {
 public:
-    OrderRepository() = default;
-    
+    explicit OrderRepository(std::shared_ptr<pqxx::connection> db);
+
     // CRUD operations
     std::optional<models::Order> findById(const std::string& id);
     std::vector<models::Order> findAll();
     models::Order create(const models::Order& order);
     models::Order update(const models::Order& order);
     bool deleteById(const std::string& id);
-    
-    // Query operations
-    std::vector<models::Order> findByStatus(const std::string& status);
-    std::vector<models::Order> findByCustomerId(const std::string& customerId);
-    std::vector<models::Order> findByWarehouseId(const std::string& warehouseId);
+
+    /**
+     * @brief Store order's status and cancellation reason if it is still in expected
+     * @return The updated order, or std::nullopt if its status had already changed
+     */
+    std::optional<models::Order> transitionStatus(const models::Order& order, models::OrderStatus expected);
+
+    /**
+     * @brief Orders matching filter, newest first
+     * @param limit Page size; std::nullopt returns every match
+     */
+    OrderPage findPage(const OrderFilter& filter, std::optional<int> limit, int offset);
+
+    /**
+     * @brief Orders matching criteria, newest first, starting after a cursor
+     *
+     * Pages by keyset on (order_date, id), so deep pages cost the same as
+     * the first. Each combination of criteria gets its own statement,
+     * prepared on first use, so the planner sees plain predicates that match
+     * the composite indexes rather than "$n IS NULL OR ..." guards.
+     */
+    models::OrderSearchPage search(const models::OrderSearchCriteria& criteria,
+                                   const std::optional<models::OrderCursor>& after, int limit);
+
+    /**
+     * @brief Append an " AND ..." predicate to sql for each criterion set
+     *
+     * The query must alias orders as o. Placeholders continue from
+     * `placeholders`, which is advanced past the ones used.
+     * @return One bit per criterion set, identifying the statement's shape
+     * @throws std::invalid_argument for a malformed warehouse id
+     */
+    static unsigned appendCriteria(const models::OrderSearchCriteria& criteria, std::string& sql,
+                                   pqxx::params& params, int& placeholders);
+
+    // Every order as (id, order number), for the type-ahead index
+    std::vector<std::pair<std::string, std::string>> findOrderNumbers();
+
+    // Orders with their lines, in the order of ids; unknown ids are skipped
+    std::vector<models::Order> findByIds(const std::vector<std::string>& ids);
+
+    // Pending and confirmed orders without line items, for the release queue
+    std::vector<models::Order> findReleasable();
+
+    // Pending orders of a warehouse reduced to what wave planning needs
+    std::vector<models::WaveOrder> findWaveOrders(const std::string& warehouseId);
+
+    // Which of orderNumbers are already taken, in one round trip
+    std::vector<std::string> findExistingOrderNumbers(const std::vector<std::string>& orderNumbers);
+
+    /**
+     * @brief COPY fully-formed orders and their lines in one transaction
+     *
+     * Orders must already carry their ids, line item ids and order date.
+     * Either every order is stored or none is.
+     */
+    void bulkInsert(const std::vector<models::Order>& orders);
+
+private:
+    std::shared_ptr<pqxx::connection> db_;
+    std::mutex mutex_;   // pqxx connections are not safe to share between threads
+    std::unordered_set<unsigned> preparedSearches_;   // criteria shapes already prepared
+
+    void prepareStatements();
+    std::optional<models::Order> findByIdLocked(pqxx::transaction_base& txn, const std::string& id);
+    void attachLineItems(pqxx::transaction_base& txn, std::vector<models::Order>& orders);
+    void insertLineItems(pqxx::transaction_base& txn, const std::string& orderId,
+                         const std::vector<models::OrderLineItem>& lineItems);
 };
 
 } // namespace order::repositories
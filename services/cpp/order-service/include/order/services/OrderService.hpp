@@ -1,13 +1,36 @@
 #pragma once
 
 #include "order/models/Order.hpp"
+#include "order/models/OrderSearch.hpp"
+#include "order/models/Sourcing.hpp"
+#include "order/models/StockReservation.hpp"
 #include "order/dtos/OrderDto.hpp"
+#include "order/dtos/OrderListDto.hpp"
+#include "order/dtos/OrderSearchResultDto.hpp"
+#include "order/dtos/OrderNumberSuggestionsDto.hpp"
+#include "order/dtos/BulkOrderResultDto.hpp"
+#include "order/dtos/SourcingPlanDto.hpp"
+#include "order/services/SourcingPlanner.hpp"
+#include "order/utils/BulkOrderParser.hpp"
+#include "order/utils/ExportWriter.hpp"
+#include "order/utils/FulfilmentQueue.hpp"
+#include "order/utils/OrderNumberAllocator.hpp"
+#include "order/utils/OrderNumberTrie.hpp"
+#include <cstddef>
+#include <functional>
+#include <istream>
 #include <optional>
+#include <ostream>
 #include <vector>
 #include <memory>
 
 namespace order::repositories {
     class OrderRepository; // Forward declaration
+    class OrderExportRepository;
+}
+
+namespace order::utils {
+    class MessageBus; // Forward declaration
 }
 
 namespace order::services {
@@ -20,20 +43,164 @@ namespace order::services {
  */
 class OrderService {
 public:
-    explicit OrderService(std::shared_ptr<repositories::OrderRepository> repository);
+    // Without a numberAllocator every order must bring its own order number;
+    // without exports, exportOrders is unavailable
+    explicit OrderService(std::shared_ptr<repositories::OrderRepository> repository,
+                          std::shared_ptr<utils::MessageBus> messageBus = nullptr,
+                          std::shared_ptr<utils::OrderNumberAllocator> numberAllocator = nullptr,
+                          std::shared_ptr<repositories::OrderExportRepository> exports = nullptr);
     
-    // CRUD operations - return DTOs, not models
+    // CRUD operations - return DTOs, not models.
+    // An order created without an order number is given the next allocated one;
+    // a supplied number in the allocator's format is rejected.
     std::optional<dtos::OrderDto> getById(const std::string& id);
     std::vector<dtos::OrderDto> getAll();
     dtos::OrderDto create(const models::Order& order);
     dtos::OrderDto update(const models::Order& order);
     bool deleteById(const std::string& id);
     
+    /**
+     * @brief One page of orders, newest first; unset filters match everything
+     * @throws std::invalid_argument if page < 1 or pageSize is outside 1..kMaxPageSize
+     */
+    dtos::OrderListDto list(const std::optional<std::string>& status,
+                            const std::optional<std::string>& customerId,
+                            const std::optional<std::string>& warehouseId,
+                            int page,
+                            int pageSize);
+    
+    static constexpr int kDefaultPageSize = 50;
+    static constexpr int kMaxPageSize = 500;
+    
+    /**
+     * @brief Orders matching every given criterion, newest first, one keyset page at a time
+     *
+     * Pass the nextCursor of one page to get the following one; the cost of
+     * a page does not grow with how deep it is.
+     * @throws std::invalid_argument on a malformed date, prefix or cursor, or limit outside 1..kMaxPageSize
+     */
+    dtos::OrderSearchResultDto search(const models::OrderSearchCriteria& criteria,
+                                      const std::optional<std::string>& cursor,
+                                      int limit);
+    
+    /**
+     * @brief Stream every order line matching criteria, oldest order first
+     *
+     * The request is validated in full before open is called, so a bad
+     * request can still be answered with an error. After that rows go out a
+     * cursor fetch at a time and the stream is flushed after each, so memory
+     * stays flat and a slow reader holds the cursor back.
+     * @param columns Column names to project, in order; empty exports every column
+     * @param open Called once, just before the first row, for the stream to write to
+     * @return Rows written
+     * @throws std::invalid_argument on a malformed date or prefix, or an unknown or repeated column
+     */
+    std::size_t exportOrders(const models::OrderSearchCriteria& criteria,
+                             utils::ExportFormat format,
+                             const std::vector<std::string>& columns,
+                             const std::function<std::ostream&()>& open);
+    
+    /**
+     * @brief Rebuild the order number index from the database; call once at startup
+     */
+    void loadOrderNumberIndex();
+    
+    /**
+     * @brief Order numbers starting with prefix, for type-ahead
+     *
+     * Served from the in-memory trie, which every create and update in this
+     * service keeps current. The prefix is upper-cased first.
+     * @throws std::invalid_argument if prefix is not 1-50 of [A-Z0-9-] or limit is outside 1..kMaxSuggestions
+     */
+    dtos::OrderNumberSuggestionsDto suggestOrderNumbers(const std::string& prefix, int limit);
+    
+    static constexpr int kDefaultSuggestions = 10;
+    static constexpr int kMaxSuggestions = 50;
+    
+    /**
+     * @brief Create orders from an NDJSON stream of CreateOrderRequest bodies
+     *
+     * The stream is consumed kBulkChunkSize lines at a time: each chunk is
+     * validated in parallel, checked for order numbers already used in the
+     * upload or the database or in the allocator's format, then stored with one COPY transaction and
+     * announced with one batch of order.created events. Lines without an
+     * order number are numbered from the allocator. A chunk whose insert
+     * fails is reported as failed as a whole; earlier chunks stay committed.
+     */
+    dtos::BulkOrderResultDto createBulk(std::istream& input);
+    
+    static constexpr std::size_t kBulkChunkSize = 1000;
+    
+    /**
+     * @brief Rebuild the release queue from the database; call once at startup
+     */
+    void loadFulfilmentQueue();
+    
+    /**
+     * @brief The next orders to release for a warehouse, most urgent first
+     *
+     * Served from the in-memory release queue, which every create, update
+     * and cancel in this service keeps in step with order status.
+     * @throws std::invalid_argument if warehouseId is empty or limit is outside 1..kMaxNextLimit
+     */
+    dtos::OrderListDto nextToRelease(const std::string& warehouseId, int limit);
+    
+    static constexpr int kDefaultNextLimit = 20;
+    static constexpr int kMaxNextLimit = 200;
+    
     // Business operations - return DTOs
+    
+    // Cancels the order and asks inventory-service to release its stock
     dtos::OrderDto cancelOrder(const std::string& id, const std::string& reason);
     
+    /**
+     * @brief Settle a pending order with inventory-service's reservation reply
+     *
+     * Reserved moves the order to confirmed; a failure cancels it. A reply
+     * for an order cancelled in the meantime releases the stock again.
+     * Replies for orders no longer pending are otherwise ignored, so a
+     * redelivered reply is harmless.
+     */
+    void applyStockReservation(const models::StockReservationReply& reply);
+    
+    /**
+     * @brief Split an order across warehouses by available-to-promise stock
+     *
+     * Plans are computed on demand and not stored; the order keeps its
+     * warehouse until the caller acts on the plan.
+     * @param stock Available quantity per (warehouse, product), e.g. from inventory-service's ATP query
+     * @param costs Per-warehouse shipment and unit costs; warehouses left out use the defaults
+     * @throws std::runtime_error if the order does not exist
+     * @throws std::invalid_argument if the order is no longer open
+     */
+    dtos::SourcingPlanDto planSourcing(const std::string& id,
+                                       const std::vector<models::WarehouseStock>& stock,
+                                       const std::vector<models::WarehouseCost>& costs);
+    
+    // Routing keys, published under the order. prefix
+    static constexpr const char* kCreatedRoutingKey = "created";
+    static constexpr const char* kReserveStockRoutingKey = "inventory.reserve";
+    static constexpr const char* kReleaseStockRoutingKey = "inventory.release";
+    
 private:
+    // Re-reads allowed when a concurrent status change beats a cancel
+    static constexpr int kCancelAttempts = 3;
+    // Numbers drawn for one create before a unique violation is reported
+    static constexpr int kCreateAttempts = 3;
+    
     std::shared_ptr<repositories::OrderRepository> repository_;
+    std::shared_ptr<utils::MessageBus> messageBus_;
+    utils::BulkOrderParser bulkParser_;
+    utils::FulfilmentQueue queue_;
+    utils::OrderNumberTrie orderNumbers_;
+    std::shared_ptr<utils::OrderNumberAllocator> numberAllocator_;
+    SourcingPlanner sourcingPlanner_;
+    std::shared_ptr<repositories::OrderExportRepository> exports_;
+    
+    // Throws std::invalid_argument when no allocator is configured
+    std::string allocateOrderNumber(const std::string& warehouseId);
+    // False when no allocator is configured
+    bool isGeneratedOrderNumber(const std::string& orderNumber) const;
 };
 
 } // namespace order::services
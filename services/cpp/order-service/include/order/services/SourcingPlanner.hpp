@@ -0,0 +1,37 @@
+#pragma once
+
+#include "order/models/Sourcing.hpp"
+#include <vector>
+
+namespace order::services {
+
+/**
+ * @brief Splits an order across warehouses when no single one can fill it
+ *
+ * The plan uses as few shipments as possible and, among plans with that
+ * many shipments, the cheapest. Quantities no warehouse can promise are
+ * backordered rather than failing the plan. A line is only split between
+ * warehouses when none of the chosen ones holds all of it.
+ *
+ * A greedy pass picks, one at a time, the warehouse that covers the most
+ * outstanding units; it bounds the number of shipments. With no more than
+ * SourcingOptions::maxExactWarehouses candidates, every smaller warehouse
+ * set is then tried, so the shipment count is optimal rather than greedy.
+ * Within a chosen set each product is filled from its cheapest warehouse
+ * first, which is optimal for per-unit costs.
+ *
+ * Stateless; safe to share between threads.
+ */
+class SourcingPlanner {
+public:
+    explicit SourcingPlanner(models::SourcingOptions options = {});
+
+    models::SourcingPlan plan(const std::vector<models::SourcingLine>& lines,
+                              const std::vector<models::WarehouseStock>& stock,
+                              const std::vector<models::WarehouseCost>& costs = {}) const;
+
+private:
+    models::SourcingOptions options_;
+};
+
+} // namespace order::services
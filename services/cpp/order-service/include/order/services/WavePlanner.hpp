@@ -0,0 +1,36 @@
+#pragma once
+
+#include "order/models/Wave.hpp"
+#include <vector>
+
+namespace order::services {
+
+/**
+ * @brief Groups open orders into pick waves
+ *
+ * Orders are first partitioned by priority and by whether they are due at
+ * the cut-off; waves never cross partitions, and partitions are planned in
+ * parallel. Within a partition each wave is seeded with the order due
+ * soonest and grown greedily with the order that shares the most pick
+ * stops (SKUs) with it, then a local search moves orders between waves
+ * when that removes stops. Every order lands in exactly one wave; an order
+ * that breaks the limits on its own gets a wave to itself.
+ *
+ * Waves come back most urgent first: by priority, due orders before later
+ * ones, then by earliest ship-by date.
+ */
+class WavePlanner {
+public:
+    /**
+     * @param workers Partitions planned at once; 0 uses std::thread::hardware_concurrency()
+     */
+    explicit WavePlanner(unsigned workers = 0);
+
+    std::vector<models::Wave> plan(const std::vector<models::WaveOrder>& orders,
+                                   const models::WaveConstraints& constraints) const;
+
+private:
+    unsigned workers_;
+};
+
+} // namespace order::services
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "order/dtos/WavePlanDto.hpp"
+#include "order/models/Wave.hpp"
+#include "order/services/WavePlanner.hpp"
+#include <memory>
+#include <string>
+
+namespace order::repositories {
+    class OrderRepository; // Forward declaration
+}
+
+namespace order::services {
+
+/**
+ * @brief Plans pick waves over a warehouse's pending orders
+ *
+ * Plans are computed on demand and not stored; each call replans from the
+ * current set of pending orders.
+ */
+class WaveService {
+public:
+    explicit WaveService(std::shared_ptr<repositories::OrderRepository> repository);
+    
+    /**
+     * @throws std::invalid_argument if warehouseId is not a UUID or a limit is zero
+     */
+    dtos::WavePlanDto plan(const std::string& warehouseId, const models::WaveConstraints& constraints);
+    
+private:
+    std::shared_ptr<repositories::OrderRepository> repository_;
+    WavePlanner planner_;
+};
+
+} // namespace order::services
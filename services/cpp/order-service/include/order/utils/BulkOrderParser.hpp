@@ -0,0 +1,79 @@
+#pragma once
+
+#include "order/models/Order.hpp"
+#include <cstddef>
+#include <istream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace order::utils {
+
+/**
+ * @brief One raw line of a bulk upload, numbered from 1
+ */
+struct BulkOrderLine {
+    std::size_t line = 0;
+    std::string text;
+};
+
+/**
+ * @brief One parsed line of a bulk upload
+ *
+ * Either order is set, or error describes why the line was rejected.
+ * orderNumber is filled in whenever the line got far enough to have one;
+ * it is empty for a request that leaves the number to be allocated.
+ */
+struct ParsedOrder {
+    std::size_t line = 0;
+    std::optional<std::string> orderNumber;
+    std::optional<models::Order> order;
+    std::string error;
+};
+
+/**
+ * @brief Streaming NDJSON reader and validator for bulk order uploads
+ *
+ * Lines are pulled from the stream a chunk at a time, so memory use is
+ * bounded by the chunk size rather than the upload. Each chunk is parsed
+ * and validated against CreateOrderRequest on up to `workers` threads;
+ * results come back in input order. Orders are returned without ids or
+ * order date, both of which the caller assigns.
+ */
+class BulkOrderParser {
+public:
+    /**
+     * @param workers Threads used per chunk; 0 uses std::thread::hardware_concurrency()
+     */
+    explicit BulkOrderParser(unsigned workers = 0);
+
+    /**
+     * @brief Read up to maxLines non-empty lines
+     * @param lineNumber Running line counter, advanced past every line consumed
+     * @return Empty at end of input
+     */
+    static std::vector<BulkOrderLine> readChunk(std::istream& input, std::size_t maxLines,
+                                                std::size_t& lineNumber);
+
+    std::vector<ParsedOrder> parse(const std::vector<BulkOrderLine>& lines) const;
+
+    /**
+     * @brief Build a pending order from one CreateOrderRequest body
+     *
+     * orderNumber is optional; without one the order's number is empty.
+     * @throws std::invalid_argument naming the first field that fails validation
+     */
+    static models::Order parseOrder(const nlohmann::json& request);
+
+    static bool isValidOrderNumber(const std::string& orderNumber);
+    static bool isValidUuid(const std::string& value);
+
+    static constexpr std::size_t kMaxOrderNumberLength = 50;
+
+private:
+    unsigned workers_;
+
+    static ParsedOrder parseLine(const BulkOrderLine& line);
+};
+
+} // namespace order::utils
@@ -63,6 +63,7 @@ private:
     json config_;
     
     json getNestedValue(const std::string& key) const;
+    static json::json_pointer toPointer(const std::string& key);
 };
 
 } // namespace order::utils
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <pqxx/pqxx>
+#include <memory>
+#include <string>
+
+namespace order::utils {
+
+/**
+ * @brief PostgreSQL connection holder
+ */
+class Database {
+public:
+    static std::shared_ptr<pqxx::connection> connect(const std::string& connectionString);
+    static void disconnect();
+    
+    static std::shared_ptr<pqxx::connection> getConnection();
+    
+private:
+    static std::shared_ptr<pqxx::connection> connection_;
+};
+
+} // namespace order::utils
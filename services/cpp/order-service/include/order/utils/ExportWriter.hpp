@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace order::utils {
+
+enum class ExportFormat {
+    Csv,
+    Ndjson
+};
+
+// "csv" or "ndjson"; @throws std::invalid_argument otherwise
+ExportFormat exportFormatFromString(const std::string& format);
+
+/**
+ * @brief One column an export can project
+ *
+ * expression is the SQL producing the value as text; it comes from a fixed
+ * catalogue, never from the request.
+ */
+struct ExportColumn {
+    std::string name;
+    std::string expression;
+    bool numeric = false;   // unquoted in NDJSON
+};
+
+/**
+ * @brief Writes export rows as CSV or NDJSON straight to a stream
+ *
+ * Nothing is buffered beyond the stream's own buffer, so memory stays flat
+ * however many rows pass through. CSV follows RFC 4180: a header row, then
+ * fields quoted when they hold a comma, quote or line break, with CRLF line
+ * ends. NDJSON writes one object per row with the column names as keys;
+ * NULL becomes an empty CSV field or a JSON null.
+ */
+class ExportWriter {
+public:
+    ExportWriter(std::ostream& out, ExportFormat format, std::vector<ExportColumn> columns);
+
+    // CSV header; nothing for NDJSON
+    void begin();
+
+    // One value per column, in column order
+    void row(const std::vector<std::optional<std::string>>& values);
+
+    std::size_t rows() const { return rows_; }
+
+    static std::string contentType(ExportFormat format);
+    static std::string fileExtension(ExportFormat format);
+
+    /**
+     * @brief The named columns of catalogue, in the order named
+     * @param names Empty selects every column
+     * @throws std::invalid_argument for an unknown or repeated column
+     */
+    static std::vector<ExportColumn> project(const std::vector<ExportColumn>& catalogue,
+                                             const std::vector<std::string>& names);
+
+private:
+    std::ostream& out_;
+    ExportFormat format_;
+    std::vector<ExportColumn> columns_;
+    std::size_t rows_ = 0;
+
+    void writeCsvField(const std::string& value);
+};
+
+} // namespace order::utils
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "order/models/Order.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace order::utils {
+
+/**
+ * @brief Per-warehouse release queue of open orders
+ *
+ * One indexed binary heap per warehouse, ordered by priority (URGENT
+ * first), then ship-by date (orders without one last), then order date,
+ * then id. An id-to-slot index gives O(log n) insert, remove and in-place
+ * re-keying when an order's priority or dates change. The top k of a
+ * warehouse are read without disturbing the heap in O(k log k).
+ *
+ * Only pending and confirmed orders are queued; sync() drops an order as
+ * soon as it moves to any other status. Safe to share between threads.
+ */
+class FulfilmentQueue {
+public:
+    struct Entry {
+        std::string orderId;
+        std::string warehouseId;
+        models::OrderPriority priority = models::OrderPriority::NORMAL;
+        std::int64_t shipBy = kNoShipBy;   // unix seconds
+        std::int64_t orderDate = 0;        // unix seconds
+    };
+
+    static constexpr std::int64_t kNoShipBy = std::numeric_limits<std::int64_t>::max();
+
+    static bool isReleasable(models::OrderStatus status);
+    static Entry entryFor(const models::Order& order);
+
+    // Queue, re-key or drop the order according to its current status
+    void sync(const models::Order& order);
+
+    void upsert(const Entry& entry);
+    bool remove(const std::string& orderId);
+
+    // The first count entries of a warehouse in release order
+    std::vector<Entry> next(const std::string& warehouseId, std::size_t count) const;
+
+    std::size_t size() const;
+    std::size_t size(const std::string& warehouseId) const;
+
+    // Parse an ISO 8601 date or UTC date-time to unix seconds
+    static std::int64_t toEpochSeconds(const std::string& timestamp);
+
+private:
+    struct Heap {
+        std::vector<Entry> nodes;
+    };
+
+    struct Slot {
+        Heap* heap;
+        std::size_t index;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Heap> heaps_;    // warehouse id -> heap
+    std::unordered_map<std::string, Slot> slots_;    // order id -> position
+
+    static bool before(const Entry& a, const Entry& b);
+
+    void place(Heap& heap, std::size_t index);
+    std::size_t siftUp(Heap& heap, std::size_t index);   // returns the final position
+    void siftDown(Heap& heap, std::size_t index);
+    void removeAt(Heap& heap, std::size_t index);
+};
+
+} // namespace order::utils
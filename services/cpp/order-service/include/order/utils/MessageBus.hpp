@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace order::utils {
+
+/**
+ * @brief Publisher for domain events
+ */
+class MessageBus {
+public:
+    struct Config {
+        std::string host;
+        int port;
+        std::string virtual_host;
+        std::string username;
+        std::string password;
+        std::string exchange;
+        std::string routing_key_prefix;
+    };
+
+    virtual ~MessageBus() = default;
+
+    virtual void publish(const std::string& routingKey,
+                         const nlohmann::json& payload) = 0;
+
+    /**
+     * @brief Publish many events with the same routing key
+     * 
+     * Implementations may override to amortise per-message overhead.
+     */
+    virtual void publishBatch(const std::string& routingKey,
+                              const std::vector<nlohmann::json>& payloads) {
+        for (const auto& payload : payloads) {
+            publish(routingKey, payload);
+        }
+    }
+};
+
+} // namespace order::utils
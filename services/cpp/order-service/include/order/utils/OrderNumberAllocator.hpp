@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace order::utils {
+
+/**
+ * @brief Durable source of order number blocks, shared by every replica
+ */
+class OrderNumberBlockSource {
+public:
+    virtual ~OrderNumberBlockSource() = default;
+
+    /**
+     * @brief Reserve `size` consecutive numbers no other caller will be given
+     * @return The first number of the block
+     */
+    virtual std::int64_t reserveBlock(std::size_t size) = 0;
+};
+
+/**
+ * @brief Hands out order numbers from blocks reserved in the database (hi/lo)
+ *
+ * One database round trip reserves a whole block; numbers within it come
+ * from an atomic counter, so taking one is a single fetch_add with no lock
+ * and no query. Only the caller that finds the block used up takes the
+ * mutex and reserves the next one. A restart abandons the rest of the
+ * block, so numbers are unique and increasing per replica but not gapless.
+ *
+ * Numbers are formatted as PREFIX-00000042: the warehouse's prefix if one
+ * is configured, otherwise the default. That format is reserved for the
+ * allocator; clients must not supply numbers in it (see isGenerated).
+ *
+ * Safe to share between threads.
+ */
+class OrderNumberAllocator {
+public:
+    static constexpr std::size_t kDefaultBlockSize = 1000;
+    static constexpr std::size_t kMaxBlockSize = std::size_t{1} << 20;
+    static constexpr const char* kDefaultPrefix = "ORD";
+
+    /**
+     * @param prefixes Warehouse id to prefix, e.g. a warehouse code
+     * @throws std::invalid_argument if blockSize is 0 or above kMaxBlockSize,
+     *         or a prefix is not 1-20 characters of A-Z, 0-9 and '-'
+     */
+    explicit OrderNumberAllocator(std::shared_ptr<OrderNumberBlockSource> source,
+                                  std::size_t blockSize = kDefaultBlockSize,
+                                  std::unordered_map<std::string, std::string> prefixes = {},
+                                  std::string defaultPrefix = kDefaultPrefix);
+
+    std::string next(const std::string& warehouseId);
+
+    // `count` numbers for one warehouse; at most one block reservation per block crossed
+    std::vector<std::string> next(const std::string& warehouseId, std::size_t count);
+
+    const std::string& prefixFor(const std::string& warehouseId) const;
+
+    // Whether number has the form next() produces under any configured prefix
+    bool isGenerated(const std::string& number) const;
+
+    static std::string format(const std::string& prefix, std::int64_t number);
+
+private:
+    // Block start in the high bits, numbers taken from it in the low bits
+    static constexpr unsigned kTakenBits = 24;
+    static constexpr std::uint64_t kTakenMask = (std::uint64_t{1} << kTakenBits) - 1;
+
+    std::shared_ptr<OrderNumberBlockSource> source_;
+    std::size_t blockSize_;
+    std::unordered_map<std::string, std::string> prefixes_;
+    std::string defaultPrefix_;
+    std::unordered_set<std::string> generatedPrefixes_;
+    std::atomic<std::uint64_t> state_;
+    std::mutex refillMutex_;
+
+    std::int64_t nextNumber();
+    std::int64_t refill();
+};
+
+} // namespace order::utils
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace order::utils {
+
+/**
+ * @brief In-memory prefix index of order numbers for type-ahead
+ *
+ * A character trie stored as one node array, children kept as sorted
+ * sibling lists, so completions come out in lexicographic order and cost
+ * O(prefix length + nodes visited) with no database round trip. Order
+ * numbers are 50 characters at most and share long prefixes, which keeps
+ * the node count close to the number of orders.
+ *
+ * Safe to share between threads.
+ */
+class OrderNumberTrie {
+public:
+    struct Match {
+        std::string orderNumber;
+        std::string orderId;
+    };
+
+    // Add an order, or move it if its number changed
+    void insert(const std::string& orderId, const std::string& orderNumber);
+    bool remove(const std::string& orderId);
+
+    // Up to limit order numbers starting with prefix, in lexicographic order
+    std::vector<Match> complete(std::string_view prefix, std::size_t limit) const;
+
+    std::size_t size() const;
+
+private:
+    static constexpr std::uint32_t kNone = std::numeric_limits<std::uint32_t>::max();
+
+    struct Node {
+        std::uint32_t firstChild = kNone;
+        std::uint32_t nextSibling = kNone;
+        std::uint32_t order = kNone;   // index into orderIds_ when a number ends here
+        char symbol = 0;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Node> nodes_{Node{}};                        // nodes_[0] is the root
+    std::vector<std::string> orderIds_;
+    std::vector<std::uint32_t> freeOrders_;                  // reusable orderIds_ slots
+    std::unordered_map<std::string, std::uint32_t> nodeById_;   // order id -> terminal node
+
+    std::uint32_t find(std::string_view key) const;
+    std::uint32_t findOrAdd(std::string_view key);
+    void removeLocked(std::uint32_t node);
+    void collect(std::uint32_t node, std::string& path, std::size_t limit,
+                 std::vector<Match>& matches) const;
+};
+
+} // namespace order::utils
@@ -0,0 +1,72 @@
+-- Deploy order-service:001_initial_schema to pg
+-- requires: 
+
+BEGIN;
+
+-- Enable UUID extension
+CREATE EXTENSION IF NOT EXISTS "uuid-ossp";
+
+-- Create orders table
+CREATE TABLE orders (
+    id UUID PRIMARY KEY DEFAULT uuid_generate_v4(),
+    order_number VARCHAR(50) NOT NULL UNIQUE,
+    customer_id VARCHAR(100) NOT NULL,
+    warehouse_id UUID NOT NULL,
+    warehouse_code VARCHAR(50),
+    warehouse_name VARCHAR(255),
+    status VARCHAR(50) NOT NULL DEFAULT 'pending' CHECK (status IN ('pending', 'confirmed', 'processing', 'picking', 'packing', 'ready_to_ship', 'shipped', 'in_transit', 'delivered', 'cancelled', 'returned')),
+    priority VARCHAR(20) NOT NULL DEFAULT 'normal' CHECK (priority IN ('low', 'normal', 'high', 'urgent')),
+    order_date TIMESTAMP NOT NULL DEFAULT CURRENT_TIMESTAMP,
+    ship_by_date TIMESTAMP,
+    total DECIMAL(12, 2) NOT NULL DEFAULT 0,
+    notes TEXT,
+    cancellation_reason TEXT,
+    -- Addresses are always read and written whole with their order
+    shipping_address JSONB,
+    billing_address JSONB,
+    created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+    updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+);
+
+-- Create order_line_items table
+CREATE TABLE order_line_items (
+    id UUID PRIMARY KEY DEFAULT uuid_generate_v4(),
+    order_id UUID NOT NULL REFERENCES orders(id) ON DELETE CASCADE,
+    line_number INTEGER NOT NULL,
+    product_id UUID NOT NULL,
+    product_sku VARCHAR(100) NOT NULL,
+    product_name VARCHAR(255) NOT NULL,
+    quantity INTEGER NOT NULL CHECK (quantity > 0),
+    unit_price DECIMAL(12, 2) NOT NULL CHECK (unit_price >= 0),
+    line_total DECIMAL(12, 2) NOT NULL,
+    notes TEXT,
+    UNIQUE (order_id, line_number)
+);
+
+-- Create indexes
+CREATE INDEX idx_orders_status ON orders(status);
+CREATE INDEX idx_orders_customer ON orders(customer_id);
+CREATE INDEX idx_orders_warehouse ON orders(warehouse_id);
+CREATE INDEX idx_orders_order_date ON orders(order_date DESC, id DESC);
+-- order_id is the leading column of the unique constraint, which serves line item loads
+
+-- Create function to update updated_at timestamp
+CREATE OR REPLACE FUNCTION update_updated_at_column()
+RETURNS TRIGGER AS $$
+BEGIN
+    NEW.updated_at = CURRENT_TIMESTAMP;
+    RETURN NEW;
+END;
+$$ LANGUAGE plpgsql;
+
+-- Create trigger for orders table
+CREATE TRIGGER update_orders_updated_at
+    BEFORE UPDATE ON orders
+    FOR EACH ROW
+    EXECUTE FUNCTION update_updated_at_column();
+
+-- Comments
+COMMENT ON TABLE orders IS 'Customer orders - managed by order-service';
+COMMENT ON TABLE order_line_items IS 'Order lines, loaded and replaced with their order - managed by order-service';
+
+COMMIT;
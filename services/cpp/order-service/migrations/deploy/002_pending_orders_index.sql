@@ -0,0 +1,9 @@
+-- Deploy order-service:002_pending_orders_index to pg
+-- requires: 001_initial_schema
+
+BEGIN;
+
+-- Wave planning reads every pending order of a warehouse; shipped history is skipped
+CREATE INDEX idx_orders_pending_by_warehouse ON orders(warehouse_id) WHERE status = 'pending';
+
+COMMIT;
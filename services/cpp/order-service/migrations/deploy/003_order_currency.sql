@@ -0,0 +1,10 @@
+-- Deploy order-service:003_order_currency to pg
+-- requires: 001_initial_schema
+
+BEGIN;
+
+-- Totals and line prices are exact minor-unit amounts in the order's currency
+ALTER TABLE orders
+    ADD COLUMN currency CHAR(3) NOT NULL DEFAULT 'USD' CHECK (currency ~ '^[A-Z]{3}$');
+
+COMMIT;
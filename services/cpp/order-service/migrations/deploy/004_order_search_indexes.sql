@@ -0,0 +1,21 @@
+-- Deploy order-service:004_order_search_indexes to pg
+-- requires: 001_initial_schema
+
+BEGIN;
+
+-- Search pages newest first on (order_date, id); each leading filter gets an
+-- index that already returns its rows in that order, so a keyset page is one
+-- index range scan. The composites replace the single-column indexes.
+DROP INDEX IF EXISTS idx_orders_status;
+DROP INDEX IF EXISTS idx_orders_customer;
+DROP INDEX IF EXISTS idx_orders_warehouse;
+
+CREATE INDEX idx_orders_status_date ON orders(status, order_date DESC, id DESC);
+-- A customer's orders are few; status, priority and date range filter that range
+CREATE INDEX idx_orders_customer_date ON orders(customer_id, order_date DESC, id DESC);
+CREATE INDEX idx_orders_warehouse_date ON orders(warehouse_id, order_date DESC, id DESC);
+
+-- LIKE 'prefix%' cannot use the collation-ordered unique index
+CREATE INDEX idx_orders_number_prefix ON orders(order_number text_pattern_ops);
+
+COMMIT;
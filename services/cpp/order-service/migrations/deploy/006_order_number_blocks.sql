@@ -0,0 +1,15 @@
+-- Deploy order-service:006_order_number_blocks to pg
+-- requires: 001_initial_schema
+
+BEGIN;
+
+-- High-water mark for generated order numbers. Each replica reserves a block
+-- by advancing next_value, then numbers orders from memory until it runs out.
+CREATE TABLE order_number_blocks (
+    name VARCHAR(50) PRIMARY KEY,
+    next_value BIGINT NOT NULL CHECK (next_value > 0)
+);
+
+INSERT INTO order_number_blocks (name, next_value) VALUES ('orders', 1);
+
+COMMIT;
@@ -0,0 +1,17 @@
+-- Revert order-service:001_initial_schema from pg
+
+BEGIN;
+
+-- Drop triggers
+DROP TRIGGER IF EXISTS update_orders_updated_at ON orders;
+
+-- Drop functions
+DROP FUNCTION IF EXISTS update_updated_at_column();
+
+-- Drop tables in reverse dependency order
+DROP TABLE IF EXISTS order_line_items;
+DROP TABLE IF EXISTS orders;
+
+-- Note: We don't drop uuid-ossp as other schemas may depend on it
+
+COMMIT;
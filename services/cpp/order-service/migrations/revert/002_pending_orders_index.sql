@@ -0,0 +1,7 @@
+-- Revert order-service:002_pending_orders_index from pg
+
+BEGIN;
+
+DROP INDEX IF EXISTS idx_orders_pending_by_warehouse;
+
+COMMIT;
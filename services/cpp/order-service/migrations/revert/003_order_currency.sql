@@ -0,0 +1,7 @@
+-- Revert order-service:003_order_currency from pg
+
+BEGIN;
+
+ALTER TABLE orders DROP COLUMN IF EXISTS currency;
+
+COMMIT;
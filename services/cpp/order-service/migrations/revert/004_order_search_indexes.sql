@@ -0,0 +1,14 @@
+-- Revert order-service:004_order_search_indexes from pg
+
+BEGIN;
+
+DROP INDEX IF EXISTS idx_orders_number_prefix;
+DROP INDEX IF EXISTS idx_orders_warehouse_date;
+DROP INDEX IF EXISTS idx_orders_customer_date;
+DROP INDEX IF EXISTS idx_orders_status_date;
+
+CREATE INDEX idx_orders_status ON orders(status);
+CREATE INDEX idx_orders_customer ON orders(customer_id);
+CREATE INDEX idx_orders_warehouse ON orders(warehouse_id);
+
+COMMIT;
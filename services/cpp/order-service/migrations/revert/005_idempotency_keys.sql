@@ -0,0 +1,7 @@
+-- Revert order-service:005_idempotency_keys from pg
+
+BEGIN;
+
+DROP TABLE IF EXISTS idempotency_keys;
+
+COMMIT;
@@ -0,0 +1,7 @@
+-- Revert order-service:006_order_number_blocks from pg
+
+BEGIN;
+
+DROP TABLE IF EXISTS order_number_blocks;
+
+COMMIT;
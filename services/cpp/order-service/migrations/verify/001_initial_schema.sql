@@ -0,0 +1,32 @@
+-- Verify order-service:001_initial_schema on pg
+
+BEGIN;
+
+-- Verify orders table exists with expected columns
+SELECT id, order_number, customer_id, warehouse_id, warehouse_code, warehouse_name,
+       status, priority, order_date, ship_by_date, total, notes, cancellation_reason,
+       shipping_address, billing_address, created_at, updated_at
+FROM orders
+WHERE FALSE;
+
+-- Verify order_line_items table exists with expected columns
+SELECT id, order_id, line_number, product_id, product_sku, product_name,
+       quantity, unit_price, line_total, notes
+FROM order_line_items
+WHERE FALSE;
+
+-- Verify indexes exist
+SELECT 1/COUNT(*) FROM pg_indexes WHERE tablename = 'orders' AND indexname = 'idx_orders_status';
+SELECT 1/COUNT(*) FROM pg_indexes WHERE tablename = 'orders' AND indexname = 'idx_orders_customer';
+SELECT 1/COUNT(*) FROM pg_indexes WHERE tablename = 'orders' AND indexname = 'idx_orders_warehouse';
+SELECT 1/COUNT(*) FROM pg_indexes WHERE tablename = 'orders' AND indexname = 'idx_orders_order_date';
+
+-- Verify foreign key constraint
+SELECT 1/COUNT(*) FROM pg_constraint
+WHERE conname = 'order_line_items_order_id_fkey'
+AND conrelid = 'order_line_items'::regclass;
+
+-- Verify trigger exists
+SELECT 1/COUNT(*) FROM pg_trigger WHERE tgname = 'update_orders_updated_at';
+
+ROLLBACK;
@@ -0,0 +1,7 @@
+-- Verify order-service:002_pending_orders_index on pg
+
+BEGIN;
+
+SELECT 1/COUNT(*) FROM pg_indexes WHERE indexname = 'idx_orders_pending_by_warehouse';
+
+ROLLBACK;
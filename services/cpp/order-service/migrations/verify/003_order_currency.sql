@@ -0,0 +1,7 @@
+-- Verify order-service:003_order_currency on pg
+
+BEGIN;
+
+SELECT currency FROM orders WHERE FALSE;
+
+ROLLBACK;
@@ -0,0 +1,10 @@
+-- Verify order-service:004_order_search_indexes on pg
+
+BEGIN;
+
+SELECT 1/COUNT(*) FROM pg_indexes WHERE indexname = 'idx_orders_status_date';
+SELECT 1/COUNT(*) FROM pg_indexes WHERE indexname = 'idx_orders_customer_date';
+SELECT 1/COUNT(*) FROM pg_indexes WHERE indexname = 'idx_orders_warehouse_date';
+SELECT 1/COUNT(*) FROM pg_indexes WHERE indexname = 'idx_orders_number_prefix';
+
+ROLLBACK;
@@ -0,0 +1,7 @@
+-- Verify order-service:006_order_number_blocks on pg
+
+BEGIN;
+
+SELECT 1 / COUNT(*) FROM order_number_blocks WHERE name = 'orders';
+
+ROLLBACK;
@@ -1,5 +1,6 @@
 #include "order/Server.hpp"
 #include "order/controllers/OrderController.hpp"
+#include "order/controllers/WaveController.hpp"
 #include "order/controllers/HealthController.hpp"
 #include "order/controllers/ClaimsController.hpp"
 #include "order/utils/Logger.hpp"
@@ -10,8 +11,12 @@ namespace order {
 
 class Server::RequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory {
 public:
-    RequestHandlerFactory(std::shared_ptr<services::OrderService> orderService)
-        : orderService_(orderService) {}
+    RequestHandlerFactory(std::shared_ptr<services::OrderService> orderService,
+                          std::shared_ptr<services::WaveService> waveService,
+                          std::shared_ptr<utils::IdempotencyStore> idempotency)
+        : orderService_(orderService)
+        , waveService_(waveService)
+        , idempotency_(idempotency) {}
     
     Poco::Net::HTTPRequestHandler* createRequestHandler(
         const Poco::Net::HTTPServerRequest& request) override {
@@ -35,7 +40,12 @@ public:
         
         // Order endpoints
         if (uri.find("/api/v1/orders") == 0) {
-            return new controllers::OrderController(orderService_);
+            return new controllers::OrderController(orderService_, idempotency_);
+        }
+        
+        // Wave planning endpoints
+        if (uri.find("/api/v1/warehouses/") == 0) {
+            return new controllers::WaveController(waveService_);
         }
         
         return nullptr; // Will result in 404
@@ -43,11 +53,18 @@ public:
 
 private:
     std::shared_ptr<services::OrderService> orderService_;
+    std::shared_ptr<services::WaveService> waveService_;
+    std::shared_ptr<utils::IdempotencyStore> idempotency_;
 };
 
-Server::Server(const Config& config, std::shared_ptr<services::OrderService> orderService)
+Server::Server(const Config& config,
+               std::shared_ptr<services::OrderService> orderService,
+               std::shared_ptr<services::WaveService> waveService,
+               std::shared_ptr<utils::IdempotencyStore> idempotency)
     : config_(config)
-    , orderService_(orderService) {}
+    , orderService_(orderService)
+    , waveService_(waveService)
+    , idempotency_(idempotency) {}
 
 Server::~Server() {
     stop();
@@ -66,7 +83,7 @@ void Server::start() {
         params->setMaxQueued(config_.maxQueued);
         
         httpServer_ = std::make_unique<Poco::Net::HTTPServer>(
-            new RequestHandlerFactory(orderService_),
+            new RequestHandlerFactory(orderService_, waveService_, idempotency_),
             socket,
             params
         );
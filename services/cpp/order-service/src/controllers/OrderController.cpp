@@ -1,19 +1,55 @@
 #include "order/controllers/OrderController.hpp"
+#include "order/controllers/OrderRoute.hpp"
 #include "order/services/OrderService.hpp"
 #include "order/dtos/ErrorDto.hpp"
 #include "order/models/Order.hpp"
+#include "order/models/OrderSearch.hpp"
 #include "order/utils/Auth.hpp"
 #include "order/utils/Logger.hpp"
 #include <Poco/Net/HTTPResponse.h>
 #include <Poco/URI.h>
 #include <nlohmann/json.hpp>
+#include <iterator>
+#include <optional>
+#include <sstream>
 
 using json = nlohmann::json;
 
 namespace order::controllers {
 
-OrderController::OrderController(std::shared_ptr<services::OrderService> service)
-    : service_(service) {}
+namespace {
+
+const std::string kIdempotencyKeyHeader = "Idempotency-Key";
+
+// Search and export share their filters; other parameters are ignored
+void applyCriterion(models::OrderSearchCriteria& criteria, const std::string& name, const std::string& value) {
+    if (name == "status") {
+        // status=shipped,delivered and repeated status= both add to the set
+        std::istringstream statuses(value);
+        for (std::string status; std::getline(statuses, status, ',');) {
+            criteria.statuses.push_back(models::orderStatusFromString(status));
+        }
+    } else if (name == "customerId") {
+        criteria.customerId = value;
+    } else if (name == "warehouseId") {
+        criteria.warehouseId = value;
+    } else if (name == "priority") {
+        criteria.priority = models::orderPriorityFromString(value);
+    } else if (name == "orderDateFrom") {
+        criteria.orderDateFrom = value;
+    } else if (name == "orderDateTo") {
+        criteria.orderDateTo = value;
+    } else if (name == "orderNumberPrefix") {
+        criteria.orderNumberPrefix = value;
+    }
+}
+
+} // namespace
+
+OrderController::OrderController(std::shared_ptr<services::OrderService> service,
+                                 std::shared_ptr<utils::IdempotencyStore> idempotency)
+    : service_(service)
+    , idempotency_(idempotency) {}
 
 void OrderController::handleRequest(
     Poco::Net::HTTPServerRequest& request,
@@ -30,38 +66,75 @@ void OrderController::handleRequest(
     utils::Logger::debug("Handling {} request to {}", method, uri);
     
     try {
-        // Parse URI to extract ID if present
         Poco::URI parsedUri(uri);
-        std::string path = parsedUri.getPath();
+        auto route = OrderRoute::match(parsedUri.getPath());
         
-        // Check for cancel endpoint
-        if (path.find("/cancel") != std::string::npos) {
-            std::string id = extractIdFromPath(path);
-            if (method == "POST") {
-                handleCancel(id, request, response);
-            } else {
+        // Each endpoint accepts one method, except the collection and a single order
+        auto only = [&](const char* allowed) {
+            if (method != allowed) {
                 sendErrorResponse(response, 405, "Method not allowed");
+                return false;
             }
-            return;
-        }
-        
-        // Check if path has ID
-        bool hasId = path.find("/api/v1/orders/") == 0 && path.length() > 16;
+            return true;
+        };
         
-        if (method == "GET") {
-            if (hasId) {
-                std::string id = extractIdFromPath(path);
-                handleGetById(id, request, response);
-            } else {
-                handleGetAll(request, response);
-            }
-        } else if (method == "POST" && !hasId) {
-            handleCreate(request, response);
-        } else if (method == "PUT" && hasId) {
-            std::string id = extractIdFromPath(path);
-            handleUpdate(id, request, response);
-        } else {
-            sendErrorResponse(response, 405, "Method not allowed");
+        switch (route.endpoint) {
+            case OrderRoute::Endpoint::Collection:
+                if (method == "GET") {
+                    handleGetAll(request, response);
+                } else if (method == "POST") {
+                    handleCreate(request, response);
+                } else {
+                    sendErrorResponse(response, 405, "Method not allowed");
+                }
+                break;
+            case OrderRoute::Endpoint::Next:
+                if (only("GET")) {
+                    handleGetNext(request, response);
+                }
+                break;
+            case OrderRoute::Endpoint::Search:
+                if (only("GET")) {
+                    handleSearch(request, response);
+                }
+                break;
+            case OrderRoute::Endpoint::Suggest:
+                if (only("GET")) {
+                    handleSuggest(request, response);
+                }
+                break;
+            case OrderRoute::Endpoint::Export:
+                if (only("GET")) {
+                    handleExport(request, response);
+                }
+                break;
+            case OrderRoute::Endpoint::Bulk:
+                if (only("POST")) {
+                    handleBulkCreate(request, response);
+                }
+                break;
+            case OrderRoute::Endpoint::Order:
+                if (method == "GET") {
+                    handleGetById(route.id, request, response);
+                } else if (method == "PUT") {
+                    handleUpdate(route.id, request, response);
+                } else {
+                    sendErrorResponse(response, 405, "Method not allowed");
+                }
+                break;
+            case OrderRoute::Endpoint::Cancel:
+                if (only("POST")) {
+                    handleCancel(route.id, request, response);
+                }
+                break;
+            case OrderRoute::Endpoint::Sourcing:
+                if (only("POST")) {
+                    handleSourcing(route.id, request, response);
+                }
+                break;
+            case OrderRoute::Endpoint::NotFound:
+                sendErrorResponse(response, 404, "Not found");
+                break;
         }
     } catch (const std::exception& e) {
         utils::Logger::error("Error handling request: {}", e.what());
@@ -76,28 +149,193 @@ void OrderController::handleGetAll(
     utils::Logger::info("Listing orders");
     
     try {
-        auto dtos = service_->getAll();
+        std::optional<std::string> status;
+        std::optional<std::string> customerId;
+        std::optional<std::string> warehouseId;
+        int page = 1;
+        int pageSize = services::OrderService::kDefaultPageSize;
         
-        json items = json::array();
-        for (const auto& dto : dtos) {
-            items.push_back(dto.toJson());
+        Poco::URI uri(request.getURI());
+        for (const auto& [name, value] : uri.getQueryParameters()) {
+            if (name == "status") {
+                status = value;
+            } else if (name == "customerId") {
+                customerId = value;
+            } else if (name == "warehouseId") {
+                warehouseId = value;
+            } else if (name == "page") {
+                page = std::stoi(value);
+            } else if (name == "pageSize") {
+                pageSize = std::stoi(value);
+            }
         }
         
-        json responseJson = {
-            {"items", items},
-            {"totalCount", dtos.size()},
-            {"page", 1},
-            {"pageSize", dtos.size()},
-            {"totalPages", 1}
-        };
-        
-        sendJsonResponse(response, 200, responseJson.dump());
+        auto dto = service_->list(status, customerId, warehouseId, page, pageSize);
+        sendJsonResponse(response, 200, dto.toJson().dump());
+    } catch (const std::invalid_argument& e) {
+        // Also raised by std::stoi on a non-numeric page or pageSize
+        utils::Logger::error("Validation error in handleGetAll: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::out_of_range& e) {
+        sendErrorResponse(response, 400, "page or pageSize out of range");
     } catch (const std::exception& e) {
         utils::Logger::error("Error in handleGetAll: {}", e.what());
         sendErrorResponse(response, 500, "Failed to retrieve orders");
     }
 }
 
+void OrderController::handleGetNext(
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    utils::Logger::info("Getting next orders to release");
+    
+    try {
+        std::string warehouseId;
+        int limit = services::OrderService::kDefaultNextLimit;
+        
+        Poco::URI uri(request.getURI());
+        for (const auto& [name, value] : uri.getQueryParameters()) {
+            if (name == "warehouseId") {
+                warehouseId = value;
+            } else if (name == "limit") {
+                limit = std::stoi(value);
+            }
+        }
+        
+        auto dto = service_->nextToRelease(warehouseId, limit);
+        sendJsonResponse(response, 200, dto.toJson().dump());
+    } catch (const std::invalid_argument& e) {
+        // Also raised by std::stoi on a non-numeric limit
+        utils::Logger::error("Validation error in handleGetNext: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::out_of_range& e) {
+        sendErrorResponse(response, 400, "limit out of range");
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleGetNext: {}", e.what());
+        sendErrorResponse(response, 500, "Failed to retrieve next orders");
+    }
+}
+
+void OrderController::handleSearch(
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    utils::Logger::info("Searching orders");
+    
+    try {
+        models::OrderSearchCriteria criteria;
+        std::optional<std::string> cursor;
+        int limit = services::OrderService::kDefaultPageSize;
+        
+        Poco::URI uri(request.getURI());
+        for (const auto& [name, value] : uri.getQueryParameters()) {
+            if (name == "cursor") {
+                cursor = value;
+            } else if (name == "limit") {
+                limit = std::stoi(value);
+            } else {
+                applyCriterion(criteria, name, value);
+            }
+        }
+        
+        auto dto = service_->search(criteria, cursor, limit);
+        sendJsonResponse(response, 200, dto.toJson().dump());
+    } catch (const std::invalid_argument& e) {
+        // Also raised by std::stoi on a non-numeric limit
+        utils::Logger::error("Validation error in handleSearch: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::out_of_range& e) {
+        sendErrorResponse(response, 400, "limit out of range");
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleSearch: {}", e.what());
+        sendErrorResponse(response, 500, "Failed to search orders");
+    }
+}
+
+void OrderController::handleExport(
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    utils::Logger::info("Exporting orders");
+    
+    models::OrderSearchCriteria criteria;
+    auto format = utils::ExportFormat::Csv;
+    std::vector<std::string> columns;
+    bool streaming = false;
+    
+    try {
+        Poco::URI uri(request.getURI());
+        for (const auto& [name, value] : uri.getQueryParameters()) {
+            if (name == "format") {
+                format = utils::exportFormatFromString(value);
+            } else if (name == "columns") {
+                std::istringstream names(value);
+                for (std::string column; std::getline(names, column, ',');) {
+                    columns.push_back(column);
+                }
+            } else {
+                applyCriterion(criteria, name, value);
+            }
+        }
+        
+        auto extension = utils::ExportWriter::fileExtension(format);
+        service_->exportOrders(criteria, format, columns, [&]() -> std::ostream& {
+            // Length unknown up front: chunked, so the client sees rows as they are fetched
+            streaming = true;
+            response.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
+            response.setChunkedTransferEncoding(true);
+            response.setContentType(utils::ExportWriter::contentType(format));
+            response.set("Content-Disposition", "attachment; filename=\"orders." + extension + "\"");
+            return response.send();
+        });
+    } catch (const std::invalid_argument& e) {
+        if (streaming) {
+            utils::Logger::error("Order export failed mid-stream: {}", e.what());
+            return;
+        }
+        utils::Logger::error("Validation error in handleExport: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::exception& e) {
+        // Once rows have gone out the status is sent; the client sees a truncated transfer
+        utils::Logger::error("Error in handleExport: {}", e.what());
+        if (!streaming) {
+            sendErrorResponse(response, 500, "Failed to export orders");
+        }
+    }
+}
+
+void OrderController::handleSuggest(
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    try {
+        std::string prefix;
+        int limit = services::OrderService::kDefaultSuggestions;
+        
+        Poco::URI uri(request.getURI());
+        for (const auto& [name, value] : uri.getQueryParameters()) {
+            if (name == "prefix") {
+                prefix = value;
+            } else if (name == "limit") {
+                limit = std::stoi(value);
+            }
+        }
+        
+        auto dto = service_->suggestOrderNumbers(prefix, limit);
+        sendJsonResponse(response, 200, dto.toJson().dump());
+    } catch (const std::invalid_argument& e) {
+        // Also raised by std::stoi on a non-numeric limit
+        utils::Logger::error("Validation error in handleSuggest: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::out_of_range& e) {
+        sendErrorResponse(response, 400, "limit out of range");
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleSuggest: {}", e.what());
+        sendErrorResponse(response, 500, "Failed to suggest order numbers");
+    }
+}
+
 void OrderController::handleGetById(
     const std::string& id,
     Poco::Net::HTTPServerRequest& request,
@@ -112,6 +350,9 @@ void OrderController::handleGetById(
             return;
         }
         sendJsonResponse(response, 200, dto->toJson().dump());
+    } catch (const std::invalid_argument& e) {
+        utils::Logger::error("Validation error in handleGetById: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
     } catch (const std::exception& e) {
         utils::Logger::error("Error in handleGetById: {}", e.what());
         sendErrorResponse(response, 500, "Failed to retrieve order");
@@ -124,9 +365,41 @@ void OrderController::handleCreate(
 ) {
     utils::Logger::info("Creating new order");
     
+    std::string body(std::istreambuf_iterator<char>(request.stream()), {});
+    
+    if (!idempotency_ || !request.has(kIdempotencyKeyHeader)) {
+        auto result = createOrder(body);
+        sendJsonResponse(response, result.status, result.body);
+        return;
+    }
+    
     try {
-        std::istream& input = request.stream();
-        json requestBody = json::parse(input);
+        auto result = idempotency_->execute("POST /api/v1/orders", request.get(kIdempotencyKeyHeader), body,
+                                            [this, &body]() { return createOrder(body); });
+        if (result.replayed) {
+            utils::Logger::info("Replaying response for Idempotency-Key {}", request.get(kIdempotencyKeyHeader));
+            response.set("Idempotent-Replayed", "true");
+        }
+        sendJsonResponse(response, result.response.status, result.response.body);
+    } catch (const utils::IdempotencyKeyReused& e) {
+        sendErrorResponse(response, 422, e.what());
+    } catch (const utils::IdempotencyKeyInProgress& e) {
+        sendErrorResponse(response, 409, e.what());
+    } catch (const std::invalid_argument& e) {
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleCreate: {}", e.what());
+        sendErrorResponse(response, 500, "Failed to create order");
+    }
+}
+
+utils::IdempotentResponse OrderController::createOrder(const std::string& body) {
+    auto error = [](int status, const std::string& message) {
+        return utils::IdempotentResponse{status, json{{"error", message}, {"status", status}}.dump()};
+    };
+    
+    try {
+        json requestBody = json::parse(body);
         
         utils::Logger::debug("Order creation request: {}", requestBody.dump());
         
@@ -136,16 +409,39 @@ void OrderController::handleCreate(
         // Call service which returns OrderDto
         auto dto = service_->create(order);
         
-        sendJsonResponse(response, 201, dto.toJson().dump());
+        return {201, dto.toJson().dump()};
     } catch (const json::exception& e) {
         utils::Logger::error("JSON parse error: {}", e.what());
-        sendErrorResponse(response, 400, "Invalid JSON");
+        return error(400, "Invalid JSON");
     } catch (const std::invalid_argument& e) {
         utils::Logger::error("Validation error in handleCreate: {}", e.what());
-        sendErrorResponse(response, 400, e.what());
+        return error(400, e.what());
     } catch (const std::exception& e) {
         utils::Logger::error("Error in handleCreate: {}", e.what());
-        sendErrorResponse(response, 500, "Failed to create order");
+        return error(500, "Failed to create order");
+    }
+}
+
+void OrderController::handleBulkCreate(
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    utils::Logger::info("Creating orders in bulk");
+    
+    const auto& contentType = request.getContentType();
+    if (contentType.find("application/x-ndjson") != 0 && contentType.find("application/jsonl") != 0) {
+        sendErrorResponse(response, 415, "Content-Type must be application/x-ndjson");
+        return;
+    }
+    
+    try {
+        // The body is consumed a chunk of lines at a time; it is never buffered whole
+        auto dto = service_->createBulk(request.stream());
+        
+        sendJsonResponse(response, 200, dto.toJson().dump());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleBulkCreate: {}", e.what());
+        sendErrorResponse(response, 500, "Failed to create orders");
     }
 }
 
@@ -222,6 +518,60 @@ void OrderController::handleCancel(
     }
 }
 
+void OrderController::handleSourcing(
+    const std::string& id,
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    utils::Logger::info("Planning sourcing for order: {}", id);
+    
+    try {
+        json requestBody = json::parse(request.stream());
+        if (!requestBody.is_object() || !requestBody.contains("stock") || !requestBody["stock"].is_array()) {
+            throw std::invalid_argument("stock must be an array of {warehouseId, productId, available}");
+        }
+        
+        std::vector<models::WarehouseStock> stock;
+        stock.reserve(requestBody["stock"].size());
+        for (const auto& row : requestBody["stock"]) {
+            if (!row.is_object() || !row.contains("available") || !row["available"].is_number_integer()) {
+                throw std::invalid_argument("stock rows need warehouseId, productId and an integer available");
+            }
+            stock.push_back({row.at("warehouseId").get<std::string>(),
+                             row.at("productId").get<std::string>(),
+                             row["available"].get<int>()});
+        }
+        
+        std::vector<models::WarehouseCost> costs;
+        if (requestBody.contains("warehouses") && !requestBody["warehouses"].is_null()) {
+            for (const auto& warehouse : requestBody["warehouses"]) {
+                models::WarehouseCost cost{warehouse.at("warehouseId").get<std::string>()};
+                cost.shipmentCost = warehouse.value("shipmentCost", models::SourcingOptions{}.defaultShipmentCost);
+                cost.unitCost = warehouse.value("unitCost", models::SourcingOptions{}.defaultUnitCost);
+                if (cost.shipmentCost < 0 || cost.unitCost < 0) {
+                    throw std::invalid_argument("Warehouse costs must be non-negative");
+                }
+                costs.push_back(cost);
+            }
+        }
+        
+        auto dto = service_->planSourcing(id, stock, costs);
+        sendJsonResponse(response, 200, dto.toJson().dump());
+    } catch (const json::exception& e) {
+        utils::Logger::error("JSON parse error: {}", e.what());
+        sendErrorResponse(response, 400, "Invalid JSON");
+    } catch (const std::invalid_argument& e) {
+        utils::Logger::error("Validation error in handleSourcing: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::runtime_error& e) {
+        utils::Logger::error("Error in handleSourcing: {}", e.what());
+        sendErrorResponse(response, 404, e.what());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleSourcing: {}", e.what());
+        sendErrorResponse(response, 500, "Failed to plan sourcing");
+    }
+}
+
 void OrderController::sendJsonResponse(
     Poco::Net::HTTPServerResponse& response,
     int status,
@@ -248,18 +598,4 @@ void OrderController::sendErrorResponse(
     sendJsonResponse(response, status, errorJson.dump());
 }
 
-std::string OrderController::extractIdFromPath(const std::string& path) {
-    // Extract UUID from path like /api/v1/orders/{id} or /api/v1/orders/{id}/cancel
-    size_t lastSlash = path.find_last_of('/');
-    size_t secondLastSlash = path.find_last_of('/', lastSlash - 1);
-    
-    // Check if last part is "cancel"
-    if (path.substr(lastSlash + 1) == "cancel") {
-        size_t thirdLastSlash = path.find_last_of('/', secondLastSlash - 1);
-        return path.substr(thirdLastSlash + 1, secondLastSlash - thirdLastSlash - 1);
-    }
-    
-    return path.substr(secondLastSlash + 1, lastSlash - secondLastSlash - 1);
-}
-
 } // namespace order::controllers
@@ -0,0 +1,65 @@
+#include "order/controllers/OrderRoute.hpp"
+#include <string_view>
+
+namespace order::controllers {
+
+namespace {
+
+constexpr std::string_view kPrefix = "/api/v1/orders";
+
+} // namespace
+
+OrderRoute OrderRoute::match(const std::string& path) {
+    OrderRoute route;
+    std::string_view rest(path);
+    if (rest.substr(0, kPrefix.size()) != kPrefix) {
+        return route;
+    }
+    rest.remove_prefix(kPrefix.size());
+    if (rest.empty() || rest == "/") {
+        route.endpoint = Endpoint::Collection;
+        return route;
+    }
+    if (rest.front() != '/') {
+        return route;
+    }
+    rest.remove_prefix(1);
+
+    // The id is the segment straight after the prefix, up to the next slash
+    auto slash = rest.find('/');
+    auto segment = rest.substr(0, slash);
+    if (segment.empty()) {
+        return route;
+    }
+
+    if (slash == std::string_view::npos) {
+        if (segment == "next") {
+            route.endpoint = Endpoint::Next;
+        } else if (segment == "search") {
+            route.endpoint = Endpoint::Search;
+        } else if (segment == "suggest") {
+            route.endpoint = Endpoint::Suggest;
+        } else if (segment == "export") {
+            route.endpoint = Endpoint::Export;
+        } else if (segment == "bulk") {
+            route.endpoint = Endpoint::Bulk;
+        } else {
+            route.endpoint = Endpoint::Order;
+            route.id = segment;
+        }
+        return route;
+    }
+
+    auto action = rest.substr(slash + 1);
+    if (action == "cancel") {
+        route.endpoint = Endpoint::Cancel;
+    } else if (action == "sourcing") {
+        route.endpoint = Endpoint::Sourcing;
+    } else {
+        return route;
+    }
+    route.id = segment;
+    return route;
+}
+
+} // namespace order::controllers
@@ -0,0 +1,145 @@
+#include "order/controllers/WaveController.hpp"
+#include "order/services/WaveService.hpp"
+#include "order/utils/Auth.hpp"
+#include "order/utils/Logger.hpp"
+#include <Poco/Net/HTTPResponse.h>
+#include <Poco/URI.h>
+#include <nlohmann/json.hpp>
+#include <ctime>
+#include <iterator>
+
+using json = nlohmann::json;
+
+namespace order::controllers {
+
+namespace {
+
+const std::string kPrefix = "/api/v1/warehouses/";
+const std::string kSuffix = "/waves/plan";
+
+std::chrono::system_clock::time_point parseTimestamp(const std::string& value) {
+    std::tm utc{};
+    const char* end = strptime(value.c_str(), "%Y-%m-%dT%H:%M:%S", &utc);
+    if (end == nullptr || (*end != '\0' && *end != 'Z')) {
+        throw std::invalid_argument("cutoff must be an ISO 8601 UTC timestamp");
+    }
+    return std::chrono::system_clock::from_time_t(timegm(&utc));
+}
+
+std::size_t positiveLimit(const json& body, const char* name, std::size_t defaultValue) {
+    auto it = body.find(name);
+    if (it == body.end() || it->is_null()) {
+        return defaultValue;
+    }
+    if (!it->is_number_integer() || it->get<long long>() < 1) {
+        throw std::invalid_argument(std::string(name) + " must be a positive integer");
+    }
+    return it->get<std::size_t>();
+}
+
+} // namespace
+
+WaveController::WaveController(std::shared_ptr<services::WaveService> service)
+    : service_(service) {}
+
+void WaveController::handleRequest(
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    if (!utils::Auth::authorizeServiceRequest(request, response)) {
+        return;
+    }
+    
+    try {
+        std::string path = Poco::URI(request.getURI()).getPath();
+        std::string warehouseId = extractWarehouseIdFromPath(path);
+        if (warehouseId.empty()) {
+            sendErrorResponse(response, 404, "Not found");
+            return;
+        }
+        if (request.getMethod() != "POST") {
+            sendErrorResponse(response, 405, "Method not allowed");
+            return;
+        }
+        
+        handlePlan(warehouseId, request, response);
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error handling request: {}", e.what());
+        sendErrorResponse(response, 500, "Internal server error");
+    }
+}
+
+void WaveController::handlePlan(
+    const std::string& warehouseId,
+    Poco::Net::HTTPServerRequest& request,
+    Poco::Net::HTTPServerResponse& response
+) {
+    utils::Logger::info("Planning waves for warehouse: {}", warehouseId);
+    
+    try {
+        // Every limit is optional, so an empty body plans with the defaults
+        std::string body(std::istreambuf_iterator<char>(request.stream()), {});
+        json options = body.empty() ? json::object() : json::parse(body);
+        if (!options.is_object()) {
+            throw std::invalid_argument("Request body must be a JSON object");
+        }
+        
+        models::WaveConstraints constraints;
+        if (options.contains("cutoff") && !options["cutoff"].is_null()) {
+            constraints.cutoff = parseTimestamp(options["cutoff"].get<std::string>());
+        }
+        constraints.maxLinesPerWave = positiveLimit(options, "maxLinesPerWave", constraints.maxLinesPerWave);
+        constraints.maxStopsPerWave = positiveLimit(options, "maxStopsPerWave", constraints.maxStopsPerWave);
+        constraints.maxOrdersPerWave = positiveLimit(options, "maxOrdersPerWave", constraints.maxOrdersPerWave);
+        
+        auto dto = service_->plan(warehouseId, constraints);
+        sendJsonResponse(response, 200, dto.toJson().dump());
+    } catch (const json::exception& e) {
+        utils::Logger::error("JSON parse error: {}", e.what());
+        sendErrorResponse(response, 400, "Invalid JSON");
+    } catch (const std::invalid_argument& e) {
+        utils::Logger::error("Validation error in handlePlan: {}", e.what());
+        sendErrorResponse(response, 400, e.what());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handlePlan: {}", e.what());
+        sendErrorResponse(response, 500, "Failed to plan waves");
+    }
+}
+
+void WaveController::sendJsonResponse(
+    Poco::Net::HTTPServerResponse& response,
+    int status,
+    const std::string& body
+) {
+    response.setStatus(static_cast<Poco::Net::HTTPResponse::HTTPStatus>(status));
+    response.setContentType("application/json");
+    response.setContentLength(body.length());
+    
+    std::ostream& out = response.send();
+    out << body;
+}
+
+void WaveController::sendErrorResponse(
+    Poco::Net::HTTPServerResponse& response,
+    int status,
+    const std::string& message
+) {
+    json errorJson = {
+        {"error", message},
+        {"status", status}
+    };
+    
+    sendJsonResponse(response, status, errorJson.dump());
+}
+
+std::string WaveController::extractWarehouseIdFromPath(const std::string& path) {
+    if (path.size() <= kPrefix.size() + kSuffix.size() ||
+        path.compare(0, kPrefix.size(), kPrefix) != 0 ||
+        path.compare(path.size() - kSuffix.size(), kSuffix.size(), kSuffix) != 0) {
+        return "";
+    }
+    auto id = path.substr(kPrefix.size(), path.size() - kPrefix.size() - kSuffix.size());
+    return id.find('/') == std::string::npos ? id : "";
+}
+
+} // namespace order::controllers
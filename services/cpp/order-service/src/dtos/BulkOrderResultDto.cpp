@@ -0,0 +1,83 @@
+#include "order/dtos/BulkOrderResultDto.hpp"
+#include <stdexcept>
+
+namespace order {
+namespace dtos {
+
+BulkOrderItemResultDto::BulkOrderItemResultDto(
+    int line,
+    const std::string& status,
+    const std::optional<std::string>& orderNumber,
+    const std::optional<std::string>& orderId,
+    const std::optional<std::string>& message)
+    : line_(line)
+    , status_(status)
+    , orderNumber_(orderNumber)
+    , orderId_(orderId)
+    , message_(message) {
+    
+    if (line_ < 1) {
+        throw std::invalid_argument("line must be positive (greater than 0)");
+    }
+    if (status_ != "created" && status_ != "rejected" && status_ != "failed") {
+        throw std::invalid_argument("status must be created, rejected or failed");
+    }
+    if (status_ == "created" && !orderId_) {
+        throw std::invalid_argument("orderId is required for created orders");
+    }
+}
+
+json BulkOrderItemResultDto::toJson() const {
+    json j = {
+        {"line", line_},
+        {"status", status_}
+    };
+    
+    if (orderNumber_) j["orderNumber"] = *orderNumber_;
+    if (orderId_) j["orderId"] = *orderId_;
+    if (message_) j["message"] = *message_;
+    
+    return j;
+}
+
+BulkOrderResultDto::BulkOrderResultDto(
+    int received,
+    int created,
+    int rejected,
+    int failed,
+    const std::vector<BulkOrderItemResultDto>& results)
+    : received_(received)
+    , created_(created)
+    , rejected_(rejected)
+    , failed_(failed)
+    , results_(results) {
+    
+    validateNonNegativeInteger(received_, "received");
+    validateNonNegativeInteger(created_, "created");
+    validateNonNegativeInteger(rejected_, "rejected");
+    validateNonNegativeInteger(failed_, "failed");
+}
+
+void BulkOrderResultDto::validateNonNegativeInteger(int value, const std::string& fieldName) const {
+    if (value < 0) {
+        throw std::invalid_argument(fieldName + " must be non-negative");
+    }
+}
+
+json BulkOrderResultDto::toJson() const {
+    json resultsJson = json::array();
+    for (const auto& result : results_) {
+        resultsJson.push_back(result.toJson());
+    }
+    
+    return {
+        {"received", received_},
+        {"created", created_},
+        {"rejected", rejected_},
+        {"failed", failed_},
+        {"results", resultsJson}
+    };
+}
+
+} // namespace dtos
+} // namespace order
@@ -18,6 +18,7 @@ OrderDto::OrderDto(
     const std::string& status,
     int totalItems,
     int totalQuantity,
+    const models::Money& total,
     const std::string& createdAt,
     const std::string& updatedAt,
     const std::optional<std::string>& customerName,
@@ -41,6 +42,7 @@ OrderDto::OrderDto(
     , status_(status)
     , totalItems_(totalItems)
     , totalQuantity_(totalQuantity)
+    , total_(total)
     , createdAt_(createdAt)
     , updatedAt_(updatedAt)
     , customerName_(customerName)
@@ -137,6 +139,8 @@ json OrderDto::toJson() const {
         {"status", status_},
         {"totalItems", totalItems_},
         {"totalQuantity", totalQuantity_},
+        {"total", total_.toDouble()},
+        {"currency", std::string(total_.currency())},
         {"createdAt", createdAt_},
         {"updatedAt", updatedAt_}
     };
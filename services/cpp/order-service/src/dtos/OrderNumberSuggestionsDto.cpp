@@ -0,0 +1,29 @@
+#include "order/dtos/OrderNumberSuggestionsDto.hpp"
+#include <stdexcept>
+
+namespace order {
+namespace dtos {
+
+OrderNumberSuggestionsDto::OrderNumberSuggestionsDto(
+    const std::string& prefix,
+    const std::vector<std::string>& orderNumbers,
+    const std::vector<std::string>& orderIds)
+    : prefix_(prefix)
+    , orderNumbers_(orderNumbers)
+    , orderIds_(orderIds) {
+    
+    if (orderIds_.size() != orderNumbers_.size()) {
+        throw std::invalid_argument("orderIds must match orderNumbers");
+    }
+}
+
+json OrderNumberSuggestionsDto::toJson() const {
+    return {
+        {"prefix", prefix_},
+        {"orderNumbers", orderNumbers_},
+        {"orderIds", orderIds_}
+    };
+}
+
+} // namespace dtos
+} // namespace order
@@ -0,0 +1,41 @@
+#include "order/dtos/OrderSearchResultDto.hpp"
+#include <stdexcept>
+
+namespace order {
+namespace dtos {
+
+OrderSearchResultDto::OrderSearchResultDto(
+    const std::vector<OrderDto>& items,
+    int limit,
+    const std::optional<std::string>& nextCursor)
+    : items_(items)
+    , limit_(limit)
+    , nextCursor_(nextCursor) {
+    
+    if (limit_ < 1) {
+        throw std::invalid_argument("limit must be positive (greater than 0)");
+    }
+    if (items_.size() > static_cast<std::size_t>(limit_)) {
+        throw std::invalid_argument("items must not exceed limit");
+    }
+}
+
+json OrderSearchResultDto::toJson() const {
+    json itemsJson = json::array();
+    for (const auto& item : items_) {
+        itemsJson.push_back(item.toJson());
+    }
+    
+    json j = {
+        {"items", itemsJson},
+        {"count", items_.size()},
+        {"limit", limit_}
+    };
+    
+    if (nextCursor_) j["nextCursor"] = *nextCursor_;
+    
+    return j;
+}
+
+} // namespace dtos
+} // namespace order
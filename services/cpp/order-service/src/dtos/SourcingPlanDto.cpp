@@ -0,0 +1,93 @@
+#include "order/dtos/SourcingPlanDto.hpp"
+#include <stdexcept>
+
+namespace order {
+namespace dtos {
+
+SourcedLineDto::SourcedLineDto(const std::string& lineItemId, const std::string& productId, int quantity)
+    : lineItemId_(lineItemId)
+    , productId_(productId)
+    , quantity_(quantity) {
+    
+    if (quantity_ < 1) {
+        throw std::invalid_argument("quantity must be positive (greater than 0)");
+    }
+}
+
+json SourcedLineDto::toJson() const {
+    return {
+        {"lineItemId", lineItemId_},
+        {"productId", productId_},
+        {"quantity", quantity_}
+    };
+}
+
+ShipmentDto::ShipmentDto(const std::string& warehouseId, const std::vector<SourcedLineDto>& lines)
+    : warehouseId_(warehouseId)
+    , lines_(lines) {
+    
+    if (warehouseId_.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+    if (lines_.empty()) {
+        throw std::invalid_argument("A shipment must contain at least one line");
+    }
+}
+
+json ShipmentDto::toJson() const {
+    json linesJson = json::array();
+    int units = 0;
+    for (const auto& line : lines_) {
+        linesJson.push_back(line.toJson());
+        units += line.getQuantity();
+    }
+    
+    return {
+        {"warehouseId", warehouseId_},
+        {"units", units},
+        {"lines", linesJson}
+    };
+}
+
+SourcingPlanDto::SourcingPlanDto(
+    const std::string& orderId,
+    const std::vector<ShipmentDto>& shipments,
+    const std::vector<SourcedLineDto>& backordered,
+    std::int64_t cost,
+    bool exact)
+    : orderId_(orderId)
+    , shipments_(shipments)
+    , backordered_(backordered)
+    , cost_(cost)
+    , exact_(exact) {
+    
+    if (orderId_.empty()) {
+        throw std::invalid_argument("orderId is required");
+    }
+    if (cost_ < 0) {
+        throw std::invalid_argument("cost must be non-negative");
+    }
+}
+
+json SourcingPlanDto::toJson() const {
+    json shipmentsJson = json::array();
+    for (const auto& shipment : shipments_) {
+        shipmentsJson.push_back(shipment.toJson());
+    }
+    json backorderedJson = json::array();
+    for (const auto& line : backordered_) {
+        backorderedJson.push_back(line.toJson());
+    }
+    
+    return {
+        {"orderId", orderId_},
+        {"shipmentCount", shipments_.size()},
+        {"shipments", shipmentsJson},
+        {"backordered", backorderedJson},
+        {"cost", cost_},
+        {"exact", exact_}
+    };
+}
+
+} // namespace dtos
+} // namespace order
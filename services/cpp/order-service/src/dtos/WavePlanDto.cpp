@@ -0,0 +1,87 @@
+#include "order/dtos/WavePlanDto.hpp"
+#include <stdexcept>
+
+namespace order {
+namespace dtos {
+
+WaveDto::WaveDto(
+    int waveNumber,
+    const std::string& priority,
+    bool dueByCutoff,
+    const std::optional<std::string>& earliestShipBy,
+    const std::vector<std::string>& orderIds,
+    const std::vector<std::string>& orderNumbers,
+    int lineCount,
+    int stopCount)
+    : waveNumber_(waveNumber)
+    , priority_(priority)
+    , dueByCutoff_(dueByCutoff)
+    , earliestShipBy_(earliestShipBy)
+    , orderIds_(orderIds)
+    , orderNumbers_(orderNumbers)
+    , lineCount_(lineCount)
+    , stopCount_(stopCount) {
+    
+    if (waveNumber_ < 1) {
+        throw std::invalid_argument("waveNumber must be positive (greater than 0)");
+    }
+    if (orderIds_.empty()) {
+        throw std::invalid_argument("A wave must contain at least one order");
+    }
+    if (orderNumbers_.size() != orderIds_.size()) {
+        throw std::invalid_argument("orderNumbers must match orderIds");
+    }
+    if (lineCount_ < 1 || stopCount_ < 1) {
+        throw std::invalid_argument("lineCount and stopCount must be positive (greater than 0)");
+    }
+}
+
+json WaveDto::toJson() const {
+    json j = {
+        {"waveNumber", waveNumber_},
+        {"priority", priority_},
+        {"dueByCutoff", dueByCutoff_},
+        {"orderIds", orderIds_},
+        {"orderNumbers", orderNumbers_},
+        {"orderCount", orderIds_.size()},
+        {"lineCount", lineCount_},
+        {"stopCount", stopCount_}
+    };
+    
+    if (earliestShipBy_) j["earliestShipBy"] = *earliestShipBy_;
+    
+    return j;
+}
+
+WavePlanDto::WavePlanDto(
+    const std::string& warehouseId,
+    int orderCount,
+    const std::vector<WaveDto>& waves)
+    : warehouseId_(warehouseId)
+    , orderCount_(orderCount)
+    , waves_(waves) {
+    
+    if (warehouseId_.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+    if (orderCount_ < 0) {
+        throw std::invalid_argument("orderCount must be non-negative");
+    }
+}
+
+json WavePlanDto::toJson() const {
+    json wavesJson = json::array();
+    for (const auto& wave : waves_) {
+        wavesJson.push_back(wave.toJson());
+    }
+    
+    return {
+        {"warehouseId", warehouseId_},
+        {"orderCount", orderCount_},
+        {"waveCount", waves_.size()},
+        {"waves", wavesJson}
+    };
+}
+
+} // namespace dtos
+} // namespace order
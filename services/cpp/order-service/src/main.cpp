@@ -1,9 +1,18 @@
 #include "order/Server.hpp"
 #include "order/services/OrderService.hpp"
+#include "order/services/WaveService.hpp"
 #include "order/repositories/OrderRepository.hpp"
+#include "order/repositories/IdempotencyRepository.hpp"
+#include "order/repositories/OrderNumberBlockRepository.hpp"
+#include "order/repositories/OrderExportRepository.hpp"
 #include "order/utils/Config.hpp"
+#include "order/utils/Database.hpp"
 #include "order/utils/Logger.hpp"
+#include "order/utils/RabbitMqMessageBus.hpp"
+#include "order/utils/RabbitMqMessageConsumer.hpp"
 #include <csignal>
+#include <string>
+#include <unordered_map>
 #include <atomic>
 
 std::atomic<bool> running(true);
@@ -34,13 +43,92 @@ int main(int argc, char** argv) {
             config.set("server.port", std::atoi(portEnv));
         }
         
+        config.setFromEnv("database.host", "DATABASE_HOST");
+        config.setFromEnv("database.database", "DATABASE_NAME");
+        config.setFromEnv("database.user", "DATABASE_USER");
+        config.setFromEnv("database.password", "DATABASE_PASSWORD");
+        const char* dbPortEnv = std::getenv("DATABASE_PORT");
+        if (dbPortEnv) {
+            config.set("database.port", std::atoi(dbPortEnv));
+        }
+        config.setFromEnv("messageBus.host", "RABBITMQ_HOST");
+        config.setFromEnv("messageBus.virtualHost", "RABBITMQ_VHOST");
+        config.setFromEnv("messageBus.username", "RABBITMQ_USER");
+        config.setFromEnv("messageBus.password", "RABBITMQ_PASSWORD");
+        
+        // Connect to database
+        auto dbConfig = config.getDatabaseConfig();
+        const std::string connectionString =
+            "host=" + dbConfig.host +
+            " port=" + std::to_string(dbConfig.port) +
+            " dbname=" + dbConfig.database +
+            " user=" + dbConfig.user +
+            " password=" + dbConfig.password;
+        auto connection = order::utils::Database::connect(connectionString);
+        order::utils::Logger::info("Connected to database {} on {}", dbConfig.database, dbConfig.host);
+        
+        order::utils::Logger::info("Initializing RabbitMQ message bus...");
+        const order::utils::MessageBus::Config busConfig{
+            .host = config.getString("messageBus.host", "rabbitmq"),
+            .port = config.getInt("messageBus.port", 5672),
+            .virtual_host = config.getString("messageBus.virtualHost", "/"),
+            .username = config.getString("messageBus.username", "warehouse"),
+            .password = config.getString("messageBus.password", "warehouse_dev"),
+            .exchange = config.getString("messageBus.exchange", "warehouse.events"),
+            .routing_key_prefix = config.getString("messageBus.routingKeyPrefix", "order.")
+        };
+        auto messageBus = std::make_shared<order::utils::RabbitMqMessageBus>(busConfig);
+        
         // Create dependencies
-        auto repository = std::make_shared<order::repositories::OrderRepository>();
-        auto service = std::make_shared<order::services::OrderService>(repository);
+        auto repository = std::make_shared<order::repositories::OrderRepository>(connection);
+        
+        // Order numbers are reserved a block at a time on a connection of their own;
+        // orderNumbers.prefixes maps warehouse ids to the prefix their numbers carry
+        std::unordered_map<std::string, std::string> numberPrefixes;
+        if (auto prefixes = config.getJson("orderNumbers.prefixes"); prefixes && prefixes->is_object()) {
+            for (const auto& [warehouseId, prefix] : prefixes->items()) {
+                numberPrefixes.emplace(warehouseId, prefix.get<std::string>());
+            }
+        }
+        auto numberAllocator = std::make_shared<order::utils::OrderNumberAllocator>(
+            std::make_shared<order::repositories::OrderNumberBlockRepository>(
+                std::make_shared<pqxx::connection>(connectionString)),
+            static_cast<std::size_t>(config.getInt("orderNumbers.blockSize",
+                static_cast<int>(order::utils::OrderNumberAllocator::kDefaultBlockSize))),
+            numberPrefixes,
+            config.getString("orderNumbers.defaultPrefix", order::utils::OrderNumberAllocator::kDefaultPrefix));
+        
+        // Each export opens a connection of its own for as long as it streams
+        auto exports = std::make_shared<order::repositories::OrderExportRepository>(connectionString);
+        
+        auto service = std::make_shared<order::services::OrderService>(
+            repository, messageBus, numberAllocator, exports);
+        auto waveService = std::make_shared<order::services::WaveService>(repository);
+        service->loadFulfilmentQueue();
+        service->loadOrderNumberIndex();
+        
+        // Idempotency keys get their own connection so they never wait on order queries
+        auto idempotency = std::make_shared<order::utils::IdempotencyStore>(
+            std::make_shared<order::repositories::IdempotencyRepository>(
+                std::make_shared<pqxx::connection>(connectionString)),
+            std::chrono::hours(config.getInt("idempotency.ttlHours", 24)));
+        
+        // Reservation saga: inventory-service answers order.inventory.reserve
+        // with one of these, which confirms or cancels the pending order
+        const std::string reservedKey = "inventory.order.reserved";
+        order::utils::RabbitMqMessageConsumer reservationReplies(
+            busConfig,
+            config.getString("messageBus.reservationQueue", "order-service.stock-reservations"),
+            {reservedKey, "inventory.order.reservation-failed"},
+            [service, reservedKey](const std::string& routingKey, const nlohmann::json& payload) {
+                service->applyStockReservation(
+                    order::models::StockReservationReply::fromJson(payload, routingKey == reservedKey));
+            });
+        reservationReplies.start();
         
         // Create and start server
         order::Config serverConfig = config.getServerConfig();
-        order::Server server(serverConfig, service);
+        order::Server server(serverConfig, service, waveService, idempotency);
         
         // Set up signal handling
         std::signal(SIGINT, signalHandler);
@@ -56,6 +144,8 @@ int main(int argc, char** argv) {
         }
         
         server.stop();
+        reservationReplies.stop();
+        order::utils::Database::disconnect();
         order::utils::Logger::info("Order Service stopped");
         
         return 0;
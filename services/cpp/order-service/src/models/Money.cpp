@@ -0,0 +1,183 @@
+#include "order/models/Money.hpp"
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace order {
+namespace models {
+
+namespace {
+
+[[noreturn]] void outOfRange() {
+    throw std::invalid_argument("Money amount out of range");
+}
+
+} // namespace
+
+Money::Money(std::int64_t minorUnits, std::string_view currency) : minor_(minorUnits) {
+    if (!isValidCurrency(currency)) {
+        throw std::invalid_argument("Invalid currency code: " + std::string(currency));
+    }
+    currency_ = {currency[0], currency[1], currency[2]};
+}
+
+bool Money::isValidCurrency(std::string_view currency) {
+    if (currency.size() != 3) {
+        return false;
+    }
+    for (char c : currency) {
+        if (c < 'A' || c > 'Z') {
+            return false;
+        }
+    }
+    return true;
+}
+
+Money Money::parse(std::string_view amount, std::string_view currency) {
+    auto invalid = [&amount]() {
+        return std::invalid_argument("Invalid money amount: " + std::string(amount));
+    };
+
+    std::string_view digits = amount;
+    bool negative = false;
+    if (!digits.empty() && (digits.front() == '-' || digits.front() == '+')) {
+        negative = digits.front() == '-';
+        digits.remove_prefix(1);
+    }
+
+    auto point = digits.find('.');
+    auto whole = digits.substr(0, point);
+    auto fraction = point == std::string_view::npos ? std::string_view{} : digits.substr(point + 1);
+    if ((whole.empty() && fraction.empty()) || fraction.size() > kScale ||
+        (point != std::string_view::npos && fraction.empty())) {
+        throw invalid();
+    }
+
+    // from_chars accepts a leading '-', which must not appear past the sign we stripped
+    auto readDigits = [&invalid](std::string_view text) -> std::int64_t {
+        if (text.empty()) {
+            return 0;
+        }
+        if (text.front() < '0' || text.front() > '9') {
+            throw invalid();
+        }
+        std::int64_t value = 0;
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec == std::errc::result_out_of_range) {
+            outOfRange();
+        }
+        if (ec != std::errc{} || end != text.data() + text.size()) {
+            throw invalid();
+        }
+        return value;
+    };
+
+    std::int64_t minor = 0;
+    auto cents = readDigits(fraction) * (fraction.size() == 1 ? 10 : 1);
+    if (__builtin_mul_overflow(readDigits(whole), kMinorPerMajor, &minor) ||
+        __builtin_add_overflow(minor, cents, &minor)) {
+        outOfRange();
+    }
+    return Money(negative ? -minor : minor, currency);
+}
+
+Money Money::fromDouble(double amount, std::string_view currency) {
+    auto scaled = std::round(amount * kMinorPerMajor);
+    // 2^63 is exactly representable; anything at or past it does not fit
+    if (!std::isfinite(scaled) || std::fabs(scaled) >= 9.2233720368547758e18) {
+        outOfRange();
+    }
+    return Money(static_cast<std::int64_t>(scaled), currency);
+}
+
+Money Money::fromJson(const json& j, std::string_view currency) {
+    if (j.is_string()) {
+        return parse(j.get_ref<const std::string&>(), currency);
+    }
+    if (j.is_number_integer()) {
+        std::int64_t minor = 0;
+        if (__builtin_mul_overflow(j.get<std::int64_t>(), kMinorPerMajor, &minor)) {
+            outOfRange();
+        }
+        return Money(minor, currency);
+    }
+    if (j.is_number()) {
+        return fromDouble(j.get<double>(), currency);
+    }
+    throw std::invalid_argument("Money amount must be a number or decimal string");
+}
+
+double Money::toDouble() const {
+    // One correctly rounded division gives the double nearest the decimal value
+    return static_cast<double>(minor_) / kMinorPerMajor;
+}
+
+char* Money::format(char* first, char* last) const {
+    // Work in unsigned so INT64_MIN has a magnitude
+    auto magnitude = static_cast<std::uint64_t>(minor_);
+    if (minor_ < 0) {
+        *first++ = '-';
+        magnitude = 0 - magnitude;
+    }
+    auto whole = magnitude / kMinorPerMajor;
+    auto cents = static_cast<unsigned>(magnitude % kMinorPerMajor);
+
+    first = std::to_chars(first, last, whole).ptr;
+    *first++ = '.';
+    *first++ = static_cast<char>('0' + cents / 10);
+    *first++ = static_cast<char>('0' + cents % 10);
+    return first;
+}
+
+std::string Money::toString() const {
+    char buffer[kMaxFormattedLength];
+    return std::string(buffer, format(buffer, buffer + sizeof(buffer)));
+}
+
+void Money::requireSameCurrency(const Money& other) const {
+    if (currency_ != other.currency_) {
+        throw std::invalid_argument("Currency mismatch: " + std::string(currency()) +
+                                    " and " + std::string(other.currency()));
+    }
+}
+
+Money& Money::operator+=(const Money& other) {
+    requireSameCurrency(other);
+    std::int64_t result = 0;
+    if (__builtin_add_overflow(minor_, other.minor_, &result)) {
+        outOfRange();
+    }
+    minor_ = result;
+    return *this;
+}
+
+Money& Money::operator-=(const Money& other) {
+    requireSameCurrency(other);
+    std::int64_t result = 0;
+    if (__builtin_sub_overflow(minor_, other.minor_, &result)) {
+        outOfRange();
+    }
+    minor_ = result;
+    return *this;
+}
+
+Money Money::operator+(const Money& other) const {
+    Money result = *this;
+    return result += other;
+}
+
+Money Money::operator-(const Money& other) const {
+    Money result = *this;
+    return result -= other;
+}
+
+Money Money::operator*(std::int64_t quantity) const {
+    Money result = *this;
+    if (__builtin_mul_overflow(minor_, quantity, &result.minor_)) {
+        outOfRange();
+    }
+    return result;
+}
+
+} // namespace models
+} // namespace order
@@ -1,6 +1,5 @@
 #include "order/models/Order.hpp"
 #include <stdexcept>
-#include <numeric>
 
 namespace order {
 namespace models {
@@ -94,10 +93,9 @@ Address Address::fromJson(const json& j) {
 // OrderLineItem implementation
 OrderLineItem::OrderLineItem(const std::string& id, const std::string& productId,
                              const std::string& productSku, const std::string& productName,
-                             int quantity, double unitPrice)
-    : id_(id), productId_(productId), productSku_(productSku), productName_(productName),
-      quantity_(quantity), unitPrice_(unitPrice) {
-    lineTotal_ = quantity * unitPrice;
+                             int quantity, const Money& unitPrice)
+    : id(id), productId(productId), productSku(productSku), productName(productName),
+      quantity(quantity), unitPrice(unitPrice), lineTotal(unitPrice * quantity) {
 }
 
 json OrderLineItem::toJson() const {
@@ -107,8 +105,8 @@ json OrderLineItem::toJson() const {
         {"productSku", productSku},
         {"productName", productName},
         {"quantity", quantity},
-        {"unitPrice", unitPrice},
-        {"lineTotal", lineTotal}
+        {"unitPrice", unitPrice.toDouble()},
+        {"lineTotal", lineTotal.toDouble()}
     };
     
     if (notes) j["notes"] = *notes;
@@ -116,15 +114,15 @@ json OrderLineItem::toJson() const {
     return j;
 }
 
-OrderLineItem OrderLineItem::fromJson(const json& j) {
+OrderLineItem OrderLineItem::fromJson(const json& j, std::string_view currency) {
     OrderLineItem item;
     item.id = j.at("id").get<std::string>();
     item.productId = j.at("productId").get<std::string>();
     item.productSku = j.at("productSku").get<std::string>();
     item.productName = j.at("productName").get<std::string>();
     item.quantity = j.at("quantity").get<int>();
-    item.unitPrice = j.at("unitPrice").get<double>();
-    item.lineTotal = j.at("lineTotal").get<double>();
+    item.unitPrice = Money::fromJson(j.at("unitPrice"), currency);
+    item.lineTotal = Money::fromJson(j.at("lineTotal"), currency);
     
     if (j.contains("notes") && !j["notes"].is_null()) {
         item.notes = j["notes"].get<std::string>();
@@ -142,10 +140,11 @@ Order::Order(const std::string& id, const std::string& orderNumber,
 }
 
 void Order::calculateTotal() {
-    total_ = std::accumulate(lineItems_.begin(), lineItems_.end(), 0.0,
-        [](double sum, const OrderLineItem& item) {
-            return sum + item.lineTotal;
-        });
+    Money total(0, total_.currency());
+    for (const auto& item : lineItems_) {
+        total += item.lineTotal;
+    }
+    total_ = total;
 }
 
 bool Order::canBeCancelled() const {
@@ -170,7 +169,8 @@ json Order::toJson() const {
         {"warehouseId", warehouseId_},
         {"status", orderStatusToString(status_)},
         {"orderDate", orderDate_},
-        {"total", total_},
+        {"total", total_.toDouble()},
+        {"currency", std::string(total_.currency())},
         {"priority", orderPriorityToString(priority_)}
     };
     
@@ -199,12 +199,13 @@ json Order::toJson() const {
 Order Order::fromJson(const json& j) {
     Order order;
     order.id_ = j.at("id").get<std::string>();
-    order.orderNumber_ = j.at("orderNumber").get<std::string>();
+    order.orderNumber_ = j.value("orderNumber", std::string());   // empty: allocated on create
     order.customerId_ = j.at("customerId").get<std::string>();
     order.warehouseId_ = j.at("warehouseId").get<std::string>();
     order.status_ = orderStatusFromString(j.at("status").get<std::string>());
     order.orderDate_ = j.at("orderDate").get<std::string>();
-    order.total_ = j.at("total").get<double>();
+    auto currency = j.value("currency", std::string(Money::kDefaultCurrency));
+    order.total_ = Money::fromJson(j.at("total"), currency);
     
     if (j.contains("priority")) {
         order.priority_ = orderPriorityFromString(j.at("priority").get<std::string>());
@@ -235,7 +236,7 @@ Order Order::fromJson(const json& j) {
     
     if (j.contains("lineItems") && j["lineItems"].is_array()) {
         for (const auto& itemJson : j["lineItems"]) {
-            order.lineItems_.push_back(OrderLineItem::fromJson(itemJson));
+            order.lineItems_.push_back(OrderLineItem::fromJson(itemJson, currency));
         }
     }
     
@@ -0,0 +1,49 @@
+#include "order/models/StockReservation.hpp"
+#include <stdexcept>
+
+namespace order {
+namespace models {
+
+StockReservationRequest StockReservationRequest::fromOrder(const Order& order) {
+    StockReservationRequest request;
+    request.orderId = order.getId();
+    request.warehouseId = order.getWarehouseId();
+    request.lines.reserve(order.getLineItems().size());
+    for (const auto& item : order.getLineItems()) {
+        request.lines.push_back({item.id, item.productId, item.quantity});
+    }
+    return request;
+}
+
+json StockReservationRequest::toJson() const {
+    json items = json::array();
+    for (const auto& line : lines) {
+        items.push_back({
+            {"lineItemId", line.lineItemId},
+            {"productId", line.productId},
+            {"quantity", line.quantity}
+        });
+    }
+    return {
+        {"orderId", orderId},
+        {"warehouseId", warehouseId},
+        {"lines", items}
+    };
+}
+
+StockReservationReply StockReservationReply::fromJson(const json& j, bool reserved) {
+    if (!j.contains("orderId") || !j["orderId"].is_string()) {
+        throw std::invalid_argument("Reservation reply is missing orderId");
+    }
+
+    StockReservationReply reply;
+    reply.orderId = j["orderId"].get<std::string>();
+    reply.reserved = reserved;
+    if (j.contains("reason") && j["reason"].is_string()) {
+        reply.reason = j["reason"].get<std::string>();
+    }
+    return reply;
+}
+
+} // namespace models
+} // namespace order
@@ -0,0 +1,78 @@
+#include "order/repositories/OrderExportRepository.hpp"
+#include "order/repositories/OrderRepository.hpp"
+#include "order/utils/Logger.hpp"
+#include <pqxx/pqxx>
+
+namespace order::repositories {
+
+OrderExportRepository::OrderExportRepository(std::string connectionString)
+    : connectionString_(std::move(connectionString)) {}
+
+const std::vector<utils::ExportColumn>& OrderExportRepository::columns() {
+    static const std::vector<utils::ExportColumn> catalogue = {
+        {"orderId", "o.id::text"},
+        {"orderNumber", "o.order_number"},
+        {"customerId", "o.customer_id"},
+        {"warehouseId", "o.warehouse_id::text"},
+        {"warehouseCode", "o.warehouse_code"},
+        {"status", "o.status"},
+        {"priority", "o.priority"},
+        {"orderDate", "to_char(o.order_date, 'YYYY-MM-DD\"T\"HH24:MI:SS\"Z\"')"},
+        {"shipByDate", "to_char(o.ship_by_date, 'YYYY-MM-DD\"T\"HH24:MI:SS\"Z\"')"},
+        {"currency", "o.currency"},
+        {"orderTotal", "o.total::text", true},
+        {"lineNumber", "l.line_number::text", true},
+        {"productId", "l.product_id::text"},
+        {"productSku", "l.product_sku"},
+        {"productName", "l.product_name"},
+        {"quantity", "l.quantity::text", true},
+        {"unitPrice", "l.unit_price::text", true},
+        {"lineTotal", "l.line_total::text", true},
+    };
+    return catalogue;
+}
+
+void OrderExportRepository::exportLines(const models::OrderSearchCriteria& criteria,
+                                        const std::vector<utils::ExportColumn>& columns,
+                                        const BatchHandler& onBatch) {
+    std::string select;
+    for (const auto& column : columns) {
+        select += (select.empty() ? "" : ", ") + column.expression;
+    }
+
+    int placeholders = 0;
+    pqxx::params params;
+    std::string sql = "SELECT " + select + " FROM orders o "
+                      "LEFT JOIN order_line_items l ON l.order_id = o.id WHERE TRUE";
+    OrderRepository::appendCriteria(criteria, sql, params, placeholders);
+    sql += " ORDER BY o.order_date, o.id, l.line_number";
+
+    pqxx::connection db(connectionString_);
+    pqxx::read_transaction txn(db);
+    txn.exec_params("DECLARE order_export NO SCROLL CURSOR FOR " + sql, params);
+
+    const std::string fetch = "FETCH " + std::to_string(kFetchSize) + " FROM order_export";
+    std::size_t total = 0;
+    std::vector<Row> batch;
+    while (true) {
+        auto result = txn.exec(fetch);
+        batch.clear();
+        batch.reserve(result.size());
+        for (const auto& row : result) {
+            Row values;
+            values.reserve(columns.size());
+            for (std::size_t i = 0; i < columns.size(); ++i) {
+                values.push_back(row[i].is_null() ? std::nullopt : std::optional<std::string>(row[i].c_str()));
+            }
+            batch.push_back(std::move(values));
+        }
+        onBatch(batch);
+        total += batch.size();
+        if (result.size() < kFetchSize) {
+            break;
+        }
+    }
+    utils::Logger::info("Exported {} order lines", total);
+}
+
+} // namespace order::repositories
@@ -0,0 +1,28 @@
+#include "order/repositories/OrderNumberBlockRepository.hpp"
+#include "order/utils/Logger.hpp"
+#include <stdexcept>
+
+namespace order::repositories {
+
+OrderNumberBlockRepository::OrderNumberBlockRepository(std::shared_ptr<pqxx::connection> db)
+    : db_(std::move(db)) {
+    db_->prepare("order_number_reserve_block",
+        "UPDATE order_number_blocks SET next_value = next_value + $1 "
+        "WHERE name = 'orders' RETURNING next_value - $1");
+}
+
+std::int64_t OrderNumberBlockRepository::reserveBlock(std::size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+    auto result = txn.exec_prepared("order_number_reserve_block", static_cast<std::int64_t>(size));
+    txn.commit();
+
+    if (result.empty()) {
+        throw std::runtime_error("order_number_blocks has no 'orders' row");
+    }
+    auto first = result[0][0].as<std::int64_t>();
+    utils::Logger::debug("Reserved order numbers {}..{}", first, first + static_cast<std::int64_t>(size) - 1);
+    return first;
+}
+
+} // namespace order::repositories
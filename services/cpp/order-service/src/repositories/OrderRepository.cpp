@@ -1,55 +1,662 @@
 #include "order/repositories/OrderRepository.hpp"
 #include "order/utils/Logger.hpp"
+#include <algorithm>
+#include <regex>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace order::repositories {
 
+namespace {
+
+bool isValidUuid(const std::string& id) {
+    static const std::regex uuid_regex(
+        R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}$)"
+    );
+    return std::regex_match(id, uuid_regex);
+}
+
+// Order header in the shape Order::fromJson reads; nulls are stripped so
+// optional fields stay absent. Amounts go out as NUMERIC text, which Money
+// parses exactly; a JSON number would round through double on the way in.
+const std::string ORDER_JSON = R"(
+    jsonb_strip_nulls(jsonb_build_object(
+        'id', o.id::text,
+        'orderNumber', o.order_number,
+        'customerId', o.customer_id,
+        'warehouseId', o.warehouse_id::text,
+        'WarehouseCode', o.warehouse_code,
+        'WarehouseName', o.warehouse_name,
+        'status', o.status,
+        'priority', o.priority,
+        'orderDate', to_char(o.order_date, 'YYYY-MM-DD"T"HH24:MI:SS"Z"'),
+        'shipByDate', to_char(o.ship_by_date, 'YYYY-MM-DD"T"HH24:MI:SS"Z"'),
+        'total', o.total::text,
+        'currency', o.currency,
+        'notes', o.notes,
+        'cancellationReason', o.cancellation_reason,
+        'shippingAddress', o.shipping_address,
+        'billingAddress', o.billing_address
+    )))";
+
+const std::string LINE_ITEM_JSON = R"(
+    jsonb_strip_nulls(jsonb_build_object(
+        'id', l.id::text,
+        'productId', l.product_id::text,
+        'productSku', l.product_sku,
+        'productName', l.product_name,
+        'quantity', l.quantity,
+        'unitPrice', l.unit_price::text,
+        'lineTotal', l.line_total::text,
+        'notes', l.notes
+    )))";
+
+// Unset filters are passed as NULL and match every row
+const std::string ORDER_FILTER = R"(
+    WHERE ($1::text IS NULL OR o.status = $1)
+      AND ($2::text IS NULL OR o.customer_id = $2)
+      AND ($3::uuid IS NULL OR o.warehouse_id = $3))";
+
+std::optional<std::string> jsonOrNull(const std::optional<models::Address>& address) {
+    if (!address) return std::nullopt;
+    return address->toJson().dump();
+}
+
+std::optional<std::string> emptyToNull(const std::string& value) {
+    if (value.empty()) return std::nullopt;
+    return value;
+}
+
+// Order numbers only use [A-Z0-9-], but escape anyway so LIKE never sees a wildcard
+std::string likePrefix(const std::string& prefix) {
+    std::string pattern;
+    pattern.reserve(prefix.size() + 1);
+    for (char c : prefix) {
+        if (c == '%' || c == '_' || c == '\\') {
+            pattern.push_back('\\');
+        }
+        pattern.push_back(c);
+    }
+    pattern.push_back('%');
+    return pattern;
+}
+
+} // namespace
+
+OrderRepository::OrderRepository(std::shared_ptr<pqxx::connection> db)
+    : db_(db) {
+    prepareStatements();
+}
+
+void OrderRepository::prepareStatements() {
+    // Single order with its lines aggregated in the same query
+    db_->prepare("order_find_by_id",
+        "SELECT (" + ORDER_JSON + " || jsonb_build_object('lineItems', COALESCE(li.items, '[]'::jsonb)))::text "
+        "FROM orders o "
+        "LEFT JOIN LATERAL ("
+        "    SELECT jsonb_agg(" + LINE_ITEM_JSON + " ORDER BY l.line_number) AS items "
+        "    FROM order_line_items l WHERE l.order_id = o.id"
+        ") li ON TRUE "
+        "WHERE o.id = $1::uuid");
+
+    // LIMIT NULL returns every row
+    db_->prepare("order_find_page",
+        "SELECT " + ORDER_JSON + "::text, COUNT(*) OVER () "
+        "FROM orders o " + ORDER_FILTER +
+        " ORDER BY o.order_date DESC, o.id DESC LIMIT $4 OFFSET $5");
+
+    db_->prepare("order_find_by_ids",
+        "SELECT " + ORDER_JSON + "::text FROM orders o WHERE o.id = ANY($1::uuid[])");
+
+    // Headers only: the release queue is keyed on priority and dates
+    db_->prepare("order_find_releasable",
+        "SELECT " + ORDER_JSON + "::text FROM orders o WHERE o.status IN ('pending', 'confirmed')");
+
+    db_->prepare("order_count",
+        "SELECT COUNT(*) FROM orders o " + ORDER_FILTER);
+
+    // Lines for a whole page of orders in one round trip
+    db_->prepare("order_line_items_for_orders",
+        "SELECT l.order_id::text, " + LINE_ITEM_JSON + "::text "
+        "FROM order_line_items l WHERE l.order_id = ANY($1::uuid[]) "
+        "ORDER BY l.order_id, l.line_number");
+
+    db_->prepare("order_insert",
+        "INSERT INTO orders (id, order_number, customer_id, warehouse_id, warehouse_code, warehouse_name, "
+        "status, priority, order_date, ship_by_date, total, currency, notes, cancellation_reason, "
+        "shipping_address, billing_address) "
+        "VALUES (COALESCE($1::uuid, uuid_generate_v4()), $2, $3, $4::uuid, $5, $6, $7, $8, "
+        "COALESCE($9::timestamp, CURRENT_TIMESTAMP), $10::timestamp, $11::numeric, $16, $12, $13, $14::jsonb, $15::jsonb) "
+        "RETURNING id::text");
+
+    db_->prepare("order_update",
+        "UPDATE orders SET order_number = $2, customer_id = $3, warehouse_id = $4::uuid, "
+        "warehouse_code = $5, warehouse_name = $6, status = $7, priority = $8, "
+        "order_date = COALESCE($9::timestamp, order_date), ship_by_date = $10::timestamp, total = $11::numeric, "
+        "currency = $16, notes = $12, cancellation_reason = $13, shipping_address = $14::jsonb, billing_address = $15::jsonb "
+        "WHERE id = $1::uuid");
+
+    // Compare-and-set on status, so a transition cannot overwrite a concurrent one
+    db_->prepare("order_transition_status",
+        "UPDATE orders SET status = $3, cancellation_reason = $4 "
+        "WHERE id = $1::uuid AND status = $2");
+
+    // One row per line; the planner only needs SKUs, not the full aggregate
+    db_->prepare("order_wave_lines",
+        "SELECT o.id::text, o.order_number, o.priority, EXTRACT(EPOCH FROM o.ship_by_date)::bigint, l.product_sku "
+        "FROM orders o JOIN order_line_items l ON l.order_id = o.id "
+        "WHERE o.warehouse_id = $1::uuid AND o.status = 'pending' "
+        "ORDER BY o.id, l.line_number");
+
+    db_->prepare("order_numbers", "SELECT id::text, order_number FROM orders");
+
+    db_->prepare("order_existing_numbers",
+        "SELECT order_number FROM orders WHERE order_number = ANY($1::text[])");
+
+    db_->prepare("order_delete", "DELETE FROM orders WHERE id = $1::uuid");
+
+    db_->prepare("order_line_items_delete", "DELETE FROM order_line_items WHERE order_id = $1::uuid");
+
+    // All lines of an order in one multi-row INSERT; line_number follows array order
+    db_->prepare("order_line_items_insert",
+        "INSERT INTO order_line_items (id, order_id, line_number, product_id, product_sku, product_name, "
+        "quantity, unit_price, line_total, notes) "
+        "SELECT COALESCE(NULLIF(i.id, '')::uuid, uuid_generate_v4()), $1::uuid, i.n, i.product_id::uuid, "
+        "i.product_sku, i.product_name, i.quantity, i.unit_price, i.line_total, i.notes "
+        "FROM unnest($2::text[], $3::text[], $4::text[], $5::text[], $6::int[], $7::numeric[], $8::numeric[], $9::text[]) "
+        "WITH ORDINALITY AS i(id, product_id, product_sku, product_name, quantity, unit_price, line_total, notes, n)");
+}
+
+std::optional<models::Order> OrderRepository::findByIdLocked(pqxx::transaction_base& txn, const std::string& id) {
+    auto result = txn.exec_prepared("order_find_by_id", id);
+    if (result.empty()) {
+        return std::nullopt;
+    }
+    return models::Order::fromJson(json::parse(result[0][0].c_str()));
+}
+
 std::optional<models::Order> OrderRepository::findById(const std::string& id) {
     utils::Logger::debug("OrderRepository::findById({})", id);
-    // TODO: Implement database query
-    return std::nullopt;
+    if (!isValidUuid(id)) {
+        throw std::invalid_argument("Invalid order id format");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::read_transaction txn(*db_);
+    return findByIdLocked(txn, id);
+}
+
+OrderPage OrderRepository::findPage(const OrderFilter& filter, std::optional<int> limit, int offset) {
+    utils::Logger::debug("OrderRepository::findPage(limit={}, offset={})", limit.value_or(-1), offset);
+    if (filter.warehouseId && !isValidUuid(*filter.warehouseId)) {
+        throw std::invalid_argument("Invalid warehouse id format");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::read_transaction txn(*db_);
+
+    auto headers = txn.exec_prepared("order_find_page",
+                                     filter.status, filter.customerId, filter.warehouseId, limit, offset);
+
+    OrderPage page;
+    if (headers.empty()) {
+        // COUNT(*) OVER () has no row to ride on past the last page
+        if (offset > 0) {
+            page.totalCount = txn.exec_prepared("order_count",
+                                                filter.status, filter.customerId, filter.warehouseId)[0][0].as<std::int64_t>();
+        }
+        return page;
+    }
+
+    page.totalCount = headers[0][1].as<std::int64_t>();
+    page.items.reserve(headers.size());
+    for (const auto& row : headers) {
+        page.items.push_back(models::Order::fromJson(json::parse(row[0].c_str())));
+    }
+    attachLineItems(txn, page.items);
+
+    return page;
+}
+
+void OrderRepository::attachLineItems(pqxx::transaction_base& txn, std::vector<models::Order>& orders) {
+    if (orders.empty()) {
+        return;
+    }
+
+    std::vector<std::string> ids;
+    ids.reserve(orders.size());
+    std::unordered_map<std::string, std::size_t> positions;
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        ids.push_back(orders[i].getId());
+        positions.emplace(ids.back(), i);
+    }
+
+    std::vector<std::vector<models::OrderLineItem>> lines(orders.size());
+    for (const auto& row : txn.exec_prepared("order_line_items_for_orders", ids)) {
+        auto position = positions.find(row[0].as<std::string>());
+        if (position != positions.end()) {
+            auto& order = orders[position->second];
+            lines[position->second].push_back(
+                models::OrderLineItem::fromJson(json::parse(row[1].c_str()), order.getCurrency()));
+        }
+    }
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        orders[i].setLineItems(lines[i]);
+    }
+}
+
+unsigned OrderRepository::appendCriteria(const models::OrderSearchCriteria& criteria, std::string& sql,
+                                         pqxx::params& params, int& placeholders) {
+    if (criteria.warehouseId && !isValidUuid(*criteria.warehouseId)) {
+        throw std::invalid_argument("Invalid warehouse id format");
+    }
+
+    unsigned shape = 0;
+    auto placeholder = [&placeholders]() { return "$" + std::to_string(++placeholders); };
+
+    if (!criteria.statuses.empty()) {
+        std::vector<std::string> statuses;
+        for (auto status : criteria.statuses) {
+            statuses.push_back(models::orderStatusToString(status));
+        }
+        shape |= 1u << 0;
+        sql += " AND o.status = ANY(" + placeholder() + "::text[])";
+        params.append(statuses);
+    }
+    if (criteria.customerId) {
+        shape |= 1u << 1;
+        sql += " AND o.customer_id = " + placeholder();
+        params.append(*criteria.customerId);
+    }
+    if (criteria.warehouseId) {
+        shape |= 1u << 2;
+        sql += " AND o.warehouse_id = " + placeholder() + "::uuid";
+        params.append(*criteria.warehouseId);
+    }
+    if (criteria.priority) {
+        shape |= 1u << 3;
+        sql += " AND o.priority = " + placeholder();
+        params.append(models::orderPriorityToString(*criteria.priority));
+    }
+    if (criteria.orderDateFrom) {
+        shape |= 1u << 4;
+        sql += " AND o.order_date >= " + placeholder() + "::timestamp";
+        params.append(*criteria.orderDateFrom);
+    }
+    if (criteria.orderDateTo) {
+        shape |= 1u << 5;
+        sql += " AND o.order_date < " + placeholder() + "::timestamp";
+        params.append(*criteria.orderDateTo);
+    }
+    if (criteria.orderNumberPrefix) {
+        shape |= 1u << 6;
+        sql += " AND o.order_number LIKE " + placeholder();
+        params.append(likePrefix(*criteria.orderNumberPrefix));
+    }
+    return shape;
+}
+
+models::OrderSearchPage OrderRepository::search(const models::OrderSearchCriteria& criteria,
+                                                const std::optional<models::OrderCursor>& after, int limit) {
+    utils::Logger::debug("OrderRepository::search(limit={})", limit);
+    if (limit < 1) {
+        throw std::invalid_argument("limit must be positive");
+    }
+    if (after && !isValidUuid(after->id)) {
+        throw std::invalid_argument("Invalid cursor");
+    }
+
+    int placeholders = 0;
+    auto placeholder = [&placeholders]() { return "$" + std::to_string(++placeholders); };
+    pqxx::params params;
+    std::string sql = "SELECT " + ORDER_JSON + "::text, "
+                      "to_char(o.order_date, 'YYYY-MM-DD\"T\"HH24:MI:SS.US'), o.id::text "
+                      "FROM orders o WHERE TRUE";
+
+    // The statement text depends only on which criteria are set; one bit each
+    unsigned shape = appendCriteria(criteria, sql, params, placeholders);
+    if (after) {
+        shape |= 1u << 7;
+        auto orderDate = placeholder();
+        auto id = placeholder();
+        sql += " AND (o.order_date, o.id) < (" + orderDate + "::timestamp, " + id + "::uuid)";
+        params.append(after->orderDate);
+        params.append(after->id);
+    }
+    // One row past the page tells whether another page follows
+    sql += " ORDER BY o.order_date DESC, o.id DESC LIMIT " + placeholder();
+    params.append(limit + 1);
+
+    auto name = "order_search_" + std::to_string(shape);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!preparedSearches_.count(shape)) {
+        db_->prepare(name, sql);
+        preparedSearches_.insert(shape);
+    }
+
+    pqxx::read_transaction txn(*db_);
+    auto rows = txn.exec_prepared(name, params);
+
+    models::OrderSearchPage page;
+    auto count = std::min(rows.size(), static_cast<std::size_t>(limit));
+    page.items.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        page.items.push_back(models::Order::fromJson(json::parse(rows[i][0].c_str())));
+    }
+    if (rows.size() > count) {
+        const auto& last = rows[count - 1];
+        page.next = models::OrderCursor{last[1].as<std::string>(), last[2].as<std::string>()};
+    }
+    attachLineItems(txn, page.items);
+
+    return page;
+}
+
+std::vector<std::pair<std::string, std::string>> OrderRepository::findOrderNumbers() {
+    utils::Logger::debug("OrderRepository::findOrderNumbers()");
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::read_transaction txn(*db_);
+
+    std::vector<std::pair<std::string, std::string>> numbers;
+    for (const auto& row : txn.exec_prepared("order_numbers")) {
+        numbers.emplace_back(row[0].as<std::string>(), row[1].as<std::string>());
+    }
+    return numbers;
+}
+
+std::vector<models::Order> OrderRepository::findByIds(const std::vector<std::string>& ids) {
+    utils::Logger::debug("OrderRepository::findByIds({} ids)", ids.size());
+    std::vector<models::Order> orders;
+    if (ids.empty()) {
+        return orders;
+    }
+    for (const auto& id : ids) {
+        if (!isValidUuid(id)) {
+            throw std::invalid_argument("Invalid order id format");
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::read_transaction txn(*db_);
+
+    std::unordered_map<std::string, models::Order> byId;
+    for (const auto& row : txn.exec_prepared("order_find_by_ids", ids)) {
+        auto order = models::Order::fromJson(json::parse(row[0].c_str()));
+        auto id = order.getId();
+        byId.emplace(std::move(id), std::move(order));
+    }
+    orders.reserve(byId.size());
+    for (const auto& id : ids) {
+        auto found = byId.find(id);
+        if (found != byId.end()) {
+            orders.push_back(std::move(found->second));
+            byId.erase(found);
+        }
+    }
+    attachLineItems(txn, orders);
+    return orders;
+}
+
+std::vector<models::Order> OrderRepository::findReleasable() {
+    utils::Logger::debug("OrderRepository::findReleasable()");
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::read_transaction txn(*db_);
+
+    std::vector<models::Order> orders;
+    for (const auto& row : txn.exec_prepared("order_find_releasable")) {
+        orders.push_back(models::Order::fromJson(json::parse(row[0].c_str())));
+    }
+    return orders;
 }
 
 std::vector<models::Order> OrderRepository::findAll() {
     utils::Logger::debug("OrderRepository::findAll()");
-    // TODO: Implement database query
-    return {};
+    return findPage(OrderFilter{}, std::nullopt, 0).items;
+}
+
+void OrderRepository::insertLineItems(pqxx::transaction_base& txn, const std::string& orderId,
+                                      const std::vector<models::OrderLineItem>& lineItems) {
+    if (lineItems.empty()) {
+        return;
+    }
+
+    std::vector<std::string> ids, productIds, skus, names;
+    std::vector<int> quantities;
+    std::vector<std::string> unitPrices, lineTotals;
+    std::vector<std::optional<std::string>> notes;
+    for (const auto& item : lineItems) {
+        if (!isValidUuid(item.productId)) {
+            throw std::invalid_argument("Invalid product id format: " + item.productId);
+        }
+        ids.push_back(item.id);
+        productIds.push_back(item.productId);
+        skus.push_back(item.productSku);
+        names.push_back(item.productName);
+        quantities.push_back(item.quantity);
+        unitPrices.push_back(item.unitPrice.toString());
+        lineTotals.push_back(item.lineTotal.toString());
+        notes.push_back(item.notes);
+    }
+
+    txn.exec_prepared("order_line_items_insert", orderId, ids, productIds, skus, names,
+                      quantities, unitPrices, lineTotals, notes);
 }
 
 models::Order OrderRepository::create(const models::Order& order) {
     utils::Logger::debug("OrderRepository::create({})", order.getOrderNumber());
-    // TODO: Implement database insert
-    throw std::runtime_error("Not implemented");
+    if (!order.getId().empty() && !isValidUuid(order.getId())) {
+        throw std::invalid_argument("Invalid order id format");
+    }
+    if (!isValidUuid(order.getWarehouseId())) {
+        throw std::invalid_argument("Invalid warehouse id format");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+
+    std::string id;
+    try {
+        id = txn.exec_prepared("order_insert",
+                               emptyToNull(order.getId()),
+                               order.getOrderNumber(),
+                               order.getCustomerId(),
+                               order.getWarehouseId(),
+                               order.getWarehouseCode(),
+                               order.getWarehouseName(),
+                               models::orderStatusToString(order.getStatus()),
+                               models::orderPriorityToString(order.getPriority()),
+                               emptyToNull(order.getOrderDate()),
+                               order.getShipByDate(),
+                               order.getTotal().toString(),
+                               order.getNotes(),
+                               order.getCancellationReason(),
+                               jsonOrNull(order.getShippingAddress()),
+                               jsonOrNull(order.getBillingAddress()),
+                               std::string(order.getCurrency()))[0][0].as<std::string>();
+    } catch (const pqxx::unique_violation&) {
+        throw OrderNumberTaken("Order number already exists: " + order.getOrderNumber());
+    }
+    insertLineItems(txn, id, order.getLineItems());
+
+    auto created = findByIdLocked(txn, id);
+    txn.commit();
+    return *created;
 }
 
 models::Order OrderRepository::update(const models::Order& order) {
     utils::Logger::debug("OrderRepository::update({})", order.getId());
-    // TODO: Implement database update
-    throw std::runtime_error("Not implemented");
+    if (!isValidUuid(order.getId())) {
+        throw std::invalid_argument("Invalid order id format");
+    }
+    if (!isValidUuid(order.getWarehouseId())) {
+        throw std::invalid_argument("Invalid warehouse id format");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+
+    auto result = txn.exec_prepared("order_update",
+                                    order.getId(),
+                                    order.getOrderNumber(),
+                                    order.getCustomerId(),
+                                    order.getWarehouseId(),
+                                    order.getWarehouseCode(),
+                                    order.getWarehouseName(),
+                                    models::orderStatusToString(order.getStatus()),
+                                    models::orderPriorityToString(order.getPriority()),
+                                    emptyToNull(order.getOrderDate()),
+                                    order.getShipByDate(),
+                                    order.getTotal().toString(),
+                                    order.getNotes(),
+                                    order.getCancellationReason(),
+                                    jsonOrNull(order.getShippingAddress()),
+                                    jsonOrNull(order.getBillingAddress()),
+                                    std::string(order.getCurrency()));
+    if (result.affected_rows() == 0) {
+        throw std::runtime_error("Order not found: " + order.getId());
+    }
+
+    // Lines are owned by the order and replaced as a whole
+    txn.exec_prepared("order_line_items_delete", order.getId());
+    insertLineItems(txn, order.getId(), order.getLineItems());
+
+    auto updated = findByIdLocked(txn, order.getId());
+    txn.commit();
+    return *updated;
 }
 
-bool OrderRepository::deleteById(const std::string& id) {
-    utils::Logger::debug("OrderRepository::deleteById({})", id);
-    // TODO: Implement database delete
-    return false;
+std::vector<models::WaveOrder> OrderRepository::findWaveOrders(const std::string& warehouseId) {
+    utils::Logger::debug("OrderRepository::findWaveOrders({})", warehouseId);
+    if (!isValidUuid(warehouseId)) {
+        throw std::invalid_argument("Invalid warehouse id format");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::read_transaction txn(*db_);
+    auto result = txn.exec_prepared("order_wave_lines", warehouseId);
+
+    std::vector<models::WaveOrder> orders;
+    for (const auto& row : result) {
+        auto id = row[0].as<std::string>();
+        if (orders.empty() || orders.back().id != id) {
+            models::WaveOrder order;
+            order.id = std::move(id);
+            order.orderNumber = row[1].as<std::string>();
+            order.priority = models::orderPriorityFromString(row[2].as<std::string>());
+            if (!row[3].is_null()) {
+                order.shipByDate = std::chrono::system_clock::from_time_t(row[3].as<std::int64_t>());
+            }
+            orders.push_back(std::move(order));
+        }
+        orders.back().skus.push_back(row[4].as<std::string>());
+    }
+    return orders;
 }
 
-std::vector<models::Order> OrderRepository::findByStatus(const std::string& status) {
-    utils::Logger::debug("OrderRepository::findByStatus({})", status);
-    // TODO: Implement database query
-    return {};
+std::vector<std::string> OrderRepository::findExistingOrderNumbers(const std::vector<std::string>& orderNumbers) {
+    utils::Logger::debug("OrderRepository::findExistingOrderNumbers({} numbers)", orderNumbers.size());
+    std::vector<std::string> existing;
+    if (orderNumbers.empty()) {
+        return existing;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::read_transaction txn(*db_);
+    for (const auto& row : txn.exec_prepared("order_existing_numbers", orderNumbers)) {
+        existing.push_back(row[0].as<std::string>());
+    }
+    return existing;
 }
 
-std::vector<models::Order> OrderRepository::findByCustomerId(const std::string& customerId) {
-    utils::Logger::debug("OrderRepository::findByCustomerId({})", customerId);
-    // TODO: Implement database query
-    return {};
+void OrderRepository::bulkInsert(const std::vector<models::Order>& orders) {
+    utils::Logger::debug("OrderRepository::bulkInsert({} orders)", orders.size());
+    if (orders.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+
+    auto orderStream = pqxx::stream_to::table(txn, {"orders"}, {
+        "id", "order_number", "customer_id", "warehouse_id", "status", "priority",
+        "order_date", "ship_by_date", "total", "currency", "notes", "shipping_address", "billing_address"
+    });
+    for (const auto& order : orders) {
+        orderStream.write_values(
+            order.getId(),
+            order.getOrderNumber(),
+            order.getCustomerId(),
+            order.getWarehouseId(),
+            models::orderStatusToString(order.getStatus()),
+            models::orderPriorityToString(order.getPriority()),
+            order.getOrderDate(),
+            order.getShipByDate(),
+            order.getTotal().toString(),
+            std::string(order.getCurrency()),
+            order.getNotes(),
+            jsonOrNull(order.getShippingAddress()),
+            jsonOrNull(order.getBillingAddress()));
+    }
+    orderStream.complete();
+
+    // Lines go second so the order_id foreign keys resolve
+    auto lineStream = pqxx::stream_to::table(txn, {"order_line_items"}, {
+        "id", "order_id", "line_number", "product_id", "product_sku", "product_name",
+        "quantity", "unit_price", "line_total", "notes"
+    });
+    for (const auto& order : orders) {
+        int lineNumber = 0;
+        for (const auto& item : order.getLineItems()) {
+            lineStream.write_values(
+                item.id,
+                order.getId(),
+                ++lineNumber,
+                item.productId,
+                item.productSku,
+                item.productName,
+                item.quantity,
+                item.unitPrice.toString(),
+                item.lineTotal.toString(),
+                item.notes);
+        }
+    }
+    lineStream.complete();
+    txn.commit();
 }
 
-std::vector<models::Order> OrderRepository::findByWarehouseId(const std::string& warehouseId) {
-    utils::Logger::debug("OrderRepository::findByWarehouseId({})", warehouseId);
-    // TODO: Implement database query
-    return {};
+bool OrderRepository::deleteById(const std::string& id) {
+    utils::Logger::debug("OrderRepository::deleteById({})", id);
+    if (!isValidUuid(id)) {
+        throw std::invalid_argument("Invalid order id format");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+    auto result = txn.exec_prepared("order_delete", id);   // line items cascade
+    txn.commit();
+    return result.affected_rows() > 0;
+}
+
+std::optional<models::Order> OrderRepository::transitionStatus(const models::Order& order,
+                                                               models::OrderStatus expected) {
+    utils::Logger::debug("OrderRepository::transitionStatus({})", order.getId());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pqxx::work txn(*db_);
+
+    auto result = txn.exec_prepared("order_transition_status",
+                                    order.getId(),
+                                    models::orderStatusToString(expected),
+                                    models::orderStatusToString(order.getStatus()),
+                                    order.getCancellationReason());
+    if (result.affected_rows() == 0) {
+        return std::nullopt;
+    }
+
+    auto updated = findByIdLocked(txn, order.getId());
+    txn.commit();
+    return updated;
 }
 
 } // namespace order::repositories
@@ -1,13 +1,87 @@
 #include "order/services/OrderService.hpp"
 #include "order/repositories/OrderRepository.hpp"
+#include "order/repositories/OrderExportRepository.hpp"
 #include "order/utils/Logger.hpp"
 #include "order/utils/DtoMapper.hpp"
+#include "order/utils/MessageBus.hpp"
+#include "order/models/StockReservation.hpp"
+#include <Poco/UUIDGenerator.h>
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <ctime>
+#include <iterator>
+#include <regex>
 #include <stdexcept>
+#include <unordered_set>
 
 namespace order::services {
 
-OrderService::OrderService(std::shared_ptr<repositories::OrderRepository> repository)
-    : repository_(repository) {}
+namespace {
+
+std::string currentTimestamp() {
+    auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm utc{};
+    gmtime_r(&now, &utc);
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return buffer;
+}
+
+// Cursors are "<order date with microseconds>_<id>"; clients treat them as opaque
+std::string encodeCursor(const models::OrderCursor& cursor) {
+    return cursor.orderDate + "_" + cursor.id;
+}
+
+models::OrderCursor decodeCursor(const std::string& cursor) {
+    static const std::regex cursorRegex(
+        R"(^(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{6})_([0-9a-fA-F-]{36})$)"
+    );
+    std::smatch match;
+    if (!std::regex_match(cursor, match, cursorRegex)) {
+        throw std::invalid_argument("Invalid cursor");
+    }
+    return {match[1].str(), match[2].str()};
+}
+
+void validateDateTime(const std::optional<std::string>& value, const char* name) {
+    static const std::regex isoRegex(
+        R"(^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}(?:\.\d{1,6})?(?:Z|[+-]\d{2}:\d{2})$)"
+    );
+    if (value && !std::regex_match(*value, isoRegex)) {
+        throw std::invalid_argument(std::string(name) + " must be in ISO 8601 format");
+    }
+}
+
+std::string normalisePrefix(std::string prefix) {
+    std::transform(prefix.begin(), prefix.end(), prefix.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    if (!utils::BulkOrderParser::isValidOrderNumber(prefix)) {
+        throw std::invalid_argument("Order number prefix must be 1-50 characters of A-Z, 0-9 and '-'");
+    }
+    return prefix;
+}
+
+// Publishing is best effort: the order is already stored when we announce it
+void publish(utils::MessageBus* bus, const std::string& routingKey, const nlohmann::json& payload) {
+    if (!bus) {
+        return;
+    }
+    try {
+        bus->publish(routingKey, payload);
+    } catch (const std::exception& e) {
+        utils::Logger::warn("Failed to publish order.{}: {}", routingKey, e.what());
+    }
+}
+
+} // namespace
+
+OrderService::OrderService(std::shared_ptr<repositories::OrderRepository> repository,
+                           std::shared_ptr<utils::MessageBus> messageBus,
+                           std::shared_ptr<utils::OrderNumberAllocator> numberAllocator,
+                           std::shared_ptr<repositories::OrderExportRepository> exports)
+    : repository_(repository), messageBus_(messageBus), numberAllocator_(std::move(numberAllocator)),
+      exports_(std::move(exports)) {}
 
 std::optional<dtos::OrderDto> OrderService::getById(const std::string& id) {
     utils::Logger::debug("OrderService::getById({})", id);
@@ -39,16 +113,358 @@ std::vector<dtos::OrderDto> OrderService::getAll() {
     return dtos;
 }
 
+dtos::OrderListDto OrderService::list(const std::optional<std::string>& status,
+                                      const std::optional<std::string>& customerId,
+                                      const std::optional<std::string>& warehouseId,
+                                      int page,
+                                      int pageSize) {
+    utils::Logger::debug("OrderService::list(page={}, pageSize={})", page, pageSize);
+    
+    if (page < 1) {
+        throw std::invalid_argument("page must be at least 1");
+    }
+    if (pageSize < 1 || pageSize > kMaxPageSize) {
+        throw std::invalid_argument("pageSize must be between 1 and " + std::to_string(kMaxPageSize));
+    }
+    if (status) {
+        models::orderStatusFromString(*status);   // throws std::invalid_argument on unknown status
+    }
+    
+    repositories::OrderFilter filter{status, customerId, warehouseId};
+    auto result = repository_->findPage(filter, pageSize, (page - 1) * pageSize);
+    
+    std::vector<dtos::OrderDto> items;
+    items.reserve(result.items.size());
+    for (const auto& order : result.items) {
+        // TODO: Batch fetch warehouse codes from warehouse service API
+        std::string warehouseCode = order.getWarehouseCode().value_or("WH-" + order.getWarehouseId().substr(0, 8));
+        items.push_back(utils::DtoMapper::toOrderDto(order, warehouseCode, order.getWarehouseName()));
+    }
+    
+    auto totalCount = static_cast<int>(result.totalCount);
+    int totalPages = std::max(1, (totalCount + pageSize - 1) / pageSize);
+    return dtos::OrderListDto(items, totalCount, page, pageSize, totalPages);
+}
+
+dtos::OrderSearchResultDto OrderService::search(const models::OrderSearchCriteria& criteria,
+                                                const std::optional<std::string>& cursor,
+                                                int limit) {
+    utils::Logger::debug("OrderService::search(limit={})", limit);
+    
+    if (limit < 1 || limit > kMaxPageSize) {
+        throw std::invalid_argument("limit must be between 1 and " + std::to_string(kMaxPageSize));
+    }
+    validateDateTime(criteria.orderDateFrom, "orderDateFrom");
+    validateDateTime(criteria.orderDateTo, "orderDateTo");
+    
+    auto normalised = criteria;
+    if (normalised.orderNumberPrefix) {
+        normalised.orderNumberPrefix = normalisePrefix(*normalised.orderNumberPrefix);
+    }
+    std::optional<models::OrderCursor> after;
+    if (cursor) {
+        after = decodeCursor(*cursor);
+    }
+    
+    auto result = repository_->search(normalised, after, limit);
+    
+    std::vector<dtos::OrderDto> items;
+    items.reserve(result.items.size());
+    for (const auto& order : result.items) {
+        // TODO: Batch fetch warehouse codes from warehouse service API
+        std::string warehouseCode = order.getWarehouseCode().value_or("WH-" + order.getWarehouseId().substr(0, 8));
+        items.push_back(utils::DtoMapper::toOrderDto(order, warehouseCode, order.getWarehouseName()));
+    }
+    
+    std::optional<std::string> nextCursor;
+    if (result.next) {
+        nextCursor = encodeCursor(*result.next);
+    }
+    return dtos::OrderSearchResultDto(items, limit, nextCursor);
+}
+
+std::size_t OrderService::exportOrders(const models::OrderSearchCriteria& criteria,
+                                      utils::ExportFormat format,
+                                      const std::vector<std::string>& columns,
+                                      const std::function<std::ostream&()>& open) {
+    utils::Logger::debug("OrderService::exportOrders({} columns)", columns.size());
+    
+    if (!exports_) {
+        throw std::logic_error("Order exports are not configured");
+    }
+    validateDateTime(criteria.orderDateFrom, "orderDateFrom");
+    validateDateTime(criteria.orderDateTo, "orderDateTo");
+    auto normalised = criteria;
+    if (normalised.orderNumberPrefix) {
+        normalised.orderNumberPrefix = normalisePrefix(*normalised.orderNumberPrefix);
+    }
+    auto projected = utils::ExportWriter::project(repositories::OrderExportRepository::columns(), columns);
+    
+    std::optional<utils::ExportWriter> writer;
+    std::ostream* out = nullptr;
+    exports_->exportLines(normalised, projected, [&](const std::vector<repositories::OrderExportRepository::Row>& rows) {
+        if (!writer) {
+            out = &open();
+            writer.emplace(*out, format, projected);
+            writer->begin();
+        }
+        for (const auto& row : rows) {
+            writer->row(row);
+        }
+        // Blocks while the client is behind, which holds back the next fetch
+        out->flush();
+        if (!*out) {
+            throw std::runtime_error("Export client went away after " + std::to_string(writer->rows()) + " rows");
+        }
+    });
+    return writer ? writer->rows() : 0;
+}
+
+void OrderService::loadOrderNumberIndex() {
+    for (const auto& [id, orderNumber] : repository_->findOrderNumbers()) {
+        orderNumbers_.insert(id, orderNumber);
+    }
+    utils::Logger::info("Order number index loaded with {} orders", orderNumbers_.size());
+}
+
+dtos::OrderNumberSuggestionsDto OrderService::suggestOrderNumbers(const std::string& prefix, int limit) {
+    utils::Logger::debug("OrderService::suggestOrderNumbers({}, {})", prefix, limit);
+    
+    if (limit < 1 || limit > kMaxSuggestions) {
+        throw std::invalid_argument("limit must be between 1 and " + std::to_string(kMaxSuggestions));
+    }
+    auto normalised = normalisePrefix(prefix);
+    
+    std::vector<std::string> numbers;
+    std::vector<std::string> ids;
+    for (auto& match : orderNumbers_.complete(normalised, static_cast<std::size_t>(limit))) {
+        numbers.push_back(std::move(match.orderNumber));
+        ids.push_back(std::move(match.orderId));
+    }
+    return dtos::OrderNumberSuggestionsDto(normalised, numbers, ids);
+}
+
+dtos::BulkOrderResultDto OrderService::createBulk(std::istream& input) {
+    utils::Logger::debug("OrderService::createBulk()");
+    
+    int received = 0;
+    int created = 0;
+    int rejected = 0;
+    int failed = 0;
+    std::vector<dtos::BulkOrderItemResultDto> results;
+    std::unordered_set<std::string> seenNumbers;
+    auto& uuids = Poco::UUIDGenerator::defaultGenerator();
+    std::size_t lineNumber = 0;
+    
+    for (auto chunk = utils::BulkOrderParser::readChunk(input, kBulkChunkSize, lineNumber); !chunk.empty();
+         chunk = utils::BulkOrderParser::readChunk(input, kBulkChunkSize, lineNumber)) {
+        received += static_cast<int>(chunk.size());
+        auto parsed = bulkParser_.parse(chunk);
+        
+        // Order numbers must be unique across the upload and against stored orders.
+        // The allocator's format is reserved, so allocated numbers are unique by
+        // construction and only supplied ones are looked up.
+        std::vector<std::string> candidates;
+        for (auto& row : parsed) {
+            if (!row.order) {
+                continue;
+            }
+            if (row.order->getOrderNumber().empty()) {
+                row.order->setOrderNumber(allocateOrderNumber(row.order->getWarehouseId()));
+                row.orderNumber = row.order->getOrderNumber();
+                seenNumbers.insert(*row.orderNumber);
+            } else if (isGeneratedOrderNumber(*row.orderNumber)) {
+                row.order.reset();
+                row.error = "Order number is in the generated format; omit it to have one allocated: " +
+                            *row.orderNumber;
+            } else if (!seenNumbers.insert(*row.orderNumber).second) {
+                row.order.reset();
+                row.error = "Duplicate order number in upload: " + *row.orderNumber;
+            } else {
+                candidates.push_back(*row.orderNumber);
+            }
+        }
+        auto existing = repository_->findExistingOrderNumbers(candidates);
+        std::unordered_set<std::string> taken(existing.begin(), existing.end());
+        
+        auto orderDate = currentTimestamp();
+        std::vector<models::Order> pending;
+        std::vector<std::size_t> pendingRows;
+        pending.reserve(parsed.size());
+        for (std::size_t i = 0; i < parsed.size(); ++i) {
+            auto& row = parsed[i];
+            if (row.order && taken.count(*row.orderNumber)) {
+                row.order.reset();
+                row.error = "Order number already exists: " + *row.orderNumber;
+            }
+            if (!row.order) {
+                continue;
+            }
+            
+            auto& order = *row.order;
+            order.setId(uuids.createRandom().toString());
+            order.setOrderDate(orderDate);
+            auto lineItems = order.getLineItems();
+            for (auto& item : lineItems) {
+                item.id = uuids.createRandom().toString();
+            }
+            order.setLineItems(lineItems);
+            pending.push_back(order);
+            pendingRows.push_back(i);
+        }
+        
+        std::optional<std::string> insertError;
+        try {
+            repository_->bulkInsert(pending);
+        } catch (const std::exception& e) {
+            // The chunk rolled back as a whole; its numbers may be retried in a later upload
+            utils::Logger::error("Bulk order chunk of {} failed: {}", pending.size(), e.what());
+            insertError = "Insert failed: " + std::string(e.what());
+            for (const auto& order : pending) {
+                seenNumbers.erase(order.getOrderNumber());
+            }
+        }
+        
+        std::vector<nlohmann::json> events;
+        std::vector<nlohmann::json> reservations;
+        events.reserve(pending.size());
+        reservations.reserve(pending.size());
+        std::size_t nextPending = 0;
+        for (std::size_t i = 0; i < parsed.size(); ++i) {
+            const auto& row = parsed[i];
+            auto line = static_cast<int>(row.line);
+            if (nextPending < pendingRows.size() && pendingRows[nextPending] == i) {
+                const auto& order = pending[nextPending++];
+                if (insertError) {
+                    ++failed;
+                    results.emplace_back(line, "failed", row.orderNumber, std::nullopt, insertError);
+                    continue;
+                }
+                ++created;
+                results.emplace_back(line, "created", row.orderNumber, order.getId(), std::nullopt);
+                queue_.sync(order);
+                orderNumbers_.insert(order.getId(), order.getOrderNumber());
+                if (messageBus_) {
+                    // TODO: Fetch warehouse code from warehouse service API
+                    std::string warehouseCode = "WH-" + order.getWarehouseId().substr(0, 8);
+                    events.push_back(utils::DtoMapper::toOrderDto(order, warehouseCode, std::nullopt).toJson());
+                    reservations.push_back(models::StockReservationRequest::fromOrder(order).toJson());
+                }
+            } else {
+                ++rejected;
+                results.emplace_back(line, "rejected", row.orderNumber, std::nullopt, row.error);
+            }
+        }
+        
+        if (!events.empty()) {
+            try {
+                messageBus_->publishBatch(kCreatedRoutingKey, events);
+                messageBus_->publishBatch(kReserveStockRoutingKey, reservations);
+            } catch (const std::exception& e) {
+                utils::Logger::warn("Failed to publish order.created events: {}", e.what());
+            }
+        }
+    }
+    
+    utils::Logger::info("Bulk order upload: {} received, {} created, {} rejected, {} failed",
+                        received, created, rejected, failed);
+    return dtos::BulkOrderResultDto(received, created, rejected, failed, results);
+}
+
+void OrderService::loadFulfilmentQueue() {
+    auto orders = repository_->findReleasable();
+    for (const auto& order : orders) {
+        queue_.sync(order);
+    }
+    utils::Logger::info("Release queue loaded with {} open orders", queue_.size());
+}
+
+dtos::OrderListDto OrderService::nextToRelease(const std::string& warehouseId, int limit) {
+    utils::Logger::debug("OrderService::nextToRelease({}, {})", warehouseId, limit);
+    
+    if (warehouseId.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+    if (limit < 1 || limit > kMaxNextLimit) {
+        throw std::invalid_argument("limit must be between 1 and " + std::to_string(kMaxNextLimit));
+    }
+    
+    auto entries = queue_.next(warehouseId, static_cast<std::size_t>(limit));
+    std::vector<std::string> ids;
+    ids.reserve(entries.size());
+    for (const auto& entry : entries) {
+        ids.push_back(entry.orderId);
+    }
+    
+    auto orders = repository_->findByIds(ids);
+    if (orders.size() != ids.size()) {
+        // Deleted behind the queue's back; drop the strays so they are not served again
+        std::unordered_set<std::string> found;
+        for (const auto& order : orders) {
+            found.insert(order.getId());
+        }
+        for (const auto& id : ids) {
+            if (!found.count(id)) {
+                queue_.remove(id);
+            }
+        }
+    }
+    
+    std::vector<dtos::OrderDto> items;
+    items.reserve(orders.size());
+    for (const auto& order : orders) {
+        // TODO: Batch fetch warehouse codes from warehouse service API
+        std::string warehouseCode = order.getWarehouseCode().value_or("WH-" + order.getWarehouseId().substr(0, 8));
+        items.push_back(utils::DtoMapper::toOrderDto(order, warehouseCode, order.getWarehouseName()));
+    }
+    
+    auto queued = static_cast<int>(queue_.size(warehouseId));
+    int totalPages = std::max(1, (queued + limit - 1) / limit);
+    return dtos::OrderListDto(items, queued, 1, limit, totalPages);
+}
+
 dtos::OrderDto OrderService::create(const models::Order& order) {
     utils::Logger::debug("OrderService::create({})", order.getOrderNumber());
     
     // TODO: Implement validation
-    auto created = repository_->create(order);
+    auto numbered = order;
+    bool allocated = numbered.getOrderNumber().empty();
+    if (!allocated && isGeneratedOrderNumber(numbered.getOrderNumber())) {
+        throw std::invalid_argument("Order number is in the generated format; omit it to have one allocated: " +
+                                    numbered.getOrderNumber());
+    }
+    
+    // The unique constraint is the only check. An allocated number can still meet
+    // one stored before its format was reserved, so that case draws again.
+    std::optional<models::Order> stored;
+    for (int attempt = 1; !stored; ++attempt) {
+        if (allocated) {
+            numbered.setOrderNumber(allocateOrderNumber(numbered.getWarehouseId()));
+        }
+        try {
+            stored = repository_->create(numbered);
+        } catch (const repositories::OrderNumberTaken&) {
+            if (!allocated || attempt == kCreateAttempts) {
+                throw;
+            }
+            utils::Logger::warn("Allocated order number {} already exists, drawing another",
+                                numbered.getOrderNumber());
+        }
+    }
+    const auto& created = *stored;
+    queue_.sync(created);
+    orderNumbers_.insert(created.getId(), created.getOrderNumber());
     
     // TODO: Fetch warehouse code from warehouse service API
     std::string warehouseCode = "WH-" + created.getWarehouseId().substr(0, 8);
+    auto dto = utils::DtoMapper::toOrderDto(created, warehouseCode, std::nullopt);
+    
+    // Stock is reserved asynchronously; the reply confirms or cancels the order
+    publish(messageBus_.get(), kCreatedRoutingKey, dto.toJson());
+    publish(messageBus_.get(), kReserveStockRoutingKey,
+            models::StockReservationRequest::fromOrder(created).toJson());
     
-    return utils::DtoMapper::toOrderDto(created, warehouseCode, std::nullopt);
+    return dto;
 }
 
 dtos::OrderDto OrderService::update(const models::Order& order) {
@@ -56,6 +472,8 @@ dtos::OrderDto OrderService::update(const models::Order& order) {
     
     // TODO: Implement validation
     auto updated = repository_->update(order);
+    queue_.sync(updated);
+    orderNumbers_.insert(updated.getId(), updated.getOrderNumber());
     
     // TODO: Fetch warehouse code from warehouse service API
     std::string warehouseCode = "WH-" + updated.getWarehouseId().substr(0, 8);
@@ -72,23 +490,123 @@ bool OrderService::deleteById(const std::string& id) {
 dtos::OrderDto OrderService::cancelOrder(const std::string& id, const std::string& reason) {
     utils::Logger::debug("OrderService::cancelOrder({})", id);
     
-    // 1. Get order by ID
+    // Compare-and-set from the status just read, as applyStockReservation does.
+    // A confirm that lands first makes the set miss; the cancel then re-reads
+    // and applies to the confirmed order instead of overwriting it.
+    std::optional<models::Order> updated;
+    for (int attempt = 0; attempt < kCancelAttempts && !updated; ++attempt) {
+        auto order = repository_->findById(id);
+        if (!order) {
+            throw std::runtime_error("Order not found: " + id);
+        }
+        const auto expected = order->getStatus();
+        order->cancel(reason);
+        updated = repository_->transitionStatus(*order, expected);
+    }
+    if (!updated) {
+        throw std::invalid_argument("Order " + id + " kept changing status; cancel again");
+    }
+    queue_.sync(*updated);
+    
+    // Compensate: hand back whatever stock the order holds
+    publish(messageBus_.get(), kReleaseStockRoutingKey, {{"orderId", updated->getId()}});
+    
+    // TODO: Fetch warehouse code from warehouse service API
+    std::string warehouseCode = "WH-" + updated->getWarehouseId().substr(0, 8);
+    
+    return utils::DtoMapper::toOrderDto(*updated, warehouseCode, std::nullopt);
+}
+
+dtos::SourcingPlanDto OrderService::planSourcing(const std::string& id,
+                                                const std::vector<models::WarehouseStock>& stock,
+                                                const std::vector<models::WarehouseCost>& costs) {
+    utils::Logger::debug("OrderService::planSourcing({})", id);
+    
     auto order = repository_->findById(id);
     if (!order) {
         throw std::runtime_error("Order not found: " + id);
     }
+    if (order->getStatus() != models::OrderStatus::PENDING &&
+        order->getStatus() != models::OrderStatus::CONFIRMED) {
+        throw std::invalid_argument("Only pending or confirmed orders can be sourced, not " +
+                                    models::orderStatusToString(order->getStatus()));
+    }
     
-    // 2. Check if order can be cancelled (TODO: Implement business logic)
-    // 3. Call order.cancel(reason)
-    order->cancel(reason);
+    const auto& items = order->getLineItems();
+    std::vector<models::SourcingLine> lines;
+    lines.reserve(items.size());
+    for (const auto& item : items) {
+        lines.push_back({item.id, item.productId, item.quantity});
+    }
     
-    // 4. Update in repository
-    auto updated = repository_->update(*order);
+    auto started = std::chrono::steady_clock::now();
+    auto plan = sourcingPlanner_.plan(lines, stock, costs);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started);
+    utils::Logger::info("Sourced order {} from {} warehouse(s), {} line(s) backordered ({} us)",
+                        id, plan.shipments.size(), plan.backordered.size(), elapsed.count());
     
-    // TODO: Fetch warehouse code from warehouse service API
-    std::string warehouseCode = "WH-" + updated.getWarehouseId().substr(0, 8);
+    auto toDto = [&lines](const models::SourcedLine& line) {
+        return dtos::SourcedLineDto(lines[line.line].lineItemId, lines[line.line].productId, line.quantity);
+    };
+    std::vector<dtos::ShipmentDto> shipments;
+    shipments.reserve(plan.shipments.size());
+    for (const auto& shipment : plan.shipments) {
+        std::vector<dtos::SourcedLineDto> shipped;
+        shipped.reserve(shipment.lines.size());
+        std::transform(shipment.lines.begin(), shipment.lines.end(), std::back_inserter(shipped), toDto);
+        shipments.emplace_back(shipment.warehouseId, shipped);
+    }
+    std::vector<dtos::SourcedLineDto> backordered;
+    backordered.reserve(plan.backordered.size());
+    std::transform(plan.backordered.begin(), plan.backordered.end(), std::back_inserter(backordered), toDto);
     
-    return utils::DtoMapper::toOrderDto(updated, warehouseCode, std::nullopt);
+    return dtos::SourcingPlanDto(id, shipments, backordered, plan.cost, plan.exact);
+}
+
+void OrderService::applyStockReservation(const models::StockReservationReply& reply) {
+    utils::Logger::debug("OrderService::applyStockReservation({}, reserved={})", reply.orderId, reply.reserved);
+    
+    auto order = repository_->findById(reply.orderId);
+    if (!order) {
+        utils::Logger::warn("Stock reservation reply for unknown order {}", reply.orderId);
+        return;
+    }
+    
+    std::optional<models::Order> updated;
+    if (order->getStatus() == models::OrderStatus::PENDING) {
+        if (reply.reserved) {
+            order->setStatus(models::OrderStatus::CONFIRMED);
+        } else {
+            // Nothing was reserved, so there is nothing to release
+            order->cancel("Insufficient stock" + (reply.reason ? ": " + *reply.reason : std::string()));
+        }
+        updated = repository_->transitionStatus(*order, models::OrderStatus::PENDING);
+    }
+    
+    if (!updated) {
+        // Cancelled while the reservation was in flight: give the stock back.
+        // Anything else is a redelivered reply for an order that has moved on.
+        auto current = repository_->findById(reply.orderId);
+        if (reply.reserved && current && current->getStatus() == models::OrderStatus::CANCELLED) {
+            publish(messageBus_.get(), kReleaseStockRoutingKey, {{"orderId", reply.orderId}});
+        }
+        return;
+    }
+    
+    queue_.sync(*updated);
+    utils::Logger::info("Order {} {} by stock reservation", updated->getId(),
+                        models::orderStatusToString(updated->getStatus()));
+}
+
+bool OrderService::isGeneratedOrderNumber(const std::string& orderNumber) const {
+    return numberAllocator_ && numberAllocator_->isGenerated(orderNumber);
+}
+
+std::string OrderService::allocateOrderNumber(const std::string& warehouseId) {
+    if (!numberAllocator_) {
+        throw std::invalid_argument("orderNumber is required");
+    }
+    return numberAllocator_->next(warehouseId);
 }
 
 } // namespace order::services
@@ -0,0 +1,291 @@
+#include "order/services/SourcingPlanner.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace order::services {
+
+namespace {
+
+constexpr std::int64_t kInfeasible = -1;
+
+// The order's products and the warehouses stocking them, interned to dense ids
+struct Problem {
+    std::size_t products = 0;
+    std::vector<std::size_t> productOf;      // per line
+    std::vector<int> target;                 // per product: units that can be sourced
+    std::vector<std::string> warehouses;
+    std::vector<int> available;              // warehouses x products, row-major
+    std::vector<std::int64_t> shipmentCost;
+    std::vector<std::int64_t> unitCost;
+    std::vector<std::size_t> byUnitCost;     // warehouse ids, cheapest per unit first
+
+    int at(std::size_t warehouse, std::size_t product) const {
+        return available[warehouse * products + product];
+    }
+};
+
+Problem intern(const std::vector<models::SourcingLine>& lines,
+               const std::vector<models::WarehouseStock>& stock,
+               const std::vector<models::WarehouseCost>& costs,
+               const models::SourcingOptions& options) {
+    Problem problem;
+    std::unordered_map<std::string_view, std::size_t> productIds;
+    std::vector<int> demand;
+    problem.productOf.reserve(lines.size());
+    for (const auto& line : lines) {
+        if (line.quantity <= 0) {
+            throw std::invalid_argument("Line quantities must be positive");
+        }
+        auto [it, inserted] = productIds.try_emplace(line.productId, productIds.size());
+        if (inserted) {
+            demand.push_back(0);
+        }
+        demand[it->second] += line.quantity;
+        problem.productOf.push_back(it->second);
+    }
+    problem.products = productIds.size();
+
+    // Only warehouses holding something the order needs are candidates
+    std::unordered_map<std::string_view, std::size_t> warehouseIds;
+    for (const auto& row : stock) {
+        auto product = productIds.find(row.productId);
+        if (product == productIds.end() || row.available <= 0) {
+            continue;
+        }
+        auto [it, inserted] = warehouseIds.try_emplace(row.warehouseId, warehouseIds.size());
+        if (inserted) {
+            problem.warehouses.push_back(row.warehouseId);
+            problem.available.resize(problem.available.size() + problem.products, 0);
+        }
+        problem.available[it->second * problem.products + product->second] += row.available;
+    }
+
+    std::unordered_map<std::string_view, const models::WarehouseCost*> costOf;
+    for (const auto& cost : costs) {
+        costOf.emplace(cost.warehouseId, &cost);
+    }
+    for (const auto& warehouse : problem.warehouses) {
+        auto it = costOf.find(warehouse);
+        problem.shipmentCost.push_back(it != costOf.end() ? it->second->shipmentCost : options.defaultShipmentCost);
+        problem.unitCost.push_back(it != costOf.end() ? it->second->unitCost : options.defaultUnitCost);
+    }
+    problem.byUnitCost.resize(problem.warehouses.size());
+    std::iota(problem.byUnitCost.begin(), problem.byUnitCost.end(), 0);
+    std::stable_sort(problem.byUnitCost.begin(), problem.byUnitCost.end(), [&](std::size_t a, std::size_t b) {
+        return problem.unitCost[a] < problem.unitCost[b];
+    });
+
+    // Whatever no warehouse holds is backordered, not planned
+    problem.target = demand;
+    for (std::size_t p = 0; p < problem.products; ++p) {
+        long long total = 0;
+        for (std::size_t w = 0; w < problem.warehouses.size(); ++w) {
+            total += problem.at(w, p);
+        }
+        problem.target[p] = static_cast<int>(std::min<long long>(demand[p], total));
+    }
+    return problem;
+}
+
+/**
+ * Cost of sourcing every target from `members` (ordered cheapest per unit
+ * first), filling each product from the cheapest warehouse that has it.
+ */
+std::int64_t fillCost(const Problem& problem, const std::vector<std::size_t>& members) {
+    std::int64_t cost = 0;
+    for (auto w : members) {
+        cost += problem.shipmentCost[w];
+    }
+    for (std::size_t p = 0; p < problem.products; ++p) {
+        int needed = problem.target[p];
+        for (auto w : members) {
+            if (needed == 0) {
+                break;
+            }
+            int taken = std::min(needed, problem.at(w, p));
+            cost += taken * problem.unitCost[w];
+            needed -= taken;
+        }
+        if (needed > 0) {
+            return kInfeasible;
+        }
+    }
+    return cost;
+}
+
+std::vector<std::size_t> inCostOrder(const Problem& problem, const std::vector<char>& chosen) {
+    std::vector<std::size_t> members;
+    for (auto w : problem.byUnitCost) {
+        if (chosen[w]) {
+            members.push_back(w);
+        }
+    }
+    return members;
+}
+
+// Set-cover greedy: take the warehouse covering the most outstanding units
+std::vector<std::size_t> greedy(const Problem& problem) {
+    const auto warehouseCount = problem.warehouses.size();
+    std::vector<int> remaining = problem.target;
+    std::vector<char> chosen(warehouseCount, 0);
+
+    while (std::any_of(remaining.begin(), remaining.end(), [](int units) { return units > 0; })) {
+        std::size_t best = warehouseCount;
+        long long bestCover = 0;
+        std::int64_t bestCost = 0;
+        for (std::size_t w = 0; w < warehouseCount; ++w) {
+            if (chosen[w]) {
+                continue;
+            }
+            long long cover = 0;
+            for (std::size_t p = 0; p < problem.products; ++p) {
+                cover += std::min(remaining[p], problem.at(w, p));
+            }
+            std::int64_t cost = problem.shipmentCost[w] + cover * problem.unitCost[w];
+            if (cover > bestCover || (cover == bestCover && cover > 0 && cost < bestCost)) {
+                best = w;
+                bestCover = cover;
+                bestCost = cost;
+            }
+        }
+        chosen[best] = 1;
+        for (std::size_t p = 0; p < problem.products; ++p) {
+            remaining[p] -= std::min(remaining[p], problem.at(best, p));
+        }
+    }
+
+    // Drop warehouses that later picks made redundant, dearest first
+    auto members = inCostOrder(problem, chosen);
+    for (auto it = members.rbegin(); it != members.rend(); ++it) {
+        chosen[*it] = 0;
+        if (fillCost(problem, inCostOrder(problem, chosen)) == kInfeasible) {
+            chosen[*it] = 1;
+        }
+    }
+    return inCostOrder(problem, chosen);
+}
+
+/**
+ * Cheapest set of the fewest warehouses, trying every set smaller than or
+ * as large as the greedy one. Sets are built from positions in byUnitCost,
+ * so members come out cheapest first without sorting.
+ */
+std::vector<std::size_t> exact(const Problem& problem, const std::vector<std::size_t>& upperBound) {
+    const auto n = problem.byUnitCost.size();
+    for (std::size_t k = 1; k <= upperBound.size(); ++k) {
+        std::vector<std::size_t> positions(k);
+        std::iota(positions.begin(), positions.end(), 0);
+        std::vector<std::size_t> members(k);
+        std::vector<std::size_t> best;
+        std::int64_t bestCost = std::numeric_limits<std::int64_t>::max();
+
+        while (true) {
+            for (std::size_t i = 0; i < k; ++i) {
+                members[i] = problem.byUnitCost[positions[i]];
+            }
+            auto cost = fillCost(problem, members);
+            if (cost != kInfeasible && cost < bestCost) {
+                best = members;
+                bestCost = cost;
+            }
+
+            // Next k-combination of positions in lexicographic order
+            std::size_t i = k;
+            while (i > 0 && positions[i - 1] == n - k + i - 1) {
+                --i;
+            }
+            if (i == 0) {
+                break;
+            }
+            ++positions[i - 1];
+            for (std::size_t j = i; j < k; ++j) {
+                positions[j] = positions[j - 1] + 1;
+            }
+        }
+        if (!best.empty()) {
+            return best;
+        }
+    }
+    return upperBound;
+}
+
+} // namespace
+
+SourcingPlanner::SourcingPlanner(models::SourcingOptions options)
+    : options_(options) {}
+
+models::SourcingPlan SourcingPlanner::plan(const std::vector<models::SourcingLine>& lines,
+                                           const std::vector<models::WarehouseStock>& stock,
+                                           const std::vector<models::WarehouseCost>& costs) const {
+    auto problem = intern(lines, stock, costs, options_);
+
+    models::SourcingPlan plan;
+    std::vector<std::size_t> members = greedy(problem);
+    plan.exact = problem.warehouses.size() <= options_.maxExactWarehouses;
+    if (plan.exact) {
+        members = exact(problem, members);
+    }
+    plan.cost = members.empty() ? 0 : fillCost(problem, members);
+
+    // Units each chosen warehouse supplies per product, cheapest first
+    std::vector<int> supply(problem.warehouses.size() * problem.products, 0);
+    for (std::size_t p = 0; p < problem.products; ++p) {
+        int needed = problem.target[p];
+        for (auto w : members) {
+            int taken = std::min(needed, problem.at(w, p));
+            supply[w * problem.products + p] = taken;
+            needed -= taken;
+        }
+    }
+
+    std::vector<std::size_t> shipmentOf(problem.warehouses.size(), 0);
+    for (auto w : members) {
+        shipmentOf[w] = plan.shipments.size();
+        plan.shipments.push_back({problem.warehouses[w], {}, 0});
+    }
+    auto ship = [&](std::size_t w, std::size_t line, int quantity) {
+        auto& shipment = plan.shipments[shipmentOf[w]];
+        shipment.lines.push_back({line, quantity});
+        shipment.units += quantity;
+        supply[w * problem.products + problem.productOf[line]] -= quantity;
+    };
+
+    std::vector<int> unsourced = problem.target;
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+        auto p = problem.productOf[i];
+        int quantity = std::min(lines[i].quantity, unsourced[p]);
+        unsourced[p] -= quantity;
+        if (quantity < lines[i].quantity) {
+            plan.backordered.push_back({i, lines[i].quantity - quantity});
+        }
+        if (quantity == 0) {
+            continue;
+        }
+
+        // Keep the line whole when one warehouse can ship all of it
+        auto whole = std::find_if(members.begin(), members.end(), [&](std::size_t w) {
+            return supply[w * problem.products + p] >= quantity;
+        });
+        if (whole != members.end()) {
+            ship(*whole, i, quantity);
+            continue;
+        }
+        for (auto w : members) {
+            int taken = std::min(quantity, supply[w * problem.products + p]);
+            if (taken > 0) {
+                ship(w, i, taken);
+                quantity -= taken;
+            }
+        }
+    }
+
+    std::stable_sort(plan.shipments.begin(), plan.shipments.end(),
+                     [](const models::Shipment& a, const models::Shipment& b) { return a.units > b.units; });
+    return plan;
+}
+
+} // namespace order::services
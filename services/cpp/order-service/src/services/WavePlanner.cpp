@@ -0,0 +1,389 @@
+#include "order/services/WavePlanner.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <queue>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+
+namespace order::services {
+
+namespace {
+
+// Local search looks at no more than this many other waves per order
+constexpr std::size_t kMaxMoveCandidates = 16;
+constexpr int kLocalSearchPasses = 2;
+// Unrelated orders tried when no order left shares a stop with the wave
+constexpr std::size_t kFillLookahead = 32;
+
+// Orders with SKUs interned to dense ids, shared read-only by all partitions
+struct Catalogue {
+    std::vector<std::vector<std::uint32_t>> stops;   // distinct SKU ids per order
+    std::vector<std::size_t> lines;
+    std::size_t skuCount = 0;
+};
+
+Catalogue intern(const std::vector<models::WaveOrder>& orders) {
+    Catalogue catalogue;
+    catalogue.stops.resize(orders.size());
+    catalogue.lines.resize(orders.size());
+    std::unordered_map<std::string_view, std::uint32_t> ids;
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        auto& stops = catalogue.stops[i];
+        for (const auto& sku : orders[i].skus) {
+            auto [it, inserted] = ids.try_emplace(sku, static_cast<std::uint32_t>(ids.size()));
+            stops.push_back(it->second);
+        }
+        std::sort(stops.begin(), stops.end());
+        stops.erase(std::unique(stops.begin(), stops.end()), stops.end());
+        catalogue.lines[i] = orders[i].skus.size();
+    }
+    catalogue.skuCount = ids.size();
+    return catalogue;
+}
+
+class PartitionPlanner {
+public:
+    PartitionPlanner(const std::vector<models::WaveOrder>& orders, const Catalogue& catalogue,
+                     const models::WaveConstraints& constraints, std::vector<std::size_t> members)
+        : orders_(orders), catalogue_(catalogue), constraints_(constraints), members_(std::move(members)) {}
+
+    std::vector<models::Wave> plan() {
+        // Seeds are taken due-soonest first; larger orders first on ties so they anchor waves
+        std::sort(members_.begin(), members_.end(), [&](std::size_t a, std::size_t b) {
+            const auto& shipA = orders_[a].shipByDate;
+            const auto& shipB = orders_[b].shipByDate;
+            if (shipA != shipB) {
+                if (!shipA) return false;
+                if (!shipB) return true;
+                return *shipA < *shipB;
+            }
+            return catalogue_.lines[a] > catalogue_.lines[b];
+        });
+        buildPostings();
+        greedy();
+        for (int pass = 0; pass < kLocalSearchPasses; ++pass) {
+            if (!improve()) {
+                break;
+            }
+        }
+        return finish();
+    }
+
+private:
+    struct Draft {
+        std::vector<std::uint32_t> members;   // local indexes
+        std::unordered_map<std::uint32_t, std::uint32_t> skuCounts;
+        std::size_t lines = 0;
+    };
+
+    // (shared stops, -new stops, -rank, local index); larger is better
+    using Candidate = std::tuple<std::uint32_t, std::int64_t, std::int64_t, std::uint32_t>;
+
+    const std::vector<models::WaveOrder>& orders_;
+    const Catalogue& catalogue_;
+    const models::WaveConstraints& constraints_;
+    std::vector<std::size_t> members_;   // input indexes, in seed order; local index = position
+
+    std::vector<std::vector<std::uint32_t>> postings_;   // SKU id -> unassigned local indexes
+    std::vector<bool> assigned_;
+    std::vector<Draft> drafts_;
+    std::vector<std::uint32_t> waveOf_;
+
+    const std::vector<std::uint32_t>& stopsOf(std::uint32_t local) const {
+        return catalogue_.stops[members_[local]];
+    }
+    std::size_t linesOf(std::uint32_t local) const {
+        return catalogue_.lines[members_[local]];
+    }
+
+    bool fits(const Draft& draft, std::uint32_t local, std::size_t newStops) const {
+        return draft.members.size() + 1 <= constraints_.maxOrdersPerWave &&
+               draft.lines + linesOf(local) <= constraints_.maxLinesPerWave &&
+               draft.skuCounts.size() + newStops <= constraints_.maxStopsPerWave;
+    }
+
+    void buildPostings() {
+        postings_.assign(catalogue_.skuCount, {});
+        for (std::uint32_t local = 0; local < members_.size(); ++local) {
+            for (auto sku : stopsOf(local)) {
+                postings_[sku].push_back(local);
+            }
+        }
+        assigned_.assign(members_.size(), false);
+        waveOf_.assign(members_.size(), 0);
+    }
+
+    void greedy() {
+        std::vector<std::uint32_t> shared(members_.size(), 0);
+        std::vector<std::uint32_t> touched;
+        std::uint32_t cursor = 0;
+
+        while (true) {
+            while (cursor < members_.size() && assigned_[cursor]) {
+                ++cursor;
+            }
+            if (cursor == members_.size()) {
+                break;
+            }
+
+            auto waveIndex = static_cast<std::uint32_t>(drafts_.size());
+            drafts_.emplace_back();
+            auto& draft = drafts_.back();
+            std::priority_queue<Candidate> heap;
+
+            auto add = [&](std::uint32_t local) {
+                assigned_[local] = true;
+                waveOf_[local] = waveIndex;
+                draft.members.push_back(local);
+                draft.lines += linesOf(local);
+                for (auto sku : stopsOf(local)) {
+                    if (draft.skuCounts[sku]++ != 0) {
+                        continue;
+                    }
+                    // A new stop: every open order on it now shares one more stop with the wave.
+                    // Assigned orders are compacted out so each posting list only shrinks.
+                    auto& posting = postings_[sku];
+                    for (std::size_t i = 0; i < posting.size();) {
+                        auto other = posting[i];
+                        if (assigned_[other]) {
+                            posting[i] = posting.back();
+                            posting.pop_back();
+                            continue;
+                        }
+                        if (shared[other]++ == 0) {
+                            touched.push_back(other);
+                        }
+                        auto newStops = stopsOf(other).size() - shared[other];
+                        heap.emplace(shared[other], -static_cast<std::int64_t>(newStops),
+                                     -static_cast<std::int64_t>(other), other);
+                        ++i;
+                    }
+                }
+            };
+
+            add(cursor);
+            while (draft.members.size() < constraints_.maxOrdersPerWave) {
+                bool grew = false;
+                while (!heap.empty()) {
+                    auto [score, negNew, negRank, local] = heap.top();
+                    heap.pop();
+                    if (assigned_[local] || score != shared[local]) {
+                        continue;   // stale entry
+                    }
+                    if (fits(draft, local, static_cast<std::size_t>(-negNew))) {
+                        add(local);
+                        grew = true;
+                        break;
+                    }
+                }
+                if (grew) {
+                    continue;
+                }
+
+                // Nothing left shares a stop; top up with the next orders due that still fit
+                std::size_t tried = 0;
+                for (auto next = cursor; next < members_.size() && tried < kFillLookahead; ++next) {
+                    if (assigned_[next]) {
+                        continue;
+                    }
+                    ++tried;
+                    if (fits(draft, next, stopsOf(next).size())) {
+                        add(next);
+                        grew = true;
+                        break;
+                    }
+                }
+                if (!grew) {
+                    break;
+                }
+            }
+
+            for (auto local : touched) {
+                shared[local] = 0;
+            }
+            touched.clear();
+        }
+    }
+
+    bool improve() {
+        // SKU id -> waves holding it; entries go stale when a wave loses the SKU
+        std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> skuWaves;
+        for (std::uint32_t w = 0; w < drafts_.size(); ++w) {
+            for (const auto& [sku, count] : drafts_[w].skuCounts) {
+                skuWaves[sku].push_back(w);
+            }
+        }
+
+        bool moved = false;
+        std::vector<std::uint32_t> candidates;
+        for (std::uint32_t local = 0; local < members_.size(); ++local) {
+            auto from = waveOf_[local];
+            auto& source = drafts_[from];
+            if (source.members.size() == 1) {
+                continue;   // moving a lone order cannot remove a stop
+            }
+
+            const auto& stops = stopsOf(local);
+            std::size_t saving = 0;
+            for (auto sku : stops) {
+                saving += source.skuCounts.at(sku) == 1 ? 1 : 0;
+            }
+            if (saving == 0) {
+                continue;
+            }
+
+            candidates.clear();
+            for (auto sku : stops) {
+                for (auto w : skuWaves[sku]) {
+                    if (w != from && std::find(candidates.begin(), candidates.end(), w) == candidates.end()) {
+                        candidates.push_back(w);
+                    }
+                    if (candidates.size() == kMaxMoveCandidates) break;
+                }
+                if (candidates.size() == kMaxMoveCandidates) break;
+            }
+
+            std::uint32_t best = from;
+            std::size_t bestCost = saving;
+            for (auto w : candidates) {
+                const auto& target = drafts_[w];
+                std::size_t cost = 0;
+                for (auto sku : stops) {
+                    cost += target.skuCounts.count(sku) ? 0 : 1;
+                }
+                if (cost < bestCost && fits(target, local, cost)) {
+                    best = w;
+                    bestCost = cost;
+                }
+            }
+            if (best == from) {
+                continue;
+            }
+
+            auto& target = drafts_[best];
+            source.members.erase(std::find(source.members.begin(), source.members.end(), local));
+            source.lines -= linesOf(local);
+            for (auto sku : stops) {
+                if (--source.skuCounts[sku] == 0) {
+                    source.skuCounts.erase(sku);
+                }
+                if (target.skuCounts[sku]++ == 0) {
+                    skuWaves[sku].push_back(best);
+                }
+            }
+            target.members.push_back(local);
+            target.lines += linesOf(local);
+            waveOf_[local] = best;
+            moved = true;
+        }
+        return moved;
+    }
+
+    std::vector<models::Wave> finish() const {
+        std::vector<models::Wave> waves;
+        waves.reserve(drafts_.size());
+        for (const auto& draft : drafts_) {
+            if (draft.members.empty()) {
+                continue;
+            }
+            models::Wave wave;
+            wave.lineCount = draft.lines;
+            wave.stopCount = draft.skuCounts.size();
+            for (auto local : draft.members) {
+                auto index = members_[local];
+                wave.orders.push_back(index);
+                const auto& shipBy = orders_[index].shipByDate;
+                if (shipBy && (!wave.earliestShipBy || *shipBy < *wave.earliestShipBy)) {
+                    wave.earliestShipBy = shipBy;
+                }
+            }
+            std::sort(wave.orders.begin(), wave.orders.end());
+            waves.push_back(std::move(wave));
+        }
+        std::stable_sort(waves.begin(), waves.end(), [](const models::Wave& a, const models::Wave& b) {
+            if (!a.earliestShipBy) return false;
+            if (!b.earliestShipBy) return true;
+            return *a.earliestShipBy < *b.earliestShipBy;
+        });
+        return waves;
+    }
+};
+
+} // namespace
+
+WavePlanner::WavePlanner(unsigned workers)
+    : workers_(workers != 0 ? workers : std::max(1u, std::thread::hardware_concurrency())) {}
+
+std::vector<models::Wave> WavePlanner::plan(const std::vector<models::WaveOrder>& orders,
+                                            const models::WaveConstraints& constraints) const {
+    if (constraints.maxLinesPerWave == 0 || constraints.maxStopsPerWave == 0 || constraints.maxOrdersPerWave == 0) {
+        throw std::invalid_argument("Wave limits must be positive");
+    }
+
+    auto catalogue = intern(orders);
+
+    // Partition key: urgent priorities first, then orders due at the cut-off before later ones
+    struct Partition {
+        models::OrderPriority priority;
+        bool due;
+        std::vector<std::size_t> members;
+    };
+    std::vector<Partition> partitions;
+    for (auto priority : {models::OrderPriority::URGENT, models::OrderPriority::HIGH,
+                          models::OrderPriority::NORMAL, models::OrderPriority::LOW}) {
+        partitions.push_back({priority, true, {}});
+        partitions.push_back({priority, false, {}});
+    }
+    auto slot = [](models::OrderPriority priority, bool due) {
+        return (3 - static_cast<std::size_t>(priority)) * 2 + (due ? 0 : 1);
+    };
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        const auto& order = orders[i];
+        bool due = constraints.cutoff && order.shipByDate && *order.shipByDate <= *constraints.cutoff;
+        partitions[slot(order.priority, due)].members.push_back(i);
+    }
+
+    auto planPartition = [&](Partition& partition) {
+        return PartitionPlanner(orders, catalogue, constraints, std::move(partition.members)).plan();
+    };
+
+    // Largest partitions first so a busy one is never queued behind small ones
+    std::vector<std::size_t> byWork;
+    for (std::size_t p = 0; p < partitions.size(); ++p) {
+        if (!partitions[p].members.empty()) {
+            byWork.push_back(p);
+        }
+    }
+    std::sort(byWork.begin(), byWork.end(), [&](std::size_t a, std::size_t b) {
+        return partitions[a].members.size() > partitions[b].members.size();
+    });
+
+    std::vector<std::vector<models::Wave>> planned(partitions.size());
+    for (std::size_t start = 0; start < byWork.size(); start += workers_) {
+        auto end = std::min(byWork.size(), start + workers_);
+        std::vector<std::future<std::vector<models::Wave>>> tasks;
+        for (auto i = start + 1; i < end; ++i) {
+            tasks.push_back(std::async(std::launch::async, planPartition, std::ref(partitions[byWork[i]])));
+        }
+        planned[byWork[start]] = planPartition(partitions[byWork[start]]);
+        for (auto i = start + 1; i < end; ++i) {
+            planned[byWork[i]] = tasks[i - start - 1].get();
+        }
+    }
+
+    std::vector<models::Wave> waves;
+    for (std::size_t p = 0; p < partitions.size(); ++p) {
+        for (auto& wave : planned[p]) {
+            wave.priority = partitions[p].priority;
+            wave.dueByCutoff = partitions[p].due;
+            waves.push_back(std::move(wave));
+        }
+    }
+    return waves;
+}
+
+} // namespace order::services
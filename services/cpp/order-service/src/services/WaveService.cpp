@@ -0,0 +1,64 @@
+#include "order/services/WaveService.hpp"
+#include "order/repositories/OrderRepository.hpp"
+#include "order/utils/Logger.hpp"
+#include <chrono>
+#include <ctime>
+
+namespace order::services {
+
+namespace {
+
+std::string formatTimestamp(std::chrono::system_clock::time_point time) {
+    auto seconds = std::chrono::system_clock::to_time_t(time);
+    std::tm utc{};
+    gmtime_r(&seconds, &utc);
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return buffer;
+}
+
+} // namespace
+
+WaveService::WaveService(std::shared_ptr<repositories::OrderRepository> repository)
+    : repository_(repository) {}
+
+dtos::WavePlanDto WaveService::plan(const std::string& warehouseId, const models::WaveConstraints& constraints) {
+    utils::Logger::debug("WaveService::plan({})", warehouseId);
+    
+    auto orders = repository_->findWaveOrders(warehouseId);
+    
+    auto started = std::chrono::steady_clock::now();
+    auto waves = planner_.plan(orders, constraints);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    utils::Logger::info("Planned {} waves for {} pending orders in warehouse {} ({} ms)",
+                        waves.size(), orders.size(), warehouseId, elapsed.count());
+    
+    std::vector<dtos::WaveDto> dtos;
+    dtos.reserve(waves.size());
+    for (const auto& wave : waves) {
+        std::vector<std::string> orderIds;
+        std::vector<std::string> orderNumbers;
+        orderIds.reserve(wave.orders.size());
+        orderNumbers.reserve(wave.orders.size());
+        for (auto index : wave.orders) {
+            orderIds.push_back(orders[index].id);
+            orderNumbers.push_back(orders[index].orderNumber);
+        }
+        std::optional<std::string> earliestShipBy;
+        if (wave.earliestShipBy) {
+            earliestShipBy = formatTimestamp(*wave.earliestShipBy);
+        }
+        dtos.emplace_back(static_cast<int>(dtos.size() + 1),
+                          models::orderPriorityToString(wave.priority),
+                          wave.dueByCutoff,
+                          earliestShipBy,
+                          orderIds,
+                          orderNumbers,
+                          static_cast<int>(wave.lineCount),
+                          static_cast<int>(wave.stopCount));
+    }
+    
+    return dtos::WavePlanDto(warehouseId, static_cast<int>(orders.size()), dtos);
+}
+
+} // namespace order::services
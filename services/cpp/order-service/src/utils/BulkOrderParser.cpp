@@ -0,0 +1,242 @@
+#include "order/utils/BulkOrderParser.hpp"
+#include <algorithm>
+#include <cctype>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace order::utils {
+
+namespace {
+
+// Below this many lines per thread, spawning costs more than it saves
+constexpr std::size_t kMinLinesPerWorker = 64;
+
+const json& requireField(const json& object, const char* name) {
+    auto it = object.find(name);
+    if (it == object.end() || it->is_null()) {
+        throw std::invalid_argument(std::string(name) + " is required");
+    }
+    return *it;
+}
+
+std::string requireString(const json& object, const char* name) {
+    const auto& value = requireField(object, name);
+    if (!value.is_string()) {
+        throw std::invalid_argument(std::string(name) + " must be a string");
+    }
+    auto text = value.get<std::string>();
+    if (text.empty()) {
+        throw std::invalid_argument(std::string(name) + " must not be empty");
+    }
+    return text;
+}
+
+std::optional<std::string> optionalString(const json& object, const char* name) {
+    auto it = object.find(name);
+    if (it == object.end() || it->is_null()) {
+        return std::nullopt;
+    }
+    if (!it->is_string()) {
+        throw std::invalid_argument(std::string(name) + " must be a string");
+    }
+    return it->get<std::string>();
+}
+
+std::optional<models::Address> optionalAddress(const json& object, const char* name) {
+    auto it = object.find(name);
+    if (it == object.end() || it->is_null()) {
+        return std::nullopt;
+    }
+    try {
+        return models::Address::fromJson(*it);
+    } catch (const json::exception&) {
+        throw std::invalid_argument(std::string(name) + " is not a valid address");
+    }
+}
+
+models::OrderLineItem parseLineItem(const json& item, std::size_t index, std::string_view currency) {
+    auto field = [index](const char* name) {
+        return "lineItems[" + std::to_string(index) + "]." + name;
+    };
+    if (!item.is_object()) {
+        throw std::invalid_argument("lineItems[" + std::to_string(index) + "] must be an object");
+    }
+
+    auto productId = optionalString(item, "productId");
+    if (!productId || !BulkOrderParser::isValidUuid(*productId)) {
+        throw std::invalid_argument(field("productId") + " must be a UUID");
+    }
+    auto sku = optionalString(item, "productSku");
+    if (!sku || sku->empty()) {
+        throw std::invalid_argument(field("productSku") + " is required");
+    }
+    auto name = optionalString(item, "productName");
+
+    auto quantity = item.find("quantity");
+    if (quantity == item.end() || !quantity->is_number_integer() || quantity->get<long long>() < 1 ||
+        quantity->get<long long>() > std::numeric_limits<int>::max()) {
+        throw std::invalid_argument(field("quantity") + " must be a positive integer");
+    }
+    auto unitPrice = item.find("unitPrice");
+    if (unitPrice == item.end() || !unitPrice->is_number() || unitPrice->get<double>() < 0.0) {
+        throw std::invalid_argument(field("unitPrice") + " must be a non-negative number");
+    }
+
+    models::OrderLineItem lineItem("", *productId, *sku, name.value_or(*sku), quantity->get<int>(),
+                                   models::Money::fromJson(*unitPrice, currency));
+    lineItem.notes = optionalString(item, "notes");
+    return lineItem;
+}
+
+} // namespace
+
+BulkOrderParser::BulkOrderParser(unsigned workers)
+    : workers_(workers != 0 ? workers : std::max(1u, std::thread::hardware_concurrency())) {}
+
+std::vector<BulkOrderLine> BulkOrderParser::readChunk(std::istream& input, std::size_t maxLines,
+                                                      std::size_t& lineNumber) {
+    std::vector<BulkOrderLine> lines;
+    lines.reserve(maxLines);
+    std::string text;
+    while (lines.size() < maxLines && std::getline(input, text)) {
+        ++lineNumber;
+        if (!text.empty() && text.back() == '\r') {
+            text.pop_back();
+        }
+        if (std::all_of(text.begin(), text.end(), [](unsigned char c) { return std::isspace(c); })) {
+            continue;
+        }
+        lines.push_back(BulkOrderLine{lineNumber, std::move(text)});
+        text.clear();
+    }
+    return lines;
+}
+
+std::vector<ParsedOrder> BulkOrderParser::parse(const std::vector<BulkOrderLine>& lines) const {
+    std::vector<ParsedOrder> results(lines.size());
+    auto parseRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            results[i] = parseLine(lines[i]);
+        }
+    };
+
+    std::size_t workers = std::min<std::size_t>(workers_, lines.size() / kMinLinesPerWorker);
+    if (workers <= 1) {
+        parseRange(0, lines.size());
+        return results;
+    }
+
+    // Contiguous slices; each task writes only its own slots in results
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(workers - 1);
+    std::size_t sliceSize = (lines.size() + workers - 1) / workers;
+    for (std::size_t begin = sliceSize; begin < lines.size(); begin += sliceSize) {
+        tasks.push_back(std::async(std::launch::async, parseRange,
+                                   begin, std::min(begin + sliceSize, lines.size())));
+    }
+    parseRange(0, std::min(sliceSize, lines.size()));
+    for (auto& task : tasks) {
+        task.get();
+    }
+    return results;
+}
+
+ParsedOrder BulkOrderParser::parseLine(const BulkOrderLine& line) {
+    ParsedOrder result;
+    result.line = line.line;
+
+    json request = json::parse(line.text, nullptr, false);
+    if (request.is_discarded()) {
+        result.error = "Invalid JSON";
+        return result;
+    }
+    if (request.is_object()) {
+        auto number = request.find("orderNumber");
+        if (number != request.end() && number->is_string()) {
+            result.orderNumber = number->get<std::string>();
+        }
+    }
+
+    try {
+        result.order = parseOrder(request);
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+    return result;
+}
+
+models::Order BulkOrderParser::parseOrder(const json& request) {
+    if (!request.is_object()) {
+        throw std::invalid_argument("Order must be a JSON object");
+    }
+
+    // Left empty for the service to allocate when the request has none
+    auto orderNumber = optionalString(request, "orderNumber").value_or("");
+    if (request.contains("orderNumber") && !isValidOrderNumber(orderNumber)) {
+        throw std::invalid_argument("orderNumber must be 1-50 characters of A-Z, 0-9 and '-'");
+    }
+    auto customerId = requireString(request, "customerId");
+    auto warehouseId = requireString(request, "warehouseId");
+    if (!isValidUuid(warehouseId)) {
+        throw std::invalid_argument("warehouseId must be a UUID");
+    }
+
+    const auto& items = requireField(request, "lineItems");
+    if (!items.is_array() || items.empty()) {
+        throw std::invalid_argument("lineItems must be a non-empty array");
+    }
+
+    auto currency = optionalString(request, "currency").value_or(std::string(models::Money::kDefaultCurrency));
+    if (!models::Money::isValidCurrency(currency)) {
+        throw std::invalid_argument("currency must be an ISO 4217 code");
+    }
+
+    models::Order order("", orderNumber, customerId, warehouseId, models::OrderStatus::PENDING, "");
+    order.setTotal(models::Money(0, currency));
+    std::vector<models::OrderLineItem> lineItems;
+    lineItems.reserve(items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        lineItems.push_back(parseLineItem(items[i], i, currency));
+    }
+    order.setLineItems(lineItems);
+    order.calculateTotal();
+
+    if (auto priority = optionalString(request, "priority")) {
+        order.setPriority(models::orderPriorityFromString(*priority));
+    }
+    order.setNotes(optionalString(request, "notes"));
+    order.setShipByDate(optionalString(request, "shipByDate"));
+    order.setShippingAddress(optionalAddress(request, "shippingAddress"));
+    order.setBillingAddress(optionalAddress(request, "billingAddress"));
+    return order;
+}
+
+bool BulkOrderParser::isValidOrderNumber(const std::string& orderNumber) {
+    if (orderNumber.empty() || orderNumber.size() > kMaxOrderNumberLength) {
+        return false;
+    }
+    return std::all_of(orderNumber.begin(), orderNumber.end(), [](char c) {
+        return (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-';
+    });
+}
+
+bool BulkOrderParser::isValidUuid(const std::string& value) {
+    // 8-4-4-4-12 hex digits; hand-rolled because std::regex dominates the per-line cost
+    if (value.size() != 36) {
+        return false;
+    }
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        if (i == 8 || i == 13 || i == 18 || i == 23) {
+            if (value[i] != '-') {
+                return false;
+            }
+        } else if (!std::isxdigit(static_cast<unsigned char>(value[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace order::utils
@@ -1,5 +1,6 @@
 #include "order/utils/Config.hpp"
 #include "order/utils/Logger.hpp"
+#include <algorithm>
 #include <fstream>
 #include <cstdlib>
 #include <sstream>
@@ -84,25 +85,25 @@ std::optional<json> Config::getJson(const std::string& key) const {
 }
 
 void Config::set(const std::string& key, const std::string& value) {
-    config_[key] = value;
+    config_[toPointer(key)] = value;
 }
 
 void Config::set(const std::string& key, int value) {
-    config_[key] = value;
+    config_[toPointer(key)] = value;
 }
 
 void Config::set(const std::string& key, bool value) {
-    config_[key] = value;
+    config_[toPointer(key)] = value;
 }
 
 void Config::set(const std::string& key, double value) {
-    config_[key] = value;
+    config_[toPointer(key)] = value;
 }
 
 void Config::setFromEnv(const std::string& key, const std::string& envVar) {
     const char* value = std::getenv(envVar.c_str());
     if (value != nullptr) {
-        config_[key] = std::string(value);
+        config_[toPointer(key)] = std::string(value);
     }
 }
 
@@ -125,6 +126,13 @@ Config::DatabaseConfig Config::getDatabaseConfig() const {
     return config;
 }
 
+json::json_pointer Config::toPointer(const std::string& key) {
+    // "database.host" -> /database/host, matching how getNestedValue reads it
+    std::string pointer = "/" + key;
+    std::replace(pointer.begin(), pointer.end(), '.', '/');
+    return json::json_pointer(pointer);
+}
+
 json Config::getNestedValue(const std::string& key) const {
     std::vector<std::string> keys;
     std::stringstream ss(key);
@@ -0,0 +1,32 @@
+#include "order/utils/Database.hpp"
+#include <stdexcept>
+
+namespace order::utils {
+
+std::shared_ptr<pqxx::connection> Database::connection_ = nullptr;
+
+std::shared_ptr<pqxx::connection> Database::connect(const std::string& connectionString) {
+    try {
+        connection_ = std::make_shared<pqxx::connection>(connectionString);
+        if (!connection_->is_open()) {
+            throw std::runtime_error("Failed to open database connection");
+        }
+        return connection_;
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Database connection error: " + std::string(e.what()));
+    }
+}
+
+void Database::disconnect() {
+    // Resetting the shared_ptr closes the connection
+    connection_.reset();
+}
+
+std::shared_ptr<pqxx::connection> Database::getConnection() {
+    if (!connection_ || !connection_->is_open()) {
+        throw std::runtime_error("No active database connection");
+    }
+    return connection_;
+}
+
+} // namespace order::utils
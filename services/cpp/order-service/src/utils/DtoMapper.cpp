@@ -99,6 +99,7 @@ dtos::OrderDto DtoMapper::toOrderDto(
         statusStr,
         totalItems,
         totalQuantity,
+        order.getTotal(),
         order.getOrderDate(), // use as createdAt
         order.getOrderDate(), // use as updatedAt (TODO: add proper timestamps to Order model)
         customerName,
@@ -0,0 +1,120 @@
+#include "order/utils/ExportWriter.hpp"
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace order::utils {
+
+ExportFormat exportFormatFromString(const std::string& format) {
+    if (format == "csv") return ExportFormat::Csv;
+    if (format == "ndjson") return ExportFormat::Ndjson;
+    throw std::invalid_argument("format must be csv or ndjson");
+}
+
+ExportWriter::ExportWriter(std::ostream& out, ExportFormat format, std::vector<ExportColumn> columns)
+    : out_(out), format_(format), columns_(std::move(columns)) {
+    if (columns_.empty()) {
+        throw std::invalid_argument("An export needs at least one column");
+    }
+}
+
+void ExportWriter::begin() {
+    if (format_ != ExportFormat::Csv) {
+        return;
+    }
+    for (std::size_t i = 0; i < columns_.size(); ++i) {
+        if (i > 0) {
+            out_ << ',';
+        }
+        writeCsvField(columns_[i].name);
+    }
+    out_ << "\r\n";
+}
+
+void ExportWriter::row(const std::vector<std::optional<std::string>>& values) {
+    if (values.size() != columns_.size()) {
+        throw std::invalid_argument("Export row has " + std::to_string(values.size()) +
+                                    " values for " + std::to_string(columns_.size()) + " columns");
+    }
+
+    if (format_ == ExportFormat::Csv) {
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i > 0) {
+                out_ << ',';
+            }
+            if (values[i]) {
+                writeCsvField(*values[i]);
+            }
+        }
+        out_ << "\r\n";
+    } else {
+        out_ << '{';
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i > 0) {
+                out_ << ',';
+            }
+            out_ << nlohmann::json(columns_[i].name).dump() << ':';
+            if (!values[i]) {
+                out_ << "null";
+            } else if (columns_[i].numeric) {
+                out_ << *values[i];
+            } else {
+                out_ << nlohmann::json(*values[i]).dump();
+            }
+        }
+        out_ << "}\n";
+    }
+    ++rows_;
+}
+
+std::string ExportWriter::contentType(ExportFormat format) {
+    return format == ExportFormat::Csv ? "text/csv; charset=utf-8" : "application/x-ndjson";
+}
+
+std::string ExportWriter::fileExtension(ExportFormat format) {
+    return format == ExportFormat::Csv ? "csv" : "ndjson";
+}
+
+std::vector<ExportColumn> ExportWriter::project(const std::vector<ExportColumn>& catalogue,
+                                                const std::vector<std::string>& names) {
+    if (names.empty()) {
+        return catalogue;
+    }
+
+    std::vector<ExportColumn> columns;
+    std::unordered_set<std::string> seen;
+    for (const auto& name : names) {
+        if (!seen.insert(name).second) {
+            throw std::invalid_argument("Column listed twice: " + name);
+        }
+        bool found = false;
+        for (const auto& column : catalogue) {
+            if (column.name == name) {
+                columns.push_back(column);
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            throw std::invalid_argument("Unknown export column: " + name);
+        }
+    }
+    return columns;
+}
+
+void ExportWriter::writeCsvField(const std::string& value) {
+    if (value.find_first_of(",\"\r\n") == std::string::npos) {
+        out_ << value;
+        return;
+    }
+    out_ << '"';
+    for (char c : value) {
+        if (c == '"') {
+            out_ << '"';
+        }
+        out_ << c;
+    }
+    out_ << '"';
+}
+
+} // namespace order::utils
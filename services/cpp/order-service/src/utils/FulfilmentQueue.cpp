@@ -0,0 +1,185 @@
+#include "order/utils/FulfilmentQueue.hpp"
+#include <algorithm>
+#include <ctime>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+
+namespace order::utils {
+
+bool FulfilmentQueue::isReleasable(models::OrderStatus status) {
+    return status == models::OrderStatus::PENDING || status == models::OrderStatus::CONFIRMED;
+}
+
+FulfilmentQueue::Entry FulfilmentQueue::entryFor(const models::Order& order) {
+    Entry entry;
+    entry.orderId = order.getId();
+    entry.warehouseId = order.getWarehouseId();
+    entry.priority = order.getPriority();
+    if (auto shipBy = order.getShipByDate()) {
+        entry.shipBy = toEpochSeconds(*shipBy);
+    }
+    if (!order.getOrderDate().empty()) {
+        entry.orderDate = toEpochSeconds(order.getOrderDate());
+    }
+    return entry;
+}
+
+std::int64_t FulfilmentQueue::toEpochSeconds(const std::string& timestamp) {
+    std::tm utc{};
+    const char* end = strptime(timestamp.c_str(), "%Y-%m-%d", &utc);
+    if (end == nullptr) {
+        throw std::invalid_argument("Invalid date: " + timestamp);
+    }
+    if (*end == 'T' || *end == ' ') {
+        end = strptime(end + 1, "%H:%M:%S", &utc);
+        if (end == nullptr) {
+            throw std::invalid_argument("Invalid date-time: " + timestamp);
+        }
+    }
+    return static_cast<std::int64_t>(timegm(&utc));
+}
+
+bool FulfilmentQueue::before(const Entry& a, const Entry& b) {
+    if (a.priority != b.priority) return a.priority > b.priority;
+    if (a.shipBy != b.shipBy) return a.shipBy < b.shipBy;
+    if (a.orderDate != b.orderDate) return a.orderDate < b.orderDate;
+    return a.orderId < b.orderId;
+}
+
+void FulfilmentQueue::sync(const models::Order& order) {
+    if (order.getId().empty()) {
+        return;
+    }
+    if (isReleasable(order.getStatus())) {
+        upsert(entryFor(order));
+    } else {
+        remove(order.getId());
+    }
+}
+
+void FulfilmentQueue::upsert(const Entry& entry) {
+    std::unique_lock lock(mutex_);
+
+    auto slot = slots_.find(entry.orderId);
+    if (slot != slots_.end()) {
+        auto& heap = *slot->second.heap;
+        auto index = slot->second.index;
+        if (heap.nodes[index].warehouseId == entry.warehouseId) {
+            // Re-key in place: whichever way the key moved, one sift restores the heap
+            heap.nodes[index] = entry;
+            siftDown(heap, siftUp(heap, index));
+            return;
+        }
+        removeAt(heap, index);
+    }
+
+    auto& heap = heaps_[entry.warehouseId];
+    heap.nodes.push_back(entry);
+    place(heap, heap.nodes.size() - 1);
+    siftUp(heap, heap.nodes.size() - 1);
+}
+
+bool FulfilmentQueue::remove(const std::string& orderId) {
+    std::unique_lock lock(mutex_);
+    auto slot = slots_.find(orderId);
+    if (slot == slots_.end()) {
+        return false;
+    }
+    removeAt(*slot->second.heap, slot->second.index);
+    return true;
+}
+
+std::vector<FulfilmentQueue::Entry> FulfilmentQueue::next(const std::string& warehouseId, std::size_t count) const {
+    std::shared_lock lock(mutex_);
+    std::vector<Entry> result;
+    auto found = heaps_.find(warehouseId);
+    if (found == heaps_.end() || count == 0) {
+        return result;
+    }
+
+    // Walk the heap best-first: the next entry is always the best child of one already taken
+    const auto& nodes = found->second.nodes;
+    auto worse = [&nodes](std::size_t a, std::size_t b) { return before(nodes[b], nodes[a]); };
+    std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(worse)> frontier(worse);
+    frontier.push(0);
+    result.reserve(std::min(count, nodes.size()));
+    while (!frontier.empty() && result.size() < count) {
+        auto index = frontier.top();
+        frontier.pop();
+        result.push_back(nodes[index]);
+        for (auto child : {2 * index + 1, 2 * index + 2}) {
+            if (child < nodes.size()) {
+                frontier.push(child);
+            }
+        }
+    }
+    return result;
+}
+
+std::size_t FulfilmentQueue::size() const {
+    std::shared_lock lock(mutex_);
+    return slots_.size();
+}
+
+std::size_t FulfilmentQueue::size(const std::string& warehouseId) const {
+    std::shared_lock lock(mutex_);
+    auto found = heaps_.find(warehouseId);
+    return found == heaps_.end() ? 0 : found->second.nodes.size();
+}
+
+void FulfilmentQueue::place(Heap& heap, std::size_t index) {
+    slots_[heap.nodes[index].orderId] = Slot{&heap, index};
+}
+
+std::size_t FulfilmentQueue::siftUp(Heap& heap, std::size_t index) {
+    while (index > 0) {
+        auto parent = (index - 1) / 2;
+        if (!before(heap.nodes[index], heap.nodes[parent])) {
+            break;
+        }
+        std::swap(heap.nodes[index], heap.nodes[parent]);
+        place(heap, index);
+        place(heap, parent);
+        index = parent;
+    }
+    return index;
+}
+
+void FulfilmentQueue::siftDown(Heap& heap, std::size_t index) {
+    auto size = heap.nodes.size();
+    while (true) {
+        auto best = index;
+        for (auto child : {2 * index + 1, 2 * index + 2}) {
+            if (child < size && before(heap.nodes[child], heap.nodes[best])) {
+                best = child;
+            }
+        }
+        if (best == index) {
+            return;
+        }
+        std::swap(heap.nodes[index], heap.nodes[best]);
+        place(heap, index);
+        place(heap, best);
+        index = best;
+    }
+}
+
+void FulfilmentQueue::removeAt(Heap& heap, std::size_t index) {
+    auto warehouseId = heap.nodes[index].warehouseId;
+    slots_.erase(heap.nodes[index].orderId);
+    auto last = heap.nodes.size() - 1;
+    if (index != last) {
+        heap.nodes[index] = std::move(heap.nodes[last]);
+        heap.nodes.pop_back();
+        place(heap, index);
+        siftDown(heap, siftUp(heap, index));
+    } else {
+        heap.nodes.pop_back();
+    }
+    if (heap.nodes.empty()) {
+        heaps_.erase(warehouseId);   // no slot points at an empty heap
+    }
+}
+
+} // namespace order::utils
@@ -0,0 +1,185 @@
+#include "order/utils/IdempotencyStore.hpp"
+#include "order/utils/Logger.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+
+namespace order::utils {
+
+IdempotencyStore::IdempotencyStore(std::shared_ptr<IdempotencyLedger> ledger,
+                                   std::chrono::milliseconds ttl)
+    : ledger_(std::move(ledger))
+    , ttl_(ttl)
+    , nextLedgerPurge_(Clock::now() + kLedgerPurgeInterval) {}
+
+bool IdempotencyStore::isValidKey(std::string_view key) {
+    if (key.empty() || key.size() > kMaxKeyLength) {
+        return false;
+    }
+    for (char c : key) {
+        if (c < 0x21 || c > 0x7e) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string IdempotencyStore::fingerprint(std::string_view requestBody) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : requestBody) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+
+    static constexpr char kHex[] = "0123456789abcdef";
+    std::string hex(16, '0');
+    for (int i = 15; i >= 0; --i, hash >>= 4) {
+        hex[i] = kHex[hash & 0xf];
+    }
+    return hex;
+}
+
+IdempotencyStore::Shard& IdempotencyStore::shardFor(const std::string& id) {
+    return shards_[std::hash<std::string>{}(id) % kShardCount];
+}
+
+std::size_t IdempotencyStore::size() const {
+    std::size_t total = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.entries.size();
+    }
+    return total;
+}
+
+void IdempotencyStore::sweepLocked(Shard& shard, Clock::time_point now) {
+    std::erase_if(shard.entries, [now](const auto& item) { return item.second.expiresAt <= now; });
+    // Sweep again once the live entries have doubled: amortised O(1) per insert
+    shard.nextSweep = std::max(kMinSweepSize, shard.entries.size() * 2);
+}
+
+void IdempotencyStore::forget(const std::string& id) {
+    auto& shard = shardFor(id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.entries.erase(id);
+}
+
+void IdempotencyStore::purgeLedgerIfDue(Clock::time_point now) {
+    std::unique_lock<std::mutex> lock(purgeMutex_, std::try_to_lock);
+    if (!lock.owns_lock() || now < nextLedgerPurge_) {
+        return;
+    }
+    nextLedgerPurge_ = now + kLedgerPurgeInterval;
+    try {
+        auto purged = ledger_->purgeExpired();
+        Logger::debug("Purged {} expired idempotency keys", purged);
+    } catch (const std::exception& e) {
+        Logger::warn("Failed to purge expired idempotency keys: {}", e.what());
+    }
+}
+
+IdempotencyStore::Result IdempotencyStore::execute(
+    const std::string& scope,
+    const std::string& key,
+    std::string_view requestBody,
+    const std::function<IdempotentResponse()>& handler
+) {
+    if (!isValidKey(key)) {
+        throw std::invalid_argument("Idempotency-Key must be 1-255 printable ASCII characters");
+    }
+
+    const auto requestFingerprint = fingerprint(requestBody);
+    const auto id = scope + '\n' + key;
+    const auto now = Clock::now();
+
+    std::promise<IdempotentResponse> promise;
+    {
+        auto& shard = shardFor(id);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+
+        auto it = shard.entries.find(id);
+        if (it != shard.entries.end() && it->second.expiresAt > now) {
+            if (it->second.fingerprint != requestFingerprint) {
+                throw IdempotencyKeyReused("Idempotency-Key was already used with a different request");
+            }
+            // Finished, or collapse onto the request still running
+            auto pending = it->second.response;
+            lock.unlock();
+            return {pending.get(), true};
+        }
+
+        if (shard.entries.size() >= shard.nextSweep) {
+            sweepLocked(shard, now);
+        }
+        shard.entries.insert_or_assign(id, Entry{
+            requestFingerprint, promise.get_future().share(), Clock::time_point::max()});
+    }
+
+    Result result;
+    bool claimed = false;
+    try {
+        std::optional<IdempotencyRecord> existing;
+        if (ledger_) {
+            existing = ledger_->claim(scope, key, requestFingerprint, ttl_);
+            claimed = !existing;
+        }
+
+        if (existing) {
+            if (existing->fingerprint != requestFingerprint) {
+                throw IdempotencyKeyReused("Idempotency-Key was already used with a different request");
+            }
+            if (!existing->response) {
+                throw IdempotencyKeyInProgress("A request with this Idempotency-Key is still in progress");
+            }
+            result = {*existing->response, true};
+        } else {
+            result.response = handler();
+        }
+    } catch (...) {
+        if (claimed) {
+            try {
+                ledger_->release(scope, key);
+            } catch (const std::exception& e) {
+                Logger::warn("Failed to release idempotency key {}: {}", key, e.what());
+            }
+        }
+        forget(id);
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    const bool keep = result.response.status < 500;
+    if (claimed) {
+        // The request has run; failing to record it must not fail the request.
+        // An unrecorded claim reads as "in progress" until it expires, which
+        // stops other replicas from running the request a second time.
+        try {
+            if (keep) {
+                ledger_->complete(scope, key, result.response);
+            } else {
+                ledger_->release(scope, key);
+            }
+        } catch (const std::exception& e) {
+            Logger::warn("Failed to record idempotency key {}: {}", key, e.what());
+        }
+    }
+
+    if (keep) {
+        auto& shard = shardFor(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(id);
+        if (it != shard.entries.end()) {
+            it->second.expiresAt = Clock::now() + ttl_;
+        }
+    } else {
+        forget(id);
+    }
+    promise.set_value(result.response);
+
+    if (ledger_) {
+        purgeLedgerIfDue(now);
+    }
+    return result;
+}
+
+} // namespace order::utils
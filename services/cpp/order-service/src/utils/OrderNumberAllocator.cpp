@@ -0,0 +1,111 @@
+#include "order/utils/OrderNumberAllocator.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+namespace order::utils {
+
+namespace {
+
+constexpr std::size_t kMaxPrefixLength = 20;
+constexpr std::int64_t kMaxBlockStart = std::int64_t{1} << 40;
+constexpr std::size_t kMinDigits = 8;   // format() zero-pads to this width
+
+void validatePrefix(const std::string& prefix) {
+    bool valid = !prefix.empty() && prefix.size() <= kMaxPrefixLength &&
+                 std::all_of(prefix.begin(), prefix.end(), [](char c) {
+                     return (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-';
+                 });
+    if (!valid) {
+        throw std::invalid_argument("Order number prefix must be 1-20 characters of A-Z, 0-9 and '-': " + prefix);
+    }
+}
+
+} // namespace
+
+OrderNumberAllocator::OrderNumberAllocator(std::shared_ptr<OrderNumberBlockSource> source,
+                                           std::size_t blockSize,
+                                           std::unordered_map<std::string, std::string> prefixes,
+                                           std::string defaultPrefix)
+    : source_(std::move(source)),
+      blockSize_(blockSize),
+      prefixes_(std::move(prefixes)),
+      defaultPrefix_(std::move(defaultPrefix)),
+      state_(blockSize) {   // no block yet: the first caller reserves one
+    if (!source_) {
+        throw std::invalid_argument("Order number block source is required");
+    }
+    if (blockSize_ == 0 || blockSize_ > kMaxBlockSize) {
+        throw std::invalid_argument("Order number block size must be 1-" + std::to_string(kMaxBlockSize));
+    }
+    validatePrefix(defaultPrefix_);
+    generatedPrefixes_.insert(defaultPrefix_);
+    for (const auto& [warehouseId, prefix] : prefixes_) {
+        validatePrefix(prefix);
+        generatedPrefixes_.insert(prefix);
+    }
+}
+
+std::string OrderNumberAllocator::next(const std::string& warehouseId) {
+    return format(prefixFor(warehouseId), nextNumber());
+}
+
+std::vector<std::string> OrderNumberAllocator::next(const std::string& warehouseId, std::size_t count) {
+    const auto& prefix = prefixFor(warehouseId);
+    std::vector<std::string> numbers;
+    numbers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        numbers.push_back(format(prefix, nextNumber()));
+    }
+    return numbers;
+}
+
+const std::string& OrderNumberAllocator::prefixFor(const std::string& warehouseId) const {
+    auto it = prefixes_.find(warehouseId);
+    return it != prefixes_.end() ? it->second : defaultPrefix_;
+}
+
+bool OrderNumberAllocator::isGenerated(const std::string& number) const {
+    auto dash = number.rfind('-');
+    if (dash == std::string::npos || number.size() - dash - 1 < kMinDigits) {
+        return false;
+    }
+    bool digits = std::all_of(number.begin() + static_cast<std::ptrdiff_t>(dash) + 1, number.end(),
+                              [](char c) { return c >= '0' && c <= '9'; });
+    return digits && generatedPrefixes_.count(number.substr(0, dash)) > 0;
+}
+
+std::string OrderNumberAllocator::format(const std::string& prefix, std::int64_t number) {
+    char digits[24];
+    std::snprintf(digits, sizeof(digits), "%08lld", static_cast<long long>(number));
+    return prefix + "-" + digits;
+}
+
+std::int64_t OrderNumberAllocator::nextNumber() {
+    while (true) {
+        auto state = state_.fetch_add(1, std::memory_order_relaxed);
+        auto taken = state & kTakenMask;
+        if (taken < blockSize_) {
+            return static_cast<std::int64_t>(state >> kTakenBits) + static_cast<std::int64_t>(taken);
+        }
+        // Block used up. Overshooting the count is harmless: it stays above
+        // blockSize_ until the refill replaces the whole state.
+        std::lock_guard<std::mutex> lock(refillMutex_);
+        if ((state_.load(std::memory_order_relaxed) & kTakenMask) >= blockSize_) {
+            return refill();
+        }
+        // Another caller refilled while we waited; take from the new block
+    }
+}
+
+std::int64_t OrderNumberAllocator::refill() {
+    auto first = source_->reserveBlock(blockSize_);
+    if (first < 0 || first >= kMaxBlockStart) {
+        throw std::overflow_error("Order number block out of range: " + std::to_string(first));
+    }
+    // The caller takes the first number itself
+    state_.store((static_cast<std::uint64_t>(first) << kTakenBits) | 1, std::memory_order_relaxed);
+    return first;
+}
+
+} // namespace order::utils
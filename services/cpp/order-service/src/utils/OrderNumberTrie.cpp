@@ -0,0 +1,131 @@
+#include "order/utils/OrderNumberTrie.hpp"
+#include <mutex>
+
+namespace order::utils {
+
+std::uint32_t OrderNumberTrie::find(std::string_view key) const {
+    std::uint32_t node = 0;
+    for (char c : key) {
+        auto child = nodes_[node].firstChild;
+        while (child != kNone && nodes_[child].symbol < c) {
+            child = nodes_[child].nextSibling;
+        }
+        if (child == kNone || nodes_[child].symbol != c) {
+            return kNone;
+        }
+        node = child;
+    }
+    return node;
+}
+
+std::uint32_t OrderNumberTrie::findOrAdd(std::string_view key) {
+    std::uint32_t node = 0;
+    for (char c : key) {
+        // Keep siblings sorted so completions come out in order
+        auto previous = kNone;
+        auto child = nodes_[node].firstChild;
+        while (child != kNone && nodes_[child].symbol < c) {
+            previous = child;
+            child = nodes_[child].nextSibling;
+        }
+        if (child == kNone || nodes_[child].symbol != c) {
+            Node added;
+            added.symbol = c;
+            added.nextSibling = child;
+            child = static_cast<std::uint32_t>(nodes_.size());
+            nodes_.push_back(added);
+            if (previous == kNone) {
+                nodes_[node].firstChild = child;
+            } else {
+                nodes_[previous].nextSibling = child;
+            }
+        }
+        node = child;
+    }
+    return node;
+}
+
+void OrderNumberTrie::removeLocked(std::uint32_t node) {
+    // The path stays; numbers are rarely removed and a later insert may reuse it
+    auto order = nodes_[node].order;
+    nodeById_.erase(orderIds_[order]);
+    orderIds_[order].clear();
+    freeOrders_.push_back(order);
+    nodes_[node].order = kNone;
+}
+
+void OrderNumberTrie::insert(const std::string& orderId, const std::string& orderNumber) {
+    std::unique_lock lock(mutex_);
+
+    auto existing = nodeById_.find(orderId);
+    if (existing != nodeById_.end()) {
+        if (existing->second == find(orderNumber)) {
+            return;
+        }
+        removeLocked(existing->second);
+    }
+
+    auto node = findOrAdd(orderNumber);
+    if (nodes_[node].order != kNone) {
+        // Order numbers are unique; the number now belongs to this order
+        removeLocked(node);
+    }
+
+    std::uint32_t order;
+    if (!freeOrders_.empty()) {
+        order = freeOrders_.back();
+        freeOrders_.pop_back();
+        orderIds_[order] = orderId;
+    } else {
+        order = static_cast<std::uint32_t>(orderIds_.size());
+        orderIds_.push_back(orderId);
+    }
+    nodes_[node].order = order;
+    nodeById_[orderId] = node;
+}
+
+bool OrderNumberTrie::remove(const std::string& orderId) {
+    std::unique_lock lock(mutex_);
+    auto existing = nodeById_.find(orderId);
+    if (existing == nodeById_.end()) {
+        return false;
+    }
+    removeLocked(existing->second);
+    return true;
+}
+
+void OrderNumberTrie::collect(std::uint32_t node, std::string& path, std::size_t limit,
+                              std::vector<Match>& matches) const {
+    if (nodes_[node].order != kNone) {
+        matches.push_back({path, orderIds_[nodes_[node].order]});
+    }
+    for (auto child = nodes_[node].firstChild; child != kNone && matches.size() < limit;
+         child = nodes_[child].nextSibling) {
+        path.push_back(nodes_[child].symbol);
+        collect(child, path, limit, matches);
+        path.pop_back();
+    }
+}
+
+std::vector<OrderNumberTrie::Match> OrderNumberTrie::complete(std::string_view prefix, std::size_t limit) const {
+    std::vector<Match> matches;
+    if (limit == 0) {
+        return matches;
+    }
+
+    std::shared_lock lock(mutex_);
+    auto node = find(prefix);
+    if (node == kNone) {
+        return matches;
+    }
+    std::string path(prefix);
+    collect(node, path, limit, matches);
+    return matches;
+}
+
+std::size_t OrderNumberTrie::size() const {
+    std::shared_lock lock(mutex_);
+    return nodeById_.size();
+}
+
+} // namespace order::utils
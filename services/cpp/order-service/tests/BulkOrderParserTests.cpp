@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "order/utils/BulkOrderParser.hpp"
+#include <sstream>
+
+using namespace order;
+using order::utils::BulkOrderParser;
+
+namespace {
+
+const std::string kWarehouseId = "650e8400-e29b-41d4-a716-446655440001";
+const std::string kProductId = "750e8400-e29b-41d4-a716-446655440002";
+
+json validRequest(const std::string& orderNumber = "ORD-2024-001") {
+    return {
+        {"orderNumber", orderNumber},
+        {"customerId", "CUST-123"},
+        {"warehouseId", kWarehouseId},
+        {"priority", "high"},
+        {"lineItems", json::array({
+            {{"productId", kProductId}, {"productSku", "SKU-1"}, {"productName", "Widget"},
+             {"quantity", 2}, {"unitPrice", 10.5}},
+            {{"productId", kProductId}, {"productSku", "SKU-2"}, {"quantity", 1}, {"unitPrice", 4.0}}
+        })}
+    };
+}
+
+} // namespace
+
+TEST_CASE("BulkOrderParser builds a pending order from a valid request", "[bulk][parser]") {
+    auto order = BulkOrderParser::parseOrder(validRequest());
+
+    REQUIRE(order.getOrderNumber() == "ORD-2024-001");
+    REQUIRE(order.getWarehouseId() == kWarehouseId);
+    REQUIRE(order.getStatus() == models::OrderStatus::PENDING);
+    REQUIRE(order.getPriority() == models::OrderPriority::HIGH);
+    REQUIRE(order.getLineItems().size() == 2);
+    REQUIRE(order.getLineItems()[1].productName == "SKU-2");   // name defaults to the SKU
+    REQUIRE(order.getTotal() == models::Money(2500));
+    REQUIRE(order.getId().empty());
+}
+
+TEST_CASE("BulkOrderParser leaves a missing order number to be allocated", "[bulk][parser]") {
+    auto request = validRequest();
+    request.erase("orderNumber");
+
+    auto order = BulkOrderParser::parseOrder(request);
+    REQUIRE(order.getOrderNumber().empty());
+
+    request["orderNumber"] = "";
+    REQUIRE_THROWS_AS(BulkOrderParser::parseOrder(request), std::invalid_argument);
+}
+
+TEST_CASE("BulkOrderParser rejects requests that break CreateOrderRequest", "[bulk][parser]") {
+    auto request = validRequest();
+
+    SECTION("lower-case order number") {
+        request["orderNumber"] = "ord-1";
+    }
+    SECTION("over-long order number") {
+        request["orderNumber"] = std::string(51, 'A');
+    }
+    SECTION("missing customer") {
+        request.erase("customerId");
+    }
+    SECTION("warehouse id is not a UUID") {
+        request["warehouseId"] = "WH-1";
+    }
+    SECTION("no line items") {
+        request["lineItems"] = json::array();
+    }
+    SECTION("zero quantity") {
+        request["lineItems"][0]["quantity"] = 0;
+    }
+    SECTION("negative price") {
+        request["lineItems"][1]["unitPrice"] = -1;
+    }
+    SECTION("unknown priority") {
+        request["priority"] = "asap";
+    }
+    SECTION("lower-case currency") {
+        request["currency"] = "usd";
+    }
+
+    REQUIRE_THROWS_AS(BulkOrderParser::parseOrder(request), std::invalid_argument);
+}
+
+TEST_CASE("BulkOrderParser reads NDJSON in chunks with line numbers", "[bulk][parser]") {
+    std::stringstream input;
+    input << validRequest("A-1").dump() << "\r\n"
+          << "\n"
+          << "{not json\n"
+          << validRequest("a-2").dump() << "\n"
+          << validRequest("A-3").dump();
+
+    std::size_t lineNumber = 0;
+    auto first = BulkOrderParser::readChunk(input, 2, lineNumber);
+    auto second = BulkOrderParser::readChunk(input, 2, lineNumber);
+    auto third = BulkOrderParser::readChunk(input, 2, lineNumber);
+
+    REQUIRE(first.size() == 2);
+    REQUIRE(first[0].line == 1);
+    REQUIRE(first[1].line == 3);   // blank line 2 skipped
+    REQUIRE(second.size() == 2);
+    REQUIRE(second[1].line == 5);
+    REQUIRE(third.empty());
+
+    BulkOrderParser parser(1);
+    auto parsed = parser.parse(first);
+    REQUIRE(parsed[0].order);
+    REQUIRE_FALSE(parsed[1].order);
+    REQUIRE(parsed[1].error == "Invalid JSON");
+
+    parsed = parser.parse(second);
+    REQUIRE_FALSE(parsed[0].order);
+    REQUIRE(parsed[0].orderNumber == "a-2");   // reported even though it is invalid
+    REQUIRE(parsed[1].order->getOrderNumber() == "A-3");
+}
+
+TEST_CASE("BulkOrderParser keeps input order when parsing in parallel", "[bulk][parser]") {
+    std::vector<utils::BulkOrderLine> lines;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        auto text = i % 7 == 0 ? std::string("[]") : validRequest("ORD-" + std::to_string(i)).dump();
+        lines.push_back({i + 1, text});
+    }
+
+    auto parsed = BulkOrderParser(4).parse(lines);
+
+    REQUIRE(parsed.size() == lines.size());
+    for (std::size_t i = 0; i < parsed.size(); ++i) {
+        REQUIRE(parsed[i].line == i + 1);
+        if (i % 7 == 0) {
+            REQUIRE_FALSE(parsed[i].order);
+        } else {
+            REQUIRE(parsed[i].order->getOrderNumber() == "ORD-" + std::to_string(i));
+        }
+    }
+}
+
+TEST_CASE("BulkOrderParser throughput", "[bulk][parser][!benchmark]") {
+    constexpr std::size_t kOrders = 10000;
+    std::string body;
+    for (std::size_t i = 0; i < kOrders; ++i) {
+        body += validRequest("ORD-" + std::to_string(i)).dump();
+        body += '\n';
+    }
+
+    // Divide kOrders by the reported mean for orders per second
+    BENCHMARK("read, parse and validate 10k orders") {
+        std::istringstream input(body);
+        BulkOrderParser parser;
+        std::size_t lineNumber = 0;
+        std::size_t accepted = 0;
+        for (auto chunk = BulkOrderParser::readChunk(input, 1000, lineNumber); !chunk.empty();
+             chunk = BulkOrderParser::readChunk(input, 1000, lineNumber)) {
+            for (const auto& result : parser.parse(chunk)) {
+                accepted += result.order ? 1 : 0;
+            }
+        }
+        return accepted;
+    };
+}
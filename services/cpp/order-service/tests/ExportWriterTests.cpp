@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "order/utils/ExportWriter.hpp"
+#include <sstream>
+#include <stdexcept>
+
+using order::utils::ExportColumn;
+using order::utils::ExportFormat;
+using order::utils::ExportWriter;
+
+namespace {
+
+const std::vector<ExportColumn> kColumns = {
+    {"orderNumber", "o.order_number"},
+    {"productName", "l.product_name"},
+    {"quantity", "l.quantity::text", true},
+};
+
+} // namespace
+
+TEST_CASE("ExportWriter writes RFC 4180 CSV", "[export]") {
+    std::ostringstream out;
+    ExportWriter writer(out, ExportFormat::Csv, kColumns);
+    writer.begin();
+    writer.row({std::string("ORD-00000001"), std::string("Widget"), std::string("3")});
+    writer.row({std::string("ORD-00000002"), std::string("Bolt, \"M6\"\nzinc"), std::nullopt});
+
+    REQUIRE(out.str() ==
+            "orderNumber,productName,quantity\r\n"
+            "ORD-00000001,Widget,3\r\n"
+            "ORD-00000002,\"Bolt, \"\"M6\"\"\nzinc\",\r\n");
+    REQUIRE(writer.rows() == 2);
+}
+
+TEST_CASE("ExportWriter writes one JSON object per line", "[export]") {
+    std::ostringstream out;
+    ExportWriter writer(out, ExportFormat::Ndjson, kColumns);
+    writer.begin();
+    writer.row({std::string("ORD-00000001"), std::string("Bolt \"M6\""), std::string("12")});
+    writer.row({std::string("ORD-00000002"), std::nullopt, std::nullopt});
+
+    REQUIRE(out.str() ==
+            "{\"orderNumber\":\"ORD-00000001\",\"productName\":\"Bolt \\\"M6\\\"\",\"quantity\":12}\n"
+            "{\"orderNumber\":\"ORD-00000002\",\"productName\":null,\"quantity\":null}\n");
+}
+
+TEST_CASE("ExportWriter rejects rows that do not match the columns", "[export]") {
+    std::ostringstream out;
+    ExportWriter writer(out, ExportFormat::Csv, kColumns);
+    REQUIRE_THROWS_AS(writer.row({std::string("ORD-00000001")}), std::invalid_argument);
+    REQUIRE_THROWS_AS(ExportWriter(out, ExportFormat::Csv, {}), std::invalid_argument);
+}
+
+TEST_CASE("ExportWriter projects columns from the catalogue", "[export]") {
+    SECTION("in the order asked for") {
+        auto columns = ExportWriter::project(kColumns, {"quantity", "orderNumber"});
+        REQUIRE(columns.size() == 2);
+        REQUIRE(columns[0].name == "quantity");
+        REQUIRE(columns[0].numeric);
+        REQUIRE(columns[1].expression == "o.order_number");
+    }
+
+    SECTION("every column when none are named") {
+        REQUIRE(ExportWriter::project(kColumns, {}).size() == kColumns.size());
+    }
+
+    SECTION("never an expression from the request") {
+        REQUIRE_THROWS_AS(ExportWriter::project(kColumns, {"o.notes"}), std::invalid_argument);
+        REQUIRE_THROWS_AS(ExportWriter::project(kColumns, {"quantity", "quantity"}), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Export formats parse from the query string", "[export]") {
+    REQUIRE(order::utils::exportFormatFromString("csv") == ExportFormat::Csv);
+    REQUIRE(order::utils::exportFormatFromString("ndjson") == ExportFormat::Ndjson);
+    REQUIRE_THROWS_AS(order::utils::exportFormatFromString("xlsx"), std::invalid_argument);
+    REQUIRE(ExportWriter::contentType(ExportFormat::Ndjson) == "application/x-ndjson");
+    REQUIRE(ExportWriter::fileExtension(ExportFormat::Csv) == "csv");
+}
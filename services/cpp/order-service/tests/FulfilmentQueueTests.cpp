@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "order/utils/FulfilmentQueue.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace order;
+using order::utils::FulfilmentQueue;
+
+namespace {
+
+FulfilmentQueue::Entry entry(const std::string& id, models::OrderPriority priority,
+                             std::int64_t shipBy = FulfilmentQueue::kNoShipBy,
+                             std::int64_t orderDate = 0,
+                             const std::string& warehouseId = "wh-1") {
+    return {id, warehouseId, priority, shipBy, orderDate};
+}
+
+std::vector<std::string> ids(const std::vector<FulfilmentQueue::Entry>& entries) {
+    std::vector<std::string> result;
+    for (const auto& e : entries) {
+        result.push_back(e.orderId);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("FulfilmentQueue orders by priority, ship-by date, then order date", "[queue]") {
+    FulfilmentQueue queue;
+    queue.upsert(entry("normal-late", models::OrderPriority::NORMAL, 300));
+    queue.upsert(entry("urgent", models::OrderPriority::URGENT));
+    queue.upsert(entry("normal-no-ship-by", models::OrderPriority::NORMAL));
+    queue.upsert(entry("normal-early", models::OrderPriority::NORMAL, 100, 50));
+    queue.upsert(entry("normal-early-older", models::OrderPriority::NORMAL, 100, 10));
+    queue.upsert(entry("low", models::OrderPriority::LOW, 1));
+
+    REQUIRE(ids(queue.next("wh-1", 10)) == std::vector<std::string>{
+        "urgent", "normal-early-older", "normal-early", "normal-late", "normal-no-ship-by", "low"});
+    REQUIRE(ids(queue.next("wh-1", 2)) == std::vector<std::string>{"urgent", "normal-early-older"});
+    REQUIRE(queue.next("wh-2", 5).empty());
+}
+
+TEST_CASE("FulfilmentQueue re-keys and moves orders in place", "[queue]") {
+    FulfilmentQueue queue;
+    queue.upsert(entry("a", models::OrderPriority::NORMAL, 100));
+    queue.upsert(entry("b", models::OrderPriority::NORMAL, 200));
+    queue.upsert(entry("c", models::OrderPriority::NORMAL, 300));
+
+    queue.upsert(entry("c", models::OrderPriority::URGENT, 300));
+    REQUIRE(ids(queue.next("wh-1", 1)) == std::vector<std::string>{"c"});
+
+    queue.upsert(entry("c", models::OrderPriority::LOW, 300));
+    REQUIRE(ids(queue.next("wh-1", 3)) == std::vector<std::string>{"a", "b", "c"});
+
+    queue.upsert(entry("a", models::OrderPriority::NORMAL, 100, 0, "wh-2"));
+    REQUIRE(queue.size("wh-1") == 2);
+    REQUIRE(ids(queue.next("wh-2", 5)) == std::vector<std::string>{"a"});
+    REQUIRE(queue.size() == 3);
+}
+
+TEST_CASE("FulfilmentQueue follows order status", "[queue]") {
+    FulfilmentQueue queue;
+    models::Order order("o-1", "ORD-1", "CUST-1", "wh-1", models::OrderStatus::PENDING, "2026-02-01T10:00:00Z");
+    order.setShipByDate("2026-02-03");
+
+    queue.sync(order);
+    auto queued = queue.next("wh-1", 1);
+    REQUIRE(queued.size() == 1);
+    REQUIRE(queued[0].shipBy == FulfilmentQueue::toEpochSeconds("2026-02-03T00:00:00Z"));
+    REQUIRE(queued[0].orderDate - queued[0].shipBy == -38 * 3600);
+
+    order.setStatus(models::OrderStatus::CONFIRMED);
+    queue.sync(order);
+    REQUIRE(queue.size() == 1);
+
+    order.cancel("customer request");
+    queue.sync(order);
+    REQUIRE(queue.size() == 0);
+    REQUIRE(queue.next("wh-1", 1).empty());
+    REQUIRE_FALSE(queue.remove("o-1"));
+}
+
+TEST_CASE("FulfilmentQueue matches a full sort under random updates", "[queue]") {
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> priority(0, 3);
+    std::uniform_int_distribution<std::int64_t> time(0, 1000);
+    std::uniform_int_distribution<int> id(0, 499);
+    FulfilmentQueue queue;
+    std::unordered_map<std::string, FulfilmentQueue::Entry> reference;
+
+    for (int step = 0; step < 5000; ++step) {
+        auto orderId = "o-" + std::to_string(id(rng));
+        if (step % 5 == 4) {
+            REQUIRE(queue.remove(orderId) == (reference.erase(orderId) == 1));
+            continue;
+        }
+        auto e = entry(orderId, static_cast<models::OrderPriority>(priority(rng)), time(rng), time(rng));
+        queue.upsert(e);
+        reference[orderId] = e;
+    }
+
+    std::vector<FulfilmentQueue::Entry> expected;
+    for (const auto& [orderId, e] : reference) {
+        expected.push_back(e);
+    }
+    std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return std::tie(b.priority, a.shipBy, a.orderDate, a.orderId) <
+               std::tie(a.priority, b.shipBy, b.orderDate, b.orderId);
+    });
+
+    REQUIRE(queue.size("wh-1") == expected.size());
+    REQUIRE(ids(queue.next("wh-1", expected.size())) == ids(expected));
+}
+
+TEST_CASE("FulfilmentQueue throughput", "[queue][!benchmark]") {
+    constexpr int kOrders = 100000;
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> priority(0, 3);
+    std::uniform_int_distribution<std::int64_t> time(0, 1000000);
+    FulfilmentQueue queue;
+    for (int i = 0; i < kOrders; ++i) {
+        queue.upsert(entry("o-" + std::to_string(i), static_cast<models::OrderPriority>(priority(rng)), time(rng), time(rng)));
+    }
+
+    BENCHMARK("next 50 of 100k") {
+        return queue.next("wh-1", 50).size();
+    };
+
+    int counter = 0;
+    BENCHMARK("re-key one of 100k") {
+        auto i = counter++ % kOrders;
+        queue.upsert(entry("o-" + std::to_string(i), static_cast<models::OrderPriority>(i % 4), time(rng), i));
+    };
+}
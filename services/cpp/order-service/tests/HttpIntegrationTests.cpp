@@ -212,11 +212,12 @@ TEST_CASE("List orders returns empty array initially", "[http][integration][orde
     auto response = doJsonRequest(cfg, "GET", "/api/v1/orders", nullptr,
                                   Poco::Net::HTTPResponse::HTTP_OK);
 
-    REQUIRE(response.contains("orders"));
-    REQUIRE(response["orders"].is_array());
-    REQUIRE(response.contains("total"));
+    REQUIRE(response.contains("items"));
+    REQUIRE(response["items"].is_array());
+    REQUIRE(response.contains("totalCount"));
     REQUIRE(response.contains("page"));
     REQUIRE(response.contains("pageSize"));
+    REQUIRE(response.contains("totalPages"));
 }
 
 TEST_CASE("Authentication is required for order endpoints", "[http][integration][auth]") {
@@ -252,7 +253,7 @@ TEST_CASE("Authentication is required for order endpoints", "[http][integration]
              response.getStatus() == HTTPResponse::HTTP_FORBIDDEN));
 }
 
-TEST_CASE("Get non-existent order returns 501", "[http][integration][orders][notfound]") {
+TEST_CASE("Get non-existent order returns 404", "[http][integration][orders][notfound]") {
     auto cfg = getHttpConfig();
     if (!cfg.enabled) {
         WARN("ORDER_HTTP_INTEGRATION not set; skipping HTTP integration tests");
@@ -262,25 +263,27 @@ TEST_CASE("Get non-existent order returns 501", "[http][integration][orders][not
     const auto randomId = generateRandomUuid();
     const auto path = "/api/v1/orders/" + randomId;
 
-    // Since service is not fully implemented, expecting 501 Not Implemented
-    // When implemented, this should return 404
     auto response = doJsonRequest(cfg, "GET", path, nullptr,
-                                  Poco::Net::HTTPResponse::HTTP_NOT_IMPLEMENTED);
+                                  Poco::Net::HTTPResponse::HTTP_NOT_FOUND);
 
     REQUIRE(response.contains("error"));
 }
 
-TEST_CASE("Create order returns 501", "[http][integration][orders][create]") {
+TEST_CASE("Create order returns 201", "[http][integration][orders][create]") {
     auto cfg = getHttpConfig();
     if (!cfg.enabled) {
         WARN("ORDER_HTTP_INTEGRATION not set; skipping HTTP integration tests");
         return;
     }
 
+    // No orderNumber: one is allocated, so reruns never clash
     json createRequest = {
-        {"orderNumber", "ORD-TEST-001"},
+        {"id", ""},
         {"customerId", "CUST-123"},
         {"warehouseId", generateRandomUuid()},
+        {"status", "pending"},
+        {"orderDate", ""},
+        {"total", "0.00"},
         {"priority", "normal"},
         {"lineItems", json::array()},
         {"shippingAddress", {
@@ -293,9 +296,33 @@ TEST_CASE("Create order returns 501", "[http][integration][orders][create]") {
         }}
     };
 
-    // Since service is not fully implemented, expecting 501 Not Implemented
     auto response = doJsonRequest(cfg, "POST", "/api/v1/orders", &createRequest,
-                                  Poco::Net::HTTPResponse::HTTP_NOT_IMPLEMENTED);
+                                  Poco::Net::HTTPResponse::HTTP_CREATED);
+
+    REQUIRE(response.contains("id"));
+    REQUIRE(response.contains("orderNumber"));
+    REQUIRE_FALSE(response["orderNumber"].get<std::string>().empty());
+}
+
+TEST_CASE("Sourcing a non-existent order returns 404", "[http][integration][orders][sourcing]") {
+    auto cfg = getHttpConfig();
+    if (!cfg.enabled) {
+        WARN("ORDER_HTTP_INTEGRATION not set; skipping HTTP integration tests");
+        return;
+    }
+
+    // A well-formed plan request, so only the order lookup can fail
+    json sourcingRequest = {
+        {"stock", json::array({
+            {{"warehouseId", generateRandomUuid()},
+             {"productId", generateRandomUuid()},
+             {"available", 10}}
+        })}
+    };
+    const auto path = "/api/v1/orders/" + generateRandomUuid() + "/sourcing";
+
+    auto response = doJsonRequest(cfg, "POST", path, &sourcingRequest,
+                                  Poco::Net::HTTPResponse::HTTP_NOT_FOUND);
 
     REQUIRE(response.contains("error"));
 }
@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "order/models/Order.hpp"
+#include <limits>
+
+using namespace order;
+using order::models::Money;
+
+namespace {
+
+models::Order b2bOrder(std::size_t lines) {
+    models::Order order("o-1", "ORD-B2B", "CUST-1", "wh-1", models::OrderStatus::PENDING, "");
+    std::vector<models::OrderLineItem> items;
+    for (std::size_t i = 0; i < lines; ++i) {
+        items.emplace_back("", "p", "SKU-" + std::to_string(i), "Item", 3, Money::parse("0.10"));
+    }
+    order.setLineItems(items);
+    return order;
+}
+
+} // namespace
+
+TEST_CASE("Money parses and formats decimals exactly", "[money]") {
+    REQUIRE(Money::parse("12.34").minorUnits() == 1234);
+    REQUIRE(Money::parse("12.3").minorUnits() == 1230);
+    REQUIRE(Money::parse("12").minorUnits() == 1200);
+    REQUIRE(Money::parse(".5").minorUnits() == 50);
+    REQUIRE(Money::parse("-0.07").minorUnits() == -7);
+    REQUIRE(Money::parse("+1.00", "EUR") == Money(100, "EUR"));
+
+    REQUIRE(Money(1234).toString() == "12.34");
+    REQUIRE(Money(-7).toString() == "-0.07");
+    REQUIRE(Money(0).toString() == "0.00");
+    REQUIRE(Money(std::numeric_limits<std::int64_t>::min()).toString() == "-92233720368547758.08");
+    REQUIRE(Money(std::numeric_limits<std::int64_t>::max()).toString() == "92233720368547758.07");
+
+    for (auto bad : {"", "-", "1.", "1.234", "1,00", "1.-5", "--1", "1e3", "abc", "99999999999999999999"}) {
+        REQUIRE_THROWS_AS(Money::parse(bad), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Money reads JSON numbers and strings", "[money]") {
+    REQUIRE(Money::fromJson(json(10.1)).minorUnits() == 1010);
+    REQUIRE(Money::fromJson(json(0.29)).minorUnits() == 29);
+    REQUIRE(Money::fromJson(json(7)).minorUnits() == 700);
+    REQUIRE(Money::fromJson(json("1234567890.12")).minorUnits() == 123456789012);
+    REQUIRE(Money(1010).toDouble() == 10.1);
+    REQUIRE_THROWS_AS(Money::fromJson(json(true)), std::invalid_argument);
+    REQUIRE_THROWS_AS(Money::fromDouble(1e300), std::invalid_argument);
+}
+
+TEST_CASE("Money arithmetic is exact and checked", "[money]") {
+    REQUIRE(Money::parse("0.10") + Money::parse("0.20") == Money::parse("0.30"));
+    REQUIRE(Money::parse("19.99") * 3 == Money::parse("59.97"));
+    REQUIRE(Money(100) - Money(250) == Money(-150));
+
+    REQUIRE_THROWS_AS(Money(100, "USD") + Money(100, "EUR"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Money(std::numeric_limits<std::int64_t>::max()) + Money(1), std::invalid_argument);
+    REQUIRE_THROWS_AS(Money(std::numeric_limits<std::int64_t>::max() / 2) * 3, std::invalid_argument);
+    REQUIRE_THROWS_AS(Money(1, "usd"), std::invalid_argument);
+}
+
+TEST_CASE("Order totals are exact for large orders", "[money][order]") {
+    auto order = b2bOrder(500);
+    order.calculateTotal();
+
+    // 1500 x 0.10 drifts in binary floating point
+    REQUIRE(order.getTotal() == Money::parse("150.00"));
+    REQUIRE(order.toJson()["total"] == 150.0);
+    REQUIRE(order.toJson()["currency"] == "USD");
+
+    auto roundTrip = models::Order::fromJson(order.toJson());
+    REQUIRE(roundTrip.getTotal() == order.getTotal());
+    REQUIRE(roundTrip.getLineItems()[499].lineTotal == Money::parse("0.30"));
+}
+
+TEST_CASE("Money throughput", "[money][!benchmark]") {
+    auto order = b2bOrder(500);
+    Money amount = Money::parse("123456.78");
+
+    BENCHMARK("total of a 500-line order") {
+        order.calculateTotal();
+        return order.getTotal().minorUnits();
+    };
+
+    BENCHMARK("format an amount") {
+        char buffer[Money::kMaxFormattedLength];
+        return amount.format(buffer, buffer + sizeof(buffer)) - buffer;
+    };
+
+    BENCHMARK("parse an amount") {
+        return Money::parse("123456.78").minorUnits();
+    };
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "order/utils/OrderNumberAllocator.hpp"
+#include <set>
+#include <thread>
+
+using order::utils::OrderNumberAllocator;
+using order::utils::OrderNumberBlockSource;
+
+namespace {
+
+// The order_number_blocks row, in memory
+class CountingBlockSource : public OrderNumberBlockSource {
+public:
+    explicit CountingBlockSource(std::int64_t next = 1) : next_(next) {}
+
+    std::int64_t reserveBlock(std::size_t size) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++reservations;
+        auto first = next_;
+        next_ += static_cast<std::int64_t>(size);
+        return first;
+    }
+
+    int reservations = 0;
+
+private:
+    std::mutex mutex_;
+    std::int64_t next_;
+};
+
+} // namespace
+
+TEST_CASE("OrderNumberAllocator numbers from reserved blocks", "[order-number][allocator]") {
+    auto source = std::make_shared<CountingBlockSource>();
+    OrderNumberAllocator allocator(source, 3);
+
+    REQUIRE(allocator.next("wh-1") == "ORD-00000001");
+    REQUIRE(allocator.next("wh-1") == "ORD-00000002");
+    REQUIRE(allocator.next("wh-1") == "ORD-00000003");
+    REQUIRE(source->reservations == 1);
+    REQUIRE(allocator.next("wh-1") == "ORD-00000004");
+    REQUIRE(source->reservations == 2);
+
+    SECTION("in batches") {
+        auto numbers = allocator.next("wh-1", 5);
+        REQUIRE(numbers.size() == 5);
+        REQUIRE(numbers.front() == "ORD-00000005");
+        REQUIRE(numbers.back() == "ORD-00000009");
+        REQUIRE(source->reservations == 3);
+    }
+}
+
+TEST_CASE("OrderNumberAllocator never repeats a number across replicas", "[order-number][allocator]") {
+    // Two replicas sharing one database row, with different block sizes
+    auto source = std::make_shared<CountingBlockSource>(1000);
+    OrderNumberAllocator first(source, 10);
+    OrderNumberAllocator second(source, 7);
+
+    std::set<std::string> seen;
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(seen.insert(first.next("wh-1")).second);
+        REQUIRE(seen.insert(second.next("wh-1")).second);
+    }
+}
+
+TEST_CASE("OrderNumberAllocator prefixes numbers by warehouse", "[order-number][allocator]") {
+    auto source = std::make_shared<CountingBlockSource>(123456789);
+    OrderNumberAllocator allocator(source, 10, {{"wh-london", "LDN"}}, "WMS");
+
+    REQUIRE(allocator.next("wh-london") == "LDN-123456789");
+    REQUIRE(allocator.next("wh-other") == "WMS-123456790");
+    REQUIRE(allocator.prefixFor("wh-london") == "LDN");
+
+    SECTION("and rejects prefixes that would make invalid order numbers") {
+        REQUIRE_THROWS_AS(OrderNumberAllocator(source, 10, {{"wh-1", "ldn"}}), std::invalid_argument);
+        REQUIRE_THROWS_AS(OrderNumberAllocator(source, 10, {}, ""), std::invalid_argument);
+        REQUIRE_THROWS_AS(OrderNumberAllocator(source, 0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("OrderNumberAllocator recognises the numbers it reserves", "[order-number][allocator]") {
+    auto source = std::make_shared<CountingBlockSource>(42);
+    OrderNumberAllocator allocator(source, 10, {{"wh-london", "LDN-A"}}, "WMS");
+
+    REQUIRE(allocator.isGenerated(allocator.next("wh-london")));
+    REQUIRE(allocator.isGenerated(allocator.next("wh-other")));
+    REQUIRE(allocator.isGenerated("WMS-123456789012"));
+
+    REQUIRE_FALSE(allocator.isGenerated("WMS-0000042"));     // shorter than the padded width
+    REQUIRE_FALSE(allocator.isGenerated("WMS-0000004X"));
+    REQUIRE_FALSE(allocator.isGenerated("LDN-00000042"));    // not a configured prefix
+    REQUIRE_FALSE(allocator.isGenerated("ORD-00000042"));
+    REQUIRE_FALSE(allocator.isGenerated("00000042"));
+    REQUIRE_FALSE(allocator.isGenerated("CUSTOMER-PO-17"));
+}
+
+TEST_CASE("OrderNumberAllocator hands out unique numbers under contention", "[order-number][allocator]") {
+    auto source = std::make_shared<CountingBlockSource>();
+    OrderNumberAllocator allocator(source, 64);
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 5000;
+
+    std::vector<std::vector<std::string>> taken(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&allocator, &taken, t]() {
+            for (int i = 0; i < kPerThread; ++i) {
+                taken[t].push_back(allocator.next("wh-1"));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<std::string> unique;
+    for (const auto& numbers : taken) {
+        unique.insert(numbers.begin(), numbers.end());
+    }
+    REQUIRE(unique.size() == kThreads * kPerThread);
+    // Every block is used up before the next is reserved
+    REQUIRE(source->reservations == (kThreads * kPerThread + 63) / 64);
+}
+
+TEST_CASE("OrderNumberAllocator throughput", "[order-number][allocator][!benchmark]") {
+    OrderNumberAllocator allocator(std::make_shared<CountingBlockSource>(), 1000);
+
+    BENCHMARK("next order number") {
+        return allocator.next("wh-1");
+    };
+    BENCHMARK("1000 numbers for a bulk chunk") {
+        return allocator.next("wh-1", 1000);
+    };
+}
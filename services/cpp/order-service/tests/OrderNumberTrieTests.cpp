@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "order/utils/OrderNumberTrie.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <set>
+
+using order::utils::OrderNumberTrie;
+
+namespace {
+
+std::vector<std::string> numbers(const std::vector<OrderNumberTrie::Match>& matches) {
+    std::vector<std::string> result;
+    for (const auto& match : matches) {
+        result.push_back(match.orderNumber);
+    }
+    return result;
+}
+
+std::string orderNumber(int year, int sequence) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "ORD-%d-%06d", year, sequence);
+    return buffer;
+}
+
+} // namespace
+
+TEST_CASE("OrderNumberTrie completes prefixes in lexicographic order", "[trie]") {
+    OrderNumberTrie trie;
+    trie.insert("id-3", "ORD-2026-0003");
+    trie.insert("id-1", "ORD-2026-0001");
+    trie.insert("id-10", "ORD-2026-0010");
+    trie.insert("id-b", "B2B-77");
+    trie.insert("id-short", "ORD-2026");
+
+    REQUIRE(numbers(trie.complete("ORD-2026", 10)) == std::vector<std::string>{
+        "ORD-2026", "ORD-2026-0001", "ORD-2026-0003", "ORD-2026-0010"});
+    REQUIRE(numbers(trie.complete("ORD-2026-00", 2)) == std::vector<std::string>{
+        "ORD-2026-0001", "ORD-2026-0003"});
+    REQUIRE(trie.complete("ORD-2026-0010", 5)[0].orderId == "id-10");
+    REQUIRE(numbers(trie.complete("", 1)) == std::vector<std::string>{"B2B-77"});
+    REQUIRE(trie.complete("ORD-2027", 5).empty());
+    REQUIRE(trie.complete("ORD", 0).empty());
+    REQUIRE(trie.size() == 5);
+}
+
+TEST_CASE("OrderNumberTrie follows renumbering and removal", "[trie]") {
+    OrderNumberTrie trie;
+    trie.insert("id-1", "ORD-1");
+    trie.insert("id-2", "ORD-2");
+
+    trie.insert("id-1", "ORD-9");
+    REQUIRE(numbers(trie.complete("ORD-", 5)) == std::vector<std::string>{"ORD-2", "ORD-9"});
+    REQUIRE(trie.size() == 2);
+
+    // A number taken over by another order moves with it
+    trie.insert("id-3", "ORD-2");
+    REQUIRE(trie.complete("ORD-2", 5).size() == 1);
+    REQUIRE(trie.complete("ORD-2", 5)[0].orderId == "id-3");
+    REQUIRE_FALSE(trie.remove("id-2"));
+
+    REQUIRE(trie.remove("id-1"));
+    REQUIRE(numbers(trie.complete("ORD-", 5)) == std::vector<std::string>{"ORD-2"});
+    trie.insert("id-4", "ORD-9");
+    REQUIRE(trie.complete("ORD-9", 5)[0].orderId == "id-4");
+    REQUIRE(trie.size() == 2);
+}
+
+TEST_CASE("OrderNumberTrie matches a sorted set", "[trie]") {
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> year(2024, 2026);
+    std::uniform_int_distribution<int> sequence(0, 3000);
+    OrderNumberTrie trie;
+    std::set<std::string> reference;
+    for (int i = 0; i < 5000; ++i) {
+        auto number = orderNumber(year(rng), sequence(rng));
+        trie.insert(number, number);
+        reference.insert(number);
+    }
+
+    for (std::string prefix : {"ORD-2025-00", "ORD-2024-0029", "ORD-2026-", "ORD-"}) {
+        std::vector<std::string> expected;
+        for (auto it = reference.lower_bound(prefix);
+             it != reference.end() && it->compare(0, prefix.size(), prefix) == 0 && expected.size() < 25; ++it) {
+            expected.push_back(*it);
+        }
+        REQUIRE(numbers(trie.complete(prefix, 25)) == expected);
+    }
+}
+
+TEST_CASE("OrderNumberTrie throughput", "[trie][!benchmark]") {
+    OrderNumberTrie trie;
+    for (int i = 0; i < 500000; ++i) {
+        auto number = orderNumber(2024 + i % 3, i);
+        trie.insert("id-" + std::to_string(i), number);
+    }
+
+    BENCHMARK("complete 10 of 500k") {
+        return trie.complete("ORD-2025-0123", 10).size();
+    };
+
+    BENCHMARK("complete 10 of 500k, short prefix") {
+        return trie.complete("ORD-2", 10).size();
+    };
+}
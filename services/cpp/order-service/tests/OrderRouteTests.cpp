@@ -0,0 +1,55 @@
+#include <catch2/catch_test_macros.hpp>
+#include "order/controllers/OrderRoute.hpp"
+
+using order::controllers::OrderRoute;
+using Endpoint = OrderRoute::Endpoint;
+
+namespace {
+
+const std::string kId = "3f2c9a1e-5b7d-4c8e-9f00-112233445566";
+
+} // namespace
+
+TEST_CASE("OrderRoute takes the id straight after /api/v1/orders/", "[routes]") {
+    auto order = OrderRoute::match("/api/v1/orders/" + kId);
+    REQUIRE(order.endpoint == Endpoint::Order);
+    REQUIRE(order.id == kId);
+
+    auto cancel = OrderRoute::match("/api/v1/orders/" + kId + "/cancel");
+    REQUIRE(cancel.endpoint == Endpoint::Cancel);
+    REQUIRE(cancel.id == kId);
+
+    auto sourcing = OrderRoute::match("/api/v1/orders/" + kId + "/sourcing");
+    REQUIRE(sourcing.endpoint == Endpoint::Sourcing);
+    REQUIRE(sourcing.id == kId);
+}
+
+TEST_CASE("OrderRoute matches the fixed order endpoints", "[routes]") {
+    REQUIRE(OrderRoute::match("/api/v1/orders").endpoint == Endpoint::Collection);
+    REQUIRE(OrderRoute::match("/api/v1/orders/").endpoint == Endpoint::Collection);
+    REQUIRE(OrderRoute::match("/api/v1/orders/next").endpoint == Endpoint::Next);
+    REQUIRE(OrderRoute::match("/api/v1/orders/search").endpoint == Endpoint::Search);
+    REQUIRE(OrderRoute::match("/api/v1/orders/suggest").endpoint == Endpoint::Suggest);
+    REQUIRE(OrderRoute::match("/api/v1/orders/export").endpoint == Endpoint::Export);
+    REQUIRE(OrderRoute::match("/api/v1/orders/bulk").endpoint == Endpoint::Bulk);
+    REQUIRE(OrderRoute::match("/api/v1/orders").id.empty());
+}
+
+TEST_CASE("OrderRoute rejects paths it does not serve", "[routes]") {
+    REQUIRE(OrderRoute::match("/api/v1/ordersx").endpoint == Endpoint::NotFound);
+    REQUIRE(OrderRoute::match("/api/v1/orders//cancel").endpoint == Endpoint::NotFound);
+    REQUIRE(OrderRoute::match("/api/v1/orders/" + kId + "/ship").endpoint == Endpoint::NotFound);
+    REQUIRE(OrderRoute::match("/api/v1/orders/" + kId + "/cancel/extra").endpoint == Endpoint::NotFound);
+    REQUIRE(OrderRoute::match("/api/v1/warehouses").endpoint == Endpoint::NotFound);
+}
+
+TEST_CASE("OrderRoute gives the sourcing planner the order id, not the action", "[routes][sourcing]") {
+    auto route = OrderRoute::match("/api/v1/orders/" + kId + "/sourcing");
+    REQUIRE(route.endpoint == Endpoint::Sourcing);
+    REQUIRE(route.id != "sourcing");
+    REQUIRE(route.id == kId);
+
+    REQUIRE(OrderRoute::match("/api/v1/orders/sourcing").endpoint == Endpoint::Order);
+    REQUIRE(OrderRoute::match("/api/v1/orders//sourcing").endpoint == Endpoint::NotFound);
+    REQUIRE(OrderRoute::match("/api/v1/orders/" + kId + "/sourcing/plan").endpoint == Endpoint::NotFound);
+}
@@ -0,0 +1,197 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "order/services/SourcingPlanner.hpp"
+#include <chrono>
+#include <map>
+#include <random>
+
+using namespace order;
+using order::services::SourcingPlanner;
+
+namespace {
+
+std::vector<models::SourcingLine> singleUnits(const std::vector<std::string>& products) {
+    std::vector<models::SourcingLine> lines;
+    for (const auto& product : products) {
+        lines.push_back({"line-" + product, product, 1});
+    }
+    return lines;
+}
+
+// Units shipped per (warehouse, product)
+std::map<std::pair<std::string, std::string>, int> shipped(const models::SourcingPlan& plan,
+                                                           const std::vector<models::SourcingLine>& lines) {
+    std::map<std::pair<std::string, std::string>, int> units;
+    for (const auto& shipment : plan.shipments) {
+        for (const auto& line : shipment.lines) {
+            units[{shipment.warehouseId, lines[line.line].productId}] += line.quantity;
+        }
+    }
+    return units;
+}
+
+struct Catalogue {
+    std::vector<models::SourcingLine> lines;
+    std::vector<models::WarehouseStock> stock;
+};
+
+Catalogue randomCatalogue(std::size_t lineCount, std::size_t warehouses, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> quantity(1, 20);
+    std::uniform_int_distribution<int> available(0, 60);
+    std::bernoulli_distribution stocked(0.6);
+    Catalogue catalogue;
+    for (std::size_t i = 0; i < lineCount; ++i) {
+        auto product = "p-" + std::to_string(i);
+        catalogue.lines.push_back({"line-" + std::to_string(i), product, quantity(rng)});
+        for (std::size_t w = 0; w < warehouses; ++w) {
+            if (stocked(rng)) {
+                catalogue.stock.push_back({"wh-" + std::to_string(w), product, available(rng)});
+            }
+        }
+    }
+    return catalogue;
+}
+
+} // namespace
+
+TEST_CASE("SourcingPlanner ships from one warehouse when it can", "[sourcing][planner]") {
+    auto lines = singleUnits({"a", "b"});
+    lines[0].quantity = 5;
+    std::vector<models::WarehouseStock> stock{
+        {"wh-1", "a", 5}, {"wh-2", "a", 10}, {"wh-2", "b", 3}, {"wh-3", "b", 1},
+    };
+
+    auto plan = SourcingPlanner().plan(lines, stock);
+
+    REQUIRE(plan.exact);
+    REQUIRE(plan.shipments.size() == 1);
+    REQUIRE(plan.shipments[0].warehouseId == "wh-2");
+    REQUIRE(plan.shipments[0].units == 6);
+    REQUIRE(plan.backordered.empty());
+}
+
+TEST_CASE("SourcingPlanner finds fewer splits than the greedy pass", "[sourcing][planner]") {
+    // wh-x and wh-y hold half the products each. Greedy takes wh-big first
+    // (most products), then needs wh-mid and wh-small for the rest; none of
+    // its three is redundant, so only the exact search finds the pair.
+    std::vector<std::string> products;
+    for (int i = 1; i <= 14; ++i) products.push_back(std::to_string(i));
+    auto lines = singleUnits(products);
+    std::vector<models::WarehouseStock> stock;
+    auto holds = [&stock](const std::string& warehouse, std::vector<int> ids) {
+        for (int id : ids) stock.push_back({warehouse, std::to_string(id), 1});
+    };
+    holds("wh-x", {1, 2, 3, 4, 5, 6, 7});
+    holds("wh-y", {8, 9, 10, 11, 12, 13, 14});
+    holds("wh-big", {1, 2, 3, 4, 8, 9, 10, 11});
+    holds("wh-mid", {5, 6, 12, 13});
+    holds("wh-small", {7, 14});
+
+    models::SourcingOptions greedyOnly;
+    greedyOnly.maxExactWarehouses = 0;
+    auto greedy = SourcingPlanner(greedyOnly).plan(lines, stock);
+    REQUIRE_FALSE(greedy.exact);
+    REQUIRE(greedy.shipments.size() == 3);
+
+    auto exact = SourcingPlanner().plan(lines, stock);
+    REQUIRE(exact.exact);
+    REQUIRE(exact.shipments.size() == 2);
+    REQUIRE(shipped(exact, lines).count({"wh-x", "1"}) == 1);
+    REQUIRE(shipped(exact, lines).count({"wh-y", "14"}) == 1);
+    REQUIRE(exact.cost < greedy.cost);
+}
+
+TEST_CASE("SourcingPlanner takes the cheapest of equally few shipments", "[sourcing][planner]") {
+    auto lines = singleUnits({"a", "b"});
+    lines[0].quantity = 4;
+    std::vector<models::WarehouseStock> stock{
+        {"wh-far", "a", 4}, {"wh-far", "b", 1},
+        {"wh-near", "a", 4}, {"wh-near", "b", 1},
+    };
+    std::vector<models::WarehouseCost> costs{{"wh-far", 100, 9}, {"wh-near", 100, 2}};
+
+    auto plan = SourcingPlanner().plan(lines, stock, costs);
+
+    REQUIRE(plan.shipments.size() == 1);
+    REQUIRE(plan.shipments[0].warehouseId == "wh-near");
+    REQUIRE(plan.cost == 100 + 5 * 2);
+}
+
+TEST_CASE("SourcingPlanner splits a line only when it must", "[sourcing][planner]") {
+    std::vector<models::SourcingLine> lines{{"line-1", "a", 10}, {"line-2", "b", 2}};
+    std::vector<models::WarehouseStock> stock{{"wh-1", "a", 6}, {"wh-1", "b", 2}, {"wh-2", "a", 7}};
+
+    auto plan = SourcingPlanner().plan(lines, stock);
+
+    REQUIRE(plan.shipments.size() == 2);
+    auto units = shipped(plan, lines);
+    REQUIRE(units[{"wh-1", "a"}] + units[{"wh-2", "a"}] == 10);
+    REQUIRE(units[{"wh-1", "b"}] == 2);
+    // Line 2 is never split
+    for (const auto& shipment : plan.shipments) {
+        for (const auto& line : shipment.lines) {
+            if (line.line == 1) {
+                REQUIRE(line.quantity == 2);
+            }
+        }
+    }
+}
+
+TEST_CASE("SourcingPlanner backorders what no warehouse can promise", "[sourcing][planner]") {
+    std::vector<models::SourcingLine> lines{{"line-1", "a", 3}, {"line-2", "a", 4}, {"line-3", "z", 1}};
+    std::vector<models::WarehouseStock> stock{{"wh-1", "a", 5}};
+
+    auto plan = SourcingPlanner().plan(lines, stock);
+
+    REQUIRE(plan.shipments.size() == 1);
+    REQUIRE(plan.shipments[0].units == 5);
+    REQUIRE(plan.backordered.size() == 2);
+    REQUIRE(plan.backordered[0].line == 1);
+    REQUIRE(plan.backordered[0].quantity == 2);
+    REQUIRE(plan.backordered[1].line == 2);
+    REQUIRE(plan.backordered[1].quantity == 1);
+
+    SECTION("and rejects non-positive quantities") {
+        lines[0].quantity = 0;
+        REQUIRE_THROWS_AS(SourcingPlanner().plan(lines, stock), std::invalid_argument);
+    }
+}
+
+TEST_CASE("SourcingPlanner plans a large order within budget", "[sourcing][planner]") {
+    // 100 lines against 12 warehouses: the exact search always runs
+    auto catalogue = randomCatalogue(100, 12, 7);
+    SourcingPlanner planner;
+
+    auto started = std::chrono::steady_clock::now();
+    auto plan = planner.plan(catalogue.lines, catalogue.stock);
+    auto elapsed = std::chrono::steady_clock::now() - started;
+
+    REQUIRE(plan.exact);
+    int units = 0;
+    for (const auto& shipment : plan.shipments) {
+        units += shipment.units;
+    }
+    for (const auto& line : plan.backordered) {
+        units += line.quantity;
+    }
+    int ordered = 0;
+    for (const auto& line : catalogue.lines) {
+        ordered += line.quantity;
+    }
+    REQUIRE(units == ordered);
+    REQUIRE(elapsed < std::chrono::milliseconds(50));   // generous for debug builds; see benchmark
+}
+
+TEST_CASE("SourcingPlanner throughput", "[sourcing][planner][!benchmark]") {
+    auto exactCase = randomCatalogue(100, 12, 11);
+    auto greedyCase = randomCatalogue(100, 40, 13);
+    SourcingPlanner planner;
+
+    BENCHMARK("100 lines, 12 warehouses (exact)") {
+        return planner.plan(exactCase.lines, exactCase.stock);
+    };
+    BENCHMARK("100 lines, 40 warehouses (greedy)") {
+        return planner.plan(greedyCase.lines, greedyCase.stock);
+    };
+}
@@ -0,0 +1,38 @@
+#include <catch2/catch_test_macros.hpp>
+#include "order/models/StockReservation.hpp"
+
+using namespace order;
+using order::models::Money;
+using order::models::StockReservationReply;
+using order::models::StockReservationRequest;
+
+TEST_CASE("StockReservationRequest carries every line of the order", "[reservation]") {
+    models::Order order("o-1", "ORD-1", "CUST-1", "wh-1", models::OrderStatus::PENDING, "");
+    order.setLineItems({
+        models::OrderLineItem("line-1", "p-1", "SKU-1", "Widget", 3, Money::parse("1.00")),
+        models::OrderLineItem("line-2", "p-2", "SKU-2", "Gadget", 5, Money::parse("2.00")),
+    });
+
+    auto request = StockReservationRequest::fromOrder(order);
+    REQUIRE(request.orderId == "o-1");
+    REQUIRE(request.warehouseId == "wh-1");
+    REQUIRE(request.lines.size() == 2);
+
+    auto j = request.toJson();
+    REQUIRE(j["lines"][1]["lineItemId"] == "line-2");
+    REQUIRE(j["lines"][1]["productId"] == "p-2");
+    REQUIRE(j["lines"][1]["quantity"] == 5);
+}
+
+TEST_CASE("StockReservationReply reads inventory-service replies", "[reservation]") {
+    auto reserved = StockReservationReply::fromJson({{"orderId", "o-1"}, {"reservations", json::array()}}, true);
+    REQUIRE(reserved.orderId == "o-1");
+    REQUIRE(reserved.reserved);
+    REQUIRE_FALSE(reserved.reason);
+
+    auto failed = StockReservationReply::fromJson({{"orderId", "o-2"}, {"reason", "1 product(s) short"}}, false);
+    REQUIRE_FALSE(failed.reserved);
+    REQUIRE(failed.reason == "1 product(s) short");
+
+    REQUIRE_THROWS_AS(StockReservationReply::fromJson({{"reason", "x"}}, false), std::invalid_argument);
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "order/services/WavePlanner.hpp"
+#include <random>
+#include <set>
+
+using namespace order;
+using order::services::WavePlanner;
+
+namespace {
+
+using namespace std::chrono_literals;
+const auto kNow = std::chrono::system_clock::time_point(std::chrono::hours(500000));
+
+models::WaveOrder makeOrder(const std::string& id, std::vector<std::string> skus,
+                            models::OrderPriority priority = models::OrderPriority::NORMAL,
+                            std::optional<std::chrono::system_clock::time_point> shipBy = std::nullopt) {
+    models::WaveOrder order;
+    order.id = id;
+    order.orderNumber = "ORD-" + id;
+    order.priority = priority;
+    order.shipByDate = shipBy;
+    order.skus = std::move(skus);
+    return order;
+}
+
+std::vector<models::WaveOrder> randomOrders(std::size_t count, std::size_t skuCount, unsigned seed) {
+    std::mt19937 rng(seed);
+    // Skewed demand: a few fast movers appear in many orders
+    std::geometric_distribution<std::size_t> sku(0.002);
+    std::uniform_int_distribution<int> lines(1, 6);
+    std::uniform_int_distribution<int> priority(0, 3);
+    std::uniform_int_distribution<int> hours(0, 72);
+    std::vector<models::WaveOrder> orders;
+    orders.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::vector<std::string> skus;
+        for (int l = lines(rng); l > 0; --l) {
+            skus.push_back("SKU-" + std::to_string(sku(rng) % skuCount));
+        }
+        orders.push_back(makeOrder(std::to_string(i), std::move(skus),
+                                   static_cast<models::OrderPriority>(priority(rng)),
+                                   kNow + std::chrono::hours(hours(rng))));
+    }
+    return orders;
+}
+
+// Every order appears in exactly one wave and every wave respects the limits
+void requireValidPlan(const std::vector<models::WaveOrder>& orders,
+                      const std::vector<models::Wave>& waves,
+                      const models::WaveConstraints& constraints) {
+    std::vector<int> seen(orders.size(), 0);
+    for (const auto& wave : waves) {
+        REQUIRE_FALSE(wave.orders.empty());
+        std::set<std::string> stops;
+        std::size_t lines = 0;
+        for (auto index : wave.orders) {
+            ++seen[index];
+            REQUIRE(orders[index].priority == wave.priority);
+            lines += orders[index].skus.size();
+            stops.insert(orders[index].skus.begin(), orders[index].skus.end());
+        }
+        REQUIRE(wave.lineCount == lines);
+        REQUIRE(wave.stopCount == stops.size());
+        if (wave.orders.size() > 1) {
+            REQUIRE(wave.orders.size() <= constraints.maxOrdersPerWave);
+            REQUIRE(wave.lineCount <= constraints.maxLinesPerWave);
+            REQUIRE(wave.stopCount <= constraints.maxStopsPerWave);
+        }
+    }
+    for (auto count : seen) {
+        REQUIRE(count == 1);
+    }
+}
+
+} // namespace
+
+TEST_CASE("WavePlanner groups orders that share SKUs", "[waves][planner]") {
+    std::vector<models::WaveOrder> orders = {
+        makeOrder("a1", {"A", "B"}),
+        makeOrder("b1", {"X", "Y"}),
+        makeOrder("a2", {"A", "B", "C"}),
+        makeOrder("b2", {"Y", "X"}),
+        makeOrder("a3", {"C"}),
+    };
+    models::WaveConstraints constraints;
+    constraints.maxOrdersPerWave = 3;
+
+    auto waves = WavePlanner(1).plan(orders, constraints);
+
+    REQUIRE(waves.size() == 2);
+    REQUIRE(waves[0].orders == std::vector<std::size_t>{0, 2, 4});
+    REQUIRE(waves[0].stopCount == 3);
+    REQUIRE(waves[1].orders == std::vector<std::size_t>{1, 3});
+    REQUIRE(waves[1].stopCount == 2);
+}
+
+TEST_CASE("WavePlanner never mixes priorities or crosses the cut-off", "[waves][planner]") {
+    std::vector<models::WaveOrder> orders = {
+        makeOrder("n-late", {"A"}, models::OrderPriority::NORMAL, kNow + 48h),
+        makeOrder("u", {"A"}, models::OrderPriority::URGENT, kNow + 48h),
+        makeOrder("n-due", {"A"}, models::OrderPriority::NORMAL, kNow + 1h),
+        makeOrder("n-none", {"A"}, models::OrderPriority::NORMAL),
+    };
+    models::WaveConstraints constraints;
+    constraints.cutoff = kNow + 2h;
+
+    auto waves = WavePlanner(1).plan(orders, constraints);
+
+    REQUIRE(waves.size() == 3);
+    REQUIRE(waves[0].priority == models::OrderPriority::URGENT);
+    REQUIRE(waves[1].dueByCutoff);
+    REQUIRE(waves[1].orders == std::vector<std::size_t>{2});
+    REQUIRE_FALSE(waves[2].dueByCutoff);
+    REQUIRE(waves[2].orders == std::vector<std::size_t>{0, 3});
+    REQUIRE(waves[2].earliestShipBy == kNow + 48h);
+}
+
+TEST_CASE("WavePlanner respects wave limits", "[waves][planner]") {
+    auto orders = randomOrders(3000, 400, 7);
+    models::WaveConstraints constraints;
+    constraints.cutoff = kNow + 24h;
+    constraints.maxLinesPerWave = 40;
+    constraints.maxStopsPerWave = 25;
+    constraints.maxOrdersPerWave = 12;
+
+    auto waves = WavePlanner(4).plan(orders, constraints);
+
+    requireValidPlan(orders, waves, constraints);
+}
+
+TEST_CASE("WavePlanner gives an oversized order its own wave", "[waves][planner]") {
+    std::vector<models::WaveOrder> orders = {
+        makeOrder("big", {"A", "B", "C", "D"}),
+        makeOrder("small", {"A"}),
+    };
+    models::WaveConstraints constraints;
+    constraints.maxLinesPerWave = 3;
+
+    auto waves = WavePlanner(1).plan(orders, constraints);
+
+    REQUIRE(waves.size() == 2);
+    requireValidPlan(orders, waves, constraints);
+}
+
+TEST_CASE("WavePlanner rejects zero limits", "[waves][planner]") {
+    models::WaveConstraints constraints;
+    constraints.maxStopsPerWave = 0;
+    REQUIRE_THROWS_AS(WavePlanner(1).plan({}, constraints), std::invalid_argument);
+}
+
+TEST_CASE("WavePlanner throughput", "[waves][planner][!benchmark]") {
+    auto orders = randomOrders(50000, 5000, 42);
+    models::WaveConstraints constraints;
+    constraints.cutoff = kNow + 24h;
+    WavePlanner planner;
+
+    BENCHMARK("plan 50k open orders") {
+        return planner.plan(orders, constraints).size();
+    };
+}
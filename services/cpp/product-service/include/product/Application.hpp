@@ -2,6 +2,8 @@
 
 #include "product/Server.hpp"
 #include "product/services/ProductService.hpp"
+#include "product/services/ProductEventPublisher.hpp"
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -21,6 +23,8 @@ public:
 private:
     std::unique_ptr<Server> server_;
     std::shared_ptr<services::ProductService> productService_;
+    std::shared_ptr<services::ProductEventPublisher> eventPublisher_;
+    std::chrono::seconds catalogueRefreshInterval_{30};
     
     void initialize();
     void start();
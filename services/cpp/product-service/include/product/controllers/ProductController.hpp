@@ -3,6 +3,7 @@
 #include <Poco/Net/HTTPRequestHandler.h>
 #include <Poco/Net/HTTPServerRequest.h>
 #include <Poco/Net/HTTPServerResponse.h>
+#include <Poco/URI.h>
 #include "product/services/ProductService.hpp"
 #include <memory>
 #include <string>
@@ -13,8 +14,12 @@ namespace product::controllers {
  * @brief Product API endpoints handler
  * 
  * Handles:
- * - GET /api/v1/products (list)
+ * - GET /api/v1/products (list; category, status and cursor filters)
+ * - GET /api/v1/products/active (list active products)
  * - GET /api/v1/products/{id} (get by id)
+ * - GET /api/v1/products/sku/{sku} (get by SKU)
+ * - GET /api/v1/products/suggest?prefix=&limit= (SKU autocomplete)
+ * - GET /api/v1/products/search?q=&limit= (full-text search)
  * - POST /api/v1/products (create)
  * - PUT /api/v1/products/{id} (update)
  * - DELETE /api/v1/products/{id} (delete)
@@ -30,10 +35,13 @@ private:
     std::shared_ptr<services::ProductService> service_;
     
     // Handler methods for different operations
-    void handleGetAll(int page, int pageSize, Poco::Net::HTTPServerRequest& request,
-                     Poco::Net::HTTPServerResponse& response);
+    void handleGetAll(const Poco::URI& uri, bool activeOnly, Poco::Net::HTTPServerResponse& response);
     void handleGetById(const std::string& id, Poco::Net::HTTPServerRequest& request,
                       Poco::Net::HTTPServerResponse& response);
+    void handleGetBySku(const std::string& sku, Poco::Net::HTTPServerRequest& request,
+                       Poco::Net::HTTPServerResponse& response);
+    void handleSuggest(const Poco::URI& uri, Poco::Net::HTTPServerResponse& response);
+    void handleSearch(const Poco::URI& uri, Poco::Net::HTTPServerResponse& response);
     void handleCreate(Poco::Net::HTTPServerRequest& request,
                      Poco::Net::HTTPServerResponse& response);
     void handleUpdate(const std::string& id, Poco::Net::HTTPServerRequest& request,
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ProductItemDto.hpp"
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace product::dtos {
@@ -17,7 +19,8 @@ public:
                    int totalCount,
                    int page,
                    int pageSize,
-                   int totalPages);
+                   int totalPages,
+                   const std::optional<std::string>& nextCursor = std::nullopt);
 
     // Immutable getters
     // CRITICAL: Return collection by const reference (zero-cost access)
@@ -28,6 +31,8 @@ public:
     int getPage() const { return page_; }
     int getPageSize() const { return pageSize_; }
     int getTotalPages() const { return totalPages_; }
+    // Pass as cursor to fetch the following page; absent on the last page
+    std::optional<std::string> getNextCursor() const { return nextCursor_; }
     
     json toJson() const;
 
@@ -37,6 +42,7 @@ private:
     int page_;
     int pageSize_;
     int totalPages_;
+    std::optional<std::string> nextCursor_;
 };
 
 }  // namespace product::dtos
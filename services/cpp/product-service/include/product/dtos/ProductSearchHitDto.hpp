@@ -0,0 +1,26 @@
+#pragma once
+
+#include "ProductItemDto.hpp"
+
+namespace product::dtos {
+
+/**
+ * @brief One product matched by a search, with its relevance score
+ * 
+ * Immutable DTO. Scores only order hits within one response.
+ */
+class ProductSearchHitDto {
+public:
+    ProductSearchHitDto(const ProductItemDto& product, double score);
+
+    const ProductItemDto& getProduct() const { return product_; }
+    double getScore() const { return score_; }
+    
+    json toJson() const;
+
+private:
+    ProductItemDto product_;
+    double score_;
+};
+
+}  // namespace product::dtos
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ProductSearchHitDto.hpp"
+#include <string>
+#include <vector>
+
+namespace product::dtos {
+
+/**
+ * @brief Products matching a free-text query
+ * 
+ * Immutable DTO; items are best match first.
+ */
+class ProductSearchResultsDto {
+public:
+    ProductSearchResultsDto(const std::string& query, const std::vector<ProductSearchHitDto>& items);
+
+    std::string getQuery() const { return query_; }
+    const std::vector<ProductSearchHitDto>& getItems() const { return items_; }
+    
+    json toJson() const;
+
+private:
+    std::string query_;
+    std::vector<ProductSearchHitDto> items_;
+};
+
+}  // namespace product::dtos
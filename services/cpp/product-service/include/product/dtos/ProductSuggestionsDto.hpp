@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ProductItemDto.hpp"
+#include <string>
+#include <vector>
+
+namespace product::dtos {
+
+/**
+ * @brief Products whose SKU completes a type-ahead prefix
+ * 
+ * Immutable DTO; items are in SKU order.
+ */
+class ProductSuggestionsDto {
+public:
+    ProductSuggestionsDto(const std::string& prefix, const std::vector<ProductItemDto>& items);
+
+    std::string getPrefix() const { return prefix_; }
+    const std::vector<ProductItemDto>& getItems() const { return items_; }
+    
+    json toJson() const;
+
+private:
+    std::string prefix_;
+    std::vector<ProductItemDto> items_;
+};
+
+}  // namespace product::dtos
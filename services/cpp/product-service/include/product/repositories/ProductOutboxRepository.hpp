@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <pqxx/pqxx>
+
+namespace product::repositories {
+
+/**
+ * @brief A product change event waiting in the outbox
+ */
+struct OutboxEvent {
+    std::int64_t sequence;          // outbox row id; publication order
+    std::string eventId;
+    std::string eventType;          // ProductCreated, ProductUpdated or ProductDeleted
+    std::string productId;
+    std::int64_t productVersion;
+    std::string createdAt;          // ISO 8601, UTC
+    nlohmann::json data;            // product fields plus version
+};
+
+/**
+ * @brief Durable queue of product events awaiting publication
+ */
+class ProductOutbox {
+public:
+    using Handler = std::function<void(const std::vector<OutboxEvent>&)>;
+
+    virtual ~ProductOutbox() = default;
+
+    /**
+     * @brief Pass up to limit of the oldest unpublished events to handler
+     *
+     * They are marked published only if handler returns; if it throws they
+     * stay queued for the next call, so delivery is at least once.
+     * @return Number of events published
+     */
+    virtual std::size_t drain(std::size_t limit, const Handler& handler) = 0;
+
+    // Delete events published more than retention ago; returns how many
+    virtual std::size_t purgePublished(std::chrono::hours retention) = 0;
+};
+
+/**
+ * @brief product_outbox table, filled by ProductRepository in the same
+ * transaction as each change
+ *
+ * drain locks the rows it hands out with FOR UPDATE SKIP LOCKED, so
+ * replicas draining together never publish the same event twice, though
+ * events of one product may then leave out of order; consumers compare
+ * versions. Uses its own connection so publishing never waits on requests.
+ */
+class ProductOutboxRepository : public ProductOutbox {
+public:
+    explicit ProductOutboxRepository(std::shared_ptr<pqxx::connection> db);
+
+    std::size_t drain(std::size_t limit, const Handler& handler) override;
+    std::size_t purgePublished(std::chrono::hours retention) override;
+
+private:
+    std::shared_ptr<pqxx::connection> db_;
+    std::mutex mutex_;
+};
+
+}  // namespace product::repositories
@@ -1,18 +1,49 @@
 #pragma once
 
 #include "product/models/Product.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <pqxx/pqxx>
 
 namespace product::repositories {
 
+/**
+ * @brief Listing filters, applied in SQL; unset fields match everything
+ */
+struct ProductFilter {
+    std::optional<std::string> category;
+    std::optional<std::string> status;   // "active", "inactive" or "discontinued"
+};
+
+/**
+ * @brief One page of products in SKU order
+ */
+struct ProductPage {
+    std::vector<models::Product> products;
+    bool hasMore = false;   // at least one matching product follows the page
+};
+
+/**
+ * @brief Products changed since a watermark, and the watermark to ask from next
+ */
+struct ProductChanges {
+    std::vector<models::Product> products;
+    std::optional<std::string> watermark;   // latest updated_at seen; unset if nothing came back
+};
+
 /**
  * @brief Product data access layer
  * 
  * Handles all database operations for products.
  * Returns models (internal representation), not DTOs.
+ * create, update and deleteById also queue a ProductCreated, ProductUpdated
+ * or ProductDeleted event in product_outbox in the same transaction, carrying
+ * the product's version after the change.
  */
 class ProductRepository {
 public:
@@ -21,14 +52,45 @@ public:
     // CRUD operations
     std::optional<models::Product> findById(const std::string& id);
     std::optional<models::Product> findBySku(const std::string& sku);
-    std::vector<models::Product> findAll();
-    std::vector<models::Product> findActive();
+
+    /**
+     * @brief Up to limit products matching filter, ordered by SKU
+     *
+     * With afterSku the page starts after that SKU (keyset) and offset is
+     * ignored, so deep pages cost the same as the first. Without it the
+     * first offset matches are skipped.
+     */
+    ProductPage findPage(const ProductFilter& filter, int limit, long long offset,
+                         const std::optional<std::string>& afterSku);
+
     models::Product create(const models::Product& product);
     models::Product update(const models::Product& product);
     bool deleteById(const std::string& id);
 
+    /**
+     * @brief Products updated at or after watermark, or every product without one
+     *
+     * Reaches kWatermarkOverlapSeconds back past the watermark, so a row
+     * committed late with an earlier timestamp is still picked up; products
+     * seen twice are harmless to apply again. Deletes leave nothing to find.
+     */
+    ProductChanges findChangedSince(const std::optional<std::string>& watermark);
+
+    // Number of products matching filter; every product by default
+    std::size_t count(const ProductFilter& filter = {});
+
+    static constexpr int kWatermarkOverlapSeconds = 5;
+
 private:
     std::shared_ptr<pqxx::connection> db_;
+    std::mutex mutex_;   // pqxx connections are not safe to share between threads
+
+    static void enqueueEvent(pqxx::work& txn, const std::string& eventType,
+                             const models::Product& product, std::int64_t version);
+
+    // Appends " AND ..." conditions for filter to sql
+    static void appendFilter(const ProductFilter& filter, std::string& sql, pqxx::params& params,
+                             int& placeholders);
 
     // Helper to convert row to Product
     models::Product rowToProduct(const pqxx::row& row);
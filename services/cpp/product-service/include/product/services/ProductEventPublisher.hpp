@@ -0,0 +1,81 @@
+#pragma once
+
+#include "product/repositories/ProductOutboxRepository.hpp"
+#include "product/utils/MessageBus.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <nlohmann/json.hpp>
+
+namespace product::services {
+
+/**
+ * @brief Moves product events from the outbox onto the message bus
+ *
+ * Drains the outbox in batches, oldest first. Consecutive events of the same
+ * type go out in one publishBatch call. An event leaves the outbox only
+ * once its batch has been published, so a broker outage delays events
+ * rather than losing them, and a crash between publishing and marking
+ * sends them again. Each event carries the product's version; consumers
+ * keep the highest they have seen and drop the rest.
+ *
+ * Events go to routing keys created, updated and deleted under the bus's
+ * prefix, in the standard envelope: eventId, eventType, eventVersion,
+ * timestamp, correlationId, source and data.
+ *
+ * start() runs a background thread that drains every interval, or at once
+ * after wake(). Published events are purged after the retention period.
+ */
+class ProductEventPublisher {
+public:
+    struct Options {
+        std::size_t batchSize = 100;
+        std::chrono::milliseconds interval{1000};
+        std::chrono::hours retention{24};
+    };
+
+    ProductEventPublisher(std::shared_ptr<repositories::ProductOutbox> outbox,
+                          std::shared_ptr<utils::MessageBus> bus,
+                          Options options);
+    ~ProductEventPublisher();
+
+    ProductEventPublisher(const ProductEventPublisher&) = delete;
+    ProductEventPublisher& operator=(const ProductEventPublisher&) = delete;
+
+    /**
+     * @brief Publish queued events until the outbox is empty
+     * @return Number of events published
+     * @throws std::runtime_error if the database or the bus fails; what was
+     *         published before that stays published
+     */
+    std::size_t publishPending();
+
+    void start();
+    void stop();
+
+    // Drain now rather than at the next interval; call after a write
+    void wake();
+
+    static nlohmann::json toMessage(const repositories::OutboxEvent& event);
+    static std::string routingKeyFor(const std::string& eventType);
+
+private:
+    std::shared_ptr<repositories::ProductOutbox> outbox_;
+    std::shared_ptr<utils::MessageBus> bus_;
+    Options options_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    bool running_ = false;
+    bool woken_ = false;
+    std::thread worker_;
+
+    void run();
+    void publishBatch(const std::vector<repositories::OutboxEvent>& events);
+};
+
+}  // namespace product::services
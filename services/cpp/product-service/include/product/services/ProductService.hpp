@@ -2,9 +2,17 @@
 
 #include "product/dtos/ProductItemDto.hpp"
 #include "product/dtos/ProductListDto.hpp"
+#include "product/dtos/ProductSearchResultsDto.hpp"
+#include "product/dtos/ProductSuggestionsDto.hpp"
 #include "product/repositories/ProductRepository.hpp"
+#include "product/services/ProductEventPublisher.hpp"
+#include "product/utils/ProductCatalogue.hpp"
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <unordered_map>
 
 namespace product::services {
 
@@ -16,13 +24,34 @@ namespace product::services {
  */
 class ProductService {
 public:
-    explicit ProductService(std::shared_ptr<repositories::ProductRepository> repository);
+    // Without a catalogue every lookup goes to the database and suggestions are unavailable.
+    // With an event publisher, writes wake it so their outbox events go out promptly.
+    explicit ProductService(std::shared_ptr<repositories::ProductRepository> repository,
+                            std::shared_ptr<utils::ProductCatalogue> catalogue = nullptr,
+                            std::shared_ptr<ProductEventPublisher> events = nullptr);
 
-    // Product queries - return DTOs
+    // Product queries - return DTOs. Id and SKU lookups are served from the catalogue.
     std::optional<dtos::ProductItemDto> getById(const std::string& id);
     std::optional<dtos::ProductItemDto> getBySku(const std::string& sku);
-    dtos::ProductListDto getAll(int page = 1, int pageSize = 50);
-    dtos::ProductListDto getActive(int page = 1, int pageSize = 50);
+
+    /**
+     * @brief One page of products matching filter, in SKU order
+     *
+     * Only the requested slice is read. Pass the previous page's nextCursor
+     * as cursor to continue by keyset instead of offset; page is then only
+     * echoed back. totalCount may be up to kCountCacheTtl old when another
+     * replica has written meanwhile.
+     * @throws std::invalid_argument for page < 1, pageSize outside 1..kMaxPageSize or an unknown status
+     */
+    dtos::ProductListDto getAll(int page = 1, int pageSize = 50,
+                                const repositories::ProductFilter& filter = {},
+                                const std::optional<std::string>& cursor = std::nullopt);
+    dtos::ProductListDto getActive(int page = 1, int pageSize = 50,
+                                   const std::optional<std::string>& category = std::nullopt,
+                                   const std::optional<std::string>& cursor = std::nullopt);
+
+    static constexpr int kMaxPageSize = 200;
+    static constexpr std::chrono::seconds kCountCacheTtl{30};
 
     // Product mutations - return DTOs
     dtos::ProductItemDto create(const std::string& sku,
@@ -38,8 +67,63 @@ public:
     
     bool deleteById(const std::string& id);
 
+    /**
+     * @brief Products whose SKU starts with prefix, for type-ahead
+     *
+     * Served from the catalogue's radix tree without touching the database.
+     * The prefix is upper-cased first.
+     * @throws std::invalid_argument if prefix is not 1-100 of [A-Z0-9-] or limit is outside 1..kMaxSuggestions
+     * @throws std::runtime_error if no catalogue is configured
+     */
+    dtos::ProductSuggestionsDto suggestBySku(const std::string& prefix, int limit);
+
+    static constexpr int kDefaultSuggestions = 10;
+    static constexpr int kMaxSuggestions = 50;
+
+    /**
+     * @brief Products whose name, category or description match query, best first
+     *
+     * Served from the catalogue's search index without touching the database.
+     * @throws std::invalid_argument if query has no letters or digits, is over
+     *         kMaxQueryLength characters, or limit is outside 1..kMaxSearchResults
+     * @throws std::runtime_error if no catalogue is configured
+     */
+    dtos::ProductSearchResultsDto search(const std::string& query, int limit);
+
+    static constexpr int kDefaultSearchResults = 20;
+    static constexpr int kMaxSearchResults = 100;
+    static constexpr std::size_t kMaxQueryLength = 200;
+
+    // Fill the catalogue from every product; call once at startup
+    void loadCatalogue();
+
+    /**
+     * @brief Bring the catalogue up to date with writes made elsewhere
+     *
+     * Applies the products changed since the last load or refresh. Deletes
+     * leave no changed row behind, so when the catalogue then holds a
+     * different number of products than the table it is reloaded in full.
+     */
+    void refreshCatalogue();
+
 private:
     std::shared_ptr<repositories::ProductRepository> repository_;
+    std::shared_ptr<utils::ProductCatalogue> catalogue_;
+    std::shared_ptr<ProductEventPublisher> events_;
+    std::mutex refreshMutex_;                         // one load or refresh at a time
+    std::optional<std::string> catalogueWatermark_;   // guarded by refreshMutex_
+    
+    struct CachedCount {
+        std::size_t count;
+        std::chrono::steady_clock::time_point at;
+    };
+    std::mutex countMutex_;
+    std::unordered_map<std::string, CachedCount> countCache_;   // by filter
+    
+    void loadCatalogueLocked();
+    std::size_t totalCount(const repositories::ProductFilter& filter);
+    void invalidateCounts();
+    void afterWrite();   // counts, events
 };
 
 }  // namespace product::services
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace product::utils {
+
+namespace detail {
+struct ArtNode;
+struct ArtNodeDeleter {
+    void operator()(ArtNode* node) const;
+};
+}  // namespace detail
+
+/**
+ * @brief Adaptive radix tree (ART) from string keys to string values
+ *
+ * Each inner node branches on one byte and grows through four layouts as
+ * children are added: up to 4 and 16 children as sorted key arrays, up to
+ * 48 through a 256-entry byte index, then a direct 256-slot array. Removing
+ * children shrinks them again. Runs of single-child nodes are collapsed into
+ * a prefix stored on the node (path compression), so a lookup costs one
+ * step per branching byte, not per key byte, and memory follows the number
+ * of keys rather than the alphabet. A key that is a prefix of another ends
+ * at an inner node, which holds its value.
+ *
+ * Keys come back in byte order, which is what prefix completion wants.
+ *
+ * Not thread-safe; callers lock around it.
+ */
+class AdaptiveRadixTree {
+public:
+    AdaptiveRadixTree();
+    ~AdaptiveRadixTree();
+    AdaptiveRadixTree(AdaptiveRadixTree&& other) noexcept;
+    AdaptiveRadixTree& operator=(AdaptiveRadixTree&& other) noexcept;
+
+    // Adds key or replaces its value; true if the key was new
+    bool insert(const std::string& key, const std::string& value);
+
+    // True if the key was present
+    bool erase(const std::string& key);
+
+    std::optional<std::string> find(const std::string& key) const;
+
+    // Up to limit (key, value) pairs whose key starts with prefix, in key order
+    std::vector<std::pair<std::string, std::string>> withPrefix(const std::string& prefix,
+                                                                std::size_t limit) const;
+
+    std::size_t size() const { return size_; }
+    void clear();
+
+private:
+    std::unique_ptr<detail::ArtNode, detail::ArtNodeDeleter> root_;
+    std::size_t size_ = 0;
+};
+
+}  // namespace product::utils
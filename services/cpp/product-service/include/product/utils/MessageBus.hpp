@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace product::utils {
+
+/**
+ * @brief Publisher for domain events
+ *
+ * Unlike the other services' buses, publishing throws when a message cannot
+ * be handed to the broker: events come from the outbox, which keeps them
+ * queued until a publish succeeds.
+ */
+class MessageBus {
+public:
+    struct Config {
+        std::string host;
+        int port;
+        std::string virtual_host;
+        std::string username;
+        std::string password;
+        std::string exchange;
+        std::string routing_key_prefix;
+    };
+
+    virtual ~MessageBus() = default;
+
+    virtual void publish(const std::string& routingKey,
+                         const nlohmann::json& payload) = 0;
+
+    /**
+     * @brief Publish many events with the same routing key, in order
+     * 
+     * Implementations may override to amortise per-message overhead.
+     */
+    virtual void publishBatch(const std::string& routingKey,
+                              const std::vector<nlohmann::json>& payloads) {
+        for (const auto& payload : payloads) {
+            publish(routingKey, payload);
+        }
+    }
+};
+
+}  // namespace product::utils
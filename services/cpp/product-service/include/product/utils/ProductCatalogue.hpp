@@ -0,0 +1,64 @@
+#pragma once
+
+#include "product/models/Product.hpp"
+#include "product/utils/AdaptiveRadixTree.hpp"
+#include "product/utils/ProductSearchIndex.hpp"
+#include <cstddef>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace product::utils {
+
+/**
+ * @brief The whole product catalogue held in memory
+ *
+ * Products are kept by id and by SKU in hash maps for exact lookups, the
+ * SKUs in an adaptive radix tree for prefix completion, and their text in
+ * a search index. Loaded once at
+ * startup, then kept current by the service's own writes and by periodic
+ * refreshes of rows changed since the last one.
+ *
+ * Safe to share between threads: readers share a lock, writers take it
+ * exclusively.
+ */
+class ProductCatalogue {
+public:
+    // Replace everything with products
+    void load(const std::vector<models::Product>& products);
+
+    /**
+     * @brief Add or replace one product
+     *
+     * A changed SKU is re-indexed. SKUs are unique, so another product still
+     * holding this one's SKU must have been deleted and is dropped.
+     */
+    void apply(const models::Product& product);
+
+    void remove(const std::string& id);
+
+    std::optional<models::Product> findById(const std::string& id) const;
+    std::optional<models::Product> findBySku(const std::string& sku) const;
+
+    // Up to limit products whose SKU starts with prefix, in SKU order
+    std::vector<models::Product> completeSku(const std::string& prefix, std::size_t limit) const;
+
+    // Up to limit products matching a free-text query with their scores, best first
+    std::vector<std::pair<models::Product, double>> search(const std::string& query, std::size_t limit) const;
+
+    std::size_t size() const;
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, models::Product> byId_;
+    std::unordered_map<std::string, std::string> idBySku_;
+    AdaptiveRadixTree skus_;   // SKU -> id
+    ProductSearchIndex text_;
+
+    void applyLocked(const models::Product& product);
+    void removeLocked(const std::string& id);
+};
+
+}  // namespace product::utils
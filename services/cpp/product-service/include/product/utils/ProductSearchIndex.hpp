@@ -0,0 +1,91 @@
+#pragma once
+
+#include "product/models/Product.hpp"
+#include "product/utils/AdaptiveRadixTree.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace product::utils {
+
+/**
+ * @brief A product matched by a search, best first
+ */
+struct SearchHit {
+    std::string id;
+    double score;
+};
+
+/**
+ * @brief Inverted index over product name, description and category
+ *
+ * Text is split into lower-case alphanumeric tokens. Each term keeps a
+ * posting list of (product, weighted term frequency) sorted by product, with
+ * name matches counting kNameWeight times, category kCategoryWeight times
+ * and description once. Products are ranked by BM25 over those weighted
+ * frequencies.
+ *
+ * Each query token matches the term itself, the terms it is a prefix of
+ * (found through a radix tree of the vocabulary) and, to tolerate typos,
+ * terms sharing most of their trigrams with it (found through a trigram
+ * index of the vocabulary, not of the products). Looser matches score less.
+ * A product matching more query tokens always ranks above one matching
+ * fewer; within that, by summed score.
+ *
+ * Updates touch only the changed product's postings. Not thread-safe;
+ * concurrent searches are fine, but callers lock around updates.
+ */
+class ProductSearchIndex {
+public:
+    // Adds product, replacing what was indexed under its id
+    void add(const models::Product& product);
+
+    void remove(const std::string& id);
+    void clear();
+
+    // Up to limit hits for query, best first; none for a query without tokens
+    std::vector<SearchHit> search(const std::string& query, std::size_t limit) const;
+
+    std::size_t size() const { return docIds_.size(); }
+
+    // Lower-cased runs of letters and digits; bytes of multi-byte UTF-8 count as letters
+    static std::vector<std::string> tokenize(const std::string& text);
+
+    static constexpr float kNameWeight = 3.0f;
+    static constexpr float kCategoryWeight = 2.0f;
+    static constexpr std::size_t kMaxQueryTokens = 10;
+
+private:
+    struct Posting {
+        std::uint32_t doc;
+        float frequency;
+    };
+    struct Term {
+        std::string text;
+        std::vector<Posting> postings;   // sorted by doc
+        std::size_t trigrams = 0;        // distinct, for similarity
+    };
+    struct Doc {
+        std::string id;
+        std::vector<std::uint32_t> terms;   // distinct terms, to undo on removal
+    };
+
+    std::vector<Doc> docs_;                  // slots of removed products are reused
+    std::vector<float> lengths_;             // weighted term count per slot, apart for locality
+    std::vector<std::uint32_t> freeDocs_;
+    std::unordered_map<std::string, std::uint32_t> docIds_;
+    std::vector<Term> terms_;                // never shrinks; a term may have no postings
+    std::unordered_map<std::string, std::uint32_t> termIds_;
+    AdaptiveRadixTree vocabulary_;           // terms with postings -> term id, for prefixes
+    std::unordered_map<std::string, std::vector<std::uint32_t>> trigrams_;   // -> term ids
+    double totalLength_ = 0;
+
+    std::uint32_t termId(const std::string& text);
+
+    // (term id, weight) for every term query token token should match
+    std::vector<std::pair<std::uint32_t, float>> expand(const std::string& token) const;
+};
+
+}  // namespace product::utils
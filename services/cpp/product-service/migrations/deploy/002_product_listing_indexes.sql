@@ -0,0 +1,13 @@
+-- Deploy product-service:002_product_listing_indexes to pg
+-- requires: 001_init_schema
+
+BEGIN;
+
+-- Filtered listings page through products in SKU order
+CREATE INDEX idx_products_category_sku ON products(category, sku);
+CREATE INDEX idx_products_status_sku ON products(status, sku);
+
+-- Covered by idx_products_status_sku
+DROP INDEX IF EXISTS idx_products_status;
+
+COMMIT;
@@ -0,0 +1,34 @@
+-- Deploy product-service:003_product_outbox to pg
+-- requires: 001_init_schema
+
+BEGIN;
+
+-- Bumped on every update so event consumers can drop stale changes
+ALTER TABLE products ADD COLUMN version BIGINT NOT NULL DEFAULT 1;
+
+CREATE OR REPLACE FUNCTION update_products_timestamp()
+RETURNS TRIGGER AS $$
+BEGIN
+    NEW.updated_at = CURRENT_TIMESTAMP;
+    NEW.version = OLD.version + 1;
+    RETURN NEW;
+END;
+$$ LANGUAGE plpgsql;
+
+-- Product change events, written in the same transaction as the change and
+-- published afterwards in id order
+CREATE TABLE product_outbox (
+    id BIGSERIAL PRIMARY KEY,
+    event_id UUID NOT NULL DEFAULT uuid_generate_v4(),
+    event_type VARCHAR(50) NOT NULL CHECK (event_type IN ('ProductCreated', 'ProductUpdated', 'ProductDeleted')),
+    product_id UUID NOT NULL,
+    product_version BIGINT NOT NULL,
+    payload JSONB NOT NULL,
+    created_at TIMESTAMP NOT NULL DEFAULT CURRENT_TIMESTAMP,
+    published_at TIMESTAMP
+);
+
+CREATE INDEX idx_product_outbox_unpublished ON product_outbox(id) WHERE published_at IS NULL;
+CREATE INDEX idx_product_outbox_published_at ON product_outbox(published_at) WHERE published_at IS NOT NULL;
+
+COMMIT;
@@ -0,0 +1,9 @@
+-- Revert product-service:002_product_listing_indexes from pg
+
+BEGIN;
+
+CREATE INDEX IF NOT EXISTS idx_products_status ON products(status);
+DROP INDEX IF EXISTS idx_products_status_sku;
+DROP INDEX IF EXISTS idx_products_category_sku;
+
+COMMIT;
@@ -0,0 +1,17 @@
+-- Revert product-service:003_product_outbox from pg
+
+BEGIN;
+
+DROP TABLE IF EXISTS product_outbox;
+
+CREATE OR REPLACE FUNCTION update_products_timestamp()
+RETURNS TRIGGER AS $$
+BEGIN
+    NEW.updated_at = CURRENT_TIMESTAMP;
+    RETURN NEW;
+END;
+$$ LANGUAGE plpgsql;
+
+ALTER TABLE products DROP COLUMN IF EXISTS version;
+
+COMMIT;
@@ -0,0 +1,11 @@
+-- Verify product-service:002_product_listing_indexes on pg
+
+BEGIN;
+
+SELECT 1/count(*) FROM pg_indexes
+WHERE tablename = 'products' AND indexname = 'idx_products_category_sku';
+
+SELECT 1/count(*) FROM pg_indexes
+WHERE tablename = 'products' AND indexname = 'idx_products_status_sku';
+
+ROLLBACK;
@@ -0,0 +1,11 @@
+-- Verify product-service:003_product_outbox on pg
+
+BEGIN;
+
+SELECT version FROM products WHERE FALSE;
+
+SELECT id, event_id, event_type, product_id, product_version, payload, created_at, published_at
+FROM product_outbox
+WHERE FALSE;
+
+ROLLBACK;
@@ -3,8 +3,12 @@
 #include "product/utils/Config.hpp"
 #include "product/utils/Database.hpp"
 #include "product/repositories/ProductRepository.hpp"
+#include "product/utils/ProductCatalogue.hpp"
+#include "product/utils/RabbitMqMessageBus.hpp"
+#include "product/repositories/ProductOutboxRepository.hpp"
 #include <iostream>
 #include <thread>
+#include <algorithm>
 #include <chrono>
 #include <signal.h>
 
@@ -28,9 +32,20 @@ int Application::run(int argc, char* argv[]) {
         initialize();
         start();
         
-        // Keep running until interrupted
+        // Keep running until interrupted, pulling other replicas' writes into the catalogue
+        auto lastRefresh = std::chrono::steady_clock::now();
         while (true) {
             std::this_thread::sleep_for(std::chrono::seconds(1));
+            if (std::chrono::steady_clock::now() - lastRefresh >= catalogueRefreshInterval_) {
+                lastRefresh = std::chrono::steady_clock::now();
+                try {
+                    productService_->refreshCatalogue();
+                } catch (const std::exception& e) {
+                    if (auto logger = utils::Logger::getLogger()) {
+                        logger->warn("Product catalogue refresh failed: {}", e.what());
+                    }
+                }
+            }
         }
         
         return EXIT_SUCCESS;
@@ -70,7 +85,32 @@ void Application::initialize() {
         utils::Database::getConnection()
     );
     
-    productService_ = std::make_shared<services::ProductService>(repository);
+    // Product events leave through the outbox, drained on a connection of its own
+    auto messageBus = std::make_shared<utils::RabbitMqMessageBus>(
+        utils::MessageBus::Config{
+            .host = utils::Config::getString("messageBus.host", "rabbitmq"),
+            .port = utils::Config::getInt("messageBus.port", 5672),
+            .virtual_host = utils::Config::getString("messageBus.virtualHost", "/"),
+            .username = utils::Config::getString("messageBus.username", "warehouse"),
+            .password = utils::Config::getString("messageBus.password", "warehouse_dev"),
+            .exchange = utils::Config::getString("messageBus.exchange", "warehouse.events"),
+            .routing_key_prefix = utils::Config::getString("messageBus.routingKeyPrefix", "product.")
+        }
+    );
+    auto outbox = std::make_shared<repositories::ProductOutboxRepository>(
+        std::make_shared<pqxx::connection>(dbUrl));
+    services::ProductEventPublisher::Options eventOptions;
+    eventOptions.batchSize = static_cast<std::size_t>(std::max(1, utils::Config::getInt("events.batchSize", 100)));
+    eventOptions.interval = std::chrono::milliseconds(
+        std::max(10, utils::Config::getInt("events.pollIntervalMs", 1000)));
+    eventOptions.retention = std::chrono::hours(std::max(1, utils::Config::getInt("events.retentionHours", 24)));
+    eventPublisher_ = std::make_shared<services::ProductEventPublisher>(outbox, messageBus, eventOptions);
+    
+    auto catalogue = std::make_shared<utils::ProductCatalogue>();
+    productService_ = std::make_shared<services::ProductService>(repository, catalogue, eventPublisher_);
+    productService_->loadCatalogue();
+    catalogueRefreshInterval_ = std::chrono::seconds(
+        std::max(1, utils::Config::getInt("catalogue.refreshSeconds", 30)));
     if (auto logger = utils::Logger::getLogger()) logger->info("Product service initialized");
     
     // Initialize server
@@ -87,6 +127,10 @@ void Application::start() {
         server_->start();
         if (auto logger = utils::Logger::getLogger()) logger->info("HTTP server started");
     }
+    if (eventPublisher_) {
+        eventPublisher_->start();
+        if (auto logger = utils::Logger::getLogger()) logger->info("Product event publisher started");
+    }
 }
 
 void Application::stop() {
@@ -95,7 +139,11 @@ void Application::stop() {
     if (server_) {
         server_->stop();
     }
+        if (eventPublisher_) {
+        eventPublisher_->stop();
+    }
     
+
     utils::Database::disconnect();
     if (auto logger = utils::Logger::getLogger()) logger->info("Shutdown complete");
 }
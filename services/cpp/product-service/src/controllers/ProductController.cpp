@@ -30,25 +30,19 @@ void ProductController::handleRequest(Poco::Net::HTTPServerRequest& request,
         Poco::URI parsed(uri);
         std::string path = parsed.getPath();
         
-        // Extract query parameters
-        int page = 1;
-        int pageSize = 50;
-        if (!parsed.getQuery().empty()) {
-            std::string query = parsed.getQuery();
-            if (query.find("page=") != std::string::npos) {
-                size_t pos = query.find("page=") + 5;
-                page = std::stoi(query.substr(pos, query.find("&", pos) - pos));
-            }
-            if (query.find("pageSize=") != std::string::npos) {
-                size_t pos = query.find("pageSize=") + 9;
-                pageSize = std::stoi(query.substr(pos, query.find("&", pos) - pos));
-            }
-        }
-        
         // Route handling
         if (method == "GET") {
             if (path == "/api/v1/products") {
-                handleGetAll(page, pageSize, request, response);
+                handleGetAll(parsed, false, response);
+            } else if (path == "/api/v1/products/active") {
+                handleGetAll(parsed, true, response);
+            } else if (path == "/api/v1/products/search") {
+                handleSearch(parsed, response);
+            } else if (path == "/api/v1/products/suggest") {
+                handleSuggest(parsed, response);
+            } else if (path.find("/api/v1/products/sku/") == 0) {
+                std::string sku = path.substr(21);  // "/api/v1/products/sku/".length() == 21
+                handleGetBySku(sku, request, response);
             } else if (path.find("/api/v1/products/") == 0) {
                 std::string id = path.substr(17);  // "/api/v1/products/".length() == 17
                 handleGetById(id, request, response);
@@ -84,11 +78,36 @@ void ProductController::handleRequest(Poco::Net::HTTPServerRequest& request,
     }
 }
 
-void ProductController::handleGetAll(int page, int pageSize, 
-                                    Poco::Net::HTTPServerRequest& request,
+void ProductController::handleGetAll(const Poco::URI& uri, bool activeOnly,
                                     Poco::Net::HTTPServerResponse& response) {
-    auto list = service_->getAll(page, pageSize);
-    sendJsonResponse(response, list.toJson().dump(), 200);
+    try {
+        int page = 1;
+        int pageSize = 50;
+        repositories::ProductFilter filter;
+        std::optional<std::string> cursor;
+        for (const auto& [key, value] : uri.getQueryParameters()) {
+            if (key == "page") {
+                page = std::stoi(value);
+            } else if (key == "pageSize") {
+                pageSize = std::stoi(value);
+            } else if (key == "category") {
+                filter.category = value;
+            } else if (key == "status" && !activeOnly) {
+                filter.status = value;
+            } else if (key == "cursor") {
+                cursor = value;
+            }
+        }
+        
+        auto list = activeOnly ? service_->getActive(page, pageSize, filter.category, cursor)
+                               : service_->getAll(page, pageSize, filter, cursor);
+        sendJsonResponse(response, list.toJson().dump(), 200);
+    } catch (const std::invalid_argument& e) {
+        // std::stoi reports non-numbers as invalid_argument too
+        sendErrorResponse(response, "BadRequest", e.what(), 400);
+    } catch (const std::out_of_range& e) {
+        sendErrorResponse(response, "BadRequest", "page or pageSize is out of range", 400);
+    }
 }
 
 void ProductController::handleGetById(const std::string& id,
@@ -104,6 +123,64 @@ void ProductController::handleGetById(const std::string& id,
     sendJsonResponse(response, product->toJson().dump(), 200);
 }
 
+void ProductController::handleGetBySku(const std::string& sku,
+                                      Poco::Net::HTTPServerRequest& request,
+                                      Poco::Net::HTTPServerResponse& response) {
+    auto product = service_->getBySku(sku);
+    
+    if (!product) {
+        sendErrorResponse(response, "NotFound", "Product not found for SKU: " + sku, 404);
+        return;
+    }
+    
+    sendJsonResponse(response, product->toJson().dump(), 200);
+}
+
+void ProductController::handleSuggest(const Poco::URI& uri,
+                                     Poco::Net::HTTPServerResponse& response) {
+    try {
+        std::string prefix;
+        int limit = services::ProductService::kDefaultSuggestions;
+        for (const auto& [key, value] : uri.getQueryParameters()) {
+            if (key == "prefix") {
+                prefix = value;
+            } else if (key == "limit") {
+                limit = std::stoi(value);
+            }
+        }
+        
+        auto suggestions = service_->suggestBySku(prefix, limit);
+        sendJsonResponse(response, suggestions.toJson().dump(), 200);
+    } catch (const std::invalid_argument& e) {
+        // std::stoi reports non-numbers as invalid_argument too
+        sendErrorResponse(response, "BadRequest", e.what(), 400);
+    } catch (const std::out_of_range& e) {
+        sendErrorResponse(response, "BadRequest", "limit is out of range", 400);
+    }
+}
+
+void ProductController::handleSearch(const Poco::URI& uri,
+                                    Poco::Net::HTTPServerResponse& response) {
+    try {
+        std::string query;
+        int limit = services::ProductService::kDefaultSearchResults;
+        for (const auto& [key, value] : uri.getQueryParameters()) {
+            if (key == "q") {
+                query = value;
+            } else if (key == "limit") {
+                limit = std::stoi(value);
+            }
+        }
+        
+        auto results = service_->search(query, limit);
+        sendJsonResponse(response, results.toJson().dump(), 200);
+    } catch (const std::invalid_argument& e) {
+        sendErrorResponse(response, "BadRequest", e.what(), 400);
+    } catch (const std::out_of_range& e) {
+        sendErrorResponse(response, "BadRequest", "limit is out of range", 400);
+    }
+}
+
 void ProductController::handleCreate(Poco::Net::HTTPServerRequest& request,
                                     Poco::Net::HTTPServerResponse& response) {
     try {
@@ -7,12 +7,14 @@ ProductListDto::ProductListDto(const std::vector<ProductItemDto>& items,
                                int totalCount,
                                int page,
                                int pageSize,
-                               int totalPages)
+                               int totalPages,
+                               const std::optional<std::string>& nextCursor)
     : items_(items)
     , totalCount_(totalCount)
     , page_(page)
     , pageSize_(pageSize)
-    , totalPages_(totalPages) {
+    , totalPages_(totalPages)
+    , nextCursor_(nextCursor) {
     
     if (totalCount < 0) {
         throw std::invalid_argument("totalCount must be non-negative");
@@ -34,13 +36,17 @@ json ProductListDto::toJson() const {
         itemsArray.push_back(item.toJson());
     }
     
-    return json{
+    json j{
         {"items", itemsArray},
         {"totalCount", totalCount_},
         {"page", page_},
         {"pageSize", pageSize_},
         {"totalPages", totalPages_}
     };
+    if (nextCursor_) {
+        j["nextCursor"] = *nextCursor_;
+    }
+    return j;
 }
 
 }  // namespace product::dtos
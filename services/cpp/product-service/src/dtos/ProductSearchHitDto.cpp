@@ -0,0 +1,22 @@
+#include "product/dtos/ProductSearchHitDto.hpp"
+#include <stdexcept>
+
+namespace product::dtos {
+
+ProductSearchHitDto::ProductSearchHitDto(const ProductItemDto& product, double score)
+    : product_(product)
+    , score_(score) {
+    
+    if (score_ < 0) {
+        throw std::invalid_argument("score must be non-negative");
+    }
+}
+
+json ProductSearchHitDto::toJson() const {
+    return json{
+        {"product", product_.toJson()},
+        {"score", score_}
+    };
+}
+
+}  // namespace product::dtos
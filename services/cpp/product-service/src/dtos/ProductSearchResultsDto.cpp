@@ -0,0 +1,28 @@
+#include "product/dtos/ProductSearchResultsDto.hpp"
+#include <stdexcept>
+
+namespace product::dtos {
+
+ProductSearchResultsDto::ProductSearchResultsDto(const std::string& query,
+                                                 const std::vector<ProductSearchHitDto>& items)
+    : query_(query)
+    , items_(items) {
+    
+    if (query_.empty()) {
+        throw std::invalid_argument("query cannot be empty");
+    }
+}
+
+json ProductSearchResultsDto::toJson() const {
+    json itemsArray = json::array();
+    for (const auto& item : items_) {
+        itemsArray.push_back(item.toJson());
+    }
+    
+    return json{
+        {"query", query_},
+        {"items", itemsArray}
+    };
+}
+
+}  // namespace product::dtos
@@ -0,0 +1,28 @@
+#include "product/dtos/ProductSuggestionsDto.hpp"
+#include <stdexcept>
+
+namespace product::dtos {
+
+ProductSuggestionsDto::ProductSuggestionsDto(const std::string& prefix,
+                                             const std::vector<ProductItemDto>& items)
+    : prefix_(prefix)
+    , items_(items) {
+    
+    if (prefix_.empty()) {
+        throw std::invalid_argument("prefix cannot be empty");
+    }
+}
+
+json ProductSuggestionsDto::toJson() const {
+    json itemsArray = json::array();
+    for (const auto& item : items_) {
+        itemsArray.push_back(item.toJson());
+    }
+    
+    return json{
+        {"prefix", prefix_},
+        {"items", itemsArray}
+    };
+}
+
+}  // namespace product::dtos
@@ -0,0 +1,83 @@
+#include "product/repositories/ProductOutboxRepository.hpp"
+#include <stdexcept>
+
+using namespace std::string_literals;
+
+namespace product::repositories {
+
+ProductOutboxRepository::ProductOutboxRepository(std::shared_ptr<pqxx::connection> db)
+    : db_(db) {
+    if (!db_) {
+        throw std::invalid_argument("Database connection cannot be null");
+    }
+}
+
+std::size_t ProductOutboxRepository::drain(std::size_t limit, const Handler& handler) {
+    bool publishing = false;
+    try {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pqxx::work txn(*db_);
+        auto result = txn.exec_params(
+            "SELECT id, event_id, event_type, product_id, product_version, "
+            "to_char(created_at, 'YYYY-MM-DD\"T\"HH24:MI:SS.MS\"Z\"') AS created_at, payload "
+            "FROM product_outbox WHERE published_at IS NULL "
+            "ORDER BY id LIMIT $1 FOR UPDATE SKIP LOCKED",
+            static_cast<long long>(limit)
+        );
+        if (result.empty()) {
+            return 0;
+        }
+        
+        std::vector<OutboxEvent> events;
+        events.reserve(result.size());
+        std::vector<std::int64_t> ids;
+        ids.reserve(result.size());
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            const auto& row = result[i];
+            events.push_back(OutboxEvent{
+                row["id"].as<std::int64_t>(),
+                row["event_id"].as<std::string>(),
+                row["event_type"].as<std::string>(),
+                row["product_id"].as<std::string>(),
+                row["product_version"].as<std::int64_t>(),
+                row["created_at"].as<std::string>(),
+                nlohmann::json::parse(row["payload"].c_str())
+            });
+            ids.push_back(events.back().sequence);
+        }
+        
+        // Rows stay locked while handler publishes; a throw rolls back and leaves them queued
+        publishing = true;
+        handler(events);
+        publishing = false;
+        
+        txn.exec_params(
+            "UPDATE product_outbox SET published_at = CURRENT_TIMESTAMP WHERE id = ANY($1::bigint[])",
+            ids
+        );
+        txn.commit();
+        return events.size();
+    } catch (const std::exception& e) {
+        if (publishing) {
+            throw;   // the handler's own failure, not the database's
+        }
+        throw std::runtime_error("Database error draining product outbox: "s + e.what());
+    }
+}
+
+std::size_t ProductOutboxRepository::purgePublished(std::chrono::hours retention) {
+    try {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pqxx::work txn(*db_);
+        auto result = txn.exec_params(
+            "DELETE FROM product_outbox WHERE published_at < CURRENT_TIMESTAMP - make_interval(hours => $1)",
+            static_cast<int>(retention.count())
+        );
+        txn.commit();
+        return result.affected_rows();
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Database error purging product outbox: "s + e.what());
+    }
+}
+
+}  // namespace product::repositories
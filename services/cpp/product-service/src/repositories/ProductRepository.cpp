@@ -1,4 +1,5 @@
 #include "product/repositories/ProductRepository.hpp"
+#include <algorithm>
 #include <stdexcept>
 
 using namespace std::string_literals;
@@ -14,6 +15,7 @@ ProductRepository::ProductRepository(std::shared_ptr<pqxx::connection> db)
 
 std::optional<models::Product> ProductRepository::findById(const std::string& id) {
     try {
+        std::lock_guard<std::mutex> lock(mutex_);
         pqxx::work txn(*db_);
         auto result = txn.exec_params(
             "SELECT id, sku, name, description, category, status FROM products WHERE id = $1",
@@ -33,6 +35,7 @@ std::optional<models::Product> ProductRepository::findById(const std::string& id
 
 std::optional<models::Product> ProductRepository::findBySku(const std::string& sku) {
     try {
+        std::lock_guard<std::mutex> lock(mutex_);
         pqxx::work txn(*db_);
         auto result = txn.exec_params(
             "SELECT id, sku, name, description, category, status FROM products WHERE sku = $1",
@@ -50,43 +53,49 @@ std::optional<models::Product> ProductRepository::findBySku(const std::string& s
     }
 }
 
-std::vector<models::Product> ProductRepository::findAll() {
+ProductPage ProductRepository::findPage(const ProductFilter& filter, int limit, long long offset,
+                                       const std::optional<std::string>& afterSku) {
     try {
-        pqxx::work txn(*db_);
-        auto result = txn.exec("SELECT id, sku, name, description, category, status FROM products ORDER BY sku");
-        txn.commit();
-        
-        std::vector<models::Product> products;
-        for (auto row : result) {
-            products.push_back(rowToProduct(row));
+        std::string sql = "SELECT id, sku, name, description, category, status FROM products WHERE TRUE";
+        pqxx::params params;
+        int placeholders = 0;
+        appendFilter(filter, sql, params, placeholders);
+        if (afterSku) {
+            sql += " AND sku > $" + std::to_string(++placeholders);
+            params.append(*afterSku);
+        }
+        // One row past the page tells whether another page follows
+        sql += " ORDER BY sku LIMIT $" + std::to_string(++placeholders);
+        params.append(limit + 1);
+        if (!afterSku && offset > 0) {
+            sql += " OFFSET $" + std::to_string(++placeholders);
+            params.append(offset);
         }
-        return products;
-    } catch (const std::exception& e) {
-        throw std::runtime_error("Database error finding products: "s + e.what());
-    }
-}
-
-std::vector<models::Product> ProductRepository::findActive() {
-    try {
-        pqxx::work txn(*db_);
-        auto result = txn.exec("SELECT id, sku, name, description, category, status FROM products WHERE status = 'active' ORDER BY sku");
-        txn.commit();
         
-        std::vector<models::Product> products;
-        for (auto row : result) {
-            products.push_back(rowToProduct(row));
+        std::lock_guard<std::mutex> lock(mutex_);
+        pqxx::read_transaction txn(*db_);
+        auto result = txn.exec_params(sql, params);
+        
+        ProductPage page;
+        auto count = std::min(result.size(), static_cast<std::size_t>(limit));
+        page.products.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            page.products.push_back(rowToProduct(result[i]));
         }
-        return products;
+        page.hasMore = result.size() > count;
+        return page;
     } catch (const std::exception& e) {
-        throw std::runtime_error("Database error finding active products: "s + e.what());
+        throw std::runtime_error("Database error finding products: "s + e.what());
     }
 }
 
 models::Product ProductRepository::create(const models::Product& product) {
     try {
+        std::lock_guard<std::mutex> lock(mutex_);
         pqxx::work txn(*db_);
-        txn.exec_params(
-            "INSERT INTO products (id, sku, name, description, category, status) VALUES ($1, $2, $3, $4, $5, $6)",
+        auto result = txn.exec_params(
+            "INSERT INTO products (id, sku, name, description, category, status) VALUES ($1, $2, $3, $4, $5, $6) "
+            "RETURNING version",
             product.getId(),
             product.getSku(),
             product.getName(),
@@ -100,6 +109,7 @@ models::Product ProductRepository::create(const models::Product& product) {
                 }
             }()
         );
+        enqueueEvent(txn, "ProductCreated", product, result[0][0].as<std::int64_t>());
         txn.commit();
         return product;
     } catch (const std::exception& e) {
@@ -109,9 +119,11 @@ models::Product ProductRepository::create(const models::Product& product) {
 
 models::Product ProductRepository::update(const models::Product& product) {
     try {
+        std::lock_guard<std::mutex> lock(mutex_);
         pqxx::work txn(*db_);
-        txn.exec_params(
-            "UPDATE products SET name = $2, description = $3, category = $4, status = $5 WHERE id = $1",
+        auto result = txn.exec_params(
+            "UPDATE products SET name = $2, description = $3, category = $4, status = $5 WHERE id = $1 "
+            "RETURNING version",
             product.getId(),
             product.getName(),
             product.getDescription().value_or(nullptr),
@@ -124,6 +136,9 @@ models::Product ProductRepository::update(const models::Product& product) {
                 }
             }()
         );
+        if (!result.empty()) {
+            enqueueEvent(txn, "ProductUpdated", product, result[0][0].as<std::int64_t>());
+        }
         txn.commit();
         return product;
     } catch (const std::exception& e) {
@@ -133,15 +148,100 @@ models::Product ProductRepository::update(const models::Product& product) {
 
 bool ProductRepository::deleteById(const std::string& id) {
     try {
+        std::lock_guard<std::mutex> lock(mutex_);
         pqxx::work txn(*db_);
-        auto result = txn.exec_params("DELETE FROM products WHERE id = $1", id);
+        auto result = txn.exec_params(
+            "DELETE FROM products WHERE id = $1 "
+            "RETURNING id, sku, name, description, category, status, version",
+            id
+        );
+        if (result.empty()) {
+            return false;
+        }
+        // The deletion supersedes the last version consumers saw
+        enqueueEvent(txn, "ProductDeleted", rowToProduct(result[0]),
+                     result[0]["version"].as<std::int64_t>() + 1);
         txn.commit();
-        return result.affected_rows() > 0;
+        return true;
     } catch (const std::exception& e) {
         throw std::runtime_error("Database error deleting product: "s + e.what());
     }
 }
 
+ProductChanges ProductRepository::findChangedSince(const std::optional<std::string>& watermark) {
+    try {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pqxx::work txn(*db_);
+        auto result = txn.exec_params(
+            "SELECT id, sku, name, description, category, status, "
+            "to_char(updated_at, 'YYYY-MM-DD\"T\"HH24:MI:SS.US') AS updated_at "
+            "FROM products WHERE $1::timestamp IS NULL "
+            "OR updated_at >= $1::timestamp - make_interval(secs => $2)",
+            watermark,
+            kWatermarkOverlapSeconds
+        );
+        txn.commit();
+        
+        ProductChanges changes;
+        changes.products.reserve(result.size());
+        for (auto row : result) {
+            changes.products.push_back(rowToProduct(row));
+            if (!row["updated_at"].is_null()) {
+                // Fixed-width text, so string order is time order
+                auto updatedAt = row["updated_at"].as<std::string>();
+                if (!changes.watermark || updatedAt > *changes.watermark) {
+                    changes.watermark = updatedAt;
+                }
+            }
+        }
+        return changes;
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Database error finding changed products: "s + e.what());
+    }
+}
+
+std::size_t ProductRepository::count(const ProductFilter& filter) {
+    try {
+        std::string sql = "SELECT count(*) FROM products WHERE TRUE";
+        pqxx::params params;
+        int placeholders = 0;
+        appendFilter(filter, sql, params, placeholders);
+        
+        std::lock_guard<std::mutex> lock(mutex_);
+        pqxx::read_transaction txn(*db_);
+        auto result = txn.exec_params(sql, params);
+        return result[0][0].as<std::size_t>();
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Database error counting products: "s + e.what());
+    }
+}
+
+void ProductRepository::enqueueEvent(pqxx::work& txn, const std::string& eventType,
+                                     const models::Product& product, std::int64_t version) {
+    auto payload = product.toJson();
+    payload["version"] = version;
+    txn.exec_params(
+        "INSERT INTO product_outbox (event_type, product_id, product_version, payload) "
+        "VALUES ($1, $2::uuid, $3, $4::jsonb)",
+        eventType,
+        product.getId(),
+        version,
+        payload.dump()
+    );
+}
+
+void ProductRepository::appendFilter(const ProductFilter& filter, std::string& sql, pqxx::params& params,
+                                     int& placeholders) {
+    if (filter.category) {
+        sql += " AND category = $" + std::to_string(++placeholders);
+        params.append(*filter.category);
+    }
+    if (filter.status) {
+        sql += " AND status = $" + std::to_string(++placeholders);
+        params.append(*filter.status);
+    }
+}
+
 models::Product ProductRepository::rowToProduct(const pqxx::row& row) {
     std::string statusStr = row["status"].as<std::string>();
     models::Product::Status status;
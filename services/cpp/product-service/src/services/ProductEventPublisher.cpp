@@ -0,0 +1,131 @@
+#include "product/services/ProductEventPublisher.hpp"
+#include "product/utils/Logger.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace product::services {
+
+ProductEventPublisher::ProductEventPublisher(std::shared_ptr<repositories::ProductOutbox> outbox,
+                                             std::shared_ptr<utils::MessageBus> bus,
+                                             Options options)
+    : outbox_(std::move(outbox))
+    , bus_(std::move(bus))
+    , options_(options) {
+    if (!outbox_) {
+        throw std::invalid_argument("Outbox cannot be null");
+    }
+    if (!bus_) {
+        throw std::invalid_argument("Message bus cannot be null");
+    }
+    if (options_.batchSize == 0) {
+        throw std::invalid_argument("Event batch size must be at least 1");
+    }
+}
+
+ProductEventPublisher::~ProductEventPublisher() {
+    stop();
+}
+
+std::size_t ProductEventPublisher::publishPending() {
+    std::size_t total = 0;
+    while (true) {
+        auto published = outbox_->drain(options_.batchSize, [this](const auto& events) {
+            publishBatch(events);
+        });
+        total += published;
+        if (published < options_.batchSize) {
+            return total;
+        }
+    }
+}
+
+void ProductEventPublisher::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    worker_ = std::thread(&ProductEventPublisher::run, this);
+}
+
+void ProductEventPublisher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    wakeup_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void ProductEventPublisher::wake() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        woken_ = true;
+    }
+    wakeup_.notify_all();
+}
+
+nlohmann::json ProductEventPublisher::toMessage(const repositories::OutboxEvent& event) {
+    return nlohmann::json{
+        {"eventId", event.eventId},
+        {"eventType", event.eventType},
+        {"eventVersion", "1.0"},
+        {"timestamp", event.createdAt},
+        {"correlationId", event.eventId},   // product changes start their own chains
+        {"source", "product-service"},
+        {"data", event.data}
+    };
+}
+
+std::string ProductEventPublisher::routingKeyFor(const std::string& eventType) {
+    if (eventType == "ProductCreated") return "created";
+    if (eventType == "ProductUpdated") return "updated";
+    if (eventType == "ProductDeleted") return "deleted";
+    throw std::invalid_argument("Unknown product event type: " + eventType);
+}
+
+void ProductEventPublisher::publishBatch(const std::vector<repositories::OutboxEvent>& events) {
+    // One publishBatch per run of equal types keeps the outbox order on the wire
+    std::size_t start = 0;
+    while (start < events.size()) {
+        auto end = start;
+        std::vector<nlohmann::json> messages;
+        while (end < events.size() && events[end].eventType == events[start].eventType) {
+            messages.push_back(toMessage(events[end]));
+            ++end;
+        }
+        bus_->publishBatch(routingKeyFor(events[start].eventType), messages);
+        start = end;
+    }
+}
+
+void ProductEventPublisher::run() {
+    auto lastPurge = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        woken_ = false;
+        lock.unlock();
+        try {
+            auto published = publishPending();
+            if (published > 0) {
+                if (auto logger = utils::Logger::getLogger()) {
+                    logger->debug("Published {} product events", published);
+                }
+            }
+            if (std::chrono::steady_clock::now() - lastPurge >= std::chrono::hours(1)) {
+                lastPurge = std::chrono::steady_clock::now();
+                outbox_->purgePublished(options_.retention);
+            }
+        } catch (const std::exception& e) {
+            if (auto logger = utils::Logger::getLogger()) {
+                logger->warn("Publishing product events failed, will retry: {}", e.what());
+            }
+        }
+        lock.lock();
+        wakeup_.wait_for(lock, options_.interval, [this] { return !running_ || woken_; });
+    }
+}
+
+}  // namespace product::services
@@ -1,20 +1,27 @@
 #include "product/services/ProductService.hpp"
 #include "product/utils/DtoMapper.hpp"
+#include "product/utils/Logger.hpp"
+#include <algorithm>
+#include <cctype>
 #include <stdexcept>
 #include <uuid/uuid.h>
 #include <cstring>
 
 namespace product::services {
 
-ProductService::ProductService(std::shared_ptr<repositories::ProductRepository> repository)
-    : repository_(repository) {
+ProductService::ProductService(std::shared_ptr<repositories::ProductRepository> repository,
+                               std::shared_ptr<utils::ProductCatalogue> catalogue,
+                               std::shared_ptr<ProductEventPublisher> events)
+    : repository_(repository)
+    , catalogue_(std::move(catalogue))
+    , events_(std::move(events)) {
     if (!repository_) {
         throw std::invalid_argument("Repository cannot be null");
     }
 }
 
 std::optional<dtos::ProductItemDto> ProductService::getById(const std::string& id) {
-    auto product = repository_->findById(id);
+    auto product = catalogue_ ? catalogue_->findById(id) : repository_->findById(id);
     if (!product) {
         return std::nullopt;
     }
@@ -23,7 +30,7 @@ std::optional<dtos::ProductItemDto> ProductService::getById(const std::string& i
 }
 
 std::optional<dtos::ProductItemDto> ProductService::getBySku(const std::string& sku) {
-    auto product = repository_->findBySku(sku);
+    auto product = catalogue_ ? catalogue_->findBySku(sku) : repository_->findBySku(sku);
     if (!product) {
         return std::nullopt;
     }
@@ -31,36 +38,47 @@ std::optional<dtos::ProductItemDto> ProductService::getBySku(const std::string&
     return utils::DtoMapper::toProductItemDto(*product);
 }
 
-dtos::ProductListDto ProductService::getAll(int page, int pageSize) {
-    auto products = repository_->findAll();
-    
-    std::vector<dtos::ProductItemDto> dtos;
-    dtos.reserve(products.size());
-    
-    for (const auto& product : products) {
-        dtos.push_back(utils::DtoMapper::toProductItemDto(product));
+dtos::ProductListDto ProductService::getAll(int page, int pageSize,
+                                            const repositories::ProductFilter& filter,
+                                            const std::optional<std::string>& cursor) {
+    if (page < 1) {
+        throw std::invalid_argument("page must be at least 1");
+    }
+    if (pageSize < 1 || pageSize > kMaxPageSize) {
+        throw std::invalid_argument("pageSize must be between 1 and " + std::to_string(kMaxPageSize));
+    }
+    if (filter.status && *filter.status != "active" && *filter.status != "inactive" &&
+        *filter.status != "discontinued") {
+        throw std::invalid_argument("Invalid product status: " + *filter.status);
+    }
+    if (cursor && cursor->empty()) {
+        throw std::invalid_argument("cursor cannot be empty");
     }
     
-    int totalCount = dtos.size();
-    int totalPages = (totalCount + pageSize - 1) / pageSize;
-    
-    return dtos::ProductListDto(dtos, totalCount, page, pageSize, totalPages);
-}
-
-dtos::ProductListDto ProductService::getActive(int page, int pageSize) {
-    auto products = repository_->findActive();
+    auto offset = static_cast<long long>(page - 1) * pageSize;
+    auto slice = repository_->findPage(filter, pageSize, offset, cursor);
     
     std::vector<dtos::ProductItemDto> dtos;
-    dtos.reserve(products.size());
-    
-    for (const auto& product : products) {
+    dtos.reserve(slice.products.size());
+    for (const auto& product : slice.products) {
         dtos.push_back(utils::DtoMapper::toProductItemDto(product));
     }
     
-    int totalCount = dtos.size();
-    int totalPages = (totalCount + pageSize - 1) / pageSize;
+    std::optional<std::string> nextCursor;
+    if (slice.hasMore && !slice.products.empty()) {
+        nextCursor = slice.products.back().getSku();
+    }
+    
+    auto count = static_cast<int>(totalCount(filter));
+    int totalPages = (count + pageSize - 1) / pageSize;
     
-    return dtos::ProductListDto(dtos, totalCount, page, pageSize, totalPages);
+    return dtos::ProductListDto(dtos, count, page, pageSize, totalPages, nextCursor);
+}
+
+dtos::ProductListDto ProductService::getActive(int page, int pageSize,
+                                               const std::optional<std::string>& category,
+                                               const std::optional<std::string>& cursor) {
+    return getAll(page, pageSize, repositories::ProductFilter{category, "active"}, cursor);
 }
 
 dtos::ProductItemDto ProductService::create(const std::string& sku,
@@ -83,6 +101,10 @@ dtos::ProductItemDto ProductService::create(const std::string& sku,
     );
     
     auto created = repository_->create(product);
+    afterWrite();
+    if (catalogue_) {
+        catalogue_->apply(created);
+    }
     return utils::DtoMapper::toProductItemDto(created);
 }
 
@@ -114,11 +136,147 @@ dtos::ProductItemDto ProductService::update(const std::string& id,
     existing->setStatus(statusEnum);
     
     auto updated = repository_->update(*existing);
+    afterWrite();
+    if (catalogue_) {
+        catalogue_->apply(updated);
+    }
     return utils::DtoMapper::toProductItemDto(updated);
 }
 
 bool ProductService::deleteById(const std::string& id) {
-    return repository_->deleteById(id);
+    bool deleted = repository_->deleteById(id);
+    if (deleted) {
+        afterWrite();
+    }
+    if (deleted && catalogue_) {
+        catalogue_->remove(id);
+    }
+    return deleted;
+}
+
+dtos::ProductSuggestionsDto ProductService::suggestBySku(const std::string& prefix, int limit) {
+    if (!catalogue_) {
+        throw std::runtime_error("Product catalogue is not configured");
+    }
+    if (limit < 1 || limit > kMaxSuggestions) {
+        throw std::invalid_argument("limit must be between 1 and " + std::to_string(kMaxSuggestions));
+    }
+    
+    std::string normalised = prefix;
+    std::transform(normalised.begin(), normalised.end(), normalised.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    bool valid = !normalised.empty() && normalised.size() <= 100 &&
+                 std::all_of(normalised.begin(), normalised.end(), [](char c) {
+                     return (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-';
+                 });
+    if (!valid) {
+        throw std::invalid_argument("prefix must be 1-100 characters of A-Z, 0-9 and '-'");
+    }
+    
+    std::vector<dtos::ProductItemDto> items;
+    for (const auto& product : catalogue_->completeSku(normalised, static_cast<std::size_t>(limit))) {
+        items.push_back(utils::DtoMapper::toProductItemDto(product));
+    }
+    return dtos::ProductSuggestionsDto(normalised, items);
+}
+
+dtos::ProductSearchResultsDto ProductService::search(const std::string& query, int limit) {
+    if (!catalogue_) {
+        throw std::runtime_error("Product catalogue is not configured");
+    }
+    if (limit < 1 || limit > kMaxSearchResults) {
+        throw std::invalid_argument("limit must be between 1 and " + std::to_string(kMaxSearchResults));
+    }
+    if (query.size() > kMaxQueryLength) {
+        throw std::invalid_argument("q must be at most " + std::to_string(kMaxQueryLength) + " characters");
+    }
+    if (utils::ProductSearchIndex::tokenize(query).empty()) {
+        throw std::invalid_argument("q must contain at least one letter or digit");
+    }
+    
+    std::vector<dtos::ProductSearchHitDto> items;
+    for (const auto& [product, score] : catalogue_->search(query, static_cast<std::size_t>(limit))) {
+        items.emplace_back(utils::DtoMapper::toProductItemDto(product), score);
+    }
+    return dtos::ProductSearchResultsDto(query, items);
+}
+
+void ProductService::loadCatalogue() {
+    if (!catalogue_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(refreshMutex_);
+    loadCatalogueLocked();
+}
+
+void ProductService::refreshCatalogue() {
+    if (!catalogue_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(refreshMutex_);
+    if (!catalogueWatermark_) {
+        loadCatalogueLocked();
+        return;
+    }
+    
+    auto changes = repository_->findChangedSince(catalogueWatermark_);
+    for (const auto& product : changes.products) {
+        catalogue_->apply(product);
+    }
+    if (changes.watermark) {
+        catalogueWatermark_ = changes.watermark;
+    }
+    
+    if (repository_->count() != catalogue_->size()) {
+        if (auto logger = utils::Logger::getLogger()) {
+            logger->info("Product catalogue out of step with the table, reloading");
+        }
+        loadCatalogueLocked();
+    }
+}
+
+std::size_t ProductService::totalCount(const repositories::ProductFilter& filter) {
+    // Category values are free text, so length-prefix them to keep keys distinct
+    std::string key = filter.status.value_or("*") + "|";
+    if (filter.category) {
+        key += std::to_string(filter.category->size()) + ":" + *filter.category;
+    }
+    
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(countMutex_);
+        auto it = countCache_.find(key);
+        if (it != countCache_.end() && now - it->second.at < kCountCacheTtl) {
+            return it->second.count;
+        }
+    }
+    
+    // Counted outside the lock; two callers racing both count, which is harmless
+    auto count = repository_->count(filter);
+    std::lock_guard<std::mutex> lock(countMutex_);
+    countCache_[key] = CachedCount{count, now};
+    return count;
+}
+
+void ProductService::invalidateCounts() {
+    std::lock_guard<std::mutex> lock(countMutex_);
+    countCache_.clear();
+}
+
+void ProductService::afterWrite() {
+    invalidateCounts();
+    if (events_) {
+        events_->wake();
+    }
+}
+
+void ProductService::loadCatalogueLocked() {
+    auto everything = repository_->findChangedSince(std::nullopt);
+    catalogue_->load(everything.products);
+    catalogueWatermark_ = everything.watermark;
+    if (auto logger = utils::Logger::getLogger()) {
+        logger->info("Product catalogue loaded with {} products", everything.products.size());
+    }
 }
 
 }  // namespace product::services
@@ -0,0 +1,514 @@
+#include "product/utils/AdaptiveRadixTree.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace product::utils {
+
+namespace detail {
+
+using NodePtr = std::unique_ptr<ArtNode, ArtNodeDeleter>;
+
+enum class Kind : std::uint8_t { N4, N16, N48, N256 };
+
+struct ArtNode {
+    explicit ArtNode(Kind k) : kind(k) {}
+    virtual ~ArtNode() = default;
+
+    Kind kind;
+    std::uint16_t count = 0;              // children
+    std::string prefix;                   // compressed path below the edge byte leading here
+    std::optional<std::string> value;     // for the key that ends at this node
+};
+
+void ArtNodeDeleter::operator()(ArtNode* node) const {
+    delete node;
+}
+
+// Sorted keys with children in the same slots
+template <Kind K, std::size_t N>
+struct SortedNode : ArtNode {
+    SortedNode() : ArtNode(K) {}
+    std::array<std::uint8_t, N> keys{};
+    std::array<NodePtr, N> children;
+
+    std::size_t lowerBound(std::uint8_t byte) const {
+        return static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.begin() + count, byte) - keys.begin());
+    }
+};
+
+using Node4 = SortedNode<Kind::N4, 4>;
+using Node16 = SortedNode<Kind::N16, 16>;
+
+struct Node48 : ArtNode {
+    Node48() : ArtNode(Kind::N48) {}
+    std::array<std::uint8_t, 256> index{};   // slot + 1, 0 when absent
+    std::array<NodePtr, 48> children;
+};
+
+struct Node256 : ArtNode {
+    Node256() : ArtNode(Kind::N256) {}
+    std::array<NodePtr, 256> children;
+};
+
+// Below these counts a node moves down to the next smaller layout; the gap
+// to each layout's capacity keeps an add/remove pair from flapping
+constexpr std::uint16_t kShrink16 = 3;
+constexpr std::uint16_t kShrink48 = 12;
+constexpr std::uint16_t kShrink256 = 36;
+
+template <typename T>
+T& as(ArtNode& node) {
+    return static_cast<T&>(node);
+}
+
+template <typename T>
+const T& as(const ArtNode& node) {
+    return static_cast<const T&>(node);
+}
+
+NodePtr makeLeaf(const std::string& key, std::size_t depth, const std::string& value) {
+    NodePtr leaf(new Node4());
+    leaf->prefix = key.substr(depth);
+    leaf->value = value;
+    return leaf;
+}
+
+void moveHeader(ArtNode& from, ArtNode& to) {
+    to.count = from.count;
+    to.prefix = std::move(from.prefix);
+    to.value = std::move(from.value);
+}
+
+template <typename Sorted>
+NodePtr* findSorted(Sorted& node, std::uint8_t byte) {
+    auto i = node.lowerBound(byte);
+    return i < node.count && node.keys[i] == byte ? &node.children[i] : nullptr;
+}
+
+NodePtr* findChild(ArtNode& node, std::uint8_t byte) {
+    switch (node.kind) {
+        case Kind::N4:
+            return findSorted(as<Node4>(node), byte);
+        case Kind::N16:
+            return findSorted(as<Node16>(node), byte);
+        case Kind::N48: {
+            auto& n = as<Node48>(node);
+            return n.index[byte] ? &n.children[n.index[byte] - 1] : nullptr;
+        }
+        case Kind::N256: {
+            auto& child = as<Node256>(node).children[byte];
+            return child ? &child : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+const ArtNode* findChild(const ArtNode& node, std::uint8_t byte) {
+    auto* child = findChild(const_cast<ArtNode&>(node), byte);
+    return child ? child->get() : nullptr;
+}
+
+// f(byte, child) in byte order; stops when f returns false
+template <typename F>
+bool forEachChild(const ArtNode& node, F&& f) {
+    switch (node.kind) {
+        case Kind::N4: {
+            const auto& n = as<Node4>(node);
+            for (std::size_t i = 0; i < n.count; ++i) {
+                if (!f(n.keys[i], *n.children[i])) return false;
+            }
+            break;
+        }
+        case Kind::N16: {
+            const auto& n = as<Node16>(node);
+            for (std::size_t i = 0; i < n.count; ++i) {
+                if (!f(n.keys[i], *n.children[i])) return false;
+            }
+            break;
+        }
+        case Kind::N48: {
+            const auto& n = as<Node48>(node);
+            for (std::size_t b = 0; b < 256; ++b) {
+                if (n.index[b] && !f(static_cast<std::uint8_t>(b), *n.children[n.index[b] - 1])) return false;
+            }
+            break;
+        }
+        case Kind::N256: {
+            const auto& n = as<Node256>(node);
+            for (std::size_t b = 0; b < 256; ++b) {
+                if (n.children[b] && !f(static_cast<std::uint8_t>(b), *n.children[b])) return false;
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+template <typename Sorted>
+void insertSorted(Sorted& node, std::uint8_t byte, NodePtr child) {
+    auto i = node.lowerBound(byte);
+    for (std::size_t j = node.count; j > i; --j) {
+        node.keys[j] = node.keys[j - 1];
+        node.children[j] = std::move(node.children[j - 1]);
+    }
+    node.keys[i] = byte;
+    node.children[i] = std::move(child);
+    ++node.count;
+}
+
+// Replace ref with the next larger layout, children and header moved across
+void grow(NodePtr& ref) {
+    switch (ref->kind) {
+        case Kind::N4: {
+            auto& from = as<Node4>(*ref);
+            auto* to = new Node16();
+            for (std::size_t i = 0; i < from.count; ++i) {
+                to->keys[i] = from.keys[i];
+                to->children[i] = std::move(from.children[i]);
+            }
+            moveHeader(from, *to);
+            ref.reset(to);
+            break;
+        }
+        case Kind::N16: {
+            auto& from = as<Node16>(*ref);
+            auto* to = new Node48();
+            for (std::size_t i = 0; i < from.count; ++i) {
+                to->index[from.keys[i]] = static_cast<std::uint8_t>(i + 1);
+                to->children[i] = std::move(from.children[i]);
+            }
+            moveHeader(from, *to);
+            ref.reset(to);
+            break;
+        }
+        case Kind::N48: {
+            auto& from = as<Node48>(*ref);
+            auto* to = new Node256();
+            for (std::size_t b = 0; b < 256; ++b) {
+                if (from.index[b]) {
+                    to->children[b] = std::move(from.children[from.index[b] - 1]);
+                }
+            }
+            moveHeader(from, *to);
+            ref.reset(to);
+            break;
+        }
+        case Kind::N256:
+            break;
+    }
+}
+
+bool isFull(const ArtNode& node) {
+    switch (node.kind) {
+        case Kind::N4: return node.count == 4;
+        case Kind::N16: return node.count == 16;
+        case Kind::N48: return node.count == 48;
+        case Kind::N256: return false;
+    }
+    return false;
+}
+
+void addChild(NodePtr& ref, std::uint8_t byte, NodePtr child) {
+    if (isFull(*ref)) {
+        grow(ref);
+    }
+    switch (ref->kind) {
+        case Kind::N4:
+            insertSorted(as<Node4>(*ref), byte, std::move(child));
+            break;
+        case Kind::N16:
+            insertSorted(as<Node16>(*ref), byte, std::move(child));
+            break;
+        case Kind::N48: {
+            auto& n = as<Node48>(*ref);
+            std::size_t slot = 0;
+            while (n.children[slot]) {
+                ++slot;
+            }
+            n.children[slot] = std::move(child);
+            n.index[byte] = static_cast<std::uint8_t>(slot + 1);
+            ++n.count;
+            break;
+        }
+        case Kind::N256:
+            as<Node256>(*ref).children[byte] = std::move(child);
+            ++ref->count;
+            break;
+    }
+}
+
+template <typename Sorted>
+void removeSorted(Sorted& node, std::uint8_t byte) {
+    auto i = node.lowerBound(byte);
+    for (std::size_t j = i + 1; j < node.count; ++j) {
+        node.keys[j - 1] = node.keys[j];
+        node.children[j - 1] = std::move(node.children[j]);
+    }
+    --node.count;
+    node.children[node.count].reset();
+}
+
+// Replace ref with the next smaller layout once it is sparse enough
+void shrink(NodePtr& ref) {
+    switch (ref->kind) {
+        case Kind::N4:
+            break;
+        case Kind::N16: {
+            if (ref->count > kShrink16) break;
+            auto& from = as<Node16>(*ref);
+            auto* to = new Node4();
+            for (std::size_t i = 0; i < from.count; ++i) {
+                to->keys[i] = from.keys[i];
+                to->children[i] = std::move(from.children[i]);
+            }
+            moveHeader(from, *to);
+            ref.reset(to);
+            break;
+        }
+        case Kind::N48: {
+            if (ref->count > kShrink48) break;
+            auto& from = as<Node48>(*ref);
+            auto* to = new Node16();
+            std::size_t i = 0;
+            for (std::size_t b = 0; b < 256; ++b) {
+                if (from.index[b]) {
+                    to->keys[i] = static_cast<std::uint8_t>(b);
+                    to->children[i++] = std::move(from.children[from.index[b] - 1]);
+                }
+            }
+            moveHeader(from, *to);
+            ref.reset(to);
+            break;
+        }
+        case Kind::N256: {
+            if (ref->count > kShrink256) break;
+            auto& from = as<Node256>(*ref);
+            auto* to = new Node48();
+            std::size_t slot = 0;
+            for (std::size_t b = 0; b < 256; ++b) {
+                if (from.children[b]) {
+                    to->index[b] = static_cast<std::uint8_t>(slot + 1);
+                    to->children[slot++] = std::move(from.children[b]);
+                }
+            }
+            moveHeader(from, *to);
+            ref.reset(to);
+            break;
+        }
+    }
+}
+
+void removeChild(NodePtr& ref, std::uint8_t byte) {
+    switch (ref->kind) {
+        case Kind::N4:
+            removeSorted(as<Node4>(*ref), byte);
+            break;
+        case Kind::N16:
+            removeSorted(as<Node16>(*ref), byte);
+            break;
+        case Kind::N48: {
+            auto& n = as<Node48>(*ref);
+            n.children[n.index[byte] - 1].reset();
+            n.index[byte] = 0;
+            --n.count;
+            break;
+        }
+        case Kind::N256:
+            as<Node256>(*ref).children[byte].reset();
+            --ref->count;
+            break;
+    }
+    shrink(ref);
+}
+
+// Drop a node that no longer holds anything, and fold a lone child into a
+// node without a value so the path stays compressed
+void compact(NodePtr& ref) {
+    if (ref->value) {
+        return;
+    }
+    if (ref->count == 0) {
+        ref.reset();
+        return;
+    }
+    if (ref->count == 1) {
+        std::uint8_t byte = 0;
+        forEachChild(*ref, [&](std::uint8_t b, const ArtNode&) {
+            byte = b;
+            return false;
+        });
+        NodePtr child = std::move(*findChild(*ref, byte));
+        child->prefix = ref->prefix + static_cast<char>(byte) + child->prefix;
+        ref = std::move(child);
+    }
+}
+
+std::size_t matchPrefix(const std::string& prefix, const std::string& key, std::size_t depth) {
+    std::size_t i = 0;
+    while (i < prefix.size() && depth + i < key.size() && prefix[i] == key[depth + i]) {
+        ++i;
+    }
+    return i;
+}
+
+bool insertAt(NodePtr& ref, const std::string& key, std::size_t depth, const std::string& value) {
+    if (!ref) {
+        ref = makeLeaf(key, depth, value);
+        return true;
+    }
+
+    auto matched = matchPrefix(ref->prefix, key, depth);
+    if (matched < ref->prefix.size()) {
+        // The key leaves the compressed path part-way: split it there
+        NodePtr split(new Node4());
+        split->prefix = ref->prefix.substr(0, matched);
+        auto edge = static_cast<std::uint8_t>(ref->prefix[matched]);
+        ref->prefix.erase(0, matched + 1);
+        NodePtr old = std::move(ref);
+        ref = std::move(split);
+        addChild(ref, edge, std::move(old));
+
+        depth += matched;
+        if (depth == key.size()) {
+            ref->value = value;
+        } else {
+            addChild(ref, static_cast<std::uint8_t>(key[depth]), makeLeaf(key, depth + 1, value));
+        }
+        return true;
+    }
+
+    depth += ref->prefix.size();
+    if (depth == key.size()) {
+        bool added = !ref->value;
+        ref->value = value;
+        return added;
+    }
+    auto byte = static_cast<std::uint8_t>(key[depth]);
+    if (auto* child = findChild(*ref, byte)) {
+        return insertAt(*child, key, depth + 1, value);
+    }
+    addChild(ref, byte, makeLeaf(key, depth + 1, value));
+    return true;
+}
+
+bool eraseAt(NodePtr& ref, const std::string& key, std::size_t depth) {
+    if (!ref || key.compare(depth, ref->prefix.size(), ref->prefix) != 0) {
+        return false;
+    }
+    depth += ref->prefix.size();
+    if (depth == key.size()) {
+        if (!ref->value) {
+            return false;
+        }
+        ref->value.reset();
+    } else {
+        auto byte = static_cast<std::uint8_t>(key[depth]);
+        auto* child = findChild(*ref, byte);
+        if (!child || !eraseAt(*child, key, depth + 1)) {
+            return false;
+        }
+        if (!*child) {
+            removeChild(ref, byte);
+        }
+    }
+    compact(ref);
+    return true;
+}
+
+// Appends the keys under node in order; false once limit is reached
+bool collect(const ArtNode& node, std::string& path, std::size_t limit,
+             std::vector<std::pair<std::string, std::string>>& out) {
+    if (node.value) {
+        out.emplace_back(path, *node.value);
+        if (out.size() >= limit) {
+            return false;
+        }
+    }
+    return forEachChild(node, [&](std::uint8_t byte, const ArtNode& child) {
+        auto length = path.size();
+        path.push_back(static_cast<char>(byte));
+        path += child.prefix;
+        bool more = collect(child, path, limit, out);
+        path.resize(length);
+        return more;
+    });
+}
+
+}  // namespace detail
+
+AdaptiveRadixTree::AdaptiveRadixTree() = default;
+AdaptiveRadixTree::~AdaptiveRadixTree() = default;
+AdaptiveRadixTree::AdaptiveRadixTree(AdaptiveRadixTree&& other) noexcept = default;
+AdaptiveRadixTree& AdaptiveRadixTree::operator=(AdaptiveRadixTree&& other) noexcept = default;
+
+bool AdaptiveRadixTree::insert(const std::string& key, const std::string& value) {
+    bool added = detail::insertAt(root_, key, 0, value);
+    if (added) {
+        ++size_;
+    }
+    return added;
+}
+
+bool AdaptiveRadixTree::erase(const std::string& key) {
+    bool erased = detail::eraseAt(root_, key, 0);
+    if (erased) {
+        --size_;
+    }
+    return erased;
+}
+
+std::optional<std::string> AdaptiveRadixTree::find(const std::string& key) const {
+    const detail::ArtNode* node = root_.get();
+    std::size_t depth = 0;
+    while (node) {
+        if (key.compare(depth, node->prefix.size(), node->prefix) != 0) {
+            return std::nullopt;
+        }
+        depth += node->prefix.size();
+        if (depth == key.size()) {
+            return node->value;
+        }
+        node = detail::findChild(*node, static_cast<std::uint8_t>(key[depth]));
+        ++depth;
+    }
+    return std::nullopt;
+}
+
+std::vector<std::pair<std::string, std::string>> AdaptiveRadixTree::withPrefix(const std::string& prefix,
+                                                                               std::size_t limit) const {
+    std::vector<std::pair<std::string, std::string>> out;
+    if (limit == 0) {
+        return out;
+    }
+
+    // Walk down until the prefix is used up, possibly part-way along a node's compressed path
+    const detail::ArtNode* node = root_.get();
+    std::size_t depth = 0;
+    std::string path;
+    while (node) {
+        auto remaining = prefix.size() - depth;
+        auto length = std::min(node->prefix.size(), remaining);
+        if (node->prefix.compare(0, length, prefix, depth, length) != 0) {
+            return out;
+        }
+        path += node->prefix;
+        if (node->prefix.size() >= remaining) {
+            detail::collect(*node, path, limit, out);
+            return out;
+        }
+        depth += node->prefix.size();
+        auto byte = static_cast<std::uint8_t>(prefix[depth]);
+        node = detail::findChild(*node, byte);
+        path.push_back(static_cast<char>(byte));
+        ++depth;
+    }
+    return out;
+}
+
+void AdaptiveRadixTree::clear() {
+    root_.reset();
+    size_ = 0;
+}
+
+}  // namespace product::utils
@@ -0,0 +1,103 @@
+#include "product/utils/ProductCatalogue.hpp"
+#include <mutex>
+
+namespace product::utils {
+
+void ProductCatalogue::load(const std::vector<models::Product>& products) {
+    std::unique_lock lock(mutex_);
+    byId_.clear();
+    idBySku_.clear();
+    skus_.clear();
+    text_.clear();
+    byId_.reserve(products.size());
+    idBySku_.reserve(products.size());
+    for (const auto& product : products) {
+        applyLocked(product);
+    }
+}
+
+void ProductCatalogue::apply(const models::Product& product) {
+    std::unique_lock lock(mutex_);
+    applyLocked(product);
+}
+
+void ProductCatalogue::remove(const std::string& id) {
+    std::unique_lock lock(mutex_);
+    removeLocked(id);
+}
+
+std::optional<models::Product> ProductCatalogue::findById(const std::string& id) const {
+    std::shared_lock lock(mutex_);
+    auto it = byId_.find(id);
+    if (it == byId_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<models::Product> ProductCatalogue::findBySku(const std::string& sku) const {
+    std::shared_lock lock(mutex_);
+    auto id = idBySku_.find(sku);
+    if (id == idBySku_.end()) {
+        return std::nullopt;
+    }
+    return byId_.at(id->second);
+}
+
+std::vector<models::Product> ProductCatalogue::completeSku(const std::string& prefix, std::size_t limit) const {
+    std::shared_lock lock(mutex_);
+    std::vector<models::Product> products;
+    for (const auto& [sku, id] : skus_.withPrefix(prefix, limit)) {
+        products.push_back(byId_.at(id));
+    }
+    return products;
+}
+
+std::vector<std::pair<models::Product, double>> ProductCatalogue::search(const std::string& query,
+                                                                       std::size_t limit) const {
+    std::shared_lock lock(mutex_);
+    std::vector<std::pair<models::Product, double>> results;
+    for (const auto& hit : text_.search(query, limit)) {
+        results.emplace_back(byId_.at(hit.id), hit.score);
+    }
+    return results;
+}
+
+std::size_t ProductCatalogue::size() const {
+    std::shared_lock lock(mutex_);
+    return byId_.size();
+}
+
+void ProductCatalogue::applyLocked(const models::Product& product) {
+    const auto id = product.getId();
+    const auto sku = product.getSku();
+
+    auto existing = byId_.find(id);
+    if (existing != byId_.end() && existing->second.getSku() != sku) {
+        idBySku_.erase(existing->second.getSku());
+        skus_.erase(existing->second.getSku());
+    }
+    auto holder = idBySku_.find(sku);
+    if (holder != idBySku_.end() && holder->second != id) {
+        removeLocked(holder->second);
+    }
+
+    byId_.insert_or_assign(id, product);
+    idBySku_.insert_or_assign(sku, id);
+    skus_.insert(sku, id);
+    text_.add(product);
+}
+
+void ProductCatalogue::removeLocked(const std::string& id) {
+    auto it = byId_.find(id);
+    if (it == byId_.end()) {
+        return;
+    }
+    // id may refer into idBySku_, so it is used before that entry goes
+    text_.remove(id);
+    idBySku_.erase(it->second.getSku());
+    skus_.erase(it->second.getSku());
+    byId_.erase(it);
+}
+
+}  // namespace product::utils
@@ -0,0 +1,294 @@
+#include "product/utils/ProductSearchIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace product::utils {
+
+namespace {
+
+// BM25 term-frequency saturation and length normalisation
+constexpr double kK1 = 1.2;
+constexpr double kB = 0.75;
+
+constexpr std::size_t kMinPrefixLength = 2;
+constexpr std::size_t kMinFuzzyLength = 3;
+constexpr std::size_t kMaxExpansions = 32;   // per query token, for each of prefix and fuzzy
+constexpr float kPrefixWeight = 0.7f;
+constexpr float kFuzzyWeight = 0.5f;         // scaled by similarity
+constexpr double kMinSimilarity = 0.5;       // Dice coefficient over trigrams
+
+// Distinct trigrams of the term padded with '$' at both ends
+std::vector<std::string> trigramsOf(const std::string& term) {
+    std::string padded = "$" + term + "$";
+    std::vector<std::string> grams;
+    for (std::size_t i = 0; i + 3 <= padded.size(); ++i) {
+        grams.push_back(padded.substr(i, 3));
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+// Per-thread buffers indexed by document slot, so concurrent searches don't
+// allocate or clear arrays the size of the catalogue
+struct Scratch {
+    std::vector<float> score;
+    std::vector<float> best;
+    std::vector<std::uint16_t> matched;
+    std::vector<std::uint32_t> touched;
+    std::vector<std::uint32_t> tokenTouched;
+
+    void fit(std::size_t docs) {
+        if (score.size() < docs) {
+            score.resize(docs, 0.0f);
+            best.resize(docs, 0.0f);
+            matched.resize(docs, 0);
+        }
+    }
+};
+
+}  // namespace
+
+std::vector<std::string> ProductSearchIndex::tokenize(const std::string& text) {
+    std::vector<std::string> tokens;
+    std::string current;
+    for (unsigned char c : text) {
+        if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c >= 0x80) {
+            current += static_cast<char>(c);
+        } else if (c >= 'A' && c <= 'Z') {
+            current += static_cast<char>(c - 'A' + 'a');
+        } else if (!current.empty()) {
+            tokens.push_back(std::move(current));
+            current.clear();
+        }
+    }
+    if (!current.empty()) {
+        tokens.push_back(std::move(current));
+    }
+    return tokens;
+}
+
+void ProductSearchIndex::add(const models::Product& product) {
+    remove(product.getId());
+
+    std::unordered_map<std::uint32_t, float> frequencies;
+    auto count = [&](const std::string& text, float weight) {
+        for (const auto& token : tokenize(text)) {
+            frequencies[termId(token)] += weight;
+        }
+    };
+    count(product.getName(), kNameWeight);
+    if (auto category = product.getCategory()) {
+        count(*category, kCategoryWeight);
+    }
+    if (auto description = product.getDescription()) {
+        count(*description, 1.0f);
+    }
+
+    std::uint32_t slot;
+    if (!freeDocs_.empty()) {
+        slot = freeDocs_.back();
+        freeDocs_.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(docs_.size());
+        docs_.emplace_back();
+        lengths_.push_back(0.0f);
+    }
+    auto& doc = docs_[slot];
+    doc.id = product.getId();
+    doc.terms.reserve(frequencies.size());
+
+    for (const auto& [id, frequency] : frequencies) {
+        auto& term = terms_[id];
+        if (term.postings.empty()) {
+            vocabulary_.insert(term.text, "");
+        }
+        auto at = std::lower_bound(term.postings.begin(), term.postings.end(), slot,
+                                   [](const Posting& p, std::uint32_t d) { return p.doc < d; });
+        term.postings.insert(at, Posting{slot, frequency});
+        doc.terms.push_back(id);
+        lengths_[slot] += frequency;
+    }
+    totalLength_ += lengths_[slot];
+    docIds_.emplace(doc.id, slot);
+}
+
+void ProductSearchIndex::remove(const std::string& id) {
+    auto it = docIds_.find(id);
+    if (it == docIds_.end()) {
+        return;
+    }
+    auto slot = it->second;
+    auto& doc = docs_[slot];
+    for (auto termId : doc.terms) {
+        auto& term = terms_[termId];
+        auto at = std::lower_bound(term.postings.begin(), term.postings.end(), slot,
+                                   [](const Posting& p, std::uint32_t d) { return p.doc < d; });
+        if (at != term.postings.end() && at->doc == slot) {
+            term.postings.erase(at);
+        }
+        if (term.postings.empty()) {
+            vocabulary_.erase(term.text);
+        }
+    }
+    totalLength_ -= lengths_[slot];
+    lengths_[slot] = 0.0f;
+    doc = Doc{};
+    freeDocs_.push_back(slot);
+    docIds_.erase(it);
+}
+
+void ProductSearchIndex::clear() {
+    docs_.clear();
+    lengths_.clear();
+    freeDocs_.clear();
+    docIds_.clear();
+    terms_.clear();
+    termIds_.clear();
+    vocabulary_.clear();
+    trigrams_.clear();
+    totalLength_ = 0;
+}
+
+std::vector<SearchHit> ProductSearchIndex::search(const std::string& query, std::size_t limit) const {
+    if (docIds_.empty() || limit == 0) {
+        return {};
+    }
+
+    auto tokens = tokenize(query);
+    std::vector<std::string> distinct;
+    for (auto& token : tokens) {
+        if (std::find(distinct.begin(), distinct.end(), token) == distinct.end()) {
+            distinct.push_back(std::move(token));
+        }
+        if (distinct.size() == kMaxQueryTokens) {
+            break;
+        }
+    }
+
+    thread_local Scratch scratch;
+    scratch.fit(docs_.size());
+    auto& score = scratch.score;
+    auto& best = scratch.best;
+    auto& matched = scratch.matched;
+    auto& touched = scratch.touched;
+    auto& tokenTouched = scratch.tokenTouched;
+
+    const double documents = static_cast<double>(docIds_.size());
+    const double averageLength = std::max(totalLength_ / documents, 1e-9);
+
+    for (const auto& token : distinct) {
+        // A product scores its best match per token, however many expansions hit it
+        for (const auto& [id, weight] : expand(token)) {
+            const auto& postings = terms_[id].postings;
+            const double df = static_cast<double>(postings.size());
+            const double idf = std::log(1.0 + (documents - df + 0.5) / (df + 0.5));
+            for (const auto& posting : postings) {
+                const double tf = posting.frequency;
+                const double norm = kK1 * (1.0 - kB + kB * lengths_[posting.doc] / averageLength);
+                auto s = static_cast<float>(weight * idf * tf * (kK1 + 1.0) / (tf + norm));
+                if (best[posting.doc] == 0.0f) {
+                    tokenTouched.push_back(posting.doc);
+                }
+                best[posting.doc] = std::max(best[posting.doc], s);
+            }
+        }
+        for (auto doc : tokenTouched) {
+            if (matched[doc] == 0) {
+                touched.push_back(doc);
+            }
+            ++matched[doc];
+            score[doc] += best[doc];
+            best[doc] = 0.0f;
+        }
+        tokenTouched.clear();
+    }
+
+    auto better = [&](std::uint32_t a, std::uint32_t b) {
+        if (matched[a] != matched[b]) return matched[a] > matched[b];
+        if (score[a] != score[b]) return score[a] > score[b];
+        return docs_[a].id < docs_[b].id;
+    };
+    auto count = std::min(limit, touched.size());
+    std::partial_sort(touched.begin(), touched.begin() + static_cast<std::ptrdiff_t>(count), touched.end(), better);
+
+    std::vector<SearchHit> hits;
+    hits.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        hits.push_back(SearchHit{docs_[touched[i]].id, score[touched[i]]});
+    }
+
+    for (auto doc : touched) {
+        score[doc] = 0.0f;
+        matched[doc] = 0;
+    }
+    touched.clear();
+    return hits;
+}
+
+std::uint32_t ProductSearchIndex::termId(const std::string& text) {
+    auto [it, inserted] = termIds_.try_emplace(text, static_cast<std::uint32_t>(terms_.size()));
+    if (inserted) {
+        auto grams = trigramsOf(text);
+        terms_.push_back(Term{text, {}, grams.size()});
+        for (const auto& gram : grams) {
+            trigrams_[gram].push_back(it->second);
+        }
+    }
+    return it->second;
+}
+
+std::vector<std::pair<std::uint32_t, float>> ProductSearchIndex::expand(const std::string& token) const {
+    std::vector<std::pair<std::uint32_t, float>> expansions;
+    std::unordered_set<std::uint32_t> seen;
+
+    auto exact = termIds_.find(token);
+    if (exact != termIds_.end() && !terms_[exact->second].postings.empty()) {
+        expansions.emplace_back(exact->second, 1.0f);
+        seen.insert(exact->second);
+    }
+
+    if (token.size() >= kMinPrefixLength) {
+        for (const auto& [text, unused] : vocabulary_.withPrefix(token, kMaxExpansions + 1)) {
+            auto id = termIds_.at(text);
+            if (seen.insert(id).second) {
+                expansions.emplace_back(id, kPrefixWeight);
+            }
+        }
+    }
+
+    if (token.size() >= kMinFuzzyLength) {
+        auto grams = trigramsOf(token);
+        std::unordered_map<std::uint32_t, int> shared;
+        for (const auto& gram : grams) {
+            auto it = trigrams_.find(gram);
+            if (it == trigrams_.end()) {
+                continue;
+            }
+            for (auto id : it->second) {
+                ++shared[id];
+            }
+        }
+
+        std::vector<std::pair<double, std::uint32_t>> similar;
+        for (const auto& [id, common] : shared) {
+            if (seen.count(id) || terms_[id].postings.empty()) {
+                continue;
+            }
+            double dice = 2.0 * common / static_cast<double>(grams.size() + terms_[id].trigrams);
+            if (dice >= kMinSimilarity) {
+                similar.emplace_back(dice, id);
+            }
+        }
+        auto keep = std::min(similar.size(), kMaxExpansions);
+        std::partial_sort(similar.begin(), similar.begin() + static_cast<std::ptrdiff_t>(keep), similar.end(),
+                          [](const auto& a, const auto& b) { return a.first > b.first; });
+        for (std::size_t i = 0; i < keep; ++i) {
+            expansions.emplace_back(similar[i].second, static_cast<float>(kFuzzyWeight * similar[i].first));
+        }
+    }
+    return expansions;
+}
+
+}  // namespace product::utils
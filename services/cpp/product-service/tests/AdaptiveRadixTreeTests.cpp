@@ -0,0 +1,106 @@
+#include <catch2/catch_all.hpp>
+#include "product/utils/AdaptiveRadixTree.hpp"
+#include <map>
+#include <random>
+
+using product::utils::AdaptiveRadixTree;
+
+namespace {
+
+std::vector<std::pair<std::string, std::string>> expectedWithPrefix(
+        const std::map<std::string, std::string>& reference, const std::string& prefix, std::size_t limit) {
+    std::vector<std::pair<std::string, std::string>> out;
+    for (auto it = reference.lower_bound(prefix); it != reference.end() && out.size() < limit; ++it) {
+        if (it->first.compare(0, prefix.size(), prefix) != 0) {
+            break;
+        }
+        out.push_back(*it);
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST_CASE("AdaptiveRadixTree finds keys, including keys that prefix others", "[art]") {
+    AdaptiveRadixTree tree;
+    REQUIRE(tree.insert("AB", "1"));
+    REQUIRE(tree.insert("ABC", "2"));
+    REQUIRE(tree.insert("ABD", "3"));
+    REQUIRE(tree.insert("A", "4"));
+    REQUIRE_FALSE(tree.insert("ABC", "5"));
+
+    REQUIRE(tree.size() == 4);
+    REQUIRE(tree.find("AB") == "1");
+    REQUIRE(tree.find("ABC") == "5");
+    REQUIRE(tree.find("A") == "4");
+    REQUIRE_FALSE(tree.find("ABE"));
+    REQUIRE_FALSE(tree.find("ABCD"));
+    REQUIRE_FALSE(tree.find(""));
+
+    SECTION("erasing an inner key keeps the longer ones") {
+        REQUIRE(tree.erase("AB"));
+        REQUIRE_FALSE(tree.erase("AB"));
+        REQUIRE_FALSE(tree.find("AB"));
+        REQUIRE(tree.find("ABD") == "3");
+        REQUIRE(tree.size() == 3);
+    }
+}
+
+TEST_CASE("AdaptiveRadixTree lists a prefix's keys in order", "[art]") {
+    AdaptiveRadixTree tree;
+    for (auto sku : {"WID-010", "WID-002", "BOLT-M6", "WID-001", "WIDGET", "WHEEL"}) {
+        tree.insert(sku, std::string("id-") + sku);
+    }
+
+    auto wid = tree.withPrefix("WID", 10);
+    REQUIRE(wid.size() == 4);
+    REQUIRE(wid[0].first == "WID-001");
+    REQUIRE(wid[1].first == "WID-002");
+    REQUIRE(wid[2].first == "WID-010");
+    REQUIRE(wid[3].first == "WIDGET");
+    REQUIRE(wid[3].second == "id-WIDGET");
+
+    REQUIRE(tree.withPrefix("WID-0", 2).size() == 2);
+    REQUIRE(tree.withPrefix("WIDGETS", 10).empty());
+    REQUIRE(tree.withPrefix("X", 10).empty());
+    REQUIRE(tree.withPrefix("", 100).size() == 6);
+    REQUIRE(tree.withPrefix("W", 0).empty());
+}
+
+TEST_CASE("AdaptiveRadixTree matches an ordered map through growth and shrinkage", "[art]") {
+    // Short keys over a wide alphabet push nodes through every layout and back
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> length(1, 4);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::map<std::string, std::string> reference;
+    AdaptiveRadixTree tree;
+
+    for (int i = 0; i < 40000; ++i) {
+        std::string key;
+        for (int n = length(rng); n > 0; --n) {
+            key.push_back(static_cast<char>(byte(rng) % (i % 3 == 0 ? 256 : 8) + (i % 3 == 0 ? 0 : 'A')));
+        }
+        if (rng() % 3 == 0) {
+            REQUIRE(tree.erase(key) == (reference.erase(key) == 1));
+        } else {
+            auto value = std::to_string(i);
+            REQUIRE(tree.insert(key, value) == !reference.count(key));
+            reference[key] = value;
+        }
+    }
+    REQUIRE(tree.size() == reference.size());
+
+    for (const auto& [key, value] : reference) {
+        REQUIRE(tree.find(key) == value);
+    }
+    REQUIRE(tree.withPrefix("", reference.size()) == expectedWithPrefix(reference, "", reference.size()));
+    for (std::string prefix : {"A", "AB", "H", "CAB"}) {
+        REQUIRE(tree.withPrefix(prefix, 25) == expectedWithPrefix(reference, prefix, 25));
+    }
+
+    for (auto it = reference.begin(); it != reference.end(); ++it) {
+        REQUIRE(tree.erase(it->first));
+    }
+    REQUIRE(tree.size() == 0);
+    REQUIRE(tree.withPrefix("", 10).empty());
+}
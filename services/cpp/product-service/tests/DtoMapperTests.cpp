@@ -3,6 +3,7 @@
 #include "product/models/Product.hpp"
 #include "product/dtos/ProductItemDto.hpp"
 #include "product/dtos/ProductListDto.hpp"
+#include "product/dtos/ProductSearchResultsDto.hpp"
 
 using namespace product;
 
@@ -246,4 +247,34 @@ TEST_CASE("ProductListDto pagination", "[dto][list]") {
             Catch::Matchers::ContainsSubstring("at least 1")
         );
     }
+    
+    SECTION("Next cursor is serialized only when present") {
+        dtos::ProductListDto last(items, 1, 1, 50, 1);
+        REQUIRE_FALSE(last.toJson().contains("nextCursor"));
+        
+        dtos::ProductListDto more(items, 2, 1, 1, 2, std::string("PROD-001"));
+        REQUIRE(more.getNextCursor() == "PROD-001");
+        REQUIRE(more.toJson()["nextCursor"] == "PROD-001");
+    }
+}
+
+TEST_CASE("ProductSearchResultsDto serialization", "[dto][search]") {
+    auto item = utils::DtoMapper::toProductItemDto(createValidProduct());
+    
+    SECTION("Hits carry the product and its score") {
+        dtos::ProductSearchResultsDto results("widget", {dtos::ProductSearchHitDto(item, 2.5)});
+        auto j = results.toJson();
+        REQUIRE(j["query"] == "widget");
+        REQUIRE(j["items"].size() == 1);
+        REQUIRE(j["items"][0]["product"]["sku"] == "PROD-001");
+        REQUIRE(j["items"][0]["score"] == 2.5);
+    }
+    
+    SECTION("Empty query throws") {
+        REQUIRE_THROWS_AS(dtos::ProductSearchResultsDto("", {}), std::invalid_argument);
+    }
+    
+    SECTION("Negative score throws") {
+        REQUIRE_THROWS_AS(dtos::ProductSearchHitDto(item, -1.0), std::invalid_argument);
+    }
 }
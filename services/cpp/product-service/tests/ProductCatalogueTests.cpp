@@ -0,0 +1,107 @@
+#include <catch2/catch_all.hpp>
+#include "product/utils/ProductCatalogue.hpp"
+#include <chrono>
+#include <cstdio>
+
+using namespace product;
+
+namespace {
+
+models::Product catalogueProduct(const std::string& id, const std::string& sku,
+                                 const std::string& name = "Widget") {
+    return models::Product(id, sku, name, std::nullopt, "Tools", models::Product::Status::ACTIVE);
+}
+
+std::string numbered(const char* format, int n) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), format, n);
+    return buffer;
+}
+
+}  // namespace
+
+TEST_CASE("ProductCatalogue looks products up by id and SKU", "[catalogue]") {
+    utils::ProductCatalogue catalogue;
+    catalogue.load({catalogueProduct("p1", "PROD-001"), catalogueProduct("p2", "PROD-002")});
+
+    REQUIRE(catalogue.size() == 2);
+    REQUIRE(catalogue.findById("p1")->getSku() == "PROD-001");
+    REQUIRE(catalogue.findBySku("PROD-002")->getId() == "p2");
+    REQUIRE_FALSE(catalogue.findById("p3"));
+    REQUIRE_FALSE(catalogue.findBySku("PROD-003"));
+
+    SECTION("apply replaces a product and re-indexes a changed SKU") {
+        catalogue.apply(catalogueProduct("p1", "PROD-101", "Renamed"));
+
+        REQUIRE(catalogue.size() == 2);
+        REQUIRE(catalogue.findById("p1")->getName() == "Renamed");
+        REQUIRE(catalogue.findBySku("PROD-101")->getId() == "p1");
+        REQUIRE_FALSE(catalogue.findBySku("PROD-001"));
+        REQUIRE(catalogue.completeSku("PROD-00", 10).size() == 1);
+    }
+
+    SECTION("a product taking another's SKU drops the other") {
+        catalogue.apply(catalogueProduct("p3", "PROD-002"));
+
+        REQUIRE(catalogue.size() == 2);
+        REQUIRE(catalogue.findBySku("PROD-002")->getId() == "p3");
+        REQUIRE_FALSE(catalogue.findById("p2"));
+    }
+
+    SECTION("remove drops both indexes") {
+        catalogue.remove("p1");
+        catalogue.remove("missing");
+
+        REQUIRE(catalogue.size() == 1);
+        REQUIRE_FALSE(catalogue.findById("p1"));
+        REQUIRE_FALSE(catalogue.findBySku("PROD-001"));
+        REQUIRE(catalogue.completeSku("PROD", 10).size() == 1);
+    }
+
+    SECTION("load replaces everything") {
+        catalogue.load({catalogueProduct("p9", "OTHER-1")});
+
+        REQUIRE(catalogue.size() == 1);
+        REQUIRE_FALSE(catalogue.findById("p1"));
+        REQUIRE(catalogue.completeSku("PROD", 10).empty());
+    }
+}
+
+TEST_CASE("ProductCatalogue completes SKU prefixes in SKU order", "[catalogue]") {
+    utils::ProductCatalogue catalogue;
+    catalogue.load({
+        catalogueProduct("p1", "BOLT-20"),
+        catalogueProduct("p2", "BOLT-10"),
+        catalogueProduct("p3", "BOLT-1"),
+        catalogueProduct("p4", "NUT-10"),
+    });
+
+    auto bolts = catalogue.completeSku("BOLT-", 10);
+    REQUIRE(bolts.size() == 3);
+    REQUIRE(bolts[0].getSku() == "BOLT-1");
+    REQUIRE(bolts[1].getSku() == "BOLT-10");
+    REQUIRE(bolts[2].getSku() == "BOLT-20");
+
+    REQUIRE(catalogue.completeSku("BOLT-", 2).size() == 2);
+    REQUIRE(catalogue.completeSku("BOLT-10", 10).size() == 1);
+    REQUIRE(catalogue.completeSku("SCREW", 10).empty());
+}
+
+TEST_CASE("ProductCatalogue serves lookups at catalogue scale", "[catalogue][!benchmark]") {
+    constexpr int kProducts = 200000;
+    std::vector<models::Product> products;
+    products.reserve(kProducts);
+    for (int i = 0; i < kProducts; ++i) {
+        products.push_back(catalogueProduct(numbered("id-%d", i), numbered("SKU-%07d", i)));
+    }
+    utils::ProductCatalogue catalogue;
+    catalogue.load(products);
+    REQUIRE(catalogue.size() == kProducts);
+
+    BENCHMARK("findBySku") {
+        return catalogue.findBySku("SKU-0123456");
+    };
+    BENCHMARK("completeSku, 10 results") {
+        return catalogue.completeSku("SKU-01234", 10);
+    };
+}
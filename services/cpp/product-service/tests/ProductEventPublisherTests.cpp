@@ -0,0 +1,178 @@
+#include <catch2/catch_all.hpp>
+#include "product/services/ProductEventPublisher.hpp"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace product;
+using product::repositories::OutboxEvent;
+using product::services::ProductEventPublisher;
+
+namespace {
+
+// In-memory outbox with the same publish-or-keep semantics as the table
+class FakeOutbox : public repositories::ProductOutbox {
+public:
+    std::deque<OutboxEvent> queued;
+    std::vector<OutboxEvent> published;
+    std::atomic<int> drains{0};
+    std::mutex mutex;   // the publisher's thread drains while tests inspect
+
+    std::size_t drain(std::size_t limit, const Handler& handler) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++drains;
+        std::vector<OutboxEvent> batch(queued.begin(), queued.begin() + std::min(limit, queued.size()));
+        if (batch.empty()) {
+            return 0;
+        }
+        handler(batch);
+        queued.erase(queued.begin(), queued.begin() + batch.size());
+        published.insert(published.end(), batch.begin(), batch.end());
+        return batch.size();
+    }
+
+    std::size_t purgePublished(std::chrono::hours) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto count = published.size();
+        published.clear();
+        return count;
+    }
+
+    void enqueue(OutboxEvent event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued.push_back(std::move(event));
+    }
+
+    std::size_t pending() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return queued.size();
+    }
+};
+
+class FakeBus : public utils::MessageBus {
+public:
+    std::vector<std::pair<std::string, nlohmann::json>> messages;
+    std::vector<std::size_t> batchSizes;
+    std::size_t failAfter = SIZE_MAX;   // messages accepted before publishing throws
+
+    void publish(const std::string& routingKey, const nlohmann::json& payload) override {
+        if (messages.size() >= failAfter) {
+            throw std::runtime_error("broker unavailable");
+        }
+        messages.emplace_back(routingKey, payload);
+    }
+
+    void publishBatch(const std::string& routingKey, const std::vector<nlohmann::json>& payloads) override {
+        batchSizes.push_back(payloads.size());
+        MessageBus::publishBatch(routingKey, payloads);
+    }
+};
+
+OutboxEvent event(std::int64_t sequence, const std::string& type, const std::string& productId,
+                  std::int64_t version) {
+    return OutboxEvent{sequence, "event-" + std::to_string(sequence), type, productId, version,
+                       "2026-02-16T10:00:00.000Z", {{"id", productId}, {"version", version}}};
+}
+
+ProductEventPublisher::Options options(std::size_t batchSize) {
+    ProductEventPublisher::Options options;
+    options.batchSize = batchSize;
+    return options;
+}
+
+}  // namespace
+
+TEST_CASE("ProductEventPublisher wraps events in the standard envelope", "[events]") {
+    auto message = ProductEventPublisher::toMessage(event(7, "ProductUpdated", "p1", 3));
+
+    REQUIRE(message["eventId"] == "event-7");
+    REQUIRE(message["eventType"] == "ProductUpdated");
+    REQUIRE(message["eventVersion"] == "1.0");
+    REQUIRE(message["timestamp"] == "2026-02-16T10:00:00.000Z");
+    REQUIRE(message["correlationId"] == "event-7");
+    REQUIRE(message["source"] == "product-service");
+    REQUIRE(message["data"]["version"] == 3);
+
+    REQUIRE(ProductEventPublisher::routingKeyFor("ProductCreated") == "created");
+    REQUIRE(ProductEventPublisher::routingKeyFor("ProductDeleted") == "deleted");
+    REQUIRE_THROWS_AS(ProductEventPublisher::routingKeyFor("ProductRenamed"), std::invalid_argument);
+}
+
+TEST_CASE("ProductEventPublisher drains the outbox in order and in batches", "[events]") {
+    auto outbox = std::make_shared<FakeOutbox>();
+    auto bus = std::make_shared<FakeBus>();
+    outbox->queued = {
+        event(1, "ProductCreated", "p1", 1),
+        event(2, "ProductCreated", "p2", 1),
+        event(3, "ProductUpdated", "p1", 2),
+        event(4, "ProductUpdated", "p2", 2),
+        event(5, "ProductDeleted", "p1", 3),
+    };
+    ProductEventPublisher publisher(outbox, bus, options(2));
+
+    REQUIRE(publisher.publishPending() == 5);
+    REQUIRE(outbox->queued.empty());
+
+    REQUIRE(bus->messages.size() == 5);
+    for (std::size_t i = 0; i < bus->messages.size(); ++i) {
+        REQUIRE(bus->messages[i].second["eventId"] == "event-" + std::to_string(i + 1));
+    }
+    REQUIRE(bus->messages[0].first == "created");
+    REQUIRE(bus->messages[2].first == "updated");
+    REQUIRE(bus->messages[4].first == "deleted");
+
+    // Batches of 2: [created, created], [updated, updated], [deleted]
+    REQUIRE(bus->batchSizes == std::vector<std::size_t>{2, 2, 1});
+
+    REQUIRE(publisher.publishPending() == 0);
+}
+
+TEST_CASE("ProductEventPublisher leaves events queued when the bus fails", "[events]") {
+    auto outbox = std::make_shared<FakeOutbox>();
+    auto bus = std::make_shared<FakeBus>();
+    for (int i = 1; i <= 5; ++i) {
+        outbox->queued.push_back(event(i, "ProductUpdated", "p" + std::to_string(i), 2));
+    }
+    ProductEventPublisher publisher(outbox, bus, options(2));
+
+    bus->failAfter = 3;   // the second batch fails halfway
+    REQUIRE_THROWS_AS(publisher.publishPending(), std::runtime_error);
+    REQUIRE(outbox->published.size() == 2);
+    REQUIRE(outbox->queued.size() == 3);
+    REQUIRE(outbox->queued.front().sequence == 3);
+
+    // The retry sends event 3 again: at least once, never lost
+    bus->failAfter = SIZE_MAX;
+    REQUIRE(publisher.publishPending() == 3);
+    REQUIRE(outbox->queued.empty());
+    REQUIRE(bus->messages.size() == 6);
+    REQUIRE(bus->messages[2].second["eventId"] == "event-3");
+    REQUIRE(bus->messages[3].second["eventId"] == "event-3");
+}
+
+TEST_CASE("ProductEventPublisher publishes from its thread when woken", "[events]") {
+    auto outbox = std::make_shared<FakeOutbox>();
+    auto bus = std::make_shared<FakeBus>();
+    auto opts = options(10);
+    opts.interval = std::chrono::hours(1);
+    ProductEventPublisher publisher(outbox, bus, opts);
+
+    publisher.start();
+    // The first pass finds nothing; the next is an hour away unless woken
+    for (int i = 0; i < 200 && outbox->drains == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    REQUIRE(outbox->drains > 0);
+
+    outbox->enqueue(event(1, "ProductCreated", "p1", 1));
+    publisher.wake();
+    for (int i = 0; i < 200 && outbox->pending() > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    publisher.stop();
+
+    REQUIRE(outbox->pending() == 0);
+    REQUIRE(bus->messages.size() == 1);
+}
@@ -0,0 +1,217 @@
+#include <catch2/catch_all.hpp>
+#include "product/utils/ProductSearchIndex.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <random>
+
+using namespace product;
+using product::utils::ProductSearchIndex;
+
+namespace {
+
+models::Product searchable(const std::string& id, const std::string& name,
+                           const std::optional<std::string>& description = std::nullopt,
+                           const std::optional<std::string>& category = std::nullopt) {
+    return models::Product(id, "SKU-" + id, name, description, category, models::Product::Status::ACTIVE);
+}
+
+std::vector<std::string> ids(const std::vector<utils::SearchHit>& hits) {
+    std::vector<std::string> out;
+    for (const auto& hit : hits) {
+        out.push_back(hit.id);
+    }
+    return out;
+}
+
+// Deterministic catalogue of pseudo-word product names and descriptions
+struct SyntheticCatalogue {
+    std::vector<std::string> words;
+    std::vector<std::string> categories;
+    std::mt19937 random{42};
+
+    SyntheticCatalogue() {
+        std::uniform_int_distribution<int> length(4, 9);
+        std::uniform_int_distribution<int> letter('a', 'z');
+        for (int i = 0; i < 5000; ++i) {
+            std::string word;
+            for (int n = length(random); n > 0; --n) {
+                word += static_cast<char>(letter(random));
+            }
+            words.push_back(word);
+        }
+        for (int i = 0; i < 60; ++i) {
+            categories.push_back(words[i]);
+        }
+    }
+
+    std::string phrase(int count) {
+        // Zipf-like: low word indexes are far more common
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        std::string text;
+        for (int i = 0; i < count; ++i) {
+            auto index = static_cast<std::size_t>(std::pow(unit(random), 3.0) * words.size());
+            text += (i ? " " : "") + words[std::min(index, words.size() - 1)];
+        }
+        return text;
+    }
+
+    models::Product product(int n) {
+        return searchable(std::to_string(n), phrase(3), phrase(12), categories[n % categories.size()]);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("ProductSearchIndex tokenizes to lower-case alphanumeric runs", "[search]") {
+    REQUIRE(ProductSearchIndex::tokenize("Hex-Bolt M8, 40mm (Zinc)") ==
+            std::vector<std::string>{"hex", "bolt", "m8", "40mm", "zinc"});
+    REQUIRE(ProductSearchIndex::tokenize("  --  ").empty());
+    REQUIRE(ProductSearchIndex::tokenize("Crème brûlée") == std::vector<std::string>{"crème", "brûlée"});
+}
+
+TEST_CASE("ProductSearchIndex ranks matches", "[search]") {
+    ProductSearchIndex index;
+    index.add(searchable("1", "Steel hex bolt", "Zinc plated", "Fasteners"));
+    index.add(searchable("2", "Brass washer", "Fits any steel bolt", "Fasteners"));
+    index.add(searchable("3", "Cordless drill", "Ships with a bolt-on handle", "Power tools"));
+    index.add(searchable("4", "Widget", std::nullopt, "Misc"));
+
+    SECTION("a name match outranks a description match") {
+        auto hits = ids(index.search("bolt", 10));
+        REQUIRE(hits.size() == 3);
+        REQUIRE(hits[0] == "1");
+    }
+
+    SECTION("products matching every token come first") {
+        auto hits = ids(index.search("steel bolt zinc", 10));
+        REQUIRE(hits.size() == 3);
+        REQUIRE(hits[0] == "1");
+        REQUIRE(hits[1] == "2");
+        REQUIRE(hits[2] == "3");
+    }
+
+    SECTION("categories are searchable") {
+        REQUIRE(ids(index.search("power", 10)) == std::vector<std::string>{"3"});
+        REQUIRE(index.search("fasteners", 10).size() == 2);
+    }
+
+    SECTION("a partial word matches by prefix") {
+        REQUIRE(ids(index.search("wid", 10)) == std::vector<std::string>{"4"});
+        REQUIRE(ids(index.search("cordl dri", 10)) == std::vector<std::string>{"3"});
+    }
+
+    SECTION("a misspelt word matches by trigrams") {
+        REQUIRE(ids(index.search("widgt", 10)) == std::vector<std::string>{"4"});
+        REQUIRE(ids(index.search("wahser", 10)).empty());   // too far off
+        REQUIRE(ids(index.search("washr", 10)) == std::vector<std::string>{"2"});
+    }
+
+    SECTION("limit and empty queries") {
+        REQUIRE(index.search("fasteners", 1).size() == 1);
+        REQUIRE(index.search("", 10).empty());
+        REQUIRE(index.search("zzzz", 10).empty());
+    }
+}
+
+TEST_CASE("ProductSearchIndex updates incrementally", "[search]") {
+    ProductSearchIndex index;
+    index.add(searchable("1", "Steel bolt"));
+    index.add(searchable("2", "Brass bolt"));
+
+    index.add(searchable("1", "Steel screw"));
+    REQUIRE(index.size() == 2);
+    REQUIRE(ids(index.search("bolt", 10)) == std::vector<std::string>{"2"});
+    REQUIRE(ids(index.search("screw", 10)) == std::vector<std::string>{"1"});
+
+    index.remove("2");
+    index.remove("missing");
+    REQUIRE(index.size() == 1);
+    REQUIRE(index.search("bolt", 10).empty());
+    REQUIRE(index.search("brass", 10).empty());
+
+    index.add(searchable("3", "Brass hinge"));
+    REQUIRE(ids(index.search("brass", 10)) == std::vector<std::string>{"3"});
+}
+
+TEST_CASE("ProductSearchIndex after updates matches a fresh build", "[search]") {
+    SyntheticCatalogue catalogue;
+    std::map<int, models::Product> live;
+    ProductSearchIndex incremental;
+    std::uniform_int_distribution<int> pick(0, 1999);
+    std::uniform_int_distribution<int> action(0, 3);
+
+    for (int i = 0; i < 8000; ++i) {
+        int n = pick(catalogue.random);
+        if (action(catalogue.random) == 0) {
+            incremental.remove(std::to_string(n));
+            live.erase(n);
+        } else {
+            auto product = catalogue.product(n);
+            incremental.add(product);
+            live.insert_or_assign(n, product);
+        }
+    }
+
+    ProductSearchIndex fresh;
+    for (const auto& [n, product] : live) {
+        fresh.add(product);
+    }
+    REQUIRE(incremental.size() == fresh.size());
+
+    for (int i = 0; i < 200; ++i) {
+        auto query = catalogue.phrase(2);
+        auto expected = fresh.search(query, 20);
+        auto actual = incremental.search(query, 20);
+        REQUIRE(ids(actual) == ids(expected));
+        for (std::size_t h = 0; h < actual.size(); ++h) {
+            REQUIRE(actual[h].score == Catch::Approx(expected[h].score).epsilon(1e-5));
+        }
+    }
+}
+
+TEST_CASE("ProductSearchIndex at catalogue scale", "[search][!benchmark]") {
+    constexpr int kProducts = 500000;
+    SyntheticCatalogue catalogue;
+    std::vector<models::Product> products;
+    products.reserve(kProducts);
+    for (int i = 0; i < kProducts; ++i) {
+        products.push_back(catalogue.product(i));
+    }
+
+    ProductSearchIndex index;
+    auto started = std::chrono::steady_clock::now();
+    for (const auto& product : products) {
+        index.add(product);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    WARN("Indexed " << kProducts << " products in " << elapsed.count() << " ms");
+
+    const auto& common = catalogue.words[5];
+    const auto& rare = catalogue.words[3000];
+    auto longer = *std::find_if(catalogue.words.begin() + 100, catalogue.words.end(),
+                                [](const std::string& word) { return word.size() >= 8; });
+    auto typo = longer.substr(0, 3) + longer.substr(4);   // one letter dropped
+
+    BENCHMARK("one common word") {
+        return index.search(common, 20);
+    };
+    BENCHMARK("two words") {
+        return index.search(common + " " + catalogue.words[40], 20);
+    };
+    BENCHMARK("prefix") {
+        return index.search(catalogue.words[10].substr(0, 3), 20);
+    };
+    BENCHMARK("misspelt word") {
+        return index.search(typo, 20);
+    };
+    BENCHMARK("category and word") {
+        return index.search(catalogue.categories[7] + " " + rare, 20);
+    };
+
+    int n = 0;
+    BENCHMARK("re-index one product") {
+        return (index.add(catalogue.product(n++ % kProducts)), index.size());
+    };
+}
@@ -4,9 +4,14 @@
 #include "utils/Config.hpp"
 #include "utils/Database.hpp"
 #include "utils/Logger.hpp"
+#include "utils/MessageBus.hpp"
 #include <memory>
 #include <string>
 
+namespace warehouse::services {
+    class SnapshotService;
+}
+
 namespace warehouse {
 
 /**
@@ -32,6 +37,13 @@ private:
     
     std::unique_ptr<Server> server_;
     std::shared_ptr<utils::Database> database_;
+    std::shared_ptr<utils::Database> backgroundDatabase_;   // occupancy and snapshot workers
+    std::shared_ptr<utils::MessageBus> messageBus_;
+    std::shared_ptr<services::WarehouseService> warehouseService_;
+    std::shared_ptr<services::LocationService> locationService_;
+    std::shared_ptr<services::PutawayService> putawayService_;
+    std::shared_ptr<services::OccupancyService> occupancyService_;
+    std::shared_ptr<services::SnapshotService> snapshotService_;
     bool initialized_ = false;
     bool running_ = false;
     
@@ -7,6 +7,8 @@
 namespace warehouse::services {
     class WarehouseService;
     class LocationService;
+    class PutawayService;
+    class OccupancyService;
 }
 
 namespace warehouse {
@@ -25,7 +27,9 @@ public:
     
     Server(const Config& config,
            std::shared_ptr<services::WarehouseService> warehouseService,
-           std::shared_ptr<services::LocationService> locationService);
+           std::shared_ptr<services::LocationService> locationService,
+           std::shared_ptr<services::PutawayService> putawayService,
+           std::shared_ptr<services::OccupancyService> occupancyService);
     
     ~Server();
     
@@ -38,6 +42,8 @@ private:
     std::unique_ptr<Poco::Net::HTTPServer> httpServer_;
     std::shared_ptr<services::WarehouseService> warehouseService_;
     std::shared_ptr<services::LocationService> locationService_;
+    std::shared_ptr<services::PutawayService> putawayService_;
+    std::shared_ptr<services::OccupancyService> occupancyService_;
     bool running_ = false;
     
     class RequestHandlerFactory;
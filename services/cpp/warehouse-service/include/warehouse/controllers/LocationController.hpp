@@ -20,6 +20,7 @@ namespace warehouse::controllers {
  * - GET /api/v1/locations/:id - Get location by ID
  * - GET /api/v1/warehouses/:warehouseId/locations - Get locations by warehouse
  * - POST /api/v1/locations - Create new location
+ * - POST /api/v1/locations/status - Apply a status transition to many locations
  * - PUT /api/v1/locations/:id - Update location
  * - DELETE /api/v1/locations/:id - Delete location
  */
@@ -45,6 +46,9 @@ private:
     void handleCreate(Poco::Net::HTTPServerRequest& request,
                      Poco::Net::HTTPServerResponse& response);
     
+    void handleChangeStatus(Poco::Net::HTTPServerRequest& request,
+                           Poco::Net::HTTPServerResponse& response);
+    
     void handleUpdate(const std::string& id,
                      Poco::Net::HTTPServerRequest& request,
                      Poco::Net::HTTPServerResponse& response);
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <memory>
+#include <string>
+
+namespace warehouse::services {
+    class OccupancyService; // Forward declaration
+}
+
+namespace warehouse::controllers {
+
+/**
+ * @brief HTTP controller for warehouse occupancy
+ * 
+ * Handles:
+ * - GET /api/v1/warehouses/:id/occupancy?depth=zone|aisle|level - Occupied/free bins,
+ *   volume and weight per zone, aisle and level
+ */
+class OccupancyController : public Poco::Net::HTTPRequestHandler {
+public:
+    explicit OccupancyController(std::shared_ptr<services::OccupancyService> service);
+    
+    void handleRequest(Poco::Net::HTTPServerRequest& request,
+                      Poco::Net::HTTPServerResponse& response) override;
+
+private:
+    void handleGet(const std::string& warehouseId,
+                  Poco::Net::HTTPServerRequest& request,
+                  Poco::Net::HTTPServerResponse& response);
+    
+    void sendJsonResponse(Poco::Net::HTTPServerResponse& response,
+                         int status,
+                         const std::string& body);
+    
+    void sendErrorResponse(Poco::Net::HTTPServerResponse& response,
+                          int status,
+                          const std::string& message);
+    
+    std::string extractWarehouseIdFromPath(const std::string& path);
+
+    std::shared_ptr<services::OccupancyService> service_;
+};
+
+} // namespace warehouse::controllers
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <memory>
+#include <string>
+
+namespace warehouse::services {
+    class LocationService; // Forward declaration
+}
+
+namespace warehouse::controllers {
+
+/**
+ * @brief HTTP controller for pick-route planning
+ * 
+ * Handles:
+ * - POST /api/v1/warehouses/:id/pick-route - Optimise the visiting order of a set of locations
+ */
+class PickRouteController : public Poco::Net::HTTPRequestHandler {
+public:
+    explicit PickRouteController(std::shared_ptr<services::LocationService> service);
+    
+    void handleRequest(Poco::Net::HTTPServerRequest& request,
+                      Poco::Net::HTTPServerResponse& response) override;
+
+private:
+    void handlePlanRoute(const std::string& warehouseId,
+                        Poco::Net::HTTPServerRequest& request,
+                        Poco::Net::HTTPServerResponse& response);
+    
+    void sendJsonResponse(Poco::Net::HTTPServerResponse& response,
+                         int status,
+                         const std::string& body);
+    
+    void sendErrorResponse(Poco::Net::HTTPServerResponse& response,
+                          int status,
+                          const std::string& message);
+    
+    std::string extractWarehouseIdFromPath(const std::string& path);
+
+    std::shared_ptr<services::LocationService> service_;
+};
+
+} // namespace warehouse::controllers
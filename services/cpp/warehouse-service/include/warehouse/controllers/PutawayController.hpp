@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <memory>
+#include <string>
+
+namespace warehouse::services {
+    class PutawayService; // Forward declaration
+}
+
+namespace warehouse::controllers {
+
+/**
+ * @brief HTTP controller for putaway suggestions
+ * 
+ * Handles:
+ * - POST /api/v1/warehouses/:id/putaway-suggestions - Rank storage locations for a received load
+ */
+class PutawayController : public Poco::Net::HTTPRequestHandler {
+public:
+    explicit PutawayController(std::shared_ptr<services::PutawayService> service);
+    
+    void handleRequest(Poco::Net::HTTPServerRequest& request,
+                      Poco::Net::HTTPServerResponse& response) override;
+
+private:
+    void handleSuggest(const std::string& warehouseId,
+                      Poco::Net::HTTPServerRequest& request,
+                      Poco::Net::HTTPServerResponse& response);
+    
+    void sendJsonResponse(Poco::Net::HTTPServerResponse& response,
+                         int status,
+                         const std::string& body);
+    
+    void sendErrorResponse(Poco::Net::HTTPServerResponse& response,
+                          int status,
+                          const std::string& message);
+    
+    std::string extractWarehouseIdFromPath(const std::string& path);
+
+    std::shared_ptr<services::PutawayService> service_;
+};
+
+} // namespace warehouse::controllers
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace warehouse {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief One rejected line of a bulk location import
+ * 
+ * Conforms to LocationImportErrorDto contract v1.0
+ */
+class LocationImportErrorDto {
+public:
+    LocationImportErrorDto(int line,
+                           const std::optional<std::string>& code,
+                           const std::string& message);
+
+    int getLine() const { return line_; }
+    const std::optional<std::string>& getCode() const { return code_; }
+    const std::string& getMessage() const { return message_; }
+
+    json toJson() const;
+
+private:
+    int line_;
+    std::optional<std::string> code_;
+    std::string message_;
+};
+
+/**
+ * @brief Outcome of a bulk location import
+ * 
+ * Conforms to LocationImportResultDto contract v1.0
+ */
+class LocationImportResultDto {
+public:
+    LocationImportResultDto(const std::string& warehouseId,
+                            int received,
+                            int imported,
+                            int rejected,
+                            const std::vector<LocationImportErrorDto>& errors);
+
+    const std::string& getWarehouseId() const { return warehouseId_; }
+    int getReceived() const { return received_; }
+    int getImported() const { return imported_; }
+    int getRejected() const { return rejected_; }
+    const std::vector<LocationImportErrorDto>& getErrors() const { return errors_; }
+
+    json toJson() const;
+
+private:
+    std::string warehouseId_;
+    int received_;
+    int imported_;
+    int rejected_;
+    std::vector<LocationImportErrorDto> errors_;
+};
+
+} // namespace dtos
+} // namespace warehouse
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "warehouse/dtos/LocationDto.hpp"
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace warehouse {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Outcome of a batch location status transition
+ * 
+ * Conforms to LocationStatusChangeDto contract v1.0
+ */
+class LocationStatusChangeDto {
+public:
+    LocationStatusChangeDto(const std::string& status,
+                            const std::vector<LocationDto>& updated,
+                            const std::vector<std::string>& unchangedLocationIds);
+
+    const std::string& getStatus() const { return status_; }
+    const std::vector<LocationDto>& getUpdated() const { return updated_; }
+    const std::vector<std::string>& getUnchangedLocationIds() const { return unchangedLocationIds_; }
+
+    json toJson() const;
+
+private:
+    std::string status_;
+    std::vector<LocationDto> updated_;
+    std::vector<std::string> unchangedLocationIds_;
+};
+
+} // namespace dtos
+} // namespace warehouse
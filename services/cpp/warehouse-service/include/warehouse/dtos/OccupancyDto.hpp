@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace warehouse {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Occupancy of one warehouse, zone, aisle or level
+ * 
+ * Conforms to OccupancyBucketDto contract v1.0
+ */
+class OccupancyBucketDto {
+public:
+    OccupancyBucketDto(const std::string& scope,
+                       const std::optional<std::string>& zone,
+                       const std::optional<std::string>& aisle,
+                       const std::optional<std::string>& level,
+                       std::int64_t totalBins,
+                       std::int64_t occupiedBins,
+                       std::int64_t freeBins,
+                       double volumeUsed,
+                       double volumeCapacity,
+                       double weightUsed,
+                       double weightCapacity);
+
+    const std::string& getScope() const { return scope_; }
+    const std::optional<std::string>& getZone() const { return zone_; }
+    const std::optional<std::string>& getAisle() const { return aisle_; }
+    const std::optional<std::string>& getLevel() const { return level_; }
+    std::int64_t getTotalBins() const { return totalBins_; }
+    std::int64_t getOccupiedBins() const { return occupiedBins_; }
+    std::int64_t getFreeBins() const { return freeBins_; }
+    double getVolumeUsed() const { return volumeUsed_; }
+    double getVolumeCapacity() const { return volumeCapacity_; }
+    double getWeightUsed() const { return weightUsed_; }
+    double getWeightCapacity() const { return weightCapacity_; }
+
+    json toJson() const;
+
+private:
+    std::string scope_;
+    std::optional<std::string> zone_;
+    std::optional<std::string> aisle_;
+    std::optional<std::string> level_;
+    std::int64_t totalBins_;
+    std::int64_t occupiedBins_;
+    std::int64_t freeBins_;
+    double volumeUsed_;
+    double volumeCapacity_;
+    double weightUsed_;
+    double weightCapacity_;
+};
+
+/**
+ * @brief Occupancy tree of a warehouse, parents before children
+ * 
+ * Conforms to OccupancyDto contract v1.0
+ */
+class OccupancyDto {
+public:
+    OccupancyDto(const std::string& warehouseId,
+                 const std::vector<OccupancyBucketDto>& buckets);
+
+    const std::string& getWarehouseId() const { return warehouseId_; }
+    const std::vector<OccupancyBucketDto>& getBuckets() const { return buckets_; }
+
+    json toJson() const;
+
+private:
+    std::string warehouseId_;
+    std::vector<OccupancyBucketDto> buckets_;
+};
+
+} // namespace dtos
+} // namespace warehouse
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace warehouse {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief One stop on an optimised pick route
+ * 
+ * Conforms to PickRouteStopDto contract v1.0
+ */
+class PickRouteStopDto {
+public:
+    PickRouteStopDto(int sequence,
+                     const std::string& locationId,
+                     const std::string& code,
+                     const std::optional<std::string>& zone = std::nullopt,
+                     const std::optional<std::string>& aisle = std::nullopt,
+                     const std::optional<std::string>& bay = std::nullopt,
+                     const std::optional<std::string>& level = std::nullopt);
+
+    int getSequence() const { return sequence_; }
+    const std::string& getLocationId() const { return locationId_; }
+    const std::string& getCode() const { return code_; }
+    const std::optional<std::string>& getZone() const { return zone_; }
+    const std::optional<std::string>& getAisle() const { return aisle_; }
+    const std::optional<std::string>& getBay() const { return bay_; }
+    const std::optional<std::string>& getLevel() const { return level_; }
+
+    json toJson() const;
+
+private:
+    int sequence_;
+    std::string locationId_;
+    std::string code_;
+    std::optional<std::string> zone_;
+    std::optional<std::string> aisle_;
+    std::optional<std::string> bay_;
+    std::optional<std::string> level_;
+};
+
+/**
+ * @brief Optimised picking sequence for a set of warehouse locations
+ * 
+ * Conforms to PickRouteDto contract v1.0
+ */
+class PickRouteDto {
+public:
+    /**
+     * @brief Construct pick route DTO
+     * @param warehouseId Warehouse the route was planned in
+     * @param strategy Routing heuristic that produced the route
+     * @param totalDistance Walking distance depot -> stops -> depot, metres (non-negative)
+     * @param stops Stops in visiting order
+     * @param unresolvedLocationIds Requested IDs not found in the warehouse
+     */
+    PickRouteDto(const std::string& warehouseId,
+                 const std::string& strategy,
+                 double totalDistance,
+                 const std::vector<PickRouteStopDto>& stops,
+                 const std::vector<std::string>& unresolvedLocationIds);
+
+    const std::string& getWarehouseId() const { return warehouseId_; }
+    const std::string& getStrategy() const { return strategy_; }
+    double getTotalDistance() const { return totalDistance_; }
+    const std::vector<PickRouteStopDto>& getStops() const { return stops_; }
+    const std::vector<std::string>& getUnresolvedLocationIds() const { return unresolvedLocationIds_; }
+
+    json toJson() const;
+
+private:
+    std::string warehouseId_;
+    std::string strategy_;
+    double totalDistance_;
+    std::vector<PickRouteStopDto> stops_;
+    std::vector<std::string> unresolvedLocationIds_;
+};
+
+} // namespace dtos
+} // namespace warehouse
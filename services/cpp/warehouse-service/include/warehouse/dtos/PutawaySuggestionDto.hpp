@@ -0,0 +1,72 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace warehouse {
+namespace dtos {
+
+using json = nlohmann::json;
+
+/**
+ * @brief Candidate storage location for a putaway
+ * 
+ * Conforms to PutawaySuggestionDto contract v1.0
+ */
+class PutawaySuggestionDto {
+public:
+    PutawaySuggestionDto(const std::string& locationId,
+                         const std::string& code,
+                         const std::optional<std::string>& zone,
+                         double score,
+                         double fit,
+                         double distance,
+                         double freeVolume,
+                         const std::optional<double>& freeWeight);
+
+    const std::string& getLocationId() const { return locationId_; }
+    const std::string& getCode() const { return code_; }
+    const std::optional<std::string>& getZone() const { return zone_; }
+    double getScore() const { return score_; }
+    double getFit() const { return fit_; }
+    double getDistance() const { return distance_; }
+    double getFreeVolume() const { return freeVolume_; }
+    const std::optional<double>& getFreeWeight() const { return freeWeight_; }
+
+    json toJson() const;
+
+private:
+    std::string locationId_;
+    std::string code_;
+    std::optional<std::string> zone_;
+    double score_;
+    double fit_;
+    double distance_;
+    double freeVolume_;
+    std::optional<double> freeWeight_;
+};
+
+/**
+ * @brief Ranked putaway candidates for one load
+ * 
+ * Conforms to PutawaySuggestionListDto contract v1.0
+ */
+class PutawaySuggestionListDto {
+public:
+    PutawaySuggestionListDto(const std::string& warehouseId,
+                             const std::vector<PutawaySuggestionDto>& items);
+
+    const std::string& getWarehouseId() const { return warehouseId_; }
+    const std::vector<PutawaySuggestionDto>& getItems() const { return items_; }
+
+    json toJson() const;
+
+private:
+    std::string warehouseId_;
+    std::vector<PutawaySuggestionDto> items_;
+};
+
+} // namespace dtos
+} // namespace warehouse
@@ -70,4 +70,7 @@ enum class Status {
 std::string statusToString(Status status);
 Status stringToStatus(const std::string& str);
 
+// True for the canonical 8-4-4-4-12 hex form PostgreSQL accepts as uuid
+bool isUuid(const std::string& value);
+
 } // namespace warehouse::models
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "warehouse/models/Location.hpp"
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <optional>
@@ -28,13 +29,47 @@ public:
     std::vector<models::Location> findByWarehouseAndType(const std::string& warehouseId, models::LocationType type);
     std::vector<models::Location> findByStatus(models::LocationStatus status);
     std::vector<models::Location> findAvailablePickingLocations(const std::string& warehouseId);
+    std::vector<models::Location> findByIds(const std::vector<std::string>& ids);
+    
+    /**
+     * @brief Locations of the given warehouses created or updated at or after since
+     * 
+     * Used to catch an in-memory cache up from its snapshot watermark. The
+     * comparison is inclusive because timestamps are stored at second
+     * precision; re-applying an unchanged location is harmless.
+     */
+    std::vector<models::Location> findChangedSince(const std::vector<std::string>& warehouseIds,
+                                                   std::chrono::system_clock::time_point since);
+    
+    // Ids of every location in the given warehouses; catch-up uses it to spot deletions
+    std::vector<std::string> findIdsByWarehouses(const std::vector<std::string>& warehouseIds);
     
     std::string create(const models::Location& location);
     bool update(const models::Location& location);
     bool deleteById(const std::string& id);
     
+    /**
+     * @brief Move locations to a new status in one conditional UPDATE
+     * 
+     * Only rows whose current status is in fromStatuses change; the
+     * updated rows are returned (via RETURNING) and the rest are untouched.
+     */
+    std::vector<models::Location> updateStatus(const std::vector<std::string>& ids,
+                                               models::LocationStatus status,
+                                               const std::vector<models::LocationStatus>& fromStatuses);
+    
     bool exists(const std::string& id);
     bool codeExists(const std::string& warehouseId, const std::string& code);
+    
+    // Bulk import support
+    std::vector<std::string> findCodesByWarehouse(const std::string& warehouseId);
+    
+    /**
+     * @brief Insert locations with a single COPY in one transaction
+     * 
+     * Locations must carry their id; either every row is committed or none.
+     */
+    void bulkInsert(const std::vector<models::Location>& locations);
 
 private:
     std::shared_ptr<utils::Database> db_;
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "warehouse/models/Location.hpp"
+#include <string>
+
+namespace warehouse::services {
+
+/**
+ * @brief Receives location changes committed by LocationService
+ * 
+ * Lets in-memory indexes stay current without re-reading the database.
+ * Called on the request thread after the change is committed.
+ */
+class LocationChangeListener {
+public:
+    virtual ~LocationChangeListener() = default;
+    
+    virtual void onLocationChanged(const models::Location& location) = 0;
+    virtual void onLocationRemoved(const std::string& locationId) = 0;
+};
+
+} // namespace warehouse::services
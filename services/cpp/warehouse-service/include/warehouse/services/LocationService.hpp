@@ -2,6 +2,14 @@
 
 #include "warehouse/models/Location.hpp"
 #include "warehouse/dtos/LocationDto.hpp"
+#include "warehouse/dtos/PickRouteDto.hpp"
+#include "warehouse/dtos/LocationImportResultDto.hpp"
+#include "warehouse/dtos/LocationStatusChangeDto.hpp"
+#include "warehouse/services/LocationChangeListener.hpp"
+#include "warehouse/services/PickRouteOptimizer.hpp"
+#include "warehouse/utils/LocationImportReader.hpp"
+#include "warehouse/utils/MessageBus.hpp"
+#include <istream>
 #include <memory>
 #include <vector>
 #include <optional>
@@ -21,7 +29,11 @@ namespace warehouse::services {
  */
 class LocationService {
 public:
-    explicit LocationService(std::shared_ptr<repositories::LocationRepository> repo);
+    explicit LocationService(std::shared_ptr<repositories::LocationRepository> repo,
+                             std::shared_ptr<utils::MessageBus> messageBus = nullptr);
+    
+    // Listeners are registered during start-up, before requests are served
+    void addListener(std::shared_ptr<LocationChangeListener> listener);
     
     // Business operations - return DTOs, not models
     std::optional<dtos::LocationDto> getById(const std::string& id);
@@ -33,9 +45,25 @@ public:
     dtos::LocationDto createLocation(const models::Location& location);
     dtos::LocationDto updateLocation(const models::Location& location);
     bool deleteLocation(const std::string& id);
+    
+    // Status transitions, each a single conditional UPDATE
+    // @throws std::runtime_error if the location does not exist
+    // @throws std::invalid_argument if the current status does not allow the transition
     dtos::LocationDto reserveLocation(const std::string& id);
     dtos::LocationDto releaseLocation(const std::string& id);
     dtos::LocationDto markLocationFull(const std::string& id);
+    dtos::LocationDto markLocationDamaged(const std::string& id);
+    dtos::LocationDto markLocationUnderMaintenance(const std::string& id);
+    
+    /**
+     * @brief Apply one status transition to many locations in one statement
+     * 
+     * Locations that do not exist or whose status does not allow the
+     * transition are listed in unchangedLocationIds.
+     * @throws std::invalid_argument if locationIds is empty or too long, or status is not a transition target
+     */
+    dtos::LocationStatusChangeDto changeStatus(const std::vector<std::string>& locationIds,
+                                               models::LocationStatus status);
     
     // Validation
     bool isValidLocation(const models::Location& location, std::string& errorMessage);
@@ -43,13 +71,43 @@ public:
     // Route optimization
     std::vector<dtos::LocationDto> optimizePickingRoute(const std::vector<std::string>& locationIds);
     
+    /**
+     * @brief Plan a pick route through locations of one warehouse
+     * 
+     * Locations that do not exist or belong to another warehouse are
+     * reported in unresolvedLocationIds rather than failing the request.
+     * @throws std::invalid_argument if warehouseId or locationIds is empty
+     */
+    dtos::PickRouteDto planPickRoute(const std::string& warehouseId, const std::vector<std::string>& locationIds);
+    
+    /**
+     * @brief Stream a CSV or NDJSON upload of locations into a warehouse
+     * 
+     * Lines are validated one at a time and loaded in chunks, each chunk in
+     * its own COPY transaction followed by a batch of location.created
+     * events. Invalid lines and codes that already exist are rejected
+     * without failing the import.
+     * @throws std::invalid_argument if warehouseId is empty or not a UUID, or the CSV header is invalid
+     */
+    dtos::LocationImportResultDto importLocations(const std::string& warehouseId,
+                                                  std::istream& input,
+                                                  utils::ImportFormat format,
+                                                  const std::string& createdBy);
+    
 private:
     std::shared_ptr<repositories::LocationRepository> repo_;
+    std::shared_ptr<utils::MessageBus> messageBus_;
+    std::vector<std::shared_ptr<LocationChangeListener>> listeners_;
+    PickRouteOptimizer routeOptimizer_;
     
     // Helper methods for DTO conversion (DRY pattern)
     dtos::LocationDto convertToDto(const models::Location& location);
     std::vector<dtos::LocationDto> convertToDtos(const std::vector<models::Location>& locations);
     
+    dtos::LocationDto transitionLocation(const std::string& id, models::LocationStatus status);
+    void publishUpdated(const std::vector<models::Location>& locations);
+    void notifyChanged(const models::Location& location);
+    
     bool validateCode(const std::string& code);
     bool validateDimensions(const models::Dimensions& dimensions);
 };
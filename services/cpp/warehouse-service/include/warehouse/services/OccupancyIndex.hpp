@@ -0,0 +1,141 @@
+#pragma once
+
+#include "warehouse/models/Location.hpp"
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace warehouse::services {
+
+/**
+ * @brief Aggregated fill of a group of locations
+ */
+struct OccupancyCounters {
+    std::int64_t totalBins = 0;
+    std::int64_t occupiedBins = 0;
+    double volumeUsed = 0.0;       // m^3
+    double volumeCapacity = 0.0;   // m^3
+    double weightUsed = 0.0;       // kg
+    double weightCapacity = 0.0;   // kg, locations without a weight limit add nothing
+
+    std::int64_t freeBins() const { return totalBins - occupiedBins; }
+};
+
+enum class OccupancyScope {
+    Warehouse,
+    Zone,
+    Aisle,
+    Level
+};
+
+std::string occupancyScopeToString(OccupancyScope scope);
+OccupancyScope stringToOccupancyScope(const std::string& str);
+
+/**
+ * @brief Counters for one node of the warehouse / zone / aisle / level tree
+ *
+ * Coordinates deeper than the scope are empty; locations without a zone,
+ * aisle or level are grouped under an empty name at that depth.
+ */
+struct OccupancyBucket {
+    OccupancyScope scope = OccupancyScope::Warehouse;
+    std::string zone;
+    std::string aisle;
+    std::string level;
+    OccupancyCounters counters;
+};
+
+/**
+ * @brief Stock currently held at a location
+ */
+struct StockLevel {
+    std::int64_t units = 0;
+    double volume = 0.0;   // m^3
+    double weight = 0.0;   // kg
+};
+
+/**
+ * @brief Incrementally maintained occupancy counters per warehouse
+ *
+ * Every location contributes to four buckets: its warehouse, zone, aisle
+ * and level. Location and stock changes subtract the location's old
+ * contribution and add the new one, so updates cost O(1) and reading a
+ * warehouse costs O(buckets) rather than a join over locations and stock.
+ * Inactive locations are tracked but not counted. rebuild() recomputes a
+ * warehouse from scratch to correct drift from missed events or
+ * floating-point accumulation.
+ *
+ * Thread-safe: reads share a lock, updates take it exclusively.
+ */
+class OccupancyIndex {
+public:
+    /**
+     * @brief Register or refresh a location; stock held there is preserved
+     */
+    void upsertLocation(const models::Location& location);
+    void removeLocation(const std::string& locationId);
+
+    /**
+     * @brief Apply stock arriving at (positive) or leaving (negative) a location
+     * @return false if the location is unknown
+     */
+    bool applyStockChange(const std::string& locationId, std::int64_t unitsDelta,
+                          double volumeDelta, double weightDelta);
+    std::optional<StockLevel> stockOf(const std::string& locationId) const;
+
+    /**
+     * @brief Replace a warehouse's locations and recompute its buckets
+     * @param units Authoritative unit counts by location id, if available;
+     *              locations missing from the map are treated as empty.
+     *              Without it, tracked stock is kept for surviving locations.
+     */
+    void rebuild(const std::string& warehouseId,
+                 const std::vector<models::Location>& locations,
+                 const std::optional<std::unordered_map<std::string, std::int64_t>>& units = std::nullopt);
+
+    /**
+     * @brief Buckets of a warehouse down to the given depth, parents before children
+     */
+    std::vector<OccupancyBucket> buckets(const std::string& warehouseId,
+                                         OccupancyScope depth = OccupancyScope::Level) const;
+    std::optional<OccupancyCounters> totals(const std::string& warehouseId) const;
+
+    std::size_t size() const;
+
+private:
+    struct Entry {
+        std::string warehouseId;
+        std::string zone;
+        std::string aisle;
+        std::string level;
+        double volumeCapacity = 0.0;
+        double weightCapacity = 0.0;
+        StockLevel stock;
+        bool counted = false;
+    };
+
+    // Ordered so that iteration is a pre-order walk of the tree
+    struct BucketKey {
+        std::string zone;
+        std::string aisle;
+        std::string level;
+        int depth = 0;
+
+        bool operator<(const BucketKey& other) const;
+    };
+
+    using BucketMap = std::map<BucketKey, OccupancyCounters>;
+
+    std::unordered_map<std::string, Entry> entries_;
+    std::unordered_map<std::string, BucketMap> warehouses_;
+    mutable std::shared_mutex mutex_;
+
+    static Entry makeEntry(const models::Location& location);
+    void apply(const Entry& entry, int sign);
+};
+
+} // namespace warehouse::services
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "warehouse/dtos/OccupancyDto.hpp"
+#include "warehouse/services/LocationChangeListener.hpp"
+#include "warehouse/services/OccupancyIndex.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace warehouse::repositories {
+    class LocationRepository; // Forward declaration
+}
+
+namespace warehouse::services {
+
+/**
+ * @brief Live zone / aisle / level occupancy backed by incremental counters
+ * 
+ * A warehouse is loaded into the OccupancyIndex on first request; after
+ * that, location changes arrive through LocationChangeListener and stock
+ * changes through recordStockMovement. A background recompute reloads each
+ * loaded warehouse at a fixed interval to correct drift.
+ */
+class OccupancyService : public LocationChangeListener {
+public:
+    // Units held per location id for a warehouse, from the inventory database
+    using StockSource = std::function<std::unordered_map<std::string, std::int64_t>(const std::string& warehouseId)>;
+    
+    explicit OccupancyService(std::shared_ptr<repositories::LocationRepository> repo,
+                              StockSource stockSource = nullptr);
+    ~OccupancyService();
+    
+    /**
+     * @brief Occupancy tree of a warehouse down to the given depth
+     * @throws std::invalid_argument if warehouseId is empty
+     */
+    dtos::OccupancyDto getOccupancy(const std::string& warehouseId, OccupancyScope depth);
+    
+    void onLocationChanged(const models::Location& location) override;
+    void onLocationRemoved(const std::string& locationId) override;
+    
+    /**
+     * @brief Apply stock arriving at (positive) or leaving (negative) a location
+     * @param quantity Number of units moved
+     * @param unitDimensions Product dimensions of a single unit, if known
+     * @param unitWeight Product weight of a single unit, if known
+     * @return false if the location is not indexed
+     */
+    bool recordStockMovement(const std::string& locationId,
+                             int quantity,
+                             const std::optional<models::Dimensions>& unitDimensions,
+                             const std::optional<models::Weight>& unitWeight);
+    
+    // Warm start from a snapshot, see SnapshotService
+    std::vector<std::string> loadedWarehouses();
+    void preload(const std::string& warehouseId, const std::vector<models::Location>& locations);
+    bool restoreStock(const std::string& locationId, const StockLevel& stock);
+    std::optional<StockLevel> stockOf(const std::string& locationId) const;
+    
+    // Drift correction
+    void recompute(const std::string& warehouseId);
+    void recomputeAll();
+    void startPeriodicRecompute(std::chrono::seconds interval);
+    void stop();
+
+private:
+    std::shared_ptr<repositories::LocationRepository> repo_;
+    StockSource stockSource_;
+    OccupancyIndex index_;
+    
+    std::mutex loadMutex_;
+    std::unordered_set<std::string> loadedWarehouses_;
+    
+    std::mutex timerMutex_;
+    std::condition_variable timerCondition_;
+    std::thread timerThread_;
+    bool stopping_ = false;
+    
+    void ensureLoaded(const std::string& warehouseId);
+    void load(const std::string& warehouseId);
+};
+
+} // namespace warehouse::services
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "warehouse/models/Location.hpp"
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace warehouse::services {
+
+/**
+ * @brief Walkable position of a location on the warehouse floor
+ *
+ * x runs across the aisles, y runs down an aisle from the front
+ * cross-aisle (y = 0) towards the back cross-aisle. Level does not
+ * change walking distance but is kept for ordering and reporting.
+ */
+struct FloorCoordinate {
+    double x = 0.0;
+    double y = 0.0;
+    int level = 0;
+};
+
+/**
+ * @brief Geometry used to turn zone/aisle/bay/level into floor coordinates
+ *
+ * Models the common parallel-aisle block layout: every aisle is reachable
+ * from a front and a back cross-aisle, and zones are laid out side by side.
+ */
+struct LayoutConfig {
+    double aisleSpacing = 3.0;   // metres between aisle centrelines
+    double bayWidth = 1.2;       // metres per bay along an aisle
+    int baysPerAisle = 50;       // aisle length in bays (front to back)
+    double zoneWidth = 120.0;    // metres reserved per zone along x
+};
+
+/**
+ * @brief Derives floor coordinates and walking distances from locations
+ */
+class WarehouseLayout {
+public:
+    explicit WarehouseLayout(LayoutConfig config = {});
+
+    /**
+     * @brief Floor position of a location
+     *
+     * Aisle labels are expected to be numbers ("07") or letters ("C"). The
+     * aisle offset is clamped to the zone, so a label whose ordinal runs past
+     * zoneWidth (such as "B12") lands on the zone's last aisle line instead
+     * of inside the next zone.
+     */
+    FloorCoordinate coordinateOf(const models::Location& location) const;
+
+    /**
+     * @brief Shortest walk between two points
+     *
+     * Points in the same aisle are joined along the aisle; otherwise the
+     * picker leaves through whichever cross-aisle (front or back) is shorter.
+     */
+    double distance(const FloorCoordinate& a, const FloorCoordinate& b) const;
+
+    double aisleLength() const { return aisleLength_; }
+    const LayoutConfig& config() const { return config_; }
+
+    /**
+     * @brief Numeric ordinal of a zone/aisle/bay/level label
+     *
+     * "07" -> 7, "C" -> 3, "AB" -> 28, "B12" -> 2012. Missing labels map to 0;
+     * over-long ones saturate at kMaxLabelOrdinal instead of overflowing.
+     */
+    static int labelOrdinal(const std::optional<std::string>& label);
+
+    static constexpr int kMaxLabelOrdinal = 1'000'000;
+
+private:
+    LayoutConfig config_;
+    double aisleLength_;
+};
+
+/**
+ * @brief Result of a pick-route optimisation
+ */
+struct PickRoute {
+    std::vector<std::size_t> sequence;   // indices into the input stops
+    double distance = 0.0;               // depot -> stops -> depot, metres
+    std::string strategy;                // construction heuristic that won
+    int improvements = 0;                // 2-opt moves applied
+};
+
+/**
+ * @brief Near-optimal pick sequencing for a single picker tour
+ *
+ * Builds S-shape and largest-gap tours, which are the standard routing
+ * policies for parallel-aisle warehouses, then refines the shorter one
+ * with 2-opt over a precomputed distance matrix. The tour starts and
+ * ends at the depot.
+ */
+class PickRouteOptimizer {
+public:
+    explicit PickRouteOptimizer(WarehouseLayout layout = WarehouseLayout(), int maxTwoOptPasses = 50);
+
+    PickRoute optimize(const std::vector<FloorCoordinate>& stops,
+                       const FloorCoordinate& depot = {}) const;
+
+    // Construction heuristics, exposed for testing and comparison
+    std::vector<std::size_t> sShapeSequence(const std::vector<FloorCoordinate>& stops) const;
+    std::vector<std::size_t> largestGapSequence(const std::vector<FloorCoordinate>& stops) const;
+
+    double routeDistance(const std::vector<std::size_t>& sequence,
+                         const std::vector<FloorCoordinate>& stops,
+                         const FloorCoordinate& depot) const;
+
+    const WarehouseLayout& layout() const { return layout_; }
+
+private:
+    WarehouseLayout layout_;
+    int maxTwoOptPasses_;
+
+    struct Aisle {
+        double x;
+        std::vector<std::size_t> stops;   // sorted by y ascending
+    };
+
+    std::vector<Aisle> groupByAisle(const std::vector<FloorCoordinate>& stops) const;
+
+    int twoOpt(std::vector<std::size_t>& tour, const std::vector<double>& matrix, std::size_t n) const;
+};
+
+} // namespace warehouse::services
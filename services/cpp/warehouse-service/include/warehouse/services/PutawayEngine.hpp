@@ -0,0 +1,145 @@
+#pragma once
+
+#include "warehouse/models/Location.hpp"
+#include "warehouse/services/PickRouteOptimizer.hpp"
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace warehouse::services {
+
+/**
+ * @brief Goods to be put away, normalised to metres and kilograms
+ */
+struct PutawayLoad {
+    double volume = 0.0;                         // m^3
+    double weight = 0.0;                         // kg
+    std::optional<std::array<double, 3>> size;   // m, any orientation
+    std::optional<std::string> preferredZone;
+    bool requiresTemperatureControl = false;
+
+    static PutawayLoad fromDimensions(const models::Dimensions& dimensions,
+                                      const std::optional<models::Weight>& weight);
+};
+
+/**
+ * @brief Current fill of a location
+ */
+struct LocationUtilisation {
+    double usedVolume = 0.0;       // m^3
+    double usedWeight = 0.0;       // kg
+    double capacityVolume = 0.0;   // m^3
+    double capacityWeight = 0.0;   // kg, 0 when the location has no weight limit
+};
+
+struct PutawayCandidate {
+    std::string locationId;
+    std::string code;
+    std::optional<std::string> zone;
+    double score = 0.0;        // 0..1, higher is better
+    double fit = 0.0;          // fraction of remaining capacity the load would use
+    double distance = 0.0;     // metres from the nearest receiving location
+    double freeVolume = 0.0;   // m^3 before the load
+    double freeWeight = 0.0;   // kg before the load, 0 when unlimited
+};
+
+/**
+ * @brief Relative importance of the scoring terms and search bounds
+ */
+struct PutawayWeights {
+    double fit = 0.5;
+    double distance = 0.35;
+    double zone = 0.15;
+    std::size_t oversample = 4;       // feasible candidates gathered per requested result
+    std::size_t maxExamined = 2048;   // hard cap on locations looked at per query
+};
+
+/**
+ * @brief Incremental putaway candidate index
+ *
+ * Each eligible location sits in a free-volume bucket (quarter-octave
+ * classes, so locations in one bucket differ by at most ~19% in free
+ * space). A query starts at the smallest bucket that can hold the load and
+ * walks upwards, so tight fits are seen first and only a bounded number of
+ * locations is examined regardless of warehouse size. Utilisation changes
+ * move a location between buckets in O(1).
+ *
+ * Thread-safe: queries share a read lock, updates take a write lock.
+ */
+class PutawayEngine {
+public:
+    explicit PutawayEngine(WarehouseLayout layout = WarehouseLayout(), PutawayWeights weights = {});
+
+    /**
+     * @brief Register or refresh a location's capacity and eligibility
+     *
+     * Current utilisation is preserved across refreshes.
+     */
+    void upsertLocation(const models::Location& location);
+    void removeLocation(const std::string& locationId);
+
+    /**
+     * @brief Apply a change in stored goods (positive when goods arrive)
+     * @return false if the location is unknown
+     */
+    bool adjustUtilisation(const std::string& locationId, double volumeDelta, double weightDelta);
+    bool setUtilisation(const std::string& locationId, double usedVolume, double usedWeight);
+    std::optional<LocationUtilisation> utilisationOf(const std::string& locationId) const;
+
+    /**
+     * @brief Best k locations in a warehouse for the given load
+     */
+    std::vector<PutawayCandidate> suggest(const std::string& warehouseId,
+                                          const PutawayLoad& load,
+                                          std::size_t k) const;
+
+    std::size_t size() const;
+
+    static double toCubicMetres(const models::Dimensions& dimensions);
+    static double toMetres(double value, const std::string& unit);
+    static double toKilograms(const models::Weight& weight);
+
+private:
+    static constexpr int kBucketCount = 96;
+
+    struct Slot {
+        std::string id;
+        std::string warehouseId;
+        std::string code;
+        std::optional<std::string> zone;
+        std::optional<std::array<double, 3>> size;   // sorted ascending, m
+        FloorCoordinate coordinate;
+        LocationUtilisation utilisation;
+        bool temperatureControlled = false;
+        bool eligible = false;
+        bool live = false;
+        int bucket = -1;
+        std::size_t bucketPosition = 0;
+    };
+
+    struct WarehouseIndex {
+        std::array<std::vector<std::size_t>, kBucketCount> buckets;
+        std::unordered_map<std::string, FloorCoordinate> receivingPoints;   // by location id
+    };
+
+    WarehouseLayout layout_;
+    PutawayWeights weights_;
+
+    std::vector<Slot> slots_;
+    std::vector<std::size_t> freeSlots_;
+    std::unordered_map<std::string, std::size_t> slotById_;
+    std::unordered_map<std::string, WarehouseIndex> warehouses_;
+    mutable std::shared_mutex mutex_;
+
+    static int bucketFor(double freeVolume);
+    static std::optional<double> metresPerUnit(const std::string& unit);
+    double distanceFromReceiving(const WarehouseIndex& index, const FloorCoordinate& coordinate) const;
+    void rebucket(std::size_t slotIndex);
+    void unbucket(std::size_t slotIndex);
+};
+
+} // namespace warehouse::services
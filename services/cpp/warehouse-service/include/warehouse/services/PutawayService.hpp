@@ -0,0 +1,74 @@
+#pragma once
+
+#include "warehouse/dtos/PutawaySuggestionDto.hpp"
+#include "warehouse/services/LocationChangeListener.hpp"
+#include "warehouse/services/PutawayEngine.hpp"
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace warehouse::repositories {
+    class LocationRepository; // Forward declaration
+}
+
+namespace warehouse::services {
+
+/**
+ * @brief Putaway location suggestions backed by an in-memory capacity index
+ * 
+ * Locations of a warehouse are loaded into the PutawayEngine on first use;
+ * afterwards the index is kept current through refreshLocation/removeLocation
+ * and recordStockMovement rather than re-reading the database.
+ */
+class PutawayService : public LocationChangeListener {
+public:
+    explicit PutawayService(std::shared_ptr<repositories::LocationRepository> repo);
+    
+    /**
+     * @brief Top candidate locations for a received pallet or case
+     * @throws std::invalid_argument on empty warehouseId or limit outside 1..50
+     */
+    dtos::PutawaySuggestionListDto suggest(const std::string& warehouseId,
+                                           const PutawayLoad& load,
+                                           int limit);
+    
+    // Index maintenance
+    void refreshLocation(const models::Location& location);
+    void removeLocation(const std::string& locationId);
+    void onLocationChanged(const models::Location& location) override { refreshLocation(location); }
+    void onLocationRemoved(const std::string& locationId) override { removeLocation(locationId); }
+    
+    /**
+     * @brief Apply stock arriving at (positive) or leaving (negative) a location
+     * @param quantity Number of units moved
+     * @param unitDimensions Product dimensions of a single unit
+     * @param unitWeight Product weight of a single unit, if known
+     * @return false if the location is not indexed
+     */
+    bool recordStockMovement(const std::string& locationId,
+                             int quantity,
+                             const models::Dimensions& unitDimensions,
+                             const std::optional<models::Weight>& unitWeight);
+    
+    // Warm start from a snapshot, see SnapshotService
+    std::vector<std::string> loadedWarehouses();
+    void preload(const std::string& warehouseId, const std::vector<models::Location>& locations);
+    bool restoreUtilisation(const std::string& locationId, double usedVolume, double usedWeight);
+    std::optional<LocationUtilisation> utilisationOf(const std::string& locationId) const;
+    
+    static constexpr int kMaxSuggestions = 50;
+
+private:
+    std::shared_ptr<repositories::LocationRepository> repo_;
+    PutawayEngine engine_;
+    
+    std::mutex loadMutex_;
+    std::unordered_set<std::string> loadedWarehouses_;
+    
+    void ensureLoaded(const std::string& warehouseId);
+};
+
+} // namespace warehouse::services
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "warehouse/services/PickRouteOptimizer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace warehouse::services {
+
+/**
+ * @brief One pick taken from a slot (a product stored at a location)
+ *
+ * Slots are interned to dense indices by the loader so aggregation works
+ * on flat arrays instead of hashing UUID strings per movement.
+ */
+struct PickEvent {
+    std::uint32_t slot = 0;
+    std::int32_t quantity = 0;
+};
+
+struct SlotVelocity {
+    std::uint64_t picks = 0;   // pick events in the period
+    std::uint64_t units = 0;   // units picked in the period
+};
+
+/**
+ * @brief A product currently stored at a pick location
+ */
+struct SlotAssignment {
+    std::string productId;
+    std::string locationId;
+    std::optional<std::string> zone;
+    FloorCoordinate coordinate;
+    SlotVelocity velocity;
+};
+
+/**
+ * @brief Proposed exchange of two products' locations
+ */
+struct SlotSwap {
+    std::size_t fastSlot = 0;        // index into the assignments, moves closer
+    std::size_t slowSlot = 0;        // index into the assignments, moves further out
+    double estimatedSaving = 0.0;    // metres of travel saved over the period
+};
+
+struct SlottingOptions {
+    unsigned threads = 0;            // 0 = hardware concurrency
+    std::size_t maxSwaps = 500;
+    bool sameZoneOnly = false;       // only swap products within one zone
+};
+
+/**
+ * @brief Velocity-based slotting
+ *
+ * Expected travel for a slot is its pick count times the round trip from
+ * the depot to its location. Total travel is minimised when pick counts
+ * and travel distances are ranked in opposite order, so the optimiser
+ * compares each slot's velocity rank with its distance rank and pairs
+ * fast movers that sit too far out with slow movers that occupy near
+ * locations. Pairs are disjoint, so each swap's saving is independent of
+ * the others and the list can be applied in any prefix.
+ */
+class SlottingOptimizer {
+public:
+    explicit SlottingOptimizer(WarehouseLayout layout = WarehouseLayout(), SlottingOptions options = {});
+
+    /**
+     * @brief Aggregate pick events per slot, partitioned across threads
+     */
+    std::vector<SlotVelocity> computeVelocity(const std::vector<PickEvent>& events,
+                                              std::size_t slotCount) const;
+
+    /**
+     * @brief Ranked swaps, largest saving first
+     */
+    std::vector<SlotSwap> proposeSwaps(const std::vector<SlotAssignment>& slots,
+                                       const FloorCoordinate& depot = {}) const;
+
+    /**
+     * @brief Expected travel in metres for the current assignment
+     */
+    double expectedTravel(const std::vector<SlotAssignment>& slots,
+                          const FloorCoordinate& depot = {}) const;
+
+    const SlottingOptions& options() const { return options_; }
+
+private:
+    WarehouseLayout layout_;
+    SlottingOptions options_;
+
+    unsigned threadCount(std::size_t work) const;
+    void pairWithinGroup(const std::vector<SlotAssignment>& slots,
+                         const std::vector<std::size_t>& group,
+                         const std::vector<double>& travel,
+                         std::vector<SlotSwap>& swaps) const;
+};
+
+} // namespace warehouse::services
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace warehouse::repositories {
+    class LocationRepository; // Forward declaration
+}
+
+namespace warehouse::services {
+
+class PutawayService;
+class OccupancyService;
+
+/**
+ * @brief Cold-start snapshot of the putaway and occupancy indexes
+ * 
+ * On startup restore() maps the last snapshot and loads its warehouses into
+ * both indexes, so requests are served without first reading every
+ * location from the database. Locations created or updated after the
+ * snapshot's watermark are then re-read and applied. save() writes the
+ * current state; it runs at a fixed interval and once more on shutdown.
+ * 
+ * Locations deleted while the service was down are not visible through the
+ * watermark, so the snapshot's ids are also checked against the warehouses'
+ * current ids and the missing ones dropped from both indexes.
+ */
+class SnapshotService {
+public:
+    SnapshotService(std::shared_ptr<repositories::LocationRepository> repo,
+                    std::shared_ptr<PutawayService> putawayService,
+                    std::shared_ptr<OccupancyService> occupancyService,
+                    std::string path);
+    ~SnapshotService();
+    
+    /**
+     * @brief Warm the indexes from the snapshot file, if there is a usable one
+     * @return false if no snapshot was restored; the indexes then load lazily
+     */
+    bool restore();
+    
+    /**
+     * @brief Write every loaded warehouse to the snapshot file
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save();
+    
+    void startPeriodicSave(std::chrono::seconds interval);
+    void stop();
+
+private:
+    std::shared_ptr<repositories::LocationRepository> repo_;
+    std::shared_ptr<PutawayService> putawayService_;
+    std::shared_ptr<OccupancyService> occupancyService_;
+    std::string path_;
+    
+    std::mutex saveMutex_;
+    
+    std::mutex timerMutex_;
+    std::condition_variable timerCondition_;
+    std::thread timerThread_;
+    bool stopping_ = false;
+};
+
+} // namespace warehouse::services
@@ -2,15 +2,41 @@
 
 #include <pqxx/pqxx>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace warehouse::utils {
 
 /**
  * @brief Database connection and query utilities for PostgreSQL
+ *
+ * One pqxx connection, which must not run two transactions at once: each
+ * transaction holds the connection's lock until it is destroyed, so threads
+ * sharing a Database take turns. Give a background worker a Database of its
+ * own rather than have it queue behind request handlers.
  */
 class Database {
 public:
+    /**
+     * @brief A pqxx::work that keeps the connection locked while it lives
+     */
+    class Transaction {
+    public:
+        Transaction(std::unique_lock<std::mutex> lock, std::unique_ptr<pqxx::work> work)
+            : lock_(std::move(lock))
+            , work_(std::move(work)) {
+        }
+        
+        pqxx::work* operator->() const { return work_.get(); }
+        pqxx::work& operator*() const { return *work_; }
+        
+    private:
+        // Declared first so the lock is released only after the work is gone
+        std::unique_lock<std::mutex> lock_;
+        std::unique_ptr<pqxx::work> work_;
+    };
+    
+
     struct Config {
         std::string host = "localhost";
         int port = 5432;
@@ -28,8 +54,8 @@ public:
     void disconnect();
     bool isConnected() const;
     
-    // Transaction support
-    std::unique_ptr<pqxx::work> beginTransaction();
+    // Transaction support; blocks while another thread's transaction is open
+    Transaction beginTransaction();
     
     // Query execution
     pqxx::result execute(const std::string& query);
@@ -47,6 +73,7 @@ private:
     Config config_;
     std::string connectionString_;
     std::unique_ptr<pqxx::connection> connection_;
+    std::mutex mutex_;   // pqxx connections are not safe to share between threads
     
     std::string buildConnectionString() const;
 };
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "warehouse/models/Location.hpp"
+#include <istream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace warehouse::utils {
+
+enum class ImportFormat {
+    Csv,
+    NdJson
+};
+
+/**
+ * @brief One parsed line of a bulk import
+ *
+ * Either location is set, or error describes why the line was rejected.
+ */
+struct ImportRow {
+    std::size_t line = 0;
+    std::optional<models::Location> location;
+    std::string error;
+};
+
+/**
+ * @brief Streaming reader for bulk location imports
+ *
+ * Reads one line at a time from the stream, so memory use does not grow
+ * with the size of the upload. CSV input must start with a header row;
+ * recognised columns are code, type, name, zone, aisle, bay, level, bin,
+ * barcode, status, maxVolume, isPickable, isReceivable,
+ * temperatureControlled and requiresEquipment. NDJSON lines use the same
+ * field names. Every location is assigned to the given warehouse.
+ */
+class LocationImportReader {
+public:
+    LocationImportReader(std::istream& input, ImportFormat format,
+                         std::string warehouseId, std::string createdBy);
+
+    /**
+     * @brief Read the next non-empty line
+     * @return false at end of input
+     * @throws std::invalid_argument if the CSV header is missing or has no code/type column
+     */
+    bool next(ImportRow& row);
+
+    static std::optional<ImportFormat> formatFromContentType(const std::string& contentType);
+
+    // Split one CSV record, honouring double-quoted fields and "" escapes
+    static std::vector<std::string> splitCsvLine(const std::string& line);
+
+private:
+    std::istream& input_;
+    ImportFormat format_;
+    std::string warehouseId_;
+    std::string createdBy_;
+    std::vector<std::string> columns_;
+    std::size_t lineNumber_ = 0;
+    bool headerRead_ = false;
+
+    void readHeader();
+    models::Location buildLocation(const nlohmann::json& fields) const;
+};
+
+} // namespace warehouse::utils
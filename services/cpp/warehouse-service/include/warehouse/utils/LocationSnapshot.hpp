@@ -0,0 +1,79 @@
+#pragma once
+
+#include "warehouse/models/Location.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace warehouse::utils {
+
+/**
+ * @brief Versioned, checksummed binary snapshot of the in-memory location state
+ *
+ * Layout: a fixed header, an array of fixed-size location records, an
+ * array of warehouse ids, then a string pool that every string field points
+ * into by (offset, length). The file is memory-mapped read-only, so opening
+ * it costs one checksum pass and locations are decoded on demand.
+ * Only the fields the in-memory indexes use are stored; metadata and
+ * temperature ranges are left to the database.
+ *
+ * Files are written to a temporary name, fsynced, renamed, and the
+ * directory fsynced, so a crash mid-write never leaves a truncated
+ * snapshot behind.
+ */
+class LocationSnapshot {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+
+    // Stock held at a location when the snapshot was taken
+    struct Stock {
+        std::int64_t units = 0;
+        double volume = 0.0;   // m^3
+        double weight = 0.0;   // kg
+    };
+
+    struct Entry {
+        models::Location location;
+        Stock stock;
+    };
+
+    ~LocationSnapshot();
+    LocationSnapshot(const LocationSnapshot&) = delete;
+    LocationSnapshot& operator=(const LocationSnapshot&) = delete;
+
+    /**
+     * @brief Write a snapshot atomically
+     * @param warehouseIds Warehouses whose locations are complete in entries
+     */
+    static void write(const std::string& path,
+                      const std::vector<std::string>& warehouseIds,
+                      const std::vector<Entry>& entries);
+
+    /**
+     * @brief Map and verify a snapshot
+     * @throws std::runtime_error if the file is missing, truncated, from another
+     *         format version or fails its checksum
+     */
+    static std::unique_ptr<LocationSnapshot> open(const std::string& path);
+
+    std::size_t size() const;
+    Entry entry(std::size_t index) const;
+    std::vector<std::string> warehouseIds() const;
+
+    // Latest created/updated time of any location; catch up from here
+    std::chrono::system_clock::time_point watermark() const;
+
+private:
+    LocationSnapshot(const std::byte* data, std::size_t length);
+
+    const std::byte* data_;
+    std::size_t length_;
+
+    std::string_view string(std::uint32_t offset, std::uint32_t length) const;
+};
+
+} // namespace warehouse::utils
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "warehouse/utils/MessageBus.hpp"
+
+#include <amqp.h>
+#include <amqp_tcp_socket.h>
+#include <mutex>
+
+namespace warehouse::utils {
+
+class RabbitMqMessageBus : public MessageBus {
+public:
+    explicit RabbitMqMessageBus(const MessageBus::Config& config);
+    ~RabbitMqMessageBus() override;
+
+    void publish(const std::string& routingKey,
+                 const nlohmann::json& payload) override;
+
+    void publishBatch(const std::string& routingKey,
+                      const std::vector<nlohmann::json>& payloads) override;
+
+    bool isConnected() const;
+
+private:
+    void connect();
+    void close();
+    bool publishLocked(const std::string& fullRoutingKey, const std::string& body);
+
+    MessageBus::Config config_;
+    amqp_connection_state_t connection_;
+    amqp_socket_t* socket_;
+    amqp_channel_t channel_;
+    std::mutex publishMutex_;   // a channel must not be used from several threads at once
+};
+
+} // namespace warehouse::utils
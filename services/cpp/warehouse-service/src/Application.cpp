@@ -1,4 +1,12 @@
 #include "warehouse/Application.hpp"
+#include "warehouse/repositories/WarehouseRepository.hpp"
+#include "warehouse/repositories/LocationRepository.hpp"
+#include "warehouse/services/WarehouseService.hpp"
+#include "warehouse/services/LocationService.hpp"
+#include "warehouse/services/PutawayService.hpp"
+#include "warehouse/services/OccupancyService.hpp"
+#include "warehouse/services/SnapshotService.hpp"
+#include "warehouse/utils/RabbitMqMessageBus.hpp"
 #include <thread>
 #include <chrono>
 
@@ -77,6 +85,23 @@ void Application::shutdown() {
         server_->stop();
     }
     
+    if (snapshotService_) {
+        snapshotService_->stop();
+        try {
+            snapshotService_->save();
+        } catch (const std::exception& e) {
+            utils::Logger::error("Snapshot on shutdown failed: {}", e.what());
+        }
+    }
+    
+    if (occupancyService_) {
+        occupancyService_->stop();
+    }
+    
+    if (backgroundDatabase_) {
+        backgroundDatabase_->disconnect();
+    }
+    
     if (database_) {
         database_->disconnect();
     }
@@ -100,6 +125,12 @@ bool Application::loadConfiguration(const std::string& configFile) {
     config.setFromEnv("database.user", "DB_USER");
     config.setFromEnv("database.password", "DB_PASSWORD");
     config.setFromEnv("database.database", "DB_NAME");
+    config.setFromEnv("inventory.databaseUrl", "INVENTORY_DB_URL");
+    config.setFromEnv("snapshot.path", "WAREHOUSE_SNAPSHOT_PATH");
+    config.setFromEnv("messageBus.host", "RABBITMQ_HOST");
+    config.setFromEnv("messageBus.virtualHost", "RABBITMQ_VHOST");
+    config.setFromEnv("messageBus.username", "RABBITMQ_USER");
+    config.setFromEnv("messageBus.password", "RABBITMQ_PASSWORD");
     
     return true;
 }
@@ -108,28 +139,91 @@ bool Application::initializeDatabase() {
     auto& config = utils::Config::instance();
     auto dbConfig = config.getDatabaseConfig();
     
-    database_ = std::make_shared<utils::Database>(
-        utils::Database::Config{
-            .host = dbConfig.host,
-            .port = dbConfig.port,
-            .database = dbConfig.database,
-            .user = dbConfig.user,
-            .password = dbConfig.password,
-            .maxConnections = dbConfig.maxConnections
-        }
-    );
+    utils::Database::Config databaseConfig{
+        .host = dbConfig.host,
+        .port = dbConfig.port,
+        .database = dbConfig.database,
+        .user = dbConfig.user,
+        .password = dbConfig.password,
+        .maxConnections = dbConfig.maxConnections
+    };
+    database_ = std::make_shared<utils::Database>(databaseConfig);
     
     if (!database_->connect()) {
         return false;
     }
     
+    // The occupancy and snapshot timers get their own connection rather than
+    // queueing behind the request handlers'
+    backgroundDatabase_ = std::make_shared<utils::Database>(databaseConfig);
+    if (!backgroundDatabase_->connect()) {
+        return false;
+    }
+    
     utils::Logger::info("Database connection established");
     return true;
 }
 
 bool Application::initializeServices() {
-    // TODO: Initialize repositories and services
-    // This will be implemented when the repository/service implementations are done
+    auto& config = utils::Config::instance();
+    
+    utils::Logger::info("Initializing RabbitMQ message bus...");
+    messageBus_ = std::make_shared<utils::RabbitMqMessageBus>(
+        utils::MessageBus::Config{
+            .host = config.getString("messageBus.host", "rabbitmq"),
+            .port = config.getInt("messageBus.port", 5672),
+            .virtual_host = config.getString("messageBus.virtualHost", "/"),
+            .username = config.getString("messageBus.username", "warehouse"),
+            .password = config.getString("messageBus.password", "warehouse_dev"),
+            .exchange = config.getString("messageBus.exchange", "warehouse.events"),
+            .routing_key_prefix = config.getString("messageBus.routingKeyPrefix", "warehouse.")
+        }
+    );
+    
+    auto warehouseRepository = std::make_shared<repositories::WarehouseRepository>(database_);
+    auto locationRepository = std::make_shared<repositories::LocationRepository>(database_);
+    auto backgroundLocationRepository = std::make_shared<repositories::LocationRepository>(backgroundDatabase_);
+    
+    warehouseService_ = std::make_shared<services::WarehouseService>(warehouseRepository);
+    locationService_ = std::make_shared<services::LocationService>(locationRepository, messageBus_);
+    putawayService_ = std::make_shared<services::PutawayService>(locationRepository);
+    
+    // Occupancy drift correction reads unit counts straight from inventory_db when configured
+    services::OccupancyService::StockSource stockSource;
+    auto inventoryDbUrl = config.getString("inventory.databaseUrl", "");
+    if (!inventoryDbUrl.empty()) {
+        stockSource = [inventoryDbUrl](const std::string& warehouseId) {
+            pqxx::connection conn(inventoryDbUrl);
+            pqxx::read_transaction txn(conn);
+            auto result = txn.exec_params(
+                "SELECT location_id::text, SUM(quantity)::bigint FROM inventory "
+                "WHERE warehouse_id = $1 GROUP BY location_id",
+                warehouseId);
+            std::unordered_map<std::string, std::int64_t> units;
+            units.reserve(result.size());
+            for (const auto& row : result) {
+                units.emplace(row[0].as<std::string>(), row[1].as<std::int64_t>());
+            }
+            return units;
+        };
+    }
+    occupancyService_ = std::make_shared<services::OccupancyService>(backgroundLocationRepository, stockSource);
+    occupancyService_->startPeriodicRecompute(
+        std::chrono::seconds(config.getInt("occupancy.recomputeIntervalSeconds", 300)));
+    
+    locationService_->addListener(putawayService_);
+    locationService_->addListener(occupancyService_);
+    
+    // Serve from the last snapshot straight away instead of loading every location first
+    auto snapshotPath = config.getString("snapshot.path", "");
+    if (!snapshotPath.empty()) {
+        snapshotService_ = std::make_shared<services::SnapshotService>(
+            backgroundLocationRepository, putawayService_, occupancyService_, snapshotPath);
+        snapshotService_->restore();
+        snapshotService_->startPeriodicSave(
+            std::chrono::seconds(config.getInt("snapshot.intervalSeconds", 600)));
+    }
+    
     utils::Logger::info("Services initialized");
     return true;
 }
@@ -138,7 +232,6 @@ bool Application::initializeServer() {
     auto& config = utils::Config::instance();
     auto serverConfig = config.getServerConfig();
     
-    // TODO: Pass actual service instances when implemented
     server_ = std::make_unique<Server>(
         Server::Config{
             .host = serverConfig.host,
@@ -146,8 +239,10 @@ bool Application::initializeServer() {
             .maxThreads = serverConfig.maxThreads,
             .maxQueued = serverConfig.maxQueued
         },
-        nullptr, // warehouseService
-        nullptr  // locationService
+        warehouseService_,
+        locationService_,
+        putawayService_,
+        occupancyService_
     );
     
     utils::Logger::info("Server initialized on {}:{}", serverConfig.host, serverConfig.port);
@@ -1,6 +1,10 @@
 #include "warehouse/Server.hpp"
 #include "warehouse/controllers/WarehouseController.hpp"
 #include "warehouse/controllers/LocationController.hpp"
+#include "warehouse/controllers/PickRouteController.hpp"
+#include "warehouse/controllers/PutawayController.hpp"
+#include "warehouse/controllers/LocationImportController.hpp"
+#include "warehouse/controllers/OccupancyController.hpp"
 #include "warehouse/controllers/HealthController.hpp"
 #include "warehouse/controllers/SwaggerController.hpp"
 #include "warehouse/controllers/ClaimsController.hpp"
@@ -13,9 +17,13 @@ namespace warehouse {
 class Server::RequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory {
 public:
     RequestHandlerFactory(std::shared_ptr<services::WarehouseService> warehouseService,
-                         std::shared_ptr<services::LocationService> locationService)
+                         std::shared_ptr<services::LocationService> locationService,
+                         std::shared_ptr<services::PutawayService> putawayService,
+                         std::shared_ptr<services::OccupancyService> occupancyService)
         : warehouseService_(warehouseService)
-        , locationService_(locationService) {}
+        , locationService_(locationService)
+        , putawayService_(putawayService)
+        , occupancyService_(occupancyService) {}
     
     Poco::Net::HTTPRequestHandler* createRequestHandler(
         const Poco::Net::HTTPServerRequest& request) override {
@@ -37,6 +45,20 @@ public:
             return new controllers::ClaimsController();
         }
         
+        // Warehouse-scoped planning endpoints served by their own services
+        if (uri.find("/api/v1/warehouses/") == 0 && uri.find("/pick-route") != std::string::npos) {
+            return new controllers::PickRouteController(locationService_);
+        }
+        if (uri.find("/api/v1/warehouses/") == 0 && uri.find("/putaway-suggestions") != std::string::npos) {
+            return new controllers::PutawayController(putawayService_);
+        }
+        if (uri.find("/api/v1/warehouses/") == 0 && uri.find("/locations/import") != std::string::npos) {
+            return new controllers::LocationImportController(locationService_);
+        }
+        if (uri.find("/api/v1/warehouses/") == 0 && uri.find("/occupancy") != std::string::npos) {
+            return new controllers::OccupancyController(occupancyService_);
+        }
+        
         // Route to appropriate controller
         if (uri.find("/api/v1/warehouses") == 0) {
             return new controllers::WarehouseController(warehouseService_);
@@ -50,14 +72,20 @@ public:
 private:
     std::shared_ptr<services::WarehouseService> warehouseService_;
     std::shared_ptr<services::LocationService> locationService_;
+    std::shared_ptr<services::PutawayService> putawayService_;
+    std::shared_ptr<services::OccupancyService> occupancyService_;
 };
 
 Server::Server(const Config& config,
                std::shared_ptr<services::WarehouseService> warehouseService,
-               std::shared_ptr<services::LocationService> locationService)
+               std::shared_ptr<services::LocationService> locationService,
+               std::shared_ptr<services::PutawayService> putawayService,
+               std::shared_ptr<services::OccupancyService> occupancyService)
     : config_(config)
     , warehouseService_(warehouseService)
-    , locationService_(locationService) {}
+    , locationService_(locationService)
+    , putawayService_(putawayService)
+    , occupancyService_(occupancyService) {}
 
 Server::~Server() {
     stop();
@@ -76,7 +104,7 @@ void Server::start() {
         params->setMaxQueued(config_.maxQueued);
         
         httpServer_ = std::make_unique<Poco::Net::HTTPServer>(
-            new RequestHandlerFactory(warehouseService_, locationService_),
+            new RequestHandlerFactory(warehouseService_, locationService_, putawayService_, occupancyService_),
             socket,
             params
         );
@@ -52,6 +52,8 @@ void LocationController::handleRequest(HTTPServerRequest& request, HTTPServerRes
             }
         } else if (method == "POST" && uri == "/api/v1/locations") {
             handleCreate(request, response);
+        } else if (method == "POST" && uri == "/api/v1/locations/status") {
+            handleChangeStatus(request, response);
         } else if (method == "PUT") {
             std::string id = extractIdFromPath(uri);
             if (!id.empty()) {
@@ -105,7 +107,7 @@ void LocationController::handleGetById(const std::string& id, HTTPServerRequest&
 
 void LocationController::handleGetByWarehouse(const std::string& warehouseId, HTTPServerRequest&, HTTPServerResponse& response) {
     try {
-        auto dtos = service_->getByWarehouseId(warehouseId);
+        auto dtos = service_->getByWarehouse(warehouseId);
         json j = json::array();
         for (const auto& dto : dtos) {
             j.push_back(dto.toJson());
@@ -141,6 +143,38 @@ void LocationController::handleCreate(HTTPServerRequest& request, HTTPServerResp
     }
 }
 
+void LocationController::handleChangeStatus(HTTPServerRequest& request, HTTPServerResponse& response) {
+    try {
+        std::istream& input = request.stream();
+        json requestBody = json::parse(input);
+        
+        if (!requestBody.contains("locationIds") || !requestBody["locationIds"].is_array()) {
+            sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "locationIds must be an array");
+            return;
+        }
+        if (!requestBody.contains("status")) {
+            sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "status is required");
+            return;
+        }
+        
+        auto locationIds = requestBody["locationIds"].get<std::vector<std::string>>();
+        auto status = models::stringToLocationStatus(requestBody["status"].get<std::string>());
+        
+        auto dto = service_->changeStatus(locationIds, status);
+        
+        sendJsonResponse(response, HTTPResponse::HTTP_OK, dto.toJson().dump());
+    } catch (const json::exception& e) {
+        utils::Logger::error("JSON parse error in handleChangeStatus: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid JSON");
+    } catch (const std::invalid_argument& e) {
+        utils::Logger::error("Validation error in handleChangeStatus: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, e.what());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleChangeStatus: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, "Failed to change location status");
+    }
+}
+
 void LocationController::handleUpdate(const std::string& id, HTTPServerRequest& request, HTTPServerResponse& response) {
     try {
         std::istream& input = request.stream();
@@ -0,0 +1,108 @@
+#include "warehouse/controllers/OccupancyController.hpp"
+#include "warehouse/services/OccupancyService.hpp"
+#include "warehouse/utils/Auth.hpp"
+#include "warehouse/utils/Logger.hpp"
+#include <Poco/Net/HTTPResponse.h>
+#include <Poco/URI.h>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace warehouse::controllers {
+
+using namespace Poco::Net;
+
+OccupancyController::OccupancyController(std::shared_ptr<services::OccupancyService> service)
+    : service_(service) {
+}
+
+void OccupancyController::handleRequest(HTTPServerRequest& request, HTTPServerResponse& response) {
+    // Service-to-service authentication
+    auto authStatus = utils::Auth::authorizeServiceRequest(request);
+    if (authStatus == utils::AuthStatus::MissingToken) {
+        sendErrorResponse(response, HTTPResponse::HTTP_UNAUTHORIZED, "Missing service authentication");
+        return;
+    }
+    if (authStatus == utils::AuthStatus::InvalidToken) {
+        sendErrorResponse(response, HTTPResponse::HTTP_FORBIDDEN, "Invalid service authentication");
+        return;
+    }
+
+    try {
+        const std::string& method = request.getMethod();
+        const std::string& uri = request.getURI();
+        
+        utils::Logger::info("Request: {} {}", method, uri);
+        
+        if (method != "GET") {
+            sendErrorResponse(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED, "Method not allowed");
+            return;
+        }
+        
+        std::string warehouseId = extractWarehouseIdFromPath(uri);
+        if (warehouseId.empty()) {
+            sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid request");
+            return;
+        }
+        
+        handleGet(warehouseId, request, response);
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error handling request: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, "Internal server error");
+    }
+}
+
+void OccupancyController::handleGet(const std::string& warehouseId,
+                                    HTTPServerRequest& request,
+                                    HTTPServerResponse& response) {
+    try {
+        auto depth = services::OccupancyScope::Level;
+        Poco::URI uri(request.getURI());
+        for (const auto& [name, value] : uri.getQueryParameters()) {
+            if (name == "depth") {
+                depth = services::stringToOccupancyScope(value);
+            }
+        }
+        
+        auto dto = service_->getOccupancy(warehouseId, depth);
+        
+        sendJsonResponse(response, HTTPResponse::HTTP_OK, dto.toJson().dump());
+    } catch (const std::invalid_argument& e) {
+        utils::Logger::error("Validation error in handleGet: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, e.what());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleGet: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, "Failed to retrieve occupancy");
+    }
+}
+
+void OccupancyController::sendJsonResponse(HTTPServerResponse& response, int status, const std::string& body) {
+    response.setStatus(static_cast<HTTPResponse::HTTPStatus>(status));
+    response.setContentType("application/json");
+    response.setContentLength(body.length());
+    
+    auto& out = response.send();
+    out << body;
+}
+
+void OccupancyController::sendErrorResponse(HTTPServerResponse& response, int status, const std::string& message) {
+    nlohmann::json error;
+    error["error"] = message;
+    error["status"] = status;
+    sendJsonResponse(response, status, error.dump());
+}
+
+std::string OccupancyController::extractWarehouseIdFromPath(const std::string& path) {
+    // /api/v1/warehouses/{id}/occupancy
+    const std::string prefix = "/api/v1/warehouses/";
+    if (path.rfind(prefix, 0) != 0) {
+        return "";
+    }
+    auto end = path.find('/', prefix.size());
+    if (end == std::string::npos) {
+        return "";
+    }
+    return path.substr(prefix.size(), end - prefix.size());
+}
+
+} // namespace warehouse::controllers
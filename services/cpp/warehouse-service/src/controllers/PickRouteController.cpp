@@ -0,0 +1,111 @@
+#include "warehouse/controllers/PickRouteController.hpp"
+#include "warehouse/services/LocationService.hpp"
+#include "warehouse/utils/Auth.hpp"
+#include "warehouse/utils/Logger.hpp"
+#include <Poco/Net/HTTPResponse.h>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace warehouse::controllers {
+
+using namespace Poco::Net;
+
+PickRouteController::PickRouteController(std::shared_ptr<services::LocationService> service)
+    : service_(service) {
+}
+
+void PickRouteController::handleRequest(HTTPServerRequest& request, HTTPServerResponse& response) {
+    // Service-to-service authentication
+    auto authStatus = utils::Auth::authorizeServiceRequest(request);
+    if (authStatus == utils::AuthStatus::MissingToken) {
+        sendErrorResponse(response, HTTPResponse::HTTP_UNAUTHORIZED, "Missing service authentication");
+        return;
+    }
+    if (authStatus == utils::AuthStatus::InvalidToken) {
+        sendErrorResponse(response, HTTPResponse::HTTP_FORBIDDEN, "Invalid service authentication");
+        return;
+    }
+
+    try {
+        const std::string& method = request.getMethod();
+        const std::string& uri = request.getURI();
+        
+        utils::Logger::info("Request: {} {}", method, uri);
+        
+        if (method != "POST") {
+            sendErrorResponse(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED, "Method not allowed");
+            return;
+        }
+        
+        std::string warehouseId = extractWarehouseIdFromPath(uri);
+        if (warehouseId.empty()) {
+            sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid request");
+            return;
+        }
+        
+        handlePlanRoute(warehouseId, request, response);
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error handling request: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, "Internal server error");
+    }
+}
+
+void PickRouteController::handlePlanRoute(const std::string& warehouseId,
+                                          HTTPServerRequest& request,
+                                          HTTPServerResponse& response) {
+    try {
+        std::istream& input = request.stream();
+        json requestBody = json::parse(input);
+        
+        if (!requestBody.contains("locationIds") || !requestBody["locationIds"].is_array()) {
+            sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "locationIds array is required");
+            return;
+        }
+        
+        auto locationIds = requestBody["locationIds"].get<std::vector<std::string>>();
+        auto dto = service_->planPickRoute(warehouseId, locationIds);
+        
+        sendJsonResponse(response, HTTPResponse::HTTP_OK, dto.toJson().dump());
+    } catch (const json::exception& e) {
+        utils::Logger::error("JSON parse error in handlePlanRoute: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid JSON");
+    } catch (const std::invalid_argument& e) {
+        utils::Logger::error("Validation error in handlePlanRoute: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, e.what());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handlePlanRoute: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, "Failed to plan pick route");
+    }
+}
+
+void PickRouteController::sendJsonResponse(HTTPServerResponse& response, int status, const std::string& body) {
+    response.setStatus(static_cast<HTTPResponse::HTTPStatus>(status));
+    response.setContentType("application/json");
+    response.setContentLength(body.length());
+    
+    auto& out = response.send();
+    out << body;
+}
+
+void PickRouteController::sendErrorResponse(HTTPServerResponse& response, int status, const std::string& message) {
+    nlohmann::json error;
+    error["error"] = message;
+    error["status"] = status;
+    sendJsonResponse(response, status, error.dump());
+}
+
+std::string PickRouteController::extractWarehouseIdFromPath(const std::string& path) {
+    // /api/v1/warehouses/{id}/pick-route
+    const std::string prefix = "/api/v1/warehouses/";
+    if (path.rfind(prefix, 0) != 0) {
+        return "";
+    }
+    auto end = path.find('/', prefix.size());
+    if (end == std::string::npos) {
+        return "";
+    }
+    return path.substr(prefix.size(), end - prefix.size());
+}
+
+} // namespace warehouse::controllers
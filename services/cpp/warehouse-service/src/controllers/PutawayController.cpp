@@ -0,0 +1,123 @@
+#include "warehouse/controllers/PutawayController.hpp"
+#include "warehouse/services/PutawayService.hpp"
+#include "warehouse/utils/Auth.hpp"
+#include "warehouse/utils/Logger.hpp"
+#include <Poco/Net/HTTPResponse.h>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace warehouse::controllers {
+
+using namespace Poco::Net;
+
+PutawayController::PutawayController(std::shared_ptr<services::PutawayService> service)
+    : service_(service) {
+}
+
+void PutawayController::handleRequest(HTTPServerRequest& request, HTTPServerResponse& response) {
+    // Service-to-service authentication
+    auto authStatus = utils::Auth::authorizeServiceRequest(request);
+    if (authStatus == utils::AuthStatus::MissingToken) {
+        sendErrorResponse(response, HTTPResponse::HTTP_UNAUTHORIZED, "Missing service authentication");
+        return;
+    }
+    if (authStatus == utils::AuthStatus::InvalidToken) {
+        sendErrorResponse(response, HTTPResponse::HTTP_FORBIDDEN, "Invalid service authentication");
+        return;
+    }
+
+    try {
+        const std::string& method = request.getMethod();
+        const std::string& uri = request.getURI();
+        
+        utils::Logger::info("Request: {} {}", method, uri);
+        
+        if (method != "POST") {
+            sendErrorResponse(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED, "Method not allowed");
+            return;
+        }
+        
+        std::string warehouseId = extractWarehouseIdFromPath(uri);
+        if (warehouseId.empty()) {
+            sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid request");
+            return;
+        }
+        
+        handleSuggest(warehouseId, request, response);
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error handling request: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, "Internal server error");
+    }
+}
+
+void PutawayController::handleSuggest(const std::string& warehouseId,
+                                      HTTPServerRequest& request,
+                                      HTTPServerResponse& response) {
+    try {
+        std::istream& input = request.stream();
+        json requestBody = json::parse(input);
+        
+        if (!requestBody.contains("dimensions")) {
+            sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "dimensions is required");
+            return;
+        }
+        
+        auto dimensions = requestBody["dimensions"].get<models::Dimensions>();
+        std::optional<models::Weight> weight;
+        if (requestBody.contains("weight")) {
+            weight = requestBody["weight"].get<models::Weight>();
+        }
+        
+        auto load = services::PutawayLoad::fromDimensions(dimensions, weight);
+        if (requestBody.contains("preferredZone")) {
+            load.preferredZone = requestBody["preferredZone"].get<std::string>();
+        }
+        load.requiresTemperatureControl = requestBody.value("requiresTemperatureControl", false);
+        int limit = requestBody.value("limit", 5);
+        
+        auto dto = service_->suggest(warehouseId, load, limit);
+        
+        sendJsonResponse(response, HTTPResponse::HTTP_OK, dto.toJson().dump());
+    } catch (const json::exception& e) {
+        utils::Logger::error("JSON parse error in handleSuggest: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid JSON");
+    } catch (const std::invalid_argument& e) {
+        utils::Logger::error("Validation error in handleSuggest: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_BAD_REQUEST, e.what());
+    } catch (const std::exception& e) {
+        utils::Logger::error("Error in handleSuggest: {}", e.what());
+        sendErrorResponse(response, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR, "Failed to suggest putaway locations");
+    }
+}
+
+void PutawayController::sendJsonResponse(HTTPServerResponse& response, int status, const std::string& body) {
+    response.setStatus(static_cast<HTTPResponse::HTTPStatus>(status));
+    response.setContentType("application/json");
+    response.setContentLength(body.length());
+    
+    auto& out = response.send();
+    out << body;
+}
+
+void PutawayController::sendErrorResponse(HTTPServerResponse& response, int status, const std::string& message) {
+    nlohmann::json error;
+    error["error"] = message;
+    error["status"] = status;
+    sendJsonResponse(response, status, error.dump());
+}
+
+std::string PutawayController::extractWarehouseIdFromPath(const std::string& path) {
+    // /api/v1/warehouses/{id}/putaway-suggestions
+    const std::string prefix = "/api/v1/warehouses/";
+    if (path.rfind(prefix, 0) != 0) {
+        return "";
+    }
+    auto end = path.find('/', prefix.size());
+    if (end == std::string::npos) {
+        return "";
+    }
+    return path.substr(prefix.size(), end - prefix.size());
+}
+
+} // namespace warehouse::controllers
@@ -0,0 +1,73 @@
+#include "warehouse/dtos/LocationImportResultDto.hpp"
+#include <stdexcept>
+
+namespace warehouse {
+namespace dtos {
+
+LocationImportErrorDto::LocationImportErrorDto(
+    int line,
+    const std::optional<std::string>& code,
+    const std::string& message)
+    : line_(line)
+    , code_(code)
+    , message_(message) {
+    
+    if (line_ < 1) {
+        throw std::invalid_argument("line must be positive");
+    }
+    if (message_.empty()) {
+        throw std::invalid_argument("message is required");
+    }
+}
+
+json LocationImportErrorDto::toJson() const {
+    json j = {
+        {"line", line_},
+        {"message", message_}
+    };
+    
+    if (code_) j["code"] = *code_;
+    
+    return j;
+}
+
+LocationImportResultDto::LocationImportResultDto(
+    const std::string& warehouseId,
+    int received,
+    int imported,
+    int rejected,
+    const std::vector<LocationImportErrorDto>& errors)
+    : warehouseId_(warehouseId)
+    , received_(received)
+    , imported_(imported)
+    , rejected_(rejected)
+    , errors_(errors) {
+    
+    if (warehouseId_.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+    if (received_ < 0 || imported_ < 0 || rejected_ < 0) {
+        throw std::invalid_argument("counts must be non-negative");
+    }
+    if (imported_ + rejected_ > received_) {
+        throw std::invalid_argument("imported and rejected cannot exceed received");
+    }
+}
+
+json LocationImportResultDto::toJson() const {
+    json errorsArray = json::array();
+    for (const auto& error : errors_) {
+        errorsArray.push_back(error.toJson());
+    }
+    
+    return {
+        {"warehouseId", warehouseId_},
+        {"received", received_},
+        {"imported", imported_},
+        {"rejected", rejected_},
+        {"errors", errorsArray}
+    };
+}
+
+} // namespace dtos
+} // namespace warehouse
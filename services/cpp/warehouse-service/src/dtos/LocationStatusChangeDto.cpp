@@ -0,0 +1,34 @@
+#include "warehouse/dtos/LocationStatusChangeDto.hpp"
+#include <stdexcept>
+
+namespace warehouse {
+namespace dtos {
+
+LocationStatusChangeDto::LocationStatusChangeDto(
+    const std::string& status,
+    const std::vector<LocationDto>& updated,
+    const std::vector<std::string>& unchangedLocationIds)
+    : status_(status)
+    , updated_(updated)
+    , unchangedLocationIds_(unchangedLocationIds) {
+    
+    if (status_.empty()) {
+        throw std::invalid_argument("status is required");
+    }
+}
+
+json LocationStatusChangeDto::toJson() const {
+    json updatedArray = json::array();
+    for (const auto& location : updated_) {
+        updatedArray.push_back(location.toJson());
+    }
+    
+    return {
+        {"status", status_},
+        {"updated", updatedArray},
+        {"unchangedLocationIds", unchangedLocationIds_}
+    };
+}
+
+} // namespace dtos
+} // namespace warehouse
@@ -0,0 +1,83 @@
+#include "warehouse/dtos/OccupancyDto.hpp"
+#include <stdexcept>
+
+namespace warehouse {
+namespace dtos {
+
+OccupancyBucketDto::OccupancyBucketDto(
+    const std::string& scope,
+    const std::optional<std::string>& zone,
+    const std::optional<std::string>& aisle,
+    const std::optional<std::string>& level,
+    std::int64_t totalBins,
+    std::int64_t occupiedBins,
+    std::int64_t freeBins,
+    double volumeUsed,
+    double volumeCapacity,
+    double weightUsed,
+    double weightCapacity)
+    : scope_(scope)
+    , zone_(zone)
+    , aisle_(aisle)
+    , level_(level)
+    , totalBins_(totalBins)
+    , occupiedBins_(occupiedBins)
+    , freeBins_(freeBins)
+    , volumeUsed_(volumeUsed)
+    , volumeCapacity_(volumeCapacity)
+    , weightUsed_(weightUsed)
+    , weightCapacity_(weightCapacity) {
+    
+    if (scope_ != "warehouse" && scope_ != "zone" && scope_ != "aisle" && scope_ != "level") {
+        throw std::invalid_argument("scope must be warehouse, zone, aisle or level");
+    }
+    if (totalBins_ < 0 || occupiedBins_ < 0 || freeBins_ < 0) {
+        throw std::invalid_argument("bin counts must be non-negative");
+    }
+}
+
+json OccupancyBucketDto::toJson() const {
+    json j = {
+        {"scope", scope_},
+        {"totalBins", totalBins_},
+        {"occupiedBins", occupiedBins_},
+        {"freeBins", freeBins_},
+        {"volumeUsed", volumeUsed_},
+        {"volumeCapacity", volumeCapacity_},
+        {"weightUsed", weightUsed_},
+        {"weightCapacity", weightCapacity_}
+    };
+    
+    if (zone_) j["zone"] = *zone_;
+    if (aisle_) j["aisle"] = *aisle_;
+    if (level_) j["level"] = *level_;
+    if (volumeCapacity_ > 0) j["volumeUtilisation"] = volumeUsed_ / volumeCapacity_;
+    
+    return j;
+}
+
+OccupancyDto::OccupancyDto(
+    const std::string& warehouseId,
+    const std::vector<OccupancyBucketDto>& buckets)
+    : warehouseId_(warehouseId)
+    , buckets_(buckets) {
+    
+    if (warehouseId_.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+}
+
+json OccupancyDto::toJson() const {
+    json bucketsArray = json::array();
+    for (const auto& bucket : buckets_) {
+        bucketsArray.push_back(bucket.toJson());
+    }
+    
+    return {
+        {"warehouseId", warehouseId_},
+        {"buckets", bucketsArray}
+    };
+}
+
+} // namespace dtos
+} // namespace warehouse
@@ -0,0 +1,85 @@
+#include "warehouse/dtos/PickRouteDto.hpp"
+#include <stdexcept>
+
+namespace warehouse {
+namespace dtos {
+
+PickRouteStopDto::PickRouteStopDto(
+    int sequence,
+    const std::string& locationId,
+    const std::string& code,
+    const std::optional<std::string>& zone,
+    const std::optional<std::string>& aisle,
+    const std::optional<std::string>& bay,
+    const std::optional<std::string>& level)
+    : sequence_(sequence)
+    , locationId_(locationId)
+    , code_(code)
+    , zone_(zone)
+    , aisle_(aisle)
+    , bay_(bay)
+    , level_(level) {
+    
+    if (sequence_ < 1) {
+        throw std::invalid_argument("sequence must be positive (>= 1)");
+    }
+    if (locationId_.empty()) {
+        throw std::invalid_argument("locationId is required");
+    }
+    if (code_.empty()) {
+        throw std::invalid_argument("code is required");
+    }
+}
+
+json PickRouteStopDto::toJson() const {
+    json j = {
+        {"sequence", sequence_},
+        {"locationId", locationId_},
+        {"code", code_}
+    };
+    
+    if (zone_) j["zone"] = *zone_;
+    if (aisle_) j["aisle"] = *aisle_;
+    if (bay_) j["bay"] = *bay_;
+    if (level_) j["level"] = *level_;
+    
+    return j;
+}
+
+PickRouteDto::PickRouteDto(
+    const std::string& warehouseId,
+    const std::string& strategy,
+    double totalDistance,
+    const std::vector<PickRouteStopDto>& stops,
+    const std::vector<std::string>& unresolvedLocationIds)
+    : warehouseId_(warehouseId)
+    , strategy_(strategy)
+    , totalDistance_(totalDistance)
+    , stops_(stops)
+    , unresolvedLocationIds_(unresolvedLocationIds) {
+    
+    if (warehouseId_.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+    if (totalDistance_ < 0.0) {
+        throw std::invalid_argument("totalDistance must be non-negative");
+    }
+}
+
+json PickRouteDto::toJson() const {
+    json stopsArray = json::array();
+    for (const auto& stop : stops_) {
+        stopsArray.push_back(stop.toJson());
+    }
+    
+    return {
+        {"warehouseId", warehouseId_},
+        {"strategy", strategy_},
+        {"totalDistance", totalDistance_},
+        {"stops", stopsArray},
+        {"unresolvedLocationIds", unresolvedLocationIds_}
+    };
+}
+
+} // namespace dtos
+} // namespace warehouse
@@ -0,0 +1,76 @@
+#include "warehouse/dtos/PutawaySuggestionDto.hpp"
+#include <stdexcept>
+
+namespace warehouse {
+namespace dtos {
+
+PutawaySuggestionDto::PutawaySuggestionDto(
+    const std::string& locationId,
+    const std::string& code,
+    const std::optional<std::string>& zone,
+    double score,
+    double fit,
+    double distance,
+    double freeVolume,
+    const std::optional<double>& freeWeight)
+    : locationId_(locationId)
+    , code_(code)
+    , zone_(zone)
+    , score_(score)
+    , fit_(fit)
+    , distance_(distance)
+    , freeVolume_(freeVolume)
+    , freeWeight_(freeWeight) {
+    
+    if (locationId_.empty()) {
+        throw std::invalid_argument("locationId is required");
+    }
+    if (code_.empty()) {
+        throw std::invalid_argument("code is required");
+    }
+    if (distance_ < 0.0 || freeVolume_ < 0.0) {
+        throw std::invalid_argument("distance and freeVolume must be non-negative");
+    }
+}
+
+json PutawaySuggestionDto::toJson() const {
+    json j = {
+        {"locationId", locationId_},
+        {"code", code_},
+        {"score", score_},
+        {"fit", fit_},
+        {"distance", distance_},
+        {"freeVolume", freeVolume_}
+    };
+    
+    if (zone_) j["zone"] = *zone_;
+    if (freeWeight_) j["freeWeight"] = *freeWeight_;
+    
+    return j;
+}
+
+PutawaySuggestionListDto::PutawaySuggestionListDto(
+    const std::string& warehouseId,
+    const std::vector<PutawaySuggestionDto>& items)
+    : warehouseId_(warehouseId)
+    , items_(items) {
+    
+    if (warehouseId_.empty()) {
+        throw std::invalid_argument("warehouseId is required");
+    }
+}
+
+json PutawaySuggestionListDto::toJson() const {
+    json itemsArray = json::array();
+    for (const auto& item : items_) {
+        itemsArray.push_back(item.toJson());
+    }
+    
+    return {
+        {"warehouseId", warehouseId_},
+        {"items", itemsArray}
+    };
+}
+
+} // namespace dtos
+} // namespace warehouse
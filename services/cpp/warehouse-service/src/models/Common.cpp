@@ -1,4 +1,5 @@
 #include "warehouse/models/Common.hpp"
+#include <cctype>
 #include <iomanip>
 #include <sstream>
 #include <ctime>
@@ -68,4 +69,17 @@ Status stringToStatus(const std::string& str) {
     throw std::invalid_argument("Invalid status string: " + str);
 }
 
+bool isUuid(const std::string& value) {
+    if (value.size() != 36) {
+        return false;
+    }
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        const bool dash = i == 8 || i == 13 || i == 18 || i == 23;
+        if (dash ? value[i] != '-' : !std::isxdigit(static_cast<unsigned char>(value[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace warehouse::models
@@ -1,9 +1,63 @@
 #include "warehouse/repositories/LocationRepository.hpp"
 #include "warehouse/utils/Database.hpp"
 #include "warehouse/utils/Logger.hpp"
+#include <pqxx/pqxx>
+#include <algorithm>
+#include <iterator>
 
 namespace warehouse::repositories {
 
+namespace {
+
+// Builds the Location JSON shape in SQL so rows go straight through
+// Location::fromJson; nulls are stripped so optional fields stay absent.
+const char* LOCATION_JSON_SELECT = R"(
+    jsonb_strip_nulls(jsonb_build_object(
+        'id', id::text,
+        'warehouseId', warehouse_id::text,
+        'code', code,
+        'name', name,
+        'type', type,
+        'zone', zone,
+        'aisle', aisle,
+        'bay', bay,
+        'level', level,
+        'bin', bin,
+        'parentLocationId', parent_location_id::text,
+        'dimensions', dimensions,
+        'maxWeight', max_weight,
+        'maxVolume', max_volume,
+        'isPickable', is_pickable,
+        'isReceivable', is_receivable,
+        'requiresEquipment', requires_equipment,
+        'temperatureControlled', temperature_controlled,
+        'temperatureRange', temperature_range,
+        'barcode', barcode,
+        'status', status,
+        'metadata', metadata,
+        'audit', jsonb_build_object(
+            'createdAt', to_char(created_at, 'YYYY-MM-DD"T"HH24:MI:SS"Z"'),
+            'createdBy', created_by,
+            'updatedAt', to_char(updated_at, 'YYYY-MM-DD"T"HH24:MI:SS"Z"'),
+            'updatedBy', updated_by
+        )
+    ))::text)";
+
+models::Location rowToLocation(const pqxx::row& row) {
+    return models::Location::fromJson(models::json::parse(row[0].c_str()));
+}
+
+// JSON text for a JSONB column, null when the field is absent
+template <typename T>
+std::optional<std::string> jsonColumn(const std::optional<T>& value) {
+    if (!value) {
+        return std::nullopt;
+    }
+    return models::json(*value).dump();
+}
+
+} // namespace
+
 LocationRepository::LocationRepository(std::shared_ptr<utils::Database> db)
     : db_(db) {
 }
@@ -27,9 +81,64 @@ std::vector<models::Location> LocationRepository::findAll() {
 }
 
 std::vector<models::Location> LocationRepository::findByWarehouse(const std::string& warehouseId) {
-    // TODO: Implement database query
     utils::Logger::debug("LocationRepository::findByWarehouse({})", warehouseId);
-    return {};
+
+    auto txn = db_->beginTransaction();
+    auto result = txn->exec_params(
+        std::string("SELECT ") + LOCATION_JSON_SELECT +
+        " FROM locations WHERE warehouse_id = $1::uuid",
+        warehouseId);
+    txn->commit();
+
+    std::vector<models::Location> locations;
+    locations.reserve(result.size());
+    for (const auto& row : result) {
+        locations.push_back(rowToLocation(row));
+    }
+    return locations;
+}
+
+std::vector<models::Location> LocationRepository::findChangedSince(const std::vector<std::string>& warehouseIds,
+                                                                   std::chrono::system_clock::time_point since) {
+    utils::Logger::debug("LocationRepository::findChangedSince({} warehouses)", warehouseIds.size());
+    if (warehouseIds.empty()) {
+        return {};
+    }
+
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(since.time_since_epoch()).count();
+    auto txn = db_->beginTransaction();
+    auto result = txn->exec_params(
+        std::string("SELECT ") + LOCATION_JSON_SELECT +
+        " FROM locations WHERE warehouse_id = ANY($1::uuid[])"
+        " AND COALESCE(updated_at, created_at) >= to_timestamp($2)",
+        warehouseIds, seconds);
+    txn->commit();
+
+    std::vector<models::Location> locations;
+    locations.reserve(result.size());
+    for (const auto& row : result) {
+        locations.push_back(rowToLocation(row));
+    }
+    return locations;
+}
+
+std::vector<std::string> LocationRepository::findIdsByWarehouses(const std::vector<std::string>& warehouseIds) {
+    utils::Logger::debug("LocationRepository::findIdsByWarehouses({} warehouses)", warehouseIds.size());
+    if (warehouseIds.empty()) {
+        return {};
+    }
+
+    auto txn = db_->beginTransaction();
+    auto result = txn->exec_params(
+        "SELECT id::text FROM locations WHERE warehouse_id = ANY($1::uuid[])", warehouseIds);
+    txn->commit();
+
+    std::vector<std::string> ids;
+    ids.reserve(result.size());
+    for (const auto& row : result) {
+        ids.push_back(row[0].as<std::string>());
+    }
+    return ids;
 }
 
 std::vector<models::Location> LocationRepository::findByWarehouseAndZone(const std::string& warehouseId, const std::string& zone) {
@@ -56,6 +165,32 @@ std::vector<models::Location> LocationRepository::findAvailablePickingLocations(
     return {};
 }
 
+std::vector<models::Location> LocationRepository::findByIds(const std::vector<std::string>& ids) {
+    utils::Logger::debug("LocationRepository::findByIds({} ids)", ids.size());
+
+    // A malformed id cannot match, and would fail the ::uuid[] cast for the whole batch
+    std::vector<std::string> uuids;
+    uuids.reserve(ids.size());
+    std::copy_if(ids.begin(), ids.end(), std::back_inserter(uuids), models::isUuid);
+    if (uuids.empty()) {
+        return {};
+    }
+
+    auto txn = db_->beginTransaction();
+    auto result = txn->exec_params(
+        std::string("SELECT ") + LOCATION_JSON_SELECT +
+        " FROM locations WHERE id = ANY($1::uuid[])",
+        uuids);
+    txn->commit();
+
+    std::vector<models::Location> locations;
+    locations.reserve(result.size());
+    for (const auto& row : result) {
+        locations.push_back(rowToLocation(row));
+    }
+    return locations;
+}
+
 std::string LocationRepository::create(const models::Location& location) {
     // TODO: Implement database insert
     utils::Logger::debug("LocationRepository::create()");
@@ -74,9 +209,45 @@ bool LocationRepository::deleteById(const std::string& id) {
     return false;
 }
 
+std::vector<models::Location> LocationRepository::updateStatus(const std::vector<std::string>& ids,
+                                                              models::LocationStatus status,
+                                                              const std::vector<models::LocationStatus>& fromStatuses) {
+    utils::Logger::debug("LocationRepository::updateStatus({} ids, {})", ids.size(), models::locationStatusToString(status));
+    if (ids.empty() || fromStatuses.empty()) {
+        return {};
+    }
+
+    std::vector<std::string> from;
+    from.reserve(fromStatuses.size());
+    for (auto fromStatus : fromStatuses) {
+        from.push_back(models::locationStatusToString(fromStatus));
+    }
+
+    // The status check lives in the WHERE clause so concurrent transitions
+    // cannot both succeed; RETURNING saves a read-back per row.
+    auto txn = db_->beginTransaction();
+    auto result = txn->exec_params(
+        std::string("UPDATE locations SET status = $1, updated_at = NOW() "
+                    "WHERE id = ANY($2::uuid[]) AND status = ANY($3::text[]) "
+                    "RETURNING ") + LOCATION_JSON_SELECT,
+        models::locationStatusToString(status),
+        ids,
+        from);
+    txn->commit();
+
+    std::vector<models::Location> locations;
+    locations.reserve(result.size());
+    for (const auto& row : result) {
+        locations.push_back(rowToLocation(row));
+    }
+    return locations;
+}
+
 bool LocationRepository::exists(const std::string& id) {
-    // TODO: Implement existence check
-    return false;
+    auto txn = db_->beginTransaction();
+    auto result = txn->exec_params("SELECT 1 FROM locations WHERE id = $1::uuid", id);
+    txn->commit();
+    return !result.empty();
 }
 
 bool LocationRepository::codeExists(const std::string& warehouseId, const std::string& code) {
@@ -84,6 +255,64 @@ bool LocationRepository::codeExists(const std::string& warehouseId, const std::s
     return false;
 }
 
+std::vector<std::string> LocationRepository::findCodesByWarehouse(const std::string& warehouseId) {
+    utils::Logger::debug("LocationRepository::findCodesByWarehouse({})", warehouseId);
+
+    auto txn = db_->beginTransaction();
+    auto result = txn->exec_params("SELECT code FROM locations WHERE warehouse_id = $1", warehouseId);
+    txn->commit();
+
+    std::vector<std::string> codes;
+    codes.reserve(result.size());
+    for (const auto& row : result) {
+        codes.push_back(row[0].as<std::string>());
+    }
+    return codes;
+}
+
+void LocationRepository::bulkInsert(const std::vector<models::Location>& locations) {
+    utils::Logger::debug("LocationRepository::bulkInsert({} locations)", locations.size());
+    if (locations.empty()) {
+        return;
+    }
+
+    auto txn = db_->beginTransaction();
+    auto stream = pqxx::stream_to::table(*txn, {"locations"}, {
+        "id", "warehouse_id", "code", "name", "type", "zone", "aisle", "bay", "level", "bin",
+        "parent_location_id", "dimensions", "max_weight", "max_volume", "is_pickable", "is_receivable",
+        "requires_equipment", "temperature_controlled", "temperature_range", "barcode", "status",
+        "metadata", "created_by"
+    });
+    for (const auto& location : locations) {
+        stream.write_values(
+            location.getId(),
+            location.getWarehouseId(),
+            location.getCode(),
+            location.getName(),
+            models::locationTypeToString(location.getType()),
+            location.getZone(),
+            location.getAisle(),
+            location.getBay(),
+            location.getLevel(),
+            location.getBin(),
+            location.getParentLocationId(),
+            jsonColumn(location.getDimensions()),
+            jsonColumn(location.getMaxWeight()),
+            location.getMaxVolume(),
+            location.isPickable(),
+            location.isReceivable(),
+            models::requiredEquipmentToString(location.getRequiresEquipment()),
+            location.isTemperatureControlled(),
+            jsonColumn(location.getTemperatureRange()),
+            location.getBarcode(),
+            models::locationStatusToString(location.getStatus()),
+            jsonColumn(location.getMetadata()),
+            location.getAudit().createdBy);
+    }
+    stream.complete();
+    txn->commit();
+}
+
 models::Location LocationRepository::mapRowToLocation(const void* row) {
     // TODO: Map database row to Location model
     return models::Location();
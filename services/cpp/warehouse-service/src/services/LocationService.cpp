@@ -2,13 +2,58 @@
 #include "warehouse/repositories/LocationRepository.hpp"
 #include "warehouse/utils/Logger.hpp"
 #include "warehouse/utils/DtoMapper.hpp"
-#include <regex>
+#include <Poco/UUIDGenerator.h>
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace warehouse::services {
 
-LocationService::LocationService(std::shared_ptr<repositories::LocationRepository> repo)
-    : repo_(repo) {
+namespace {
+
+// Rows per COPY transaction and event batch
+constexpr std::size_t kImportChunkSize = 5000;
+
+// Error details returned to the caller; further rejections are only counted
+constexpr std::size_t kMaxImportErrors = 100;
+
+// Locations accepted by one batch status change
+constexpr std::size_t kMaxStatusBatch = 1000;
+
+// Statuses each transition may start from. Release returns a location to
+// service from any held state; inactive locations are never transitioned.
+const std::vector<models::LocationStatus>& transitionSources(models::LocationStatus target) {
+    using models::LocationStatus;
+    static const std::vector<LocationStatus> toReserved = {LocationStatus::Active};
+    static const std::vector<LocationStatus> toActive = {
+        LocationStatus::Reserved, LocationStatus::Full, LocationStatus::Damaged, LocationStatus::Maintenance};
+    static const std::vector<LocationStatus> toFull = {LocationStatus::Active, LocationStatus::Reserved};
+    static const std::vector<LocationStatus> toDamaged = {
+        LocationStatus::Active, LocationStatus::Reserved, LocationStatus::Full, LocationStatus::Maintenance};
+    static const std::vector<LocationStatus> toMaintenance = {
+        LocationStatus::Active, LocationStatus::Reserved, LocationStatus::Full, LocationStatus::Damaged};
+    
+    switch (target) {
+        case LocationStatus::Reserved: return toReserved;
+        case LocationStatus::Active: return toActive;
+        case LocationStatus::Full: return toFull;
+        case LocationStatus::Damaged: return toDamaged;
+        case LocationStatus::Maintenance: return toMaintenance;
+        default:
+            throw std::invalid_argument("Unsupported status transition target: " + models::locationStatusToString(target));
+    }
+}
+
+} // namespace
+
+LocationService::LocationService(std::shared_ptr<repositories::LocationRepository> repo,
+                                 std::shared_ptr<utils::MessageBus> messageBus)
+    : repo_(repo)
+    , messageBus_(messageBus) {
+}
+
+void LocationService::addListener(std::shared_ptr<LocationChangeListener> listener) {
+    listeners_.push_back(std::move(listener));
 }
 
 std::optional<dtos::LocationDto> LocationService::getById(const std::string& id) {
@@ -55,6 +100,7 @@ dtos::LocationDto LocationService::createLocation(const models::Location& locati
     if (!created) {
         throw std::runtime_error("Failed to retrieve created location");
     }
+    notifyChanged(*created);
     
     // TODO: Fetch warehouse code from warehouse service API
     std::string warehouseCode = "WH-" + created->getWarehouseId().substr(0, 8);
@@ -78,6 +124,7 @@ dtos::LocationDto LocationService::updateLocation(const models::Location& locati
     if (!updated) {
         throw std::runtime_error("Failed to retrieve updated location");
     }
+    notifyChanged(*updated);
     
     // TODO: Fetch warehouse code from warehouse service API
     std::string warehouseCode = "WH-" + updated->getWarehouseId().substr(0, 8);
@@ -86,88 +133,123 @@ dtos::LocationDto LocationService::updateLocation(const models::Location& locati
 }
 
 bool LocationService::deleteLocation(const std::string& id) {
-    return repo_->deleteById(id);
+    bool deleted = repo_->deleteById(id);
+    if (deleted) {
+        for (const auto& listener : listeners_) {
+            listener->onLocationRemoved(id);
+        }
+    }
+    return deleted;
 }
 
 dtos::LocationDto LocationService::reserveLocation(const std::string& id) {
     utils::Logger::info("LocationService::reserveLocation({})", id);
+    return transitionLocation(id, models::LocationStatus::Reserved);
+}
+
+dtos::LocationDto LocationService::releaseLocation(const std::string& id) {
+    utils::Logger::info("LocationService::releaseLocation({})", id);
+    return transitionLocation(id, models::LocationStatus::Active);
+}
+
+dtos::LocationDto LocationService::markLocationFull(const std::string& id) {
+    utils::Logger::info("LocationService::markLocationFull({})", id);
+    return transitionLocation(id, models::LocationStatus::Full);
+}
+
+dtos::LocationDto LocationService::markLocationDamaged(const std::string& id) {
+    utils::Logger::info("LocationService::markLocationDamaged({})", id);
+    return transitionLocation(id, models::LocationStatus::Damaged);
+}
+
+dtos::LocationDto LocationService::markLocationUnderMaintenance(const std::string& id) {
+    utils::Logger::info("LocationService::markLocationUnderMaintenance({})", id);
+    return transitionLocation(id, models::LocationStatus::Maintenance);
+}
+
+dtos::LocationStatusChangeDto LocationService::changeStatus(const std::vector<std::string>& locationIds,
+                                                            models::LocationStatus status) {
+    if (locationIds.empty()) {
+        throw std::invalid_argument("locationIds must contain at least one location");
+    }
+    if (locationIds.size() > kMaxStatusBatch) {
+        throw std::invalid_argument("locationIds cannot contain more than " + std::to_string(kMaxStatusBatch) + " locations");
+    }
     
-    auto location = repo_->findById(id);
-    if (!location) {
-        throw std::runtime_error("Location not found: " + id);
+    std::vector<std::string> uniqueIds;
+    std::unordered_set<std::string> seen;
+    uniqueIds.reserve(locationIds.size());
+    for (const auto& id : locationIds) {
+        // Checked up front: one bad id would otherwise fail the ::uuid[] cast for the batch
+        if (!models::isUuid(id)) {
+            throw std::invalid_argument("Invalid location id: " + id);
+        }
+        if (seen.insert(id).second) {
+            uniqueIds.push_back(id);
+        }
     }
     
-    // TODO: Implement status change to reserved
-    location->setStatus(models::LocationStatus::Reserved);
+    auto updated = repo_->updateStatus(uniqueIds, status, transitionSources(status));
+    publishUpdated(updated);
     
-    bool success = repo_->update(*location);
-    if (!success) {
-        throw std::runtime_error("Failed to reserve location");
+    std::unordered_set<std::string> updatedIds;
+    for (const auto& location : updated) {
+        updatedIds.insert(location.getId());
     }
-    
-    auto updated = repo_->findById(id);
-    if (!updated) {
-        throw std::runtime_error("Failed to retrieve reserved location");
+    std::vector<std::string> unchanged;
+    for (const auto& id : uniqueIds) {
+        if (updatedIds.count(id) == 0) {
+            unchanged.push_back(id);
+        }
     }
     
-    // TODO: Fetch warehouse code from warehouse service API
-    std::string warehouseCode = "WH-" + updated->getWarehouseId().substr(0, 8);
-    
-    return utils::DtoMapper::toLocationDto(*updated, warehouseCode);
+    utils::Logger::info("Moved {} of {} locations to {}", updated.size(), uniqueIds.size(),
+                        models::locationStatusToString(status));
+    return dtos::LocationStatusChangeDto(models::locationStatusToString(status), convertToDtos(updated), unchanged);
 }
 
-dtos::LocationDto LocationService::releaseLocation(const std::string& id) {
-    utils::Logger::info("LocationService::releaseLocation({})", id);
-    
-    auto location = repo_->findById(id);
-    if (!location) {
+dtos::LocationDto LocationService::transitionLocation(const std::string& id, models::LocationStatus status) {
+    if (!models::isUuid(id)) {
         throw std::runtime_error("Location not found: " + id);
     }
-    
-    // TODO: Implement status change back to active
-    location->setStatus(models::LocationStatus::Available);
-    
-    bool success = repo_->update(*location);
-    if (!success) {
-        throw std::runtime_error("Failed to release location");
+    auto updated = repo_->updateStatus({id}, status, transitionSources(status));
+    if (updated.empty()) {
+        // Only the failure path pays for a second query, to say why
+        if (!repo_->exists(id)) {
+            throw std::runtime_error("Location not found: " + id);
+        }
+        throw std::invalid_argument("Location " + id + " cannot be moved to " +
+                                    models::locationStatusToString(status) + " from its current status");
     }
     
-    auto updated = repo_->findById(id);
-    if (!updated) {
-        throw std::runtime_error("Failed to retrieve released location");
+    publishUpdated(updated);
+    return convertToDto(updated.front());
+}
+
+void LocationService::notifyChanged(const models::Location& location) {
+    for (const auto& listener : listeners_) {
+        listener->onLocationChanged(location);
     }
-    
-    // TODO: Fetch warehouse code from warehouse service API
-    std::string warehouseCode = "WH-" + updated->getWarehouseId().substr(0, 8);
-    
-    return utils::DtoMapper::toLocationDto(*updated, warehouseCode);
 }
 
-dtos::LocationDto LocationService::markLocationFull(const std::string& id) {
-    utils::Logger::info("LocationService::markLocationFull({})", id);
-    
-    auto location = repo_->findById(id);
-    if (!location) {
-        throw std::runtime_error("Location not found: " + id);
+void LocationService::publishUpdated(const std::vector<models::Location>& locations) {
+    for (const auto& location : locations) {
+        notifyChanged(location);
     }
-    
-    // TODO: Implement status change to full
-    location->setStatus(models::LocationStatus::Full);
-    
-    bool success = repo_->update(*location);
-    if (!success) {
-        throw std::runtime_error("Failed to mark location as full");
+    if (!messageBus_ || locations.empty()) {
+        return;
     }
     
-    auto updated = repo_->findById(id);
-    if (!updated) {
-        throw std::runtime_error("Failed to retrieve full location");
+    std::vector<nlohmann::json> events;
+    events.reserve(locations.size());
+    for (const auto& location : locations) {
+        events.push_back(convertToDto(location).toJson());
+    }
+    try {
+        messageBus_->publishBatch("location.updated", events);
+    } catch (const std::exception& e) {
+        utils::Logger::warn("Failed to publish location.updated events: {}", e.what());
     }
-    
-    // TODO: Fetch warehouse code from warehouse service API
-    std::string warehouseCode = "WH-" + updated->getWarehouseId().substr(0, 8);
-    
-    return utils::DtoMapper::toLocationDto(*updated, warehouseCode);
 }
 
 bool LocationService::isValidLocation(const models::Location& location, std::string& errorMessage) {
@@ -195,21 +277,191 @@ bool LocationService::isValidLocation(const models::Location& location, std::str
 }
 
 std::vector<dtos::LocationDto> LocationService::optimizePickingRoute(const std::vector<std::string>& locationIds) {
-    // TODO: Implement route optimization algorithm
-    // For now, just return locations in the order they were provided
     utils::Logger::info("LocationService::optimizePickingRoute() called with {} locations", locationIds.size());
     
-    std::vector<dtos::LocationDto> route;
-    route.reserve(locationIds.size());
+    auto locations = repo_->findByIds(locationIds);
+    
+    std::vector<FloorCoordinate> stops;
+    stops.reserve(locations.size());
+    for (const auto& location : locations) {
+        stops.push_back(routeOptimizer_.layout().coordinateOf(location));
+    }
+    
+    auto route = routeOptimizer_.optimize(stops);
+    
+    std::vector<dtos::LocationDto> ordered;
+    ordered.reserve(route.sequence.size());
+    for (std::size_t index : route.sequence) {
+        ordered.push_back(convertToDto(locations[index]));
+    }
     
+    return ordered;
+}
+
+dtos::PickRouteDto LocationService::planPickRoute(const std::string& warehouseId,
+                                                  const std::vector<std::string>& locationIds) {
+    if (warehouseId.empty()) {
+        throw std::invalid_argument("Warehouse ID is required");
+    }
+    if (locationIds.empty()) {
+        throw std::invalid_argument("locationIds must contain at least one location");
+    }
+    
+    // Visit each location once, keeping first-seen order for unresolved reporting
+    std::vector<std::string> uniqueIds;
+    std::unordered_set<std::string> seen;
+    uniqueIds.reserve(locationIds.size());
     for (const auto& id : locationIds) {
-        auto location = repo_->findById(id);
-        if (location) {
-            route.push_back(convertToDto(*location));
+        if (seen.insert(id).second) {
+            uniqueIds.push_back(id);
+        }
+    }
+    
+    std::unordered_map<std::string, models::Location> byId;
+    for (auto& location : repo_->findByIds(uniqueIds)) {
+        if (location.getWarehouseId() == warehouseId) {
+            byId.emplace(location.getId(), std::move(location));
+        }
+    }
+    
+    std::vector<const models::Location*> resolved;
+    std::vector<std::string> unresolved;
+    std::vector<FloorCoordinate> stops;
+    resolved.reserve(byId.size());
+    stops.reserve(byId.size());
+    for (const auto& id : uniqueIds) {
+        auto it = byId.find(id);
+        if (it == byId.end()) {
+            unresolved.push_back(id);
+            continue;
+        }
+        resolved.push_back(&it->second);
+        stops.push_back(routeOptimizer_.layout().coordinateOf(it->second));
+    }
+    
+    auto route = routeOptimizer_.optimize(stops);
+    utils::Logger::info("Planned pick route for warehouse {}: {} stops, {:.1f} m ({}), {} unresolved",
+                        warehouseId, route.sequence.size(), route.distance, route.strategy, unresolved.size());
+    
+    std::vector<dtos::PickRouteStopDto> routeStops;
+    routeStops.reserve(route.sequence.size());
+    int sequence = 1;
+    for (std::size_t index : route.sequence) {
+        const auto& location = *resolved[index];
+        routeStops.emplace_back(sequence++,
+                                location.getId(),
+                                location.getCode(),
+                                location.getZone(),
+                                location.getAisle(),
+                                location.getBay(),
+                                location.getLevel());
+    }
+    
+    return dtos::PickRouteDto(warehouseId, route.strategy, route.distance, routeStops, unresolved);
+}
+
+dtos::LocationImportResultDto LocationService::importLocations(const std::string& warehouseId,
+                                                              std::istream& input,
+                                                              utils::ImportFormat format,
+                                                              const std::string& createdBy) {
+    if (warehouseId.empty()) {
+        throw std::invalid_argument("Warehouse ID is required");
+    }
+    // Checked before any query, so a malformed id never reaches the COPY
+    if (!models::isUuid(warehouseId)) {
+        throw std::invalid_argument("Invalid warehouse id: " + warehouseId);
+    }
+    
+    auto existing = repo_->findCodesByWarehouse(warehouseId);
+    std::unordered_set<std::string> codes(existing.begin(), existing.end());
+    
+    int received = 0;
+    int imported = 0;
+    int rejected = 0;
+    std::vector<dtos::LocationImportErrorDto> errors;
+    auto reject = [&](std::size_t line, const std::optional<std::string>& code, const std::string& message) {
+        ++rejected;
+        if (errors.size() < kMaxImportErrors) {
+            errors.emplace_back(static_cast<int>(line), code, message);
+        }
+    };
+    
+    std::vector<models::Location> pending;
+    std::vector<std::size_t> pendingLines;
+    pending.reserve(kImportChunkSize);
+    pendingLines.reserve(kImportChunkSize);
+    
+    auto flush = [&]() {
+        if (pending.empty()) {
+            return;
+        }
+        try {
+            repo_->bulkInsert(pending);
+            imported += static_cast<int>(pending.size());
+        } catch (const std::exception& e) {
+            // The chunk rolled back as a whole; its codes may be retried in a later upload
+            utils::Logger::error("Location import chunk of {} failed: {}", pending.size(), e.what());
+            for (std::size_t i = 0; i < pending.size(); ++i) {
+                codes.erase(pending[i].getCode());
+                reject(pendingLines[i], pending[i].getCode(), "Insert failed: " + std::string(e.what()));
+            }
+            pending.clear();
+            pendingLines.clear();
+            return;
+        }
+        for (const auto& location : pending) {
+            notifyChanged(location);
+        }
+        
+        if (messageBus_) {
+            std::vector<nlohmann::json> events;
+            events.reserve(pending.size());
+            for (const auto& location : pending) {
+                events.push_back(convertToDto(location).toJson());
+            }
+            try {
+                messageBus_->publishBatch("location.created", events);
+            } catch (const std::exception& e) {
+                utils::Logger::warn("Failed to publish location.created events: {}", e.what());
+            }
+        }
+        pending.clear();
+        pendingLines.clear();
+    };
+    
+    utils::LocationImportReader reader(input, format, warehouseId, createdBy);
+    utils::ImportRow row;
+    auto& uuids = Poco::UUIDGenerator::defaultGenerator();
+    while (reader.next(row)) {
+        ++received;
+        if (!row.location) {
+            reject(row.line, std::nullopt, row.error);
+            continue;
+        }
+        
+        auto& location = *row.location;
+        std::string errorMessage;
+        if (!isValidLocation(location, errorMessage)) {
+            reject(row.line, location.getCode(), errorMessage);
+            continue;
+        }
+        if (!codes.insert(location.getCode()).second) {
+            reject(row.line, location.getCode(), "Location code already exists in this warehouse");
+            continue;
+        }
+        
+        location.setId(uuids.createRandom().toString());
+        pending.push_back(std::move(location));
+        pendingLines.push_back(row.line);
+        if (pending.size() >= kImportChunkSize) {
+            flush();
         }
     }
+    flush();
     
-    return route;
+    utils::Logger::info("Imported {} of {} locations into warehouse {} ({} rejected)",
+                        imported, received, warehouseId, rejected);
+    return dtos::LocationImportResultDto(warehouseId, received, imported, rejected, errors);
 }
 
 // Helper methods for DTO conversion (DRY pattern)
@@ -231,9 +483,10 @@ std::vector<dtos::LocationDto> LocationService::convertToDtos(const std::vector<
 }
 
 bool LocationService::validateCode(const std::string& code) {
-    // Code should match pattern: ^[A-Z0-9-]+$
-    std::regex pattern("^[A-Z0-9-]+$");
-    return std::regex_match(code, pattern);
+    // ^[A-Z0-9-]+$, checked by hand: this runs once per imported row
+    return !code.empty() && std::all_of(code.begin(), code.end(), [](char c) {
+        return (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-';
+    });
 }
 
 bool LocationService::validateDimensions(const models::Dimensions& dimensions) {
@@ -0,0 +1,245 @@
+#include "warehouse/services/OccupancyIndex.hpp"
+#include "warehouse/services/PutawayEngine.hpp"
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+
+namespace warehouse::services {
+
+namespace {
+
+// Below this a location counts as empty even if volume rounding leaves a residue
+constexpr double kEpsilon = 1e-9;
+
+} // namespace
+
+std::string occupancyScopeToString(OccupancyScope scope) {
+    switch (scope) {
+        case OccupancyScope::Warehouse: return "warehouse";
+        case OccupancyScope::Zone: return "zone";
+        case OccupancyScope::Aisle: return "aisle";
+        case OccupancyScope::Level: return "level";
+        default: return "warehouse";
+    }
+}
+
+OccupancyScope stringToOccupancyScope(const std::string& str) {
+    if (str == "warehouse") return OccupancyScope::Warehouse;
+    if (str == "zone") return OccupancyScope::Zone;
+    if (str == "aisle") return OccupancyScope::Aisle;
+    if (str == "level") return OccupancyScope::Level;
+    throw std::invalid_argument("Invalid occupancy scope string: " + str);
+}
+
+bool OccupancyIndex::BucketKey::operator<(const BucketKey& other) const {
+    return std::tie(zone, aisle, level, depth) < std::tie(other.zone, other.aisle, other.level, other.depth);
+}
+
+OccupancyIndex::Entry OccupancyIndex::makeEntry(const models::Location& location) {
+    Entry entry;
+    entry.warehouseId = location.getWarehouseId();
+    entry.zone = location.getZone().value_or("");
+    entry.aisle = location.getAisle().value_or("");
+    entry.level = location.getLevel().value_or("");
+    entry.counted = location.getStatus() != models::LocationStatus::Inactive;
+
+    // Same capacity rules as putaway: maxVolume, else the location's own dimensions
+    if (location.getMaxVolume()) {
+        entry.volumeCapacity = *location.getMaxVolume();
+    } else if (const auto& dims = location.getDimensions()) {
+        try {
+            entry.volumeCapacity = PutawayEngine::toCubicMetres(*dims);
+        } catch (const std::invalid_argument&) {
+            entry.volumeCapacity = 0.0;
+        }
+    }
+    if (const auto& maxWeight = location.getMaxWeight()) {
+        try {
+            entry.weightCapacity = PutawayEngine::toKilograms(*maxWeight);
+        } catch (const std::invalid_argument&) {
+            entry.weightCapacity = 0.0;
+        }
+    }
+    return entry;
+}
+
+void OccupancyIndex::apply(const Entry& entry, int sign) {
+    if (!entry.counted) {
+        return;
+    }
+
+    const bool occupied = entry.stock.units > 0 || entry.stock.volume > kEpsilon;
+    auto& buckets = warehouses_[entry.warehouseId];
+    const BucketKey keys[] = {
+        {"", "", "", 0},
+        {entry.zone, "", "", 1},
+        {entry.zone, entry.aisle, "", 2},
+        {entry.zone, entry.aisle, entry.level, 3},
+    };
+    for (const auto& key : keys) {
+        auto& counters = buckets[key];
+        counters.totalBins += sign;
+        counters.occupiedBins += occupied ? sign : 0;
+        counters.volumeUsed += sign * entry.stock.volume;
+        counters.volumeCapacity += sign * entry.volumeCapacity;
+        counters.weightUsed += sign * entry.stock.weight;
+        counters.weightCapacity += sign * entry.weightCapacity;
+        if (counters.totalBins == 0) {
+            buckets.erase(key);   // no locations left under this node
+        }
+    }
+    if (buckets.empty()) {
+        warehouses_.erase(entry.warehouseId);
+    }
+}
+
+void OccupancyIndex::upsertLocation(const models::Location& location) {
+    std::unique_lock lock(mutex_);
+
+    Entry entry = makeEntry(location);
+    auto it = entries_.find(location.getId());
+    if (it != entries_.end()) {
+        apply(it->second, -1);
+        entry.stock = it->second.stock;
+        it->second = std::move(entry);
+        apply(it->second, +1);
+    } else {
+        auto inserted = entries_.emplace(location.getId(), std::move(entry));
+        apply(inserted.first->second, +1);
+    }
+}
+
+void OccupancyIndex::removeLocation(const std::string& locationId) {
+    std::unique_lock lock(mutex_);
+
+    auto it = entries_.find(locationId);
+    if (it == entries_.end()) {
+        return;
+    }
+    apply(it->second, -1);
+    entries_.erase(it);
+}
+
+bool OccupancyIndex::applyStockChange(const std::string& locationId, std::int64_t unitsDelta,
+                                      double volumeDelta, double weightDelta) {
+    std::unique_lock lock(mutex_);
+
+    auto it = entries_.find(locationId);
+    if (it == entries_.end()) {
+        return false;
+    }
+    apply(it->second, -1);
+    auto& stock = it->second.stock;
+    stock.units = std::max<std::int64_t>(0, stock.units + unitsDelta);
+    stock.volume = std::max(0.0, stock.volume + volumeDelta);
+    stock.weight = std::max(0.0, stock.weight + weightDelta);
+    apply(it->second, +1);
+    return true;
+}
+
+std::optional<StockLevel> OccupancyIndex::stockOf(const std::string& locationId) const {
+    std::shared_lock lock(mutex_);
+
+    auto it = entries_.find(locationId);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    return it->second.stock;
+}
+
+void OccupancyIndex::rebuild(const std::string& warehouseId,
+                             const std::vector<models::Location>& locations,
+                             const std::optional<std::unordered_map<std::string, std::int64_t>>& units) {
+    std::unordered_map<std::string, Entry> fresh;
+    fresh.reserve(locations.size());
+    for (const auto& location : locations) {
+        fresh.emplace(location.getId(), makeEntry(location));
+    }
+
+    std::unique_lock lock(mutex_);
+
+    // Carry tracked stock over, then drop the warehouse's old entries
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.warehouseId != warehouseId) {
+            ++it;
+            continue;
+        }
+        auto survivor = fresh.find(it->first);
+        if (survivor != fresh.end()) {
+            survivor->second.stock = it->second.stock;
+        }
+        it = entries_.erase(it);
+    }
+
+    if (units) {
+        for (auto& [id, entry] : fresh) {
+            auto count = units->find(id);
+            entry.stock.units = count != units->end() ? std::max<std::int64_t>(0, count->second) : 0;
+            if (entry.stock.units == 0) {
+                entry.stock.volume = 0.0;
+                entry.stock.weight = 0.0;
+            }
+        }
+    }
+
+    // Summing from zero discards whatever the incremental path accumulated
+    warehouses_.erase(warehouseId);
+    for (auto& [id, entry] : fresh) {
+        auto moved = entries_.find(id);
+        if (moved != entries_.end()) {
+            // Previously filed under another warehouse
+            apply(moved->second, -1);
+            entries_.erase(moved);
+        }
+        auto inserted = entries_.emplace(id, std::move(entry));
+        apply(inserted.first->second, +1);
+    }
+}
+
+std::vector<OccupancyBucket> OccupancyIndex::buckets(const std::string& warehouseId, OccupancyScope depth) const {
+    std::shared_lock lock(mutex_);
+
+    std::vector<OccupancyBucket> result;
+    auto warehouse = warehouses_.find(warehouseId);
+    if (warehouse == warehouses_.end()) {
+        return result;
+    }
+
+    const int maxDepth = static_cast<int>(depth);
+    result.reserve(warehouse->second.size());
+    for (const auto& [key, counters] : warehouse->second) {
+        if (key.depth > maxDepth) {
+            continue;
+        }
+        OccupancyBucket bucket;
+        bucket.scope = static_cast<OccupancyScope>(key.depth);
+        bucket.zone = key.zone;
+        bucket.aisle = key.aisle;
+        bucket.level = key.level;
+        bucket.counters = counters;
+        result.push_back(std::move(bucket));
+    }
+    return result;
+}
+
+std::optional<OccupancyCounters> OccupancyIndex::totals(const std::string& warehouseId) const {
+    std::shared_lock lock(mutex_);
+
+    auto warehouse = warehouses_.find(warehouseId);
+    if (warehouse == warehouses_.end()) {
+        return std::nullopt;
+    }
+    auto root = warehouse->second.find(BucketKey{"", "", "", 0});
+    if (root == warehouse->second.end()) {
+        return std::nullopt;
+    }
+    return root->second;
+}
+
+std::size_t OccupancyIndex::size() const {
+    std::shared_lock lock(mutex_);
+    return entries_.size();
+}
+
+} // namespace warehouse::services
@@ -0,0 +1,193 @@
+#include "warehouse/services/OccupancyService.hpp"
+#include "warehouse/services/PutawayEngine.hpp"
+#include "warehouse/repositories/LocationRepository.hpp"
+#include "warehouse/utils/Logger.hpp"
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+namespace warehouse::services {
+
+OccupancyService::OccupancyService(std::shared_ptr<repositories::LocationRepository> repo,
+                                   StockSource stockSource)
+    : repo_(repo)
+    , stockSource_(std::move(stockSource)) {
+}
+
+OccupancyService::~OccupancyService() {
+    stop();
+}
+
+void OccupancyService::load(const std::string& warehouseId) {
+    auto started = std::chrono::steady_clock::now();
+    auto locations = repo_->findByWarehouse(warehouseId);
+    
+    std::optional<std::unordered_map<std::string, std::int64_t>> units;
+    if (stockSource_) {
+        try {
+            units = stockSource_(warehouseId);
+        } catch (const std::exception& e) {
+            utils::Logger::warn("Occupancy stock reload failed for warehouse {}, keeping tracked stock: {}",
+                                warehouseId, e.what());
+        }
+    }
+    
+    auto before = index_.totals(warehouseId);
+    index_.rebuild(warehouseId, locations, units);
+    auto after = index_.totals(warehouseId).value_or(OccupancyCounters{});
+    
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    if (before) {
+        utils::Logger::info("Occupancy recomputed for warehouse {} in {} ms: occupied bins {} -> {}, volume used {:.3f} -> {:.3f}",
+                            warehouseId, elapsed.count(), before->occupiedBins, after.occupiedBins,
+                            before->volumeUsed, after.volumeUsed);
+    } else {
+        utils::Logger::info("Occupancy loaded {} locations for warehouse {} in {} ms",
+                            locations.size(), warehouseId, elapsed.count());
+    }
+}
+
+void OccupancyService::ensureLoaded(const std::string& warehouseId) {
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    if (loadedWarehouses_.count(warehouseId) > 0) {
+        return;
+    }
+    load(warehouseId);
+    loadedWarehouses_.insert(warehouseId);
+}
+
+dtos::OccupancyDto OccupancyService::getOccupancy(const std::string& warehouseId, OccupancyScope depth) {
+    if (warehouseId.empty()) {
+        throw std::invalid_argument("Warehouse ID is required");
+    }
+    
+    ensureLoaded(warehouseId);
+    
+    auto buckets = index_.buckets(warehouseId, depth);
+    std::vector<dtos::OccupancyBucketDto> items;
+    items.reserve(buckets.size());
+    for (const auto& bucket : buckets) {
+        auto optionalName = [](const std::string& name, bool applies) -> std::optional<std::string> {
+            if (!applies || name.empty()) return std::nullopt;
+            return name;
+        };
+        const auto& c = bucket.counters;
+        items.emplace_back(occupancyScopeToString(bucket.scope),
+                           optionalName(bucket.zone, bucket.scope >= OccupancyScope::Zone),
+                           optionalName(bucket.aisle, bucket.scope >= OccupancyScope::Aisle),
+                           optionalName(bucket.level, bucket.scope >= OccupancyScope::Level),
+                           c.totalBins,
+                           c.occupiedBins,
+                           c.freeBins(),
+                           c.volumeUsed,
+                           c.volumeCapacity,
+                           c.weightUsed,
+                           c.weightCapacity);
+    }
+    
+    return dtos::OccupancyDto(warehouseId, items);
+}
+
+void OccupancyService::onLocationChanged(const models::Location& location) {
+    {
+        std::lock_guard<std::mutex> lock(loadMutex_);
+        if (loadedWarehouses_.count(location.getWarehouseId()) == 0) {
+            return;   // picked up in full when the warehouse is first requested
+        }
+    }
+    index_.upsertLocation(location);
+}
+
+void OccupancyService::onLocationRemoved(const std::string& locationId) {
+    index_.removeLocation(locationId);
+}
+
+bool OccupancyService::recordStockMovement(const std::string& locationId,
+                                           int quantity,
+                                           const std::optional<models::Dimensions>& unitDimensions,
+                                           const std::optional<models::Weight>& unitWeight) {
+    double volumeDelta = unitDimensions ? PutawayEngine::toCubicMetres(*unitDimensions) * quantity : 0.0;
+    double weightDelta = unitWeight ? PutawayEngine::toKilograms(*unitWeight) * quantity : 0.0;
+    
+    bool applied = index_.applyStockChange(locationId, quantity, volumeDelta, weightDelta);
+    if (!applied) {
+        utils::Logger::debug("Stock movement for unindexed location {} ignored", locationId);
+    }
+    return applied;
+}
+
+std::vector<std::string> OccupancyService::loadedWarehouses() {
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    return std::vector<std::string>(loadedWarehouses_.begin(), loadedWarehouses_.end());
+}
+
+void OccupancyService::preload(const std::string& warehouseId, const std::vector<models::Location>& locations) {
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    index_.rebuild(warehouseId, locations);
+    loadedWarehouses_.insert(warehouseId);
+}
+
+bool OccupancyService::restoreStock(const std::string& locationId, const StockLevel& stock) {
+    auto current = index_.stockOf(locationId);
+    if (!current) {
+        return false;
+    }
+    return index_.applyStockChange(locationId,
+                                   stock.units - current->units,
+                                   stock.volume - current->volume,
+                                   stock.weight - current->weight);
+}
+
+std::optional<StockLevel> OccupancyService::stockOf(const std::string& locationId) const {
+    return index_.stockOf(locationId);
+}
+
+void OccupancyService::recompute(const std::string& warehouseId) {
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    load(warehouseId);
+    loadedWarehouses_.insert(warehouseId);
+}
+
+void OccupancyService::recomputeAll() {
+    std::vector<std::string> warehouses;
+    {
+        std::lock_guard<std::mutex> lock(loadMutex_);
+        warehouses.assign(loadedWarehouses_.begin(), loadedWarehouses_.end());
+    }
+    for (const auto& warehouseId : warehouses) {
+        try {
+            recompute(warehouseId);
+        } catch (const std::exception& e) {
+            utils::Logger::error("Occupancy recompute failed for warehouse {}: {}", warehouseId, e.what());
+        }
+    }
+}
+
+void OccupancyService::startPeriodicRecompute(std::chrono::seconds interval) {
+    if (timerThread_.joinable() || interval.count() <= 0) {
+        return;
+    }
+    
+    timerThread_ = std::thread([this, interval]() {
+        std::unique_lock<std::mutex> lock(timerMutex_);
+        while (!timerCondition_.wait_for(lock, interval, [this]() { return stopping_; })) {
+            lock.unlock();
+            recomputeAll();
+            lock.lock();
+        }
+    });
+    utils::Logger::info("Occupancy recompute scheduled every {} s", interval.count());
+}
+
+void OccupancyService::stop() {
+    {
+        std::lock_guard<std::mutex> lock(timerMutex_);
+        stopping_ = true;
+    }
+    timerCondition_.notify_all();
+    if (timerThread_.joinable()) {
+        timerThread_.join();
+    }
+}
+
+} // namespace warehouse::services
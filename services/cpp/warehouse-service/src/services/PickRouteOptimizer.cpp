@@ -0,0 +1,279 @@
+#include "warehouse/services/PickRouteOptimizer.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+
+namespace warehouse::services {
+
+namespace {
+
+constexpr double kEpsilon = 1e-9;
+
+} // namespace
+
+WarehouseLayout::WarehouseLayout(LayoutConfig config)
+    : config_(config)
+    , aisleLength_(std::max(1, config.baysPerAisle) * config.bayWidth) {
+}
+
+int WarehouseLayout::labelOrdinal(const std::optional<std::string>& label) {
+    if (!label || label->empty()) {
+        return 0;
+    }
+
+    // Saturate as we go, so no label length can overflow
+    constexpr std::int64_t cap = kMaxLabelOrdinal;
+    std::int64_t letters = 0;
+    std::int64_t digits = 0;
+    bool hasDigits = false;
+    for (char ch : *label) {
+        unsigned char c = static_cast<unsigned char>(ch);
+        if (std::isdigit(c)) {
+            digits = std::min(cap, digits * 10 + (c - '0'));
+            hasDigits = true;
+        } else if (std::isalpha(c)) {
+            letters = std::min(cap, letters * 26 + (std::toupper(c) - 'A' + 1));
+        }
+    }
+
+    if (!hasDigits) {
+        return static_cast<int>(letters);
+    }
+    return static_cast<int>(std::min(cap, letters * 1000 + digits));
+}
+
+FloorCoordinate WarehouseLayout::coordinateOf(const models::Location& location) const {
+    const int zone = labelOrdinal(location.getZone());
+    const int aisle = labelOrdinal(location.getAisle());
+    const int bay = labelOrdinal(location.getBay());
+
+    FloorCoordinate coordinate;
+    const double lastAisle = std::max(0.0, config_.zoneWidth - config_.aisleSpacing);
+    coordinate.x = zone * config_.zoneWidth + std::clamp(aisle * config_.aisleSpacing, 0.0, lastAisle);
+    coordinate.y = std::clamp(bay * config_.bayWidth, 0.0, aisleLength_);
+    coordinate.level = labelOrdinal(location.getLevel());
+    return coordinate;
+}
+
+double WarehouseLayout::distance(const FloorCoordinate& a, const FloorCoordinate& b) const {
+    const double dx = std::abs(a.x - b.x);
+    if (dx < kEpsilon) {
+        return std::abs(a.y - b.y);
+    }
+    const double viaFront = a.y + b.y;
+    const double viaBack = 2.0 * aisleLength_ - a.y - b.y;
+    return dx + std::min(viaFront, viaBack);
+}
+
+PickRouteOptimizer::PickRouteOptimizer(WarehouseLayout layout, int maxTwoOptPasses)
+    : layout_(std::move(layout))
+    , maxTwoOptPasses_(maxTwoOptPasses) {
+}
+
+std::vector<PickRouteOptimizer::Aisle> PickRouteOptimizer::groupByAisle(
+    const std::vector<FloorCoordinate>& stops) const {
+
+    std::vector<std::size_t> order(stops.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&stops](std::size_t lhs, std::size_t rhs) {
+        const auto& a = stops[lhs];
+        const auto& b = stops[rhs];
+        if (a.x != b.x) return a.x < b.x;
+        if (a.y != b.y) return a.y < b.y;
+        return a.level < b.level;
+    });
+
+    std::vector<Aisle> aisles;
+    for (std::size_t index : order) {
+        if (aisles.empty() || std::abs(aisles.back().x - stops[index].x) >= kEpsilon) {
+            aisles.push_back(Aisle{stops[index].x, {}});
+        }
+        aisles.back().stops.push_back(index);
+    }
+    return aisles;
+}
+
+std::vector<std::size_t> PickRouteOptimizer::sShapeSequence(const std::vector<FloorCoordinate>& stops) const {
+    std::vector<std::size_t> sequence;
+    sequence.reserve(stops.size());
+
+    auto aisles = groupByAisle(stops);
+    for (std::size_t i = 0; i < aisles.size(); ++i) {
+        const auto& aisleStops = aisles[i].stops;
+        if (i % 2 == 0) {
+            sequence.insert(sequence.end(), aisleStops.begin(), aisleStops.end());
+        } else {
+            sequence.insert(sequence.end(), aisleStops.rbegin(), aisleStops.rend());
+        }
+    }
+    return sequence;
+}
+
+std::vector<std::size_t> PickRouteOptimizer::largestGapSequence(const std::vector<FloorCoordinate>& stops) const {
+    std::vector<std::size_t> sequence;
+    sequence.reserve(stops.size());
+
+    auto aisles = groupByAisle(stops);
+    if (aisles.size() <= 1) {
+        for (const auto& aisle : aisles) {
+            sequence.insert(sequence.end(), aisle.stops.begin(), aisle.stops.end());
+        }
+        return sequence;
+    }
+
+    // For each middle aisle, the number of picks served from the front
+    // cross-aisle; the rest are served from the back. The split sits at
+    // the largest gap, which is the stretch of aisle never walked.
+    std::vector<std::size_t> frontCount(aisles.size(), 0);
+    for (std::size_t a = 1; a + 1 < aisles.size(); ++a) {
+        const auto& aisleStops = aisles[a].stops;
+        double largestGap = stops[aisleStops.front()].y;   // front cross-aisle to first pick
+        std::size_t split = 0;
+        for (std::size_t k = 0; k + 1 < aisleStops.size(); ++k) {
+            double gap = stops[aisleStops[k + 1]].y - stops[aisleStops[k]].y;
+            if (gap > largestGap) {
+                largestGap = gap;
+                split = k + 1;
+            }
+        }
+        double backGap = layout_.aisleLength() - stops[aisleStops.back()].y;
+        if (backGap > largestGap) {
+            split = aisleStops.size();
+        }
+        frontCount[a] = split;
+    }
+
+    // First aisle is traversed front to back
+    const auto& first = aisles.front().stops;
+    sequence.insert(sequence.end(), first.begin(), first.end());
+
+    // Back parts of the middle aisles, walking the back cross-aisle left to right
+    for (std::size_t a = 1; a + 1 < aisles.size(); ++a) {
+        const auto& aisleStops = aisles[a].stops;
+        for (std::size_t k = aisleStops.size(); k > frontCount[a]; --k) {
+            sequence.push_back(aisleStops[k - 1]);
+        }
+    }
+
+    // Last aisle is traversed back to front
+    const auto& last = aisles.back().stops;
+    sequence.insert(sequence.end(), last.rbegin(), last.rend());
+
+    // Front parts of the middle aisles, walking the front cross-aisle right to left
+    for (std::size_t a = aisles.size() - 2; a >= 1; --a) {
+        const auto& aisleStops = aisles[a].stops;
+        sequence.insert(sequence.end(), aisleStops.begin(), aisleStops.begin() + frontCount[a]);
+    }
+
+    return sequence;
+}
+
+double PickRouteOptimizer::routeDistance(const std::vector<std::size_t>& sequence,
+                                         const std::vector<FloorCoordinate>& stops,
+                                         const FloorCoordinate& depot) const {
+    if (sequence.empty()) {
+        return 0.0;
+    }
+
+    double total = layout_.distance(depot, stops[sequence.front()]);
+    for (std::size_t i = 1; i < sequence.size(); ++i) {
+        total += layout_.distance(stops[sequence[i - 1]], stops[sequence[i]]);
+    }
+    total += layout_.distance(stops[sequence.back()], depot);
+    return total;
+}
+
+int PickRouteOptimizer::twoOpt(std::vector<std::size_t>& tour,
+                               const std::vector<double>& matrix,
+                               std::size_t n) const {
+    // tour holds node ids with the depot (node 0) at both ends
+    const std::size_t last = tour.size() - 2;
+    int moves = 0;
+
+    for (int pass = 0; pass < maxTwoOptPasses_; ++pass) {
+        bool improved = false;
+        for (std::size_t i = 1; i < last; ++i) {
+            for (std::size_t j = i + 1; j <= last; ++j) {
+                const std::size_t a = tour[i - 1];
+                const std::size_t b = tour[i];
+                const std::size_t c = tour[j];
+                const std::size_t d = tour[j + 1];
+                const double delta = matrix[a * n + c] + matrix[b * n + d]
+                                   - matrix[a * n + b] - matrix[c * n + d];
+                if (delta < -kEpsilon) {
+                    std::reverse(tour.begin() + static_cast<std::ptrdiff_t>(i),
+                                 tour.begin() + static_cast<std::ptrdiff_t>(j) + 1);
+                    improved = true;
+                    ++moves;
+                }
+            }
+        }
+        if (!improved) {
+            break;
+        }
+    }
+    return moves;
+}
+
+PickRoute PickRouteOptimizer::optimize(const std::vector<FloorCoordinate>& stops,
+                                       const FloorCoordinate& depot) const {
+    PickRoute best;
+    if (stops.empty()) {
+        best.strategy = "none";
+        return best;
+    }
+
+    // Node 0 is the depot, node i + 1 is stop i
+    const std::size_t n = stops.size() + 1;
+    std::vector<double> matrix(n * n, 0.0);
+    auto nodeAt = [&](std::size_t node) -> const FloorCoordinate& {
+        return node == 0 ? depot : stops[node - 1];
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i + 1; j < n; ++j) {
+            double d = layout_.distance(nodeAt(i), nodeAt(j));
+            matrix[i * n + j] = d;
+            matrix[j * n + i] = d;
+        }
+    }
+
+    const std::pair<const char*, std::vector<std::size_t>> candidates[] = {
+        {"s-shape", sShapeSequence(stops)},
+        {"largest-gap", largestGapSequence(stops)},
+    };
+
+    bool haveBest = false;
+    for (const auto& [name, sequence] : candidates) {
+        std::vector<std::size_t> tour;
+        tour.reserve(sequence.size() + 2);
+        tour.push_back(0);
+        for (std::size_t index : sequence) {
+            tour.push_back(index + 1);
+        }
+        tour.push_back(0);
+
+        int moves = twoOpt(tour, matrix, n);
+
+        double total = 0.0;
+        for (std::size_t i = 1; i < tour.size(); ++i) {
+            total += matrix[tour[i - 1] * n + tour[i]];
+        }
+
+        if (!haveBest || total < best.distance - kEpsilon) {
+            best.sequence.clear();
+            for (std::size_t i = 1; i + 1 < tour.size(); ++i) {
+                best.sequence.push_back(tour[i] - 1);
+            }
+            best.distance = total;
+            best.strategy = name;
+            best.improvements = moves;
+            haveBest = true;
+        }
+    }
+
+    return best;
+}
+
+} // namespace warehouse::services
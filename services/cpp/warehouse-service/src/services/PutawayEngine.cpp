@@ -0,0 +1,357 @@
+#include "warehouse/services/PutawayEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+namespace warehouse::services {
+
+namespace {
+
+constexpr double kMinBucketVolume = 1e-4;   // 0.1 litre; anything smaller counts as full
+constexpr double kBucketsPerOctave = 4.0;
+constexpr double kEpsilon = 1e-9;
+
+bool isStorageType(models::LocationType type) {
+    switch (type) {
+        case models::LocationType::Receiving:
+        case models::LocationType::Shipping:
+        case models::LocationType::Staging:
+            return false;
+        default:
+            return true;
+    }
+}
+
+std::array<double, 3> sortedSides(double a, double b, double c) {
+    std::array<double, 3> sides = {a, b, c};
+    std::sort(sides.begin(), sides.end());
+    return sides;
+}
+
+} // namespace
+
+std::optional<double> PutawayEngine::metresPerUnit(const std::string& unit) {
+    if (unit == "m") return 1.0;
+    if (unit == "cm") return 0.01;
+    if (unit == "mm") return 0.001;
+    if (unit == "in") return 0.0254;
+    if (unit == "ft") return 0.3048;
+    return std::nullopt;
+}
+
+double PutawayEngine::toMetres(double value, const std::string& unit) {
+    auto factor = metresPerUnit(unit);
+    if (!factor) {
+        throw std::invalid_argument("Unsupported length unit: " + unit);
+    }
+    return value * *factor;
+}
+
+double PutawayEngine::toCubicMetres(const models::Dimensions& dimensions) {
+    return toMetres(dimensions.length, dimensions.unit)
+         * toMetres(dimensions.width, dimensions.unit)
+         * toMetres(dimensions.height, dimensions.unit);
+}
+
+double PutawayEngine::toKilograms(const models::Weight& weight) {
+    if (weight.unit == "kg") return weight.value;
+    if (weight.unit == "g") return weight.value * 0.001;
+    if (weight.unit == "lb") return weight.value * 0.45359237;
+    if (weight.unit == "oz") return weight.value * 0.028349523125;
+    throw std::invalid_argument("Unsupported weight unit: " + weight.unit);
+}
+
+PutawayLoad PutawayLoad::fromDimensions(const models::Dimensions& dimensions,
+                                        const std::optional<models::Weight>& weight) {
+    if (dimensions.length <= 0 || dimensions.width <= 0 || dimensions.height <= 0) {
+        throw std::invalid_argument("Load dimensions must be positive");
+    }
+
+    PutawayLoad load;
+    load.size = sortedSides(PutawayEngine::toMetres(dimensions.length, dimensions.unit),
+                            PutawayEngine::toMetres(dimensions.width, dimensions.unit),
+                            PutawayEngine::toMetres(dimensions.height, dimensions.unit));
+    load.volume = (*load.size)[0] * (*load.size)[1] * (*load.size)[2];
+    if (weight) {
+        if (weight->value < 0) {
+            throw std::invalid_argument("Load weight must be non-negative");
+        }
+        load.weight = PutawayEngine::toKilograms(*weight);
+    }
+    return load;
+}
+
+PutawayEngine::PutawayEngine(WarehouseLayout layout, PutawayWeights weights)
+    : layout_(std::move(layout))
+    , weights_(weights) {
+}
+
+int PutawayEngine::bucketFor(double freeVolume) {
+    if (freeVolume < kMinBucketVolume) {
+        return -1;
+    }
+    int bucket = static_cast<int>(std::floor(kBucketsPerOctave * std::log2(freeVolume / kMinBucketVolume)));
+    return std::clamp(bucket, 0, kBucketCount - 1);
+}
+
+void PutawayEngine::unbucket(std::size_t slotIndex) {
+    Slot& slot = slots_[slotIndex];
+    if (slot.bucket < 0) {
+        return;
+    }
+
+    // Swap-remove keeps bucket membership changes O(1)
+    auto& bucket = warehouses_[slot.warehouseId].buckets[static_cast<std::size_t>(slot.bucket)];
+    std::size_t moved = bucket.back();
+    bucket[slot.bucketPosition] = moved;
+    slots_[moved].bucketPosition = slot.bucketPosition;
+    bucket.pop_back();
+    slot.bucket = -1;
+}
+
+void PutawayEngine::rebucket(std::size_t slotIndex) {
+    Slot& slot = slots_[slotIndex];
+    int target = -1;
+    if (slot.live && slot.eligible) {
+        const auto& u = slot.utilisation;
+        bool weightFull = u.capacityWeight > 0 && u.usedWeight >= u.capacityWeight - kEpsilon;
+        if (!weightFull) {
+            target = bucketFor(u.capacityVolume - u.usedVolume);
+        }
+    }
+
+    if (target == slot.bucket) {
+        return;
+    }
+
+    unbucket(slotIndex);
+    if (target >= 0) {
+        auto& bucket = warehouses_[slot.warehouseId].buckets[static_cast<std::size_t>(target)];
+        slot.bucket = target;
+        slot.bucketPosition = bucket.size();
+        bucket.push_back(slotIndex);
+    }
+}
+
+void PutawayEngine::upsertLocation(const models::Location& location) {
+    std::unique_lock lock(mutex_);
+
+    std::size_t index;
+    auto it = slotById_.find(location.getId());
+    if (it != slotById_.end()) {
+        index = it->second;
+        if (slots_[index].warehouseId != location.getWarehouseId()) {
+            unbucket(index);
+            warehouses_[slots_[index].warehouseId].receivingPoints.erase(location.getId());
+        }
+    } else if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+        slots_[index] = Slot{};
+        slotById_.emplace(location.getId(), index);
+    } else {
+        index = slots_.size();
+        slots_.emplace_back();
+        slotById_.emplace(location.getId(), index);
+    }
+
+    Slot& slot = slots_[index];
+    slot.id = location.getId();
+    slot.warehouseId = location.getWarehouseId();
+    slot.code = location.getCode();
+    slot.zone = location.getZone();
+    slot.coordinate = layout_.coordinateOf(location);
+    slot.temperatureControlled = location.isTemperatureControlled();
+    slot.live = true;
+
+    slot.size.reset();
+    double dimensionVolume = 0.0;
+    if (const auto& dims = location.getDimensions()) {
+        auto factor = metresPerUnit(dims->unit);
+        if (factor && dims->length > 0 && dims->width > 0 && dims->height > 0) {
+            slot.size = sortedSides(dims->length * *factor, dims->width * *factor, dims->height * *factor);
+            dimensionVolume = (*slot.size)[0] * (*slot.size)[1] * (*slot.size)[2];
+        }
+    }
+    slot.utilisation.capacityVolume = location.getMaxVolume().value_or(dimensionVolume);
+
+    slot.utilisation.capacityWeight = 0.0;
+    if (const auto& maxWeight = location.getMaxWeight()) {
+        try {
+            slot.utilisation.capacityWeight = toKilograms(*maxWeight);
+        } catch (const std::invalid_argument&) {
+            // Unknown unit: treat as unlimited rather than rejecting the location
+        }
+    }
+
+    auto& warehouse = warehouses_[slot.warehouseId];
+    if (location.getType() == models::LocationType::Receiving) {
+        warehouse.receivingPoints[slot.id] = slot.coordinate;
+    } else {
+        warehouse.receivingPoints.erase(slot.id);
+    }
+
+    slot.eligible = location.getStatus() == models::LocationStatus::Active
+                 && location.isReceivable()
+                 && isStorageType(location.getType())
+                 && slot.utilisation.capacityVolume > 0.0;
+
+    rebucket(index);
+}
+
+void PutawayEngine::removeLocation(const std::string& locationId) {
+    std::unique_lock lock(mutex_);
+
+    auto it = slotById_.find(locationId);
+    if (it == slotById_.end()) {
+        return;
+    }
+
+    std::size_t index = it->second;
+    unbucket(index);
+    warehouses_[slots_[index].warehouseId].receivingPoints.erase(locationId);
+    slots_[index].live = false;
+    freeSlots_.push_back(index);
+    slotById_.erase(it);
+}
+
+bool PutawayEngine::adjustUtilisation(const std::string& locationId, double volumeDelta, double weightDelta) {
+    std::unique_lock lock(mutex_);
+
+    auto it = slotById_.find(locationId);
+    if (it == slotById_.end()) {
+        return false;
+    }
+
+    auto& u = slots_[it->second].utilisation;
+    u.usedVolume = std::max(0.0, u.usedVolume + volumeDelta);
+    u.usedWeight = std::max(0.0, u.usedWeight + weightDelta);
+    rebucket(it->second);
+    return true;
+}
+
+bool PutawayEngine::setUtilisation(const std::string& locationId, double usedVolume, double usedWeight) {
+    std::unique_lock lock(mutex_);
+
+    auto it = slotById_.find(locationId);
+    if (it == slotById_.end()) {
+        return false;
+    }
+
+    auto& u = slots_[it->second].utilisation;
+    u.usedVolume = std::max(0.0, usedVolume);
+    u.usedWeight = std::max(0.0, usedWeight);
+    rebucket(it->second);
+    return true;
+}
+
+std::optional<LocationUtilisation> PutawayEngine::utilisationOf(const std::string& locationId) const {
+    std::shared_lock lock(mutex_);
+
+    auto it = slotById_.find(locationId);
+    if (it == slotById_.end()) {
+        return std::nullopt;
+    }
+    return slots_[it->second].utilisation;
+}
+
+std::size_t PutawayEngine::size() const {
+    std::shared_lock lock(mutex_);
+    return slotById_.size();
+}
+
+double PutawayEngine::distanceFromReceiving(const WarehouseIndex& index, const FloorCoordinate& coordinate) const {
+    if (index.receivingPoints.empty()) {
+        // No receiving dock registered: measure from the layout origin
+        return layout_.distance(FloorCoordinate{}, coordinate);
+    }
+
+    double best = std::numeric_limits<double>::max();
+    for (const auto& [id, point] : index.receivingPoints) {
+        best = std::min(best, layout_.distance(point, coordinate));
+    }
+    return best;
+}
+
+std::vector<PutawayCandidate> PutawayEngine::suggest(const std::string& warehouseId,
+                                                     const PutawayLoad& load,
+                                                     std::size_t k) const {
+    std::shared_lock lock(mutex_);
+
+    std::vector<PutawayCandidate> candidates;
+    auto warehouseIt = warehouses_.find(warehouseId);
+    if (k == 0 || warehouseIt == warehouses_.end()) {
+        return candidates;
+    }
+    const WarehouseIndex& index = warehouseIt->second;
+
+    const std::size_t wanted = k * std::max<std::size_t>(1, weights_.oversample);
+    const double scale = layout_.aisleLength();
+    std::size_t examined = 0;
+
+    // Buckets below the load's own class cannot hold it, so start there and
+    // walk towards emptier locations; tighter fits are therefore seen first.
+    int firstBucket = std::max(0, bucketFor(load.volume));
+    for (int b = firstBucket; b < kBucketCount; ++b) {
+        for (std::size_t slotIndex : index.buckets[static_cast<std::size_t>(b)]) {
+            if (++examined > weights_.maxExamined) {
+                break;
+            }
+
+            const Slot& slot = slots_[slotIndex];
+            const auto& u = slot.utilisation;
+            const double freeVolume = u.capacityVolume - u.usedVolume;
+            const double freeWeight = u.capacityWeight > 0 ? u.capacityWeight - u.usedWeight : 0.0;
+
+            if (freeVolume + kEpsilon < load.volume) continue;
+            if (u.capacityWeight > 0 && freeWeight + kEpsilon < load.weight) continue;
+            if (load.requiresTemperatureControl && !slot.temperatureControlled) continue;
+            if (load.size && slot.size &&
+                ((*load.size)[0] > (*slot.size)[0] + kEpsilon ||
+                 (*load.size)[1] > (*slot.size)[1] + kEpsilon ||
+                 (*load.size)[2] > (*slot.size)[2] + kEpsilon)) {
+                continue;
+            }
+
+            PutawayCandidate candidate;
+            candidate.locationId = slot.id;
+            candidate.code = slot.code;
+            candidate.zone = slot.zone;
+            candidate.freeVolume = freeVolume;
+            candidate.freeWeight = freeWeight;
+            candidate.distance = distanceFromReceiving(index, slot.coordinate);
+
+            // Fit is driven by whichever of volume or weight is the tighter constraint
+            double fit = freeVolume > 0 ? load.volume / freeVolume : 0.0;
+            if (u.capacityWeight > 0 && freeWeight > 0) {
+                fit = std::max(fit, load.weight / freeWeight);
+            }
+            candidate.fit = std::min(1.0, fit);
+
+            const double distanceScore = scale / (scale + candidate.distance);
+            const double zoneScore = load.preferredZone && slot.zone == load.preferredZone ? 1.0 : 0.0;
+            candidate.score = weights_.fit * candidate.fit
+                            + weights_.distance * distanceScore
+                            + weights_.zone * zoneScore;
+
+            candidates.push_back(std::move(candidate));
+        }
+
+        if (candidates.size() >= wanted || examined > weights_.maxExamined) {
+            break;
+        }
+    }
+
+    std::size_t resultCount = std::min(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(resultCount),
+                      candidates.end(), [](const PutawayCandidate& a, const PutawayCandidate& b) {
+                          if (a.score != b.score) return a.score > b.score;
+                          return a.locationId < b.locationId;
+                      });
+    candidates.resize(resultCount);
+    return candidates;
+}
+
+} // namespace warehouse::services
@@ -0,0 +1,100 @@
+#include "warehouse/services/PutawayService.hpp"
+#include "warehouse/repositories/LocationRepository.hpp"
+#include "warehouse/utils/Logger.hpp"
+#include <stdexcept>
+
+namespace warehouse::services {
+
+PutawayService::PutawayService(std::shared_ptr<repositories::LocationRepository> repo)
+    : repo_(repo) {
+}
+
+void PutawayService::ensureLoaded(const std::string& warehouseId) {
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    if (loadedWarehouses_.count(warehouseId) > 0) {
+        return;
+    }
+    
+    auto locations = repo_->findByWarehouse(warehouseId);
+    for (const auto& location : locations) {
+        engine_.upsertLocation(location);
+    }
+    loadedWarehouses_.insert(warehouseId);
+    
+    utils::Logger::info("Putaway index loaded {} locations for warehouse {}", locations.size(), warehouseId);
+}
+
+dtos::PutawaySuggestionListDto PutawayService::suggest(const std::string& warehouseId,
+                                                       const PutawayLoad& load,
+                                                       int limit) {
+    if (warehouseId.empty()) {
+        throw std::invalid_argument("Warehouse ID is required");
+    }
+    if (limit < 1 || limit > kMaxSuggestions) {
+        throw std::invalid_argument("limit must be between 1 and " + std::to_string(kMaxSuggestions));
+    }
+    
+    ensureLoaded(warehouseId);
+    
+    auto candidates = engine_.suggest(warehouseId, load, static_cast<std::size_t>(limit));
+    
+    std::vector<dtos::PutawaySuggestionDto> items;
+    items.reserve(candidates.size());
+    for (const auto& candidate : candidates) {
+        items.emplace_back(candidate.locationId,
+                           candidate.code,
+                           candidate.zone,
+                           candidate.score,
+                           candidate.fit,
+                           candidate.distance,
+                           candidate.freeVolume,
+                           candidate.freeWeight > 0 ? std::optional<double>(candidate.freeWeight) : std::nullopt);
+    }
+    
+    return dtos::PutawaySuggestionListDto(warehouseId, items);
+}
+
+void PutawayService::refreshLocation(const models::Location& location) {
+    engine_.upsertLocation(location);
+}
+
+void PutawayService::removeLocation(const std::string& locationId) {
+    engine_.removeLocation(locationId);
+}
+
+bool PutawayService::recordStockMovement(const std::string& locationId,
+                                         int quantity,
+                                         const models::Dimensions& unitDimensions,
+                                         const std::optional<models::Weight>& unitWeight) {
+    double volumeDelta = PutawayEngine::toCubicMetres(unitDimensions) * quantity;
+    double weightDelta = unitWeight ? PutawayEngine::toKilograms(*unitWeight) * quantity : 0.0;
+    
+    bool applied = engine_.adjustUtilisation(locationId, volumeDelta, weightDelta);
+    if (!applied) {
+        utils::Logger::debug("Stock movement for unindexed location {} ignored", locationId);
+    }
+    return applied;
+}
+
+std::vector<std::string> PutawayService::loadedWarehouses() {
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    return std::vector<std::string>(loadedWarehouses_.begin(), loadedWarehouses_.end());
+}
+
+void PutawayService::preload(const std::string& warehouseId, const std::vector<models::Location>& locations) {
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    for (const auto& location : locations) {
+        engine_.upsertLocation(location);
+    }
+    loadedWarehouses_.insert(warehouseId);
+}
+
+bool PutawayService::restoreUtilisation(const std::string& locationId, double usedVolume, double usedWeight) {
+    return engine_.setUtilisation(locationId, usedVolume, usedWeight);
+}
+
+std::optional<LocationUtilisation> PutawayService::utilisationOf(const std::string& locationId) const {
+    return engine_.utilisationOf(locationId);
+}
+
+} // namespace warehouse::services
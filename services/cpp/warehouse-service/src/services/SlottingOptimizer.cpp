@@ -0,0 +1,168 @@
+#include "warehouse/services/SlottingOptimizer.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <numeric>
+#include <thread>
+
+namespace warehouse::services {
+
+namespace {
+
+// Below this many events the thread start-up cost outweighs the work
+constexpr std::size_t kMinEventsPerThread = 1 << 16;
+
+} // namespace
+
+SlottingOptimizer::SlottingOptimizer(WarehouseLayout layout, SlottingOptions options)
+    : layout_(std::move(layout))
+    , options_(options) {
+}
+
+unsigned SlottingOptimizer::threadCount(std::size_t work) const {
+    unsigned threads = options_.threads > 0 ? options_.threads : std::thread::hardware_concurrency();
+    threads = std::max(1u, threads);
+    std::size_t useful = std::max<std::size_t>(1, work / kMinEventsPerThread);
+    return static_cast<unsigned>(std::min<std::size_t>(threads, useful));
+}
+
+std::vector<SlotVelocity> SlottingOptimizer::computeVelocity(const std::vector<PickEvent>& events,
+                                                             std::size_t slotCount) const {
+    const unsigned threads = threadCount(events.size());
+
+    // Each thread aggregates a contiguous range into its own dense table,
+    // then the tables are summed; no locking on the hot path.
+    std::vector<std::vector<SlotVelocity>> partials(threads, std::vector<SlotVelocity>(slotCount));
+    auto aggregate = [&](unsigned worker) {
+        const std::size_t begin = events.size() * worker / threads;
+        const std::size_t end = events.size() * (worker + 1) / threads;
+        auto& table = partials[worker];
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto& event = events[i];
+            if (event.slot >= slotCount) {
+                continue;
+            }
+            auto& velocity = table[event.slot];
+            velocity.picks += 1;
+            velocity.units += static_cast<std::uint64_t>(std::abs(static_cast<std::int64_t>(event.quantity)));
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned worker = 1; worker < threads; ++worker) {
+        workers.emplace_back(aggregate, worker);
+    }
+    aggregate(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::vector<SlotVelocity> totals = std::move(partials[0]);
+    for (unsigned worker = 1; worker < threads; ++worker) {
+        for (std::size_t slot = 0; slot < slotCount; ++slot) {
+            totals[slot].picks += partials[worker][slot].picks;
+            totals[slot].units += partials[worker][slot].units;
+        }
+    }
+    return totals;
+}
+
+double SlottingOptimizer::expectedTravel(const std::vector<SlotAssignment>& slots,
+                                         const FloorCoordinate& depot) const {
+    double total = 0.0;
+    for (const auto& slot : slots) {
+        total += 2.0 * layout_.distance(depot, slot.coordinate) * static_cast<double>(slot.velocity.picks);
+    }
+    return total;
+}
+
+void SlottingOptimizer::pairWithinGroup(const std::vector<SlotAssignment>& slots,
+                                        const std::vector<std::size_t>& group,
+                                        const std::vector<double>& travel,
+                                        std::vector<SlotSwap>& swaps) const {
+    const std::size_t n = group.size();
+    if (n < 2) {
+        return;
+    }
+
+    // Velocity rank (fastest first) and travel rank (nearest first) per member
+    std::vector<std::size_t> byVelocity(group);
+    std::stable_sort(byVelocity.begin(), byVelocity.end(), [&](std::size_t a, std::size_t b) {
+        return slots[a].velocity.picks > slots[b].velocity.picks;
+    });
+    std::vector<std::size_t> byTravel(group);
+    std::stable_sort(byTravel.begin(), byTravel.end(), [&](std::size_t a, std::size_t b) {
+        return travel[a] < travel[b];
+    });
+
+    std::vector<std::size_t> velocityRank(slots.size());
+    std::vector<std::size_t> travelRank(slots.size());
+    for (std::size_t r = 0; r < n; ++r) {
+        velocityRank[byVelocity[r]] = r;
+        travelRank[byTravel[r]] = r;
+    }
+
+    // Fast movers placed further out than their velocity deserves, fastest first;
+    // slow movers holding nearer locations than they deserve, nearest first.
+    std::vector<std::size_t> tooFar;
+    for (std::size_t index : byVelocity) {
+        if (travelRank[index] > velocityRank[index]) tooFar.push_back(index);
+    }
+    std::vector<std::size_t> tooNear;
+    for (std::size_t index : byTravel) {
+        if (travelRank[index] < velocityRank[index]) tooNear.push_back(index);
+    }
+
+    std::size_t next = 0;
+    for (std::size_t fast : tooFar) {
+        while (next < tooNear.size()) {
+            std::size_t slow = tooNear[next];
+            double pickGap = static_cast<double>(slots[fast].velocity.picks) -
+                             static_cast<double>(slots[slow].velocity.picks);
+            double travelGap = travel[fast] - travel[slow];
+            if (pickGap > 0 && travelGap > 0) {
+                swaps.push_back(SlotSwap{fast, slow, pickGap * travelGap});
+                ++next;
+                break;
+            }
+            ++next;
+        }
+        if (next >= tooNear.size()) {
+            break;
+        }
+    }
+}
+
+std::vector<SlotSwap> SlottingOptimizer::proposeSwaps(const std::vector<SlotAssignment>& slots,
+                                                      const FloorCoordinate& depot) const {
+    std::vector<double> travel(slots.size());
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        travel[i] = 2.0 * layout_.distance(depot, slots[i].coordinate);
+    }
+
+    std::vector<SlotSwap> swaps;
+    if (options_.sameZoneOnly) {
+        std::map<std::string, std::vector<std::size_t>> zones;
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            zones[slots[i].zone.value_or("")].push_back(i);
+        }
+        for (const auto& [zone, group] : zones) {
+            pairWithinGroup(slots, group, travel, swaps);
+        }
+    } else {
+        std::vector<std::size_t> all(slots.size());
+        std::iota(all.begin(), all.end(), 0);
+        pairWithinGroup(slots, all, travel, swaps);
+    }
+
+    std::sort(swaps.begin(), swaps.end(), [](const SlotSwap& a, const SlotSwap& b) {
+        return a.estimatedSaving > b.estimatedSaving;
+    });
+    if (swaps.size() > options_.maxSwaps) {
+        swaps.resize(options_.maxSwaps);
+    }
+    return swaps;
+}
+
+} // namespace warehouse::services
@@ -0,0 +1,161 @@
+#include "warehouse/services/SnapshotService.hpp"
+#include "warehouse/services/OccupancyService.hpp"
+#include "warehouse/services/PutawayService.hpp"
+#include "warehouse/repositories/LocationRepository.hpp"
+#include "warehouse/utils/LocationSnapshot.hpp"
+#include "warehouse/utils/Logger.hpp"
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace warehouse::services {
+
+SnapshotService::SnapshotService(std::shared_ptr<repositories::LocationRepository> repo,
+                                 std::shared_ptr<PutawayService> putawayService,
+                                 std::shared_ptr<OccupancyService> occupancyService,
+                                 std::string path)
+    : repo_(repo)
+    , putawayService_(putawayService)
+    , occupancyService_(occupancyService)
+    , path_(std::move(path)) {
+}
+
+SnapshotService::~SnapshotService() {
+    stop();
+}
+
+bool SnapshotService::restore() {
+    auto started = std::chrono::steady_clock::now();
+    
+    std::unique_ptr<utils::LocationSnapshot> snapshot;
+    try {
+        snapshot = utils::LocationSnapshot::open(path_);
+    } catch (const std::exception& e) {
+        utils::Logger::info("No usable snapshot, indexes will load on demand: {}", e.what());
+        return false;
+    }
+    
+    // Group by warehouse so each index is rebuilt once per warehouse
+    std::unordered_map<std::string, std::vector<models::Location>> byWarehouse;
+    for (const auto& warehouseId : snapshot->warehouseIds()) {
+        byWarehouse[warehouseId];
+    }
+    std::vector<std::pair<std::string, utils::LocationSnapshot::Stock>> stock;
+    stock.reserve(snapshot->size());
+    for (std::size_t i = 0; i < snapshot->size(); ++i) {
+        auto entry = snapshot->entry(i);
+        stock.emplace_back(entry.location.getId(), entry.stock);
+        byWarehouse[entry.location.getWarehouseId()].push_back(std::move(entry.location));
+    }
+    
+    for (const auto& [warehouseId, locations] : byWarehouse) {
+        putawayService_->preload(warehouseId, locations);
+        occupancyService_->preload(warehouseId, locations);
+    }
+    for (const auto& [locationId, level] : stock) {
+        putawayService_->restoreUtilisation(locationId, level.volume, level.weight);
+        occupancyService_->restoreStock(locationId, StockLevel{level.units, level.volume, level.weight});
+    }
+    
+    auto restored = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    utils::Logger::info("Snapshot restored {} locations in {} warehouses in {} ms",
+                        stock.size(), byWarehouse.size(), restored.count());
+    
+    // Catch up on changes made after the snapshot was written. Deleted
+    // locations leave no row behind, so they are found by their absence.
+    std::vector<std::string> warehouseIds;
+    warehouseIds.reserve(byWarehouse.size());
+    for (const auto& [warehouseId, locations] : byWarehouse) {
+        warehouseIds.push_back(warehouseId);
+    }
+    try {
+        auto changed = repo_->findChangedSince(warehouseIds, snapshot->watermark());
+        for (const auto& location : changed) {
+            putawayService_->onLocationChanged(location);
+            occupancyService_->onLocationChanged(location);
+        }
+        
+        auto currentIds = repo_->findIdsByWarehouses(warehouseIds);
+        std::unordered_set<std::string> current(currentIds.begin(), currentIds.end());
+        std::size_t removed = 0;
+        for (const auto& [locationId, level] : stock) {
+            if (current.count(locationId) == 0) {
+                putawayService_->onLocationRemoved(locationId);
+                occupancyService_->onLocationRemoved(locationId);
+                ++removed;
+            }
+        }
+        utils::Logger::info("Snapshot catch-up applied {} changed and {} removed locations",
+                            changed.size(), removed);
+    } catch (const std::exception& e) {
+        utils::Logger::warn("Snapshot catch-up failed, serving snapshot state until the next recompute: {}", e.what());
+    }
+    
+    return true;
+}
+
+void SnapshotService::save() {
+    std::lock_guard<std::mutex> lock(saveMutex_);
+    auto started = std::chrono::steady_clock::now();
+    
+    auto warehouseIds = occupancyService_->loadedWarehouses();
+    for (auto& warehouseId : putawayService_->loadedWarehouses()) {
+        if (std::find(warehouseIds.begin(), warehouseIds.end(), warehouseId) == warehouseIds.end()) {
+            warehouseIds.push_back(std::move(warehouseId));
+        }
+    }
+    
+    std::vector<utils::LocationSnapshot::Entry> entries;
+    for (const auto& warehouseId : warehouseIds) {
+        for (auto& location : repo_->findByWarehouse(warehouseId)) {
+            utils::LocationSnapshot::Stock stock;
+            if (auto level = occupancyService_->stockOf(location.getId())) {
+                stock = utils::LocationSnapshot::Stock{level->units, level->volume, level->weight};
+            } else if (auto utilisation = putawayService_->utilisationOf(location.getId())) {
+                stock.volume = utilisation->usedVolume;
+                stock.weight = utilisation->usedWeight;
+            }
+            entries.push_back(utils::LocationSnapshot::Entry{std::move(location), stock});
+        }
+    }
+    
+    utils::LocationSnapshot::write(path_, warehouseIds, entries);
+    
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+    utils::Logger::info("Snapshot saved {} locations in {} warehouses to {} in {} ms",
+                        entries.size(), warehouseIds.size(), path_, elapsed.count());
+}
+
+void SnapshotService::startPeriodicSave(std::chrono::seconds interval) {
+    if (timerThread_.joinable() || interval.count() <= 0) {
+        return;
+    }
+    
+    timerThread_ = std::thread([this, interval]() {
+        std::unique_lock<std::mutex> lock(timerMutex_);
+        while (!timerCondition_.wait_for(lock, interval, [this]() { return stopping_; })) {
+            lock.unlock();
+            try {
+                save();
+            } catch (const std::exception& e) {
+                utils::Logger::error("Periodic snapshot failed: {}", e.what());
+            }
+            lock.lock();
+        }
+    });
+    utils::Logger::info("Snapshot scheduled every {} s to {}", interval.count(), path_);
+}
+
+void SnapshotService::stop() {
+    {
+        std::lock_guard<std::mutex> lock(timerMutex_);
+        stopping_ = true;
+    }
+    timerCondition_.notify_all();
+    if (timerThread_.joinable()) {
+        timerThread_.join();
+    }
+}
+
+} // namespace warehouse::services
@@ -0,0 +1,264 @@
+/**
+ * @file slotting_job.cpp
+ * @brief Offline slotting job: ranks product/location swaps by travel saved
+ *
+ * Usage: ./warehouse-slotting --warehouse-id <uuid> [options]
+ *
+ * Options:
+ *   --warehouse-id <uuid>      Warehouse to analyse (required)
+ *   --warehouse-db <conninfo>  Connection string for warehouse_db (default: $WAREHOUSE_DB_URL)
+ *   --inventory-db <conninfo>  Connection string for inventory_db (default: $INVENTORY_DB_URL)
+ *   --days <n>                 History window in days (default: 365)
+ *   --threads <n>              Aggregation threads (default: all cores)
+ *   --limit <n>                Maximum number of moves to report (default: 500)
+ *   --same-zone                Only propose swaps within a zone
+ *   --output <path>            Write the JSON report to a file instead of stdout
+ */
+
+#include "warehouse/services/SlottingOptimizer.hpp"
+#include "warehouse/utils/Logger.hpp"
+#include <pqxx/pqxx>
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+using json = nlohmann::json;
+using namespace warehouse;
+
+struct Args {
+    std::string warehouseId;
+    std::string warehouseDb;
+    std::string inventoryDb;
+    int days = 365;
+    unsigned threads = 0;
+    std::size_t limit = 500;
+    bool sameZone = false;
+    std::string output;
+};
+
+void printUsage(const char* progName) {
+    std::cout << "Usage: " << progName << " --warehouse-id <uuid> [options]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --warehouse-id <uuid>      Warehouse to analyse (required)\n";
+    std::cout << "  --warehouse-db <conninfo>  Connection string for warehouse_db (default: $WAREHOUSE_DB_URL)\n";
+    std::cout << "  --inventory-db <conninfo>  Connection string for inventory_db (default: $INVENTORY_DB_URL)\n";
+    std::cout << "  --days <n>                 History window in days (default: 365)\n";
+    std::cout << "  --threads <n>              Aggregation threads (default: all cores)\n";
+    std::cout << "  --limit <n>                Maximum number of moves to report (default: 500)\n";
+    std::cout << "  --same-zone                Only propose swaps within a zone\n";
+    std::cout << "  --output <path>            Write the JSON report to a file instead of stdout\n";
+    std::cout << "  --help                     Show this help message\n";
+}
+
+Args parseArgs(int argc, char* argv[]) {
+    Args args;
+    if (const char* env = std::getenv("WAREHOUSE_DB_URL")) args.warehouseDb = env;
+    if (const char* env = std::getenv("INVENTORY_DB_URL")) args.inventoryDb = env;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a value\n";
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            std::exit(0);
+        } else if (arg == "--warehouse-id") {
+            args.warehouseId = next();
+        } else if (arg == "--warehouse-db") {
+            args.warehouseDb = next();
+        } else if (arg == "--inventory-db") {
+            args.inventoryDb = next();
+        } else if (arg == "--days") {
+            args.days = std::stoi(next());
+        } else if (arg == "--threads") {
+            args.threads = static_cast<unsigned>(std::stoul(next()));
+        } else if (arg == "--limit") {
+            args.limit = std::stoul(next());
+        } else if (arg == "--same-zone") {
+            args.sameZone = true;
+        } else if (arg == "--output") {
+            args.output = next();
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage(argv[0]);
+            std::exit(1);
+        }
+    }
+
+    if (args.warehouseId.empty() || args.warehouseDb.empty() || args.inventoryDb.empty()) {
+        std::cerr << "Error: --warehouse-id, --warehouse-db and --inventory-db are required\n";
+        printUsage(argv[0]);
+        std::exit(1);
+    }
+    if (args.days < 1) {
+        std::cerr << "Error: --days must be positive\n";
+        std::exit(1);
+    }
+    return args;
+}
+
+struct PickLocation {
+    std::string code;
+    std::optional<std::string> zone;
+    services::FloorCoordinate coordinate;
+};
+
+std::unordered_map<std::string, PickLocation> loadPickLocations(pqxx::connection& conn,
+                                                                const std::string& warehouseId,
+                                                                const services::WarehouseLayout& layout) {
+    pqxx::work txn(conn);
+    auto result = txn.exec_params(
+        "SELECT id::text, code, zone, aisle, bay, level FROM locations "
+        "WHERE warehouse_id = $1 AND is_pickable AND status <> 'inactive'",
+        warehouseId);
+    txn.commit();
+
+    auto optionalField = [](const pqxx::field& field) -> std::optional<std::string> {
+        if (field.is_null()) return std::nullopt;
+        return field.as<std::string>();
+    };
+
+    std::unordered_map<std::string, PickLocation> locations;
+    locations.reserve(result.size());
+    for (const auto& row : result) {
+        models::Location location;
+        location.setZone(optionalField(row[2]));
+        location.setAisle(optionalField(row[3]));
+        location.setBay(optionalField(row[4]));
+        location.setLevel(optionalField(row[5]));
+        locations.emplace(row[0].as<std::string>(),
+                          PickLocation{row[1].as<std::string>(), location.getZone(), layout.coordinateOf(location)});
+    }
+    return locations;
+}
+
+int main(int argc, char* argv[]) {
+    Args args = parseArgs(argc, argv);
+    utils::Logger::init("logs/warehouse-slotting.log", utils::Logger::Level::Info, true);
+
+    try {
+        const auto started = std::chrono::steady_clock::now();
+        services::WarehouseLayout layout;
+        services::SlottingOptimizer optimizer(layout, services::SlottingOptions{args.threads, args.limit, args.sameZone});
+
+        pqxx::connection warehouseConn(args.warehouseDb);
+        auto locations = loadPickLocations(warehouseConn, args.warehouseId, layout);
+        utils::Logger::info("Loaded {} pick locations", locations.size());
+
+        // Slots are inventory rows (product at location); intern them while
+        // streaming so the movement table is reduced to flat PickEvents.
+        pqxx::connection inventoryConn(args.inventoryDb);
+        pqxx::work txn(inventoryConn);
+
+        std::vector<services::SlotAssignment> slots;
+        std::unordered_map<std::string, std::uint32_t> slotByInventoryId;
+        auto inventoryRows = txn.exec_params(
+            "SELECT id::text, product_id::text, location_id::text FROM inventory WHERE warehouse_id = $1",
+            args.warehouseId);
+        for (const auto& row : inventoryRows) {
+            auto location = locations.find(row[2].as<std::string>());
+            if (location == locations.end()) {
+                continue;   // not a pick location
+            }
+            services::SlotAssignment slot;
+            slot.productId = row[1].as<std::string>();
+            slot.locationId = location->first;
+            slot.zone = location->second.zone;
+            slot.coordinate = location->second.coordinate;
+            slotByInventoryId.emplace(row[0].as<std::string>(), static_cast<std::uint32_t>(slots.size()));
+            slots.push_back(std::move(slot));
+        }
+
+        std::vector<services::PickEvent> events;
+        auto stream = pqxx::stream_from::query(txn,
+            "SELECT m.inventory_id::text, m.quantity_change FROM inventory_movements m "
+            "JOIN inventory i ON i.id = m.inventory_id "
+            "WHERE i.warehouse_id = " + txn.quote(args.warehouseId) +
+            " AND m.movement_type = 'issue'"
+            " AND m.created_at >= NOW() - make_interval(days => " + std::to_string(args.days) + ")");
+        std::tuple<std::string, int> movement;
+        while (stream >> movement) {
+            auto slot = slotByInventoryId.find(std::get<0>(movement));
+            if (slot != slotByInventoryId.end()) {
+                events.push_back(services::PickEvent{slot->second, std::get<1>(movement)});
+            }
+        }
+        stream.complete();
+        txn.commit();
+        utils::Logger::info("Streamed {} pick movements for {} slots", events.size(), slots.size());
+
+        auto velocity = optimizer.computeVelocity(events, slots.size());
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            slots[i].velocity = velocity[i];
+        }
+
+        auto swaps = optimizer.proposeSwaps(slots);
+
+        double totalSaving = 0.0;
+        json moves = json::array();
+        for (std::size_t rank = 0; rank < swaps.size(); ++rank) {
+            const auto& fast = slots[swaps[rank].fastSlot];
+            const auto& slow = slots[swaps[rank].slowSlot];
+            totalSaving += swaps[rank].estimatedSaving;
+            moves.push_back({
+                {"rank", rank + 1},
+                {"estimatedSaving", swaps[rank].estimatedSaving},
+                {"fastMover", {
+                    {"productId", fast.productId},
+                    {"picks", fast.velocity.picks},
+                    {"fromLocationId", fast.locationId},
+                    {"fromLocationCode", locations.at(fast.locationId).code},
+                    {"toLocationId", slow.locationId},
+                    {"toLocationCode", locations.at(slow.locationId).code}
+                }},
+                {"slowMover", {
+                    {"productId", slow.productId},
+                    {"picks", slow.velocity.picks},
+                    {"fromLocationId", slow.locationId},
+                    {"fromLocationCode", locations.at(slow.locationId).code},
+                    {"toLocationId", fast.locationId},
+                    {"toLocationCode", locations.at(fast.locationId).code}
+                }}
+            });
+        }
+
+        const double travel = optimizer.expectedTravel(slots);
+        json report = {
+            {"warehouseId", args.warehouseId},
+            {"periodDays", args.days},
+            {"slotsAnalysed", slots.size()},
+            {"pickMovements", events.size()},
+            {"expectedTravel", travel},
+            {"estimatedSaving", totalSaving},
+            {"moves", moves}
+        };
+
+        if (args.output.empty()) {
+            std::cout << report.dump(2) << std::endl;
+        } else {
+            std::ofstream out(args.output);
+            out << report.dump(2) << std::endl;
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - started);
+        utils::Logger::info("Slotting finished in {} ms: {} moves, {:.0f} m saved of {:.0f} m",
+                            elapsed.count(), swaps.size(), totalSaving, travel);
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Slotting job failed: " << e.what() << std::endl;
+        utils::Logger::critical("Slotting job failed: {}", e.what());
+        return 1;
+    }
+}
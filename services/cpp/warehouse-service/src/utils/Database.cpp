@@ -45,11 +45,13 @@ bool Database::isConnected() const {
     return connection_ && connection_->is_open();
 }
 
-std::unique_ptr<pqxx::work> Database::beginTransaction() {
+Database::Transaction Database::beginTransaction() {
+    std::unique_lock<std::mutex> lock(mutex_);
     if (!isConnected()) {
         throw std::runtime_error("Database not connected");
     }
-    return std::make_unique<pqxx::work>(*connection_);
+    auto work = std::make_unique<pqxx::work>(*connection_);
+    return Transaction(std::move(lock), std::move(work));
 }
 
 pqxx::result Database::execute(const std::string& query) {
@@ -68,6 +70,7 @@ pqxx::result Database::executeParams(const std::string& query, const std::vector
 }
 
 void Database::prepare(const std::string& name, const std::string& query) {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (!isConnected()) {
         throw std::runtime_error("Database not connected");
     }
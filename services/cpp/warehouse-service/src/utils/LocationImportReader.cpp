@@ -0,0 +1,243 @@
+#include "warehouse/utils/LocationImportReader.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <stdexcept>
+
+namespace warehouse::utils {
+
+namespace {
+
+using json = nlohmann::json;
+
+const char* const BOOLEAN_COLUMNS[] = {"isPickable", "isReceivable", "temperatureControlled"};
+
+std::string trim(const std::string& value) {
+    auto begin = value.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    auto end = value.find_last_not_of(" \t\r");
+    return value.substr(begin, end - begin + 1);
+}
+
+bool isBooleanColumn(const std::string& column) {
+    return std::find(std::begin(BOOLEAN_COLUMNS), std::end(BOOLEAN_COLUMNS), column) != std::end(BOOLEAN_COLUMNS);
+}
+
+bool parseBool(const std::string& column, const std::string& value) {
+    std::string lower = value;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (lower == "true" || lower == "1" || lower == "yes") return true;
+    if (lower == "false" || lower == "0" || lower == "no") return false;
+    throw std::invalid_argument(column + " must be true or false");
+}
+
+double parseNumber(const std::string& column, const std::string& value) {
+    // std::stod stops at the first bad character; the whole field must be a number
+    std::size_t used = 0;
+    double number = 0;
+    try {
+        number = std::stod(value, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != value.size()) {
+        throw std::invalid_argument(column + " must be a number");
+    }
+    return number;
+}
+
+std::optional<std::string> optionalString(const json& fields, const char* name) {
+    if (!fields.contains(name) || fields[name].is_null()) {
+        return std::nullopt;
+    }
+    return fields[name].get<std::string>();
+}
+
+} // namespace
+
+LocationImportReader::LocationImportReader(std::istream& input, ImportFormat format,
+                                           std::string warehouseId, std::string createdBy)
+    : input_(input)
+    , format_(format)
+    , warehouseId_(std::move(warehouseId))
+    , createdBy_(std::move(createdBy)) {
+}
+
+std::optional<ImportFormat> LocationImportReader::formatFromContentType(const std::string& contentType) {
+    if (contentType.find("text/csv") == 0) {
+        return ImportFormat::Csv;
+    }
+    if (contentType.find("application/x-ndjson") == 0 || contentType.find("application/jsonl") == 0) {
+        return ImportFormat::NdJson;
+    }
+    return std::nullopt;
+}
+
+std::vector<std::string> LocationImportReader::splitCsvLine(const std::string& line) {
+    std::vector<std::string> fields;
+    std::string current;
+    bool quoted = false;
+
+    for (std::size_t i = 0; i < line.size(); ++i) {
+        char c = line[i];
+        if (quoted) {
+            if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                current += '"';
+                ++i;
+            } else if (c == '"') {
+                quoted = false;
+            } else {
+                current += c;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            fields.push_back(trim(current));
+            current.clear();
+        } else {
+            current += c;
+        }
+    }
+    if (quoted) {
+        throw std::invalid_argument("Unterminated quoted field");
+    }
+    fields.push_back(trim(current));
+    return fields;
+}
+
+void LocationImportReader::readHeader() {
+    headerRead_ = true;
+    if (format_ != ImportFormat::Csv) {
+        return;
+    }
+
+    std::string line;
+    while (std::getline(input_, line)) {
+        ++lineNumber_;
+        if (!trim(line).empty()) {
+            columns_ = splitCsvLine(line);
+            break;
+        }
+    }
+
+    bool hasCode = std::find(columns_.begin(), columns_.end(), "code") != columns_.end();
+    bool hasType = std::find(columns_.begin(), columns_.end(), "type") != columns_.end();
+    if (!hasCode || !hasType) {
+        throw std::invalid_argument("CSV header must include code and type columns");
+    }
+}
+
+bool LocationImportReader::next(ImportRow& row) {
+    if (!headerRead_) {
+        readHeader();
+    }
+
+    std::string line;
+    while (std::getline(input_, line)) {
+        ++lineNumber_;
+        if (trim(line).empty()) {
+            continue;
+        }
+
+        row.line = lineNumber_;
+        row.location.reset();
+        row.error.clear();
+
+        try {
+            json fields;
+            if (format_ == ImportFormat::NdJson) {
+                fields = json::parse(line);
+                if (!fields.is_object()) {
+                    throw std::invalid_argument("Each line must be a JSON object");
+                }
+            } else {
+                auto values = splitCsvLine(line);
+                if (values.size() != columns_.size()) {
+                    throw std::invalid_argument("Expected " + std::to_string(columns_.size()) +
+                                                " fields but found " + std::to_string(values.size()));
+                }
+                fields = json::object();
+                for (std::size_t i = 0; i < columns_.size(); ++i) {
+                    if (values[i].empty()) {
+                        continue;
+                    }
+                    const auto& column = columns_[i];
+                    if (isBooleanColumn(column)) {
+                        fields[column] = parseBool(column, values[i]);
+                    } else if (column == "maxVolume") {
+                        fields[column] = parseNumber(column, values[i]);
+                    } else {
+                        fields[column] = values[i];
+                    }
+                }
+            }
+            row.location = buildLocation(fields);
+        } catch (const json::exception& e) {
+            row.error = std::string("Invalid field value: ") + e.what();
+        } catch (const std::exception& e) {
+            row.error = e.what();
+        }
+        return true;
+    }
+    return false;
+}
+
+models::Location LocationImportReader::buildLocation(const json& fields) const {
+    auto code = optionalString(fields, "code");
+    if (!code || code->empty()) {
+        throw std::invalid_argument("Location code is required");
+    }
+    auto type = optionalString(fields, "type");
+    if (!type) {
+        throw std::invalid_argument("Location type is required");
+    }
+
+    models::Location location;
+    location.setWarehouseId(warehouseId_);
+    location.setCode(*code);
+    location.setType(models::stringToLocationType(*type));
+    location.setName(optionalString(fields, "name"));
+    location.setZone(optionalString(fields, "zone"));
+    location.setAisle(optionalString(fields, "aisle"));
+    location.setBay(optionalString(fields, "bay"));
+    location.setLevel(optionalString(fields, "level"));
+    location.setBin(optionalString(fields, "bin"));
+    location.setBarcode(optionalString(fields, "barcode"));
+
+    if (auto status = optionalString(fields, "status")) {
+        location.setStatus(models::stringToLocationStatus(*status));
+    } else {
+        location.setStatus(models::LocationStatus::Active);
+    }
+    if (auto equipment = optionalString(fields, "requiresEquipment")) {
+        location.setRequiresEquipment(models::stringToRequiredEquipment(*equipment));
+    }
+    if (fields.contains("maxVolume")) {
+        double maxVolume = fields["maxVolume"].get<double>();
+        if (maxVolume <= 0) {
+            throw std::invalid_argument("maxVolume must be positive");
+        }
+        location.setMaxVolume(maxVolume);
+    }
+    if (fields.contains("dimensions")) {
+        location.setDimensions(fields["dimensions"].get<models::Dimensions>());
+    }
+    if (fields.contains("maxWeight")) {
+        location.setMaxWeight(fields["maxWeight"].get<models::Weight>());
+    }
+
+    location.setIsPickable(fields.value("isPickable", true));
+    location.setIsReceivable(fields.value("isReceivable", true));
+    location.setTemperatureControlled(fields.value("temperatureControlled", false));
+
+    models::AuditInfo audit;
+    audit.createdAt = std::chrono::system_clock::now();
+    audit.createdBy = createdBy_;
+    location.setAudit(audit);
+
+    return location;
+}
+
+} // namespace warehouse::utils
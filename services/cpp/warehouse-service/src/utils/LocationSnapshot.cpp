@@ -0,0 +1,436 @@
+#include "warehouse/utils/LocationSnapshot.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace warehouse::utils {
+
+namespace {
+
+constexpr char kMagic[8] = {'W', 'H', 'S', 'N', 'A', 'P', '\0', '\0'};
+constexpr std::uint32_t kNullString = std::numeric_limits<std::uint32_t>::max();
+constexpr std::int64_t kNoTimestamp = std::numeric_limits<std::int64_t>::min();
+
+enum Flags : std::uint8_t {
+    kPickable = 1 << 0,
+    kReceivable = 1 << 1,
+    kTemperatureControlled = 1 << 2,
+    kHasDimensions = 1 << 3,
+    kHasMaxWeight = 1 << 4,
+    kHasMaxVolume = 1 << 5,
+};
+
+struct StringRef {
+    std::uint32_t offset;
+    std::uint32_t length;   // kNullString for an absent optional
+};
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t recordSize;
+    std::uint64_t locationCount;
+    std::uint64_t warehouseCount;
+    std::uint64_t stringPoolSize;
+    std::int64_t watermark;   // unix seconds
+    std::uint64_t checksum;   // over everything after the header
+};
+
+struct LocationRecord {
+    StringRef id;
+    StringRef warehouseId;
+    StringRef code;
+    StringRef name;
+    StringRef zone;
+    StringRef aisle;
+    StringRef bay;
+    StringRef level;
+    StringRef bin;
+    StringRef barcode;
+    StringRef dimensionUnit;
+    StringRef weightUnit;
+    StringRef createdBy;
+    double length;
+    double width;
+    double height;
+    double maxWeight;
+    double maxVolume;
+    double stockVolume;
+    double stockWeight;
+    std::int64_t stockUnits;
+    std::int64_t createdAt;   // unix seconds
+    std::int64_t updatedAt;   // unix seconds, kNoTimestamp if never updated
+    std::uint8_t type;
+    std::uint8_t status;
+    std::uint8_t requiresEquipment;
+    std::uint8_t flags;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(Header) == 56, "snapshot header layout changed; bump kVersion");
+static_assert(sizeof(LocationRecord) == 192, "snapshot record layout changed; bump kVersion");
+
+// FNV-1a over 8-byte words, then the tail bytes
+std::uint64_t checksum(const std::byte* data, std::size_t length) {
+    constexpr std::uint64_t kPrime = 0x100000001b3ULL;
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    std::size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * kPrime;
+    }
+    for (; i < length; ++i) {
+        hash = (hash ^ static_cast<std::uint64_t>(data[i])) * kPrime;
+    }
+    return hash;
+}
+
+std::int64_t toSeconds(const models::timestamp& time) {
+    return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+}
+
+models::timestamp fromSeconds(std::int64_t seconds) {
+    return models::timestamp(std::chrono::seconds(seconds));
+}
+
+class StringPool {
+public:
+    StringRef add(const std::string& value) {
+        auto it = offsets_.find(value);
+        if (it != offsets_.end()) {
+            return StringRef{it->second, static_cast<std::uint32_t>(value.size())};
+        }
+        if (pool_.size() + value.size() >= kNullString) {
+            throw std::runtime_error("Snapshot string pool exceeds 4 GiB");
+        }
+        auto offset = static_cast<std::uint32_t>(pool_.size());
+        pool_.append(value);
+        offsets_.emplace(value, offset);
+        return StringRef{offset, static_cast<std::uint32_t>(value.size())};
+    }
+
+    StringRef add(const std::optional<std::string>& value) {
+        return value ? add(*value) : StringRef{0, kNullString};
+    }
+
+    const std::string& data() const { return pool_; }
+
+private:
+    std::string pool_;
+    std::unordered_map<std::string, std::uint32_t> offsets_;   // zone, aisle and unit names repeat a lot
+};
+
+
+void writeAll(int fd, const void* data, std::size_t size, const std::string& path) {
+    const auto* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = ::write(fd, bytes, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("Failed writing snapshot: " + path + ": " + std::strerror(errno));
+        }
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+// Makes a rename within the directory durable
+void syncDirectoryOf(const std::string& path) {
+    auto slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open snapshot directory: " + directory);
+    }
+    int result = ::fsync(fd);
+    ::close(fd);
+    if (result != 0) {
+        throw std::runtime_error("Cannot sync snapshot directory: " + directory);
+    }
+}
+} // namespace
+
+LocationSnapshot::LocationSnapshot(const std::byte* data, std::size_t length)
+    : data_(data)
+    , length_(length) {
+}
+
+LocationSnapshot::~LocationSnapshot() {
+    if (data_) {
+        ::munmap(const_cast<std::byte*>(data_), length_);
+    }
+}
+
+void LocationSnapshot::write(const std::string& path,
+                             const std::vector<std::string>& warehouseIds,
+                             const std::vector<Entry>& entries) {
+    StringPool pool;
+    std::vector<LocationRecord> records;
+    records.reserve(entries.size());
+    std::int64_t watermark = 0;
+
+    for (const auto& [location, stock] : entries) {
+        LocationRecord record{};
+        record.id = pool.add(location.getId());
+        record.warehouseId = pool.add(location.getWarehouseId());
+        record.code = pool.add(location.getCode());
+        record.name = pool.add(location.getName());
+        record.zone = pool.add(location.getZone());
+        record.aisle = pool.add(location.getAisle());
+        record.bay = pool.add(location.getBay());
+        record.level = pool.add(location.getLevel());
+        record.bin = pool.add(location.getBin());
+        record.barcode = pool.add(location.getBarcode());
+        record.createdBy = pool.add(location.getAudit().createdBy);
+        record.dimensionUnit = StringRef{0, kNullString};
+        record.weightUnit = StringRef{0, kNullString};
+
+        std::uint8_t flags = 0;
+        if (location.isPickable()) flags |= kPickable;
+        if (location.isReceivable()) flags |= kReceivable;
+        if (location.isTemperatureControlled()) flags |= kTemperatureControlled;
+        if (const auto& dims = location.getDimensions()) {
+            flags |= kHasDimensions;
+            record.length = dims->length;
+            record.width = dims->width;
+            record.height = dims->height;
+            record.dimensionUnit = pool.add(dims->unit);
+        }
+        if (const auto& maxWeight = location.getMaxWeight()) {
+            flags |= kHasMaxWeight;
+            record.maxWeight = maxWeight->value;
+            record.weightUnit = pool.add(maxWeight->unit);
+        }
+        if (const auto& maxVolume = location.getMaxVolume()) {
+            flags |= kHasMaxVolume;
+            record.maxVolume = *maxVolume;
+        }
+        record.flags = flags;
+        record.type = static_cast<std::uint8_t>(location.getType());
+        record.status = static_cast<std::uint8_t>(location.getStatus());
+        record.requiresEquipment = static_cast<std::uint8_t>(location.getRequiresEquipment());
+
+        record.stockUnits = stock.units;
+        record.stockVolume = stock.volume;
+        record.stockWeight = stock.weight;
+
+        const auto& audit = location.getAudit();
+        record.createdAt = toSeconds(audit.createdAt);
+        record.updatedAt = audit.updatedAt ? toSeconds(*audit.updatedAt) : kNoTimestamp;
+        watermark = std::max({watermark, record.createdAt, record.updatedAt});
+
+        records.push_back(record);
+    }
+
+    std::vector<StringRef> warehouses;
+    warehouses.reserve(warehouseIds.size());
+    for (const auto& id : warehouseIds) {
+        warehouses.push_back(pool.add(id));
+    }
+
+    // Assemble the body once so the checksum covers exactly what is written
+    const std::size_t recordBytes = records.size() * sizeof(LocationRecord);
+    const std::size_t warehouseBytes = warehouses.size() * sizeof(StringRef);
+    std::vector<std::byte> body(recordBytes + warehouseBytes + pool.data().size());
+    if (recordBytes > 0) {
+        std::memcpy(body.data(), records.data(), recordBytes);
+    }
+    if (warehouseBytes > 0) {
+        std::memcpy(body.data() + recordBytes, warehouses.data(), warehouseBytes);
+    }
+    if (!pool.data().empty()) {
+        std::memcpy(body.data() + recordBytes + warehouseBytes, pool.data().data(), pool.data().size());
+    }
+
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.recordSize = sizeof(LocationRecord);
+    header.locationCount = records.size();
+    header.warehouseCount = warehouses.size();
+    header.stringPoolSize = pool.data().size();
+    header.watermark = watermark;
+    header.checksum = checksum(body.data(), body.size());
+
+    // The data must reach the disk before the rename does, and the rename
+    // before write() returns; otherwise a crash can leave an empty file
+    // under the final name
+    const std::string tempPath = path + ".tmp";
+    int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot write snapshot: " + tempPath);
+    }
+    try {
+        writeAll(fd, &header, sizeof(header), tempPath);
+        writeAll(fd, body.data(), body.size(), tempPath);
+        if (::fsync(fd) != 0) {
+            throw std::runtime_error("Cannot sync snapshot: " + tempPath);
+        }
+    } catch (...) {
+        ::close(fd);
+        std::remove(tempPath.c_str());
+        throw;
+    }
+    if (::close(fd) != 0) {
+        std::remove(tempPath.c_str());
+        throw std::runtime_error("Failed writing snapshot: " + tempPath);
+    }
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        throw std::runtime_error("Cannot replace snapshot: " + path);
+    }
+    syncDirectoryOf(path);
+}
+
+std::unique_ptr<LocationSnapshot> LocationSnapshot::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Snapshot not found: " + path);
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(Header)) {
+        ::close(fd);
+        throw std::runtime_error("Snapshot truncated: " + path);
+    }
+
+    const auto length = static_cast<std::size_t>(info.st_size);
+    void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);   // the mapping keeps the file alive
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Cannot map snapshot: " + path);
+    }
+    std::unique_ptr<LocationSnapshot> snapshot(new LocationSnapshot(static_cast<const std::byte*>(mapped), length));
+
+    Header header;
+    std::memcpy(&header, snapshot->data_, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("Not a warehouse snapshot: " + path);
+    }
+    if (header.version != kVersion || header.recordSize != sizeof(LocationRecord)) {
+        throw std::runtime_error("Snapshot format version " + std::to_string(header.version) +
+                                 " is not supported (expected " + std::to_string(kVersion) + ")");
+    }
+
+    const std::size_t expected = sizeof(Header)
+                               + header.locationCount * sizeof(LocationRecord)
+                               + header.warehouseCount * sizeof(StringRef)
+                               + header.stringPoolSize;
+    if (expected != length) {
+        throw std::runtime_error("Snapshot size does not match its header: " + path);
+    }
+    if (checksum(snapshot->data_ + sizeof(Header), length - sizeof(Header)) != header.checksum) {
+        throw std::runtime_error("Snapshot checksum mismatch: " + path);
+    }
+
+    return snapshot;
+}
+
+std::size_t LocationSnapshot::size() const {
+    Header header;
+    std::memcpy(&header, data_, sizeof(header));
+    return static_cast<std::size_t>(header.locationCount);
+}
+
+std::string_view LocationSnapshot::string(std::uint32_t offset, std::uint32_t length) const {
+    Header header;
+    std::memcpy(&header, data_, sizeof(header));
+    const std::size_t poolStart = sizeof(Header)
+                                + header.locationCount * sizeof(LocationRecord)
+                                + header.warehouseCount * sizeof(StringRef);
+    if (static_cast<std::uint64_t>(offset) + length > header.stringPoolSize) {
+        throw std::runtime_error("Snapshot string reference out of range");
+    }
+    return std::string_view(reinterpret_cast<const char*>(data_ + poolStart + offset), length);
+}
+
+LocationSnapshot::Entry LocationSnapshot::entry(std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Snapshot entry out of range");
+    }
+
+    LocationRecord record;
+    std::memcpy(&record, data_ + sizeof(Header) + index * sizeof(LocationRecord), sizeof(record));
+
+    auto required = [this](const StringRef& ref) {
+        return ref.length == kNullString ? std::string() : std::string(string(ref.offset, ref.length));
+    };
+    auto optional = [this](const StringRef& ref) -> std::optional<std::string> {
+        if (ref.length == kNullString) return std::nullopt;
+        return std::string(string(ref.offset, ref.length));
+    };
+
+    Entry entry;
+    auto& location = entry.location;
+    location.setId(required(record.id));
+    location.setWarehouseId(required(record.warehouseId));
+    location.setCode(required(record.code));
+    location.setName(optional(record.name));
+    location.setType(static_cast<models::LocationType>(record.type));
+    location.setZone(optional(record.zone));
+    location.setAisle(optional(record.aisle));
+    location.setBay(optional(record.bay));
+    location.setLevel(optional(record.level));
+    location.setBin(optional(record.bin));
+    location.setBarcode(optional(record.barcode));
+    location.setStatus(static_cast<models::LocationStatus>(record.status));
+    location.setRequiresEquipment(static_cast<models::RequiredEquipment>(record.requiresEquipment));
+    location.setIsPickable(record.flags & kPickable);
+    location.setIsReceivable(record.flags & kReceivable);
+    location.setTemperatureControlled(record.flags & kTemperatureControlled);
+    if (record.flags & kHasDimensions) {
+        location.setDimensions(models::Dimensions{record.length, record.width, record.height,
+                                                  required(record.dimensionUnit)});
+    }
+    if (record.flags & kHasMaxWeight) {
+        location.setMaxWeight(models::Weight{record.maxWeight, required(record.weightUnit)});
+    }
+    if (record.flags & kHasMaxVolume) {
+        location.setMaxVolume(record.maxVolume);
+    }
+
+    models::AuditInfo audit;
+    audit.createdAt = fromSeconds(record.createdAt);
+    audit.createdBy = required(record.createdBy);
+    if (record.updatedAt != kNoTimestamp) {
+        audit.updatedAt = fromSeconds(record.updatedAt);
+    }
+    location.setAudit(audit);
+
+    entry.stock = Stock{record.stockUnits, record.stockVolume, record.stockWeight};
+    return entry;
+}
+
+std::vector<std::string> LocationSnapshot::warehouseIds() const {
+    Header header;
+    std::memcpy(&header, data_, sizeof(header));
+    const std::byte* table = data_ + sizeof(Header) + header.locationCount * sizeof(LocationRecord);
+
+    std::vector<std::string> ids;
+    ids.reserve(header.warehouseCount);
+    for (std::uint64_t i = 0; i < header.warehouseCount; ++i) {
+        StringRef ref;
+        std::memcpy(&ref, table + i * sizeof(StringRef), sizeof(ref));
+        ids.emplace_back(string(ref.offset, ref.length));
+    }
+    return ids;
+}
+
+std::chrono::system_clock::time_point LocationSnapshot::watermark() const {
+    Header header;
+    std::memcpy(&header, data_, sizeof(header));
+    return fromSeconds(header.watermark);
+}
+
+} // namespace warehouse::utils
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include "warehouse/utils/LocationImportReader.hpp"
+#include <sstream>
+
+using namespace warehouse;
+using namespace warehouse::utils;
+
+namespace {
+
+std::vector<ImportRow> readAll(const std::string& body, ImportFormat format) {
+    std::istringstream input(body);
+    LocationImportReader reader(input, format, "wh-1", "tester");
+    std::vector<ImportRow> rows;
+    ImportRow row;
+    while (reader.next(row)) {
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+} // namespace
+
+TEST_CASE("Location import CSV splitting", "[import]") {
+    SECTION("Plain fields are trimmed") {
+        auto fields = LocationImportReader::splitCsvLine("A-01, bin ,zone A");
+        REQUIRE(fields == std::vector<std::string>{"A-01", "bin", "zone A"});
+    }
+
+    SECTION("Quoted fields keep commas and escaped quotes") {
+        auto fields = LocationImportReader::splitCsvLine("A-01,\"Aisle 1, \"\"cold\"\" bay\",");
+        REQUIRE(fields == std::vector<std::string>{"A-01", "Aisle 1, \"cold\" bay", ""});
+    }
+
+    SECTION("Unterminated quotes are rejected") {
+        REQUIRE_THROWS_AS(LocationImportReader::splitCsvLine("A-01,\"open"), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Location import content types", "[import]") {
+    REQUIRE(LocationImportReader::formatFromContentType("text/csv; charset=utf-8") == ImportFormat::Csv);
+    REQUIRE(LocationImportReader::formatFromContentType("application/x-ndjson") == ImportFormat::NdJson);
+    REQUIRE(LocationImportReader::formatFromContentType("application/jsonl") == ImportFormat::NdJson);
+    REQUIRE_FALSE(LocationImportReader::formatFromContentType("application/json").has_value());
+}
+
+TEST_CASE("Location import from CSV", "[import]") {
+    SECTION("Rows become locations for the target warehouse") {
+        auto rows = readAll(
+            "code,type,zone,aisle,maxVolume,isPickable,status\n"
+            "A-01-01,bin,A,01,1.5,false,\n"
+            "\n"
+            "A-01-02,shelf,A,01,,yes,reserved\n",
+            ImportFormat::Csv);
+
+        REQUIRE(rows.size() == 2);
+        REQUIRE(rows[0].line == 2);
+        REQUIRE(rows[0].location.has_value());
+        const auto& first = *rows[0].location;
+        REQUIRE(first.getWarehouseId() == "wh-1");
+        REQUIRE(first.getCode() == "A-01-01");
+        REQUIRE(first.getType() == models::LocationType::Bin);
+        REQUIRE(first.getZone() == "A");
+        REQUIRE(first.getMaxVolume() == 1.5);
+        REQUIRE_FALSE(first.isPickable());
+        REQUIRE(first.getStatus() == models::LocationStatus::Active);
+        REQUIRE(first.getAudit().createdBy == "tester");
+
+        REQUIRE(rows[1].line == 4);
+        REQUIRE(rows[1].location->isPickable());
+        REQUIRE_FALSE(rows[1].location->getMaxVolume().has_value());
+        REQUIRE(rows[1].location->getStatus() == models::LocationStatus::Reserved);
+    }
+
+    SECTION("Bad lines are reported without stopping the import") {
+        auto rows = readAll(
+            "code,type,maxVolume,isPickable\n"
+            "A-01,bin,-2,true\n"
+            "A-02,bin,1,maybe\n"
+            "A-03,bin\n"
+            ",bin,1,true\n"
+            "A-05,bin,12abc,true\n"
+            "A-04,bin,1,true\n",
+            ImportFormat::Csv);
+
+        REQUIRE(rows.size() == 6);
+        for (std::size_t i = 0; i < 5; ++i) {
+            REQUIRE_FALSE(rows[i].location.has_value());
+            REQUIRE_FALSE(rows[i].error.empty());
+        }
+        REQUIRE(rows[4].error == "maxVolume must be a number");
+        REQUIRE(rows[5].location.has_value());
+        REQUIRE(rows[5].error.empty());
+    }
+
+    SECTION("Header must name code and type") {
+        REQUIRE_THROWS_AS(readAll("code,zone\nA-01,A\n", ImportFormat::Csv), std::invalid_argument);
+        REQUIRE_THROWS_AS(readAll("", ImportFormat::Csv), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Location import from NDJSON", "[import]") {
+    auto rows = readAll(
+        "{\"code\":\"B-01\",\"type\":\"pallet\",\"requiresEquipment\":\"forklift\",\"temperatureControlled\":true}\n"
+        "[1,2]\n"
+        "{\"code\":\"B-02\",\"type\":\"nonsense\"}\n"
+        "{not json\n",
+        ImportFormat::NdJson);
+
+    REQUIRE(rows.size() == 4);
+    REQUIRE(rows[0].location.has_value());
+    REQUIRE(rows[0].location->getType() == models::LocationType::Pallet);
+    REQUIRE(rows[0].location->getRequiresEquipment() == models::RequiredEquipment::Forklift);
+    REQUIRE(rows[0].location->isTemperatureControlled());
+    REQUIRE_FALSE(rows[1].location.has_value());
+    REQUIRE_FALSE(rows[2].location.has_value());
+    REQUIRE_FALSE(rows[3].location.has_value());
+    REQUIRE(rows[3].line == 4);
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "warehouse/utils/LocationSnapshot.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace warehouse;
+using warehouse::utils::LocationSnapshot;
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+    return "/tmp/warehouse-snapshot-test-" + name + ".bin";
+}
+
+models::Location sampleLocation(const std::string& id, const std::string& warehouseId = "wh-1") {
+    models::Location location;
+    location.setId(id);
+    location.setWarehouseId(warehouseId);
+    location.setCode("A-01-" + id);
+    location.setType(models::LocationType::Bin);
+    location.setStatus(models::LocationStatus::Active);
+    location.setZone(std::string("A"));
+    location.setAisle(std::string("01"));
+    location.setLevel(std::string("2"));
+    location.setIsPickable(true);
+    location.setIsReceivable(false);
+    location.setRequiresEquipment(models::RequiredEquipment::Forklift);
+    location.setMaxVolume(1.5);
+
+    models::AuditInfo audit;
+    audit.createdAt = models::timestamp(std::chrono::seconds(1700000000));
+    audit.createdBy = "tester";
+    location.setAudit(audit);
+    return location;
+}
+
+void flipByte(const std::string& path, std::streamoff offset) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(offset);
+    char byte = 0;
+    file.read(&byte, 1);
+    byte = static_cast<char>(byte ^ 0x5A);
+    file.seekp(offset);
+    file.write(&byte, 1);
+}
+
+} // namespace
+
+TEST_CASE("Location snapshot round trip", "[snapshot]") {
+    const auto path = tempPath("roundtrip");
+
+    auto full = sampleLocation("loc-1");
+    full.setName(std::string("Pick face"));
+    full.setBarcode(std::string("BC-001"));
+    full.setDimensions(models::Dimensions{120.0, 80.0, 150.0, "cm"});
+    full.setMaxWeight(models::Weight{500.0, "kg"});
+    full.setTemperatureControlled(true);
+    auto audit = full.getAudit();
+    audit.updatedAt = models::timestamp(std::chrono::seconds(1700000500));
+    full.setAudit(audit);
+
+    auto sparse = sampleLocation("loc-2", "wh-2");
+    sparse.setZone(std::nullopt);
+    sparse.setMaxVolume(std::nullopt);
+
+    LocationSnapshot::write(path, {"wh-1", "wh-2", "wh-empty"},
+                            {{full, {12, 0.4, 30.0}}, {sparse, {}}});
+    auto snapshot = LocationSnapshot::open(path);
+
+    REQUIRE(snapshot->size() == 2);
+    REQUIRE(snapshot->warehouseIds() == std::vector<std::string>{"wh-1", "wh-2", "wh-empty"});
+    REQUIRE(snapshot->watermark() == models::timestamp(std::chrono::seconds(1700000500)));
+
+    auto first = snapshot->entry(0);
+    REQUIRE(first.location.toJson() == full.toJson());
+    REQUIRE(first.stock.units == 12);
+    REQUIRE(first.stock.volume == 0.4);
+    REQUIRE(first.stock.weight == 30.0);
+
+    auto second = snapshot->entry(1);
+    REQUIRE(second.location.toJson() == sparse.toJson());
+    REQUIRE_FALSE(second.location.getZone().has_value());
+    REQUIRE_FALSE(second.location.getMaxVolume().has_value());
+    REQUIRE(second.stock.units == 0);
+
+    REQUIRE_THROWS_AS(snapshot->entry(2), std::out_of_range);
+
+    snapshot.reset();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Location snapshot rejects unusable files", "[snapshot]") {
+    const auto path = tempPath("corrupt");
+    LocationSnapshot::write(path, {"wh-1"}, {{sampleLocation("loc-1"), {}}});
+
+    SECTION("Missing file") {
+        REQUIRE_THROWS_AS(LocationSnapshot::open(tempPath("missing")), std::runtime_error);
+    }
+
+    SECTION("Corrupted body fails the checksum") {
+        flipByte(path, 100);
+        REQUIRE_THROWS_AS(LocationSnapshot::open(path), std::runtime_error);
+    }
+
+    SECTION("Other format version") {
+        flipByte(path, 8);   // first byte of the version field
+        REQUIRE_THROWS_AS(LocationSnapshot::open(path), std::runtime_error);
+    }
+
+    SECTION("Truncated file") {
+        std::ofstream truncated(path, std::ios::binary | std::ios::trunc);
+        truncated << "WHSNAP";
+        truncated.close();
+        REQUIRE_THROWS_AS(LocationSnapshot::open(path), std::runtime_error);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Location snapshot benchmark", "[snapshot][!benchmark]") {
+    const auto path = tempPath("benchmark");
+
+    std::vector<LocationSnapshot::Entry> entries;
+    entries.reserve(200000);
+    for (int i = 0; i < 200000; ++i) {
+        auto location = sampleLocation("L" + std::to_string(i));
+        location.setZone("Z" + std::to_string(i % 8));
+        location.setAisle(std::to_string(i / 8 % 50));
+        entries.push_back({std::move(location), {i % 3, 0.01 * (i % 3), 1.0}});
+    }
+    LocationSnapshot::write(path, {"wh-1"}, entries);
+
+    BENCHMARK("open and decode, 200k locations") {
+        auto snapshot = LocationSnapshot::open(path);
+        std::size_t decoded = 0;
+        for (std::size_t i = 0; i < snapshot->size(); ++i) {
+            decoded += snapshot->entry(i).location.getCode().size();
+        }
+        return decoded;
+    };
+
+    BENCHMARK("write, 200k locations") {
+        LocationSnapshot::write(path, {"wh-1"}, entries);
+    };
+
+    std::remove(path.c_str());
+}
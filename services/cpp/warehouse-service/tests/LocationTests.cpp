@@ -70,3 +70,13 @@ TEST_CASE("Location model tests", "[location]") {
         REQUIRE(location.getDimensions()->unit == "cm");
     }
 }
+
+TEST_CASE("Location ids are recognised as UUIDs", "[location]") {
+    REQUIRE(isUuid("123e4567-e89b-12d3-a456-426614174001"));
+    REQUIRE(isUuid("123E4567-E89B-12D3-A456-426614174001"));
+    REQUIRE_FALSE(isUuid(""));
+    REQUIRE_FALSE(isUuid("warehouse-uuid"));
+    REQUIRE_FALSE(isUuid("123e4567e89b12d3a456426614174001"));
+    REQUIRE_FALSE(isUuid("123e4567-e89b-12d3-a456-42661417400g"));
+    REQUIRE_FALSE(isUuid("123e4567-e89b-12d3-a456-4266141740011"));
+}
@@ -0,0 +1,183 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "warehouse/services/OccupancyIndex.hpp"
+#include <random>
+
+using namespace warehouse;
+using namespace warehouse::services;
+
+namespace {
+
+models::Location binAt(const std::string& id, const std::string& zone, const std::string& aisle,
+                       const std::string& level, double maxVolume = 1.0,
+                       const std::string& warehouseId = "wh-1") {
+    models::Location location;
+    location.setId(id);
+    location.setWarehouseId(warehouseId);
+    location.setCode(id);
+    location.setType(models::LocationType::Bin);
+    location.setStatus(models::LocationStatus::Active);
+    location.setZone(zone);
+    location.setAisle(aisle);
+    location.setLevel(level);
+    location.setMaxVolume(maxVolume);
+    return location;
+}
+
+const OccupancyBucket* findBucket(const std::vector<OccupancyBucket>& buckets, OccupancyScope scope,
+                                  const std::string& zone, const std::string& aisle = "",
+                                  const std::string& level = "") {
+    for (const auto& bucket : buckets) {
+        if (bucket.scope == scope && bucket.zone == zone && bucket.aisle == aisle && bucket.level == level) {
+            return &bucket;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("Occupancy counters per bucket", "[occupancy]") {
+    OccupancyIndex index;
+    index.upsertLocation(binAt("a1", "A", "01", "1"));
+    index.upsertLocation(binAt("a2", "A", "01", "2"));
+    index.upsertLocation(binAt("a3", "A", "02", "1"));
+    index.upsertLocation(binAt("b1", "B", "01", "1", 2.0));
+
+    SECTION("Empty warehouse has only free bins") {
+        auto totals = index.totals("wh-1");
+        REQUIRE(totals.has_value());
+        REQUIRE(totals->totalBins == 4);
+        REQUIRE(totals->occupiedBins == 0);
+        REQUIRE(totals->freeBins() == 4);
+        REQUIRE(totals->volumeCapacity == Catch::Approx(5.0));
+    }
+
+    SECTION("Stock changes move every ancestor bucket") {
+        REQUIRE(index.applyStockChange("a1", 10, 0.4, 12.0));
+        REQUIRE(index.applyStockChange("a3", 1, 0.1, 1.0));
+        REQUIRE_FALSE(index.applyStockChange("unknown", 1, 0.1, 1.0));
+
+        auto buckets = index.buckets("wh-1");
+        auto zoneA = findBucket(buckets, OccupancyScope::Zone, "A");
+        REQUIRE(zoneA != nullptr);
+        REQUIRE(zoneA->counters.totalBins == 3);
+        REQUIRE(zoneA->counters.occupiedBins == 2);
+        REQUIRE(zoneA->counters.volumeUsed == Catch::Approx(0.5));
+
+        auto aisle = findBucket(buckets, OccupancyScope::Aisle, "A", "01");
+        REQUIRE(aisle->counters.occupiedBins == 1);
+        REQUIRE(aisle->counters.weightUsed == Catch::Approx(12.0));
+
+        auto level = findBucket(buckets, OccupancyScope::Level, "A", "01", "2");
+        REQUIRE(level->counters.occupiedBins == 0);
+
+        // Emptying a location frees its bin again
+        REQUIRE(index.applyStockChange("a1", -10, -0.4, -12.0));
+        REQUIRE(index.totals("wh-1")->occupiedBins == 1);
+    }
+
+    SECTION("Buckets are returned parents first, down to the requested depth") {
+        auto all = index.buckets("wh-1");
+        REQUIRE(all.front().scope == OccupancyScope::Warehouse);
+        // 1 warehouse + 2 zones + 3 aisles + 4 levels
+        REQUIRE(all.size() == 10);
+
+        auto zones = index.buckets("wh-1", OccupancyScope::Zone);
+        REQUIRE(zones.size() == 3);
+        REQUIRE(zones[1].zone == "A");
+        REQUIRE(zones[2].zone == "B");
+    }
+
+    SECTION("Moving a location keeps its stock and re-files it") {
+        index.applyStockChange("a1", 5, 0.2, 0.0);
+        index.upsertLocation(binAt("a1", "B", "01", "1"));
+
+        auto buckets = index.buckets("wh-1");
+        REQUIRE(findBucket(buckets, OccupancyScope::Zone, "A")->counters.totalBins == 2);
+        REQUIRE(findBucket(buckets, OccupancyScope::Zone, "B")->counters.occupiedBins == 1);
+        REQUIRE(findBucket(buckets, OccupancyScope::Level, "A", "01", "1") == nullptr);
+        REQUIRE(index.stockOf("a1")->units == 5);
+    }
+
+    SECTION("Inactive and removed locations are not counted") {
+        auto inactive = binAt("a2", "A", "01", "2");
+        inactive.setStatus(models::LocationStatus::Inactive);
+        index.upsertLocation(inactive);
+        index.removeLocation("b1");
+
+        auto totals = index.totals("wh-1");
+        REQUIRE(totals->totalBins == 2);
+        REQUIRE(findBucket(index.buckets("wh-1"), OccupancyScope::Zone, "B") == nullptr);
+    }
+}
+
+TEST_CASE("Occupancy rebuild corrects drift", "[occupancy]") {
+    OccupancyIndex index;
+    std::vector<models::Location> locations = {
+        binAt("a1", "A", "01", "1"),
+        binAt("a2", "A", "01", "2"),
+    };
+    index.rebuild("wh-1", locations);
+    index.upsertLocation(binAt("x1", "X", "01", "1", 1.0, "wh-2"));
+
+    // Many small movements leave floating-point residue in the aggregates
+    for (int i = 0; i < 1000; ++i) {
+        index.applyStockChange("a1", 1, 0.001, 0.0);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        index.applyStockChange("a1", -1, -0.001, 0.0);
+    }
+    index.applyStockChange("a2", 3, 0.3, 0.0);
+
+    SECTION("Without authoritative stock, tracked stock is kept") {
+        index.rebuild("wh-1", locations);
+        auto totals = index.totals("wh-1");
+        REQUIRE(totals->occupiedBins == 1);
+        REQUIRE(totals->volumeUsed == Catch::Approx(0.3));
+    }
+
+    SECTION("Authoritative unit counts replace tracked stock") {
+        index.rebuild("wh-1", locations, std::unordered_map<std::string, std::int64_t>{{"a1", 4}});
+        REQUIRE(index.stockOf("a1")->units == 4);
+        REQUIRE(index.stockOf("a2")->units == 0);
+        REQUIRE(index.stockOf("a2")->volume == 0.0);
+        REQUIRE(index.totals("wh-1")->occupiedBins == 1);
+    }
+
+    SECTION("Locations gone from the database are dropped; other warehouses untouched") {
+        index.rebuild("wh-1", {binAt("a2", "A", "01", "2")});
+        REQUIRE_FALSE(index.stockOf("a1").has_value());
+        REQUIRE(index.totals("wh-1")->totalBins == 1);
+        REQUIRE(index.totals("wh-2")->totalBins == 1);
+    }
+}
+
+TEST_CASE("Occupancy index benchmark", "[occupancy][!benchmark]") {
+    OccupancyIndex index;
+    std::vector<models::Location> locations;
+    for (int zone = 0; zone < 8; ++zone) {
+        for (int aisle = 0; aisle < 50; ++aisle) {
+            for (int level = 0; level < 5; ++level) {
+                for (int bay = 0; bay < 100; ++bay) {
+                    locations.push_back(binAt(
+                        "L" + std::to_string(locations.size()),
+                        "Z" + std::to_string(zone), std::to_string(aisle), std::to_string(level)));
+                }
+            }
+        }
+    }
+    index.rebuild("wh-1", locations);
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<std::size_t> pick(0, locations.size() - 1);
+
+    BENCHMARK("stock change, 200k locations") {
+        return index.applyStockChange(locations[pick(rng)].getId(), 1, 0.01, 1.0);
+    };
+
+    BENCHMARK("read full tree, 200k locations") {
+        return index.buckets("wh-1");
+    };
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "warehouse/services/PickRouteOptimizer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+using namespace warehouse::services;
+using warehouse::models::Location;
+
+namespace {
+
+std::vector<FloorCoordinate> randomStops(std::size_t count, unsigned seed) {
+    WarehouseLayout layout;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> aisle(1, 40);
+    std::uniform_int_distribution<int> bay(1, layout.config().baysPerAisle);
+    std::uniform_int_distribution<int> level(1, 5);
+
+    std::vector<FloorCoordinate> stops;
+    stops.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Location location;
+        location.setZone("A");
+        location.setAisle(std::to_string(aisle(rng)));
+        location.setBay(std::to_string(bay(rng)));
+        location.setLevel(std::to_string(level(rng)));
+        stops.push_back(layout.coordinateOf(location));
+    }
+    return stops;
+}
+
+bool isPermutation(const std::vector<std::size_t>& sequence, std::size_t count) {
+    std::vector<std::size_t> sorted = sequence;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return sorted.size() == count;
+}
+
+} // namespace
+
+TEST_CASE("Warehouse layout coordinates", "[pick-route]") {
+    SECTION("Labels map to ordinals") {
+        REQUIRE(WarehouseLayout::labelOrdinal(std::nullopt) == 0);
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("07")) == 7);
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("C")) == 3);
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("ab")) == 28);
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("B12")) == 2012);
+    }
+
+    SECTION("Over-long labels saturate instead of overflowing") {
+        const auto cap = WarehouseLayout::kMaxLabelOrdinal;
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("ZZZZZZZZ")) == cap);
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("12345678901234567890")) == cap);
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("ZZZZZZZZ99999999999")) == cap);
+        REQUIRE(WarehouseLayout::labelOrdinal(std::string("ZZ999")) == 702999);
+    }
+
+    SECTION("Location fields become floor coordinates") {
+        WarehouseLayout layout(LayoutConfig{3.0, 1.0, 50, 100.0});
+        Location location;
+        location.setZone("B");
+        location.setAisle("04");
+        location.setBay("10");
+        location.setLevel("3");
+
+        auto coordinate = layout.coordinateOf(location);
+        REQUIRE(coordinate.x == Catch::Approx(2 * 100.0 + 4 * 3.0));
+        REQUIRE(coordinate.y == Catch::Approx(10.0));
+        REQUIRE(coordinate.level == 3);
+
+        // "B12" has ordinal 2012; it stays on zone B's last aisle line
+        location.setAisle("B12");
+        REQUIRE(layout.coordinateOf(location).x == Catch::Approx(2 * 100.0 + 97.0));
+    }
+
+    SECTION("Same aisle walks along the aisle, different aisles use the nearer cross-aisle") {
+        WarehouseLayout layout(LayoutConfig{3.0, 1.0, 50, 100.0});
+        REQUIRE(layout.distance({3.0, 5.0, 0}, {3.0, 20.0, 0}) == Catch::Approx(15.0));
+        REQUIRE(layout.distance({3.0, 5.0, 0}, {9.0, 10.0, 0}) == Catch::Approx(6.0 + 15.0));
+        REQUIRE(layout.distance({3.0, 45.0, 0}, {9.0, 40.0, 0}) == Catch::Approx(6.0 + 15.0));
+    }
+}
+
+TEST_CASE("Pick route optimisation", "[pick-route]") {
+    PickRouteOptimizer optimizer;
+
+    SECTION("Empty input yields an empty route") {
+        auto route = optimizer.optimize({});
+        REQUIRE(route.sequence.empty());
+        REQUIRE(route.distance == 0.0);
+    }
+
+    SECTION("S-shape alternates direction per aisle") {
+        std::vector<FloorCoordinate> stops = {
+            {3.0, 10.0, 0}, {3.0, 2.0, 0}, {6.0, 4.0, 0}, {6.0, 12.0, 0}
+        };
+        auto sequence = optimizer.sShapeSequence(stops);
+        REQUIRE(sequence == std::vector<std::size_t>{1, 0, 3, 2});
+    }
+
+    SECTION("Heuristics and the optimised route visit every stop once") {
+        auto stops = randomStops(120, 7);
+        REQUIRE(isPermutation(optimizer.sShapeSequence(stops), stops.size()));
+        REQUIRE(isPermutation(optimizer.largestGapSequence(stops), stops.size()));
+
+        auto route = optimizer.optimize(stops);
+        REQUIRE(isPermutation(route.sequence, stops.size()));
+        REQUIRE(route.distance == Catch::Approx(optimizer.routeDistance(route.sequence, stops, {})));
+    }
+
+    SECTION("Optimised route is never longer than either heuristic") {
+        auto stops = randomStops(80, 11);
+        auto route = optimizer.optimize(stops);
+        double sShape = optimizer.routeDistance(optimizer.sShapeSequence(stops), stops, {});
+        double largestGap = optimizer.routeDistance(optimizer.largestGapSequence(stops), stops, {});
+        REQUIRE(route.distance <= std::min(sShape, largestGap) + 1e-6);
+    }
+
+    SECTION("300-stop route stays within the latency budget") {
+        auto stops = randomStops(300, 42);
+        auto started = std::chrono::steady_clock::now();
+        auto route = optimizer.optimize(stops);
+        auto elapsed = std::chrono::steady_clock::now() - started;
+
+        REQUIRE(route.sequence.size() == 300);
+        // Generous bound so unoptimised/sanitizer builds stay green;
+        // the benchmark below tracks the real 10 ms target.
+        REQUIRE(elapsed < std::chrono::milliseconds(100));
+    }
+}
+
+TEST_CASE("Pick route optimiser benchmark", "[pick-route][!benchmark]") {
+    PickRouteOptimizer optimizer;
+    auto stops50 = randomStops(50, 1);
+    auto stops300 = randomStops(300, 2);
+
+    BENCHMARK("optimize 50 stops") {
+        return optimizer.optimize(stops50);
+    };
+
+    BENCHMARK("optimize 300 stops") {
+        return optimizer.optimize(stops300);
+    };
+}
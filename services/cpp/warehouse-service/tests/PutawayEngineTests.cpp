@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "warehouse/services/PutawayEngine.hpp"
+#include <random>
+
+using namespace warehouse::services;
+using warehouse::models::Location;
+using warehouse::models::LocationStatus;
+using warehouse::models::LocationType;
+
+namespace {
+
+const std::string kWarehouse = "wh-1";
+
+Location makeBin(const std::string& id, const std::string& aisle, const std::string& bay,
+                 double maxVolume, double maxWeightKg = 0.0) {
+    Location location;
+    location.setId(id);
+    location.setWarehouseId(kWarehouse);
+    location.setCode("BIN-" + id);
+    location.setType(LocationType::Bin);
+    location.setStatus(LocationStatus::Active);
+    location.setIsReceivable(true);
+    location.setZone("A");
+    location.setAisle(aisle);
+    location.setBay(bay);
+    location.setMaxVolume(maxVolume);
+    if (maxWeightKg > 0) {
+        location.setMaxWeight(warehouse::models::Weight{maxWeightKg, "kg"});
+    }
+    return location;
+}
+
+PutawayLoad boxLoad(double volume, double weight = 0.0) {
+    PutawayLoad load;
+    load.volume = volume;
+    load.weight = weight;
+    return load;
+}
+
+} // namespace
+
+TEST_CASE("Putaway unit conversion", "[putaway]") {
+    REQUIRE(PutawayEngine::toMetres(120, "cm") == Catch::Approx(1.2));
+    REQUIRE(PutawayEngine::toCubicMetres({1000, 1000, 1000, "mm"}) == Catch::Approx(1.0));
+    REQUIRE(PutawayEngine::toKilograms({2.0, "lb"}) == Catch::Approx(0.907185));
+    REQUIRE_THROWS_AS(PutawayEngine::toMetres(1, "furlong"), std::invalid_argument);
+
+    auto load = PutawayLoad::fromDimensions({120, 80, 100, "cm"}, warehouse::models::Weight{500, "kg"});
+    REQUIRE(load.volume == Catch::Approx(0.96));
+    REQUIRE(load.weight == Catch::Approx(500));
+    REQUIRE((*load.size)[0] == Catch::Approx(0.8));
+}
+
+TEST_CASE("Putaway suggestions", "[putaway]") {
+    PutawayEngine engine;
+
+    SECTION("Only locations with room for the load are suggested") {
+        engine.upsertLocation(makeBin("small", "01", "01", 0.5));
+        engine.upsertLocation(makeBin("large", "01", "02", 2.0));
+
+        auto candidates = engine.suggest(kWarehouse, boxLoad(1.0), 5);
+        REQUIRE(candidates.size() == 1);
+        REQUIRE(candidates[0].locationId == "large");
+        REQUIRE(candidates[0].fit == Catch::Approx(0.5));
+    }
+
+    SECTION("Tighter fits rank above looser ones at equal distance") {
+        engine.upsertLocation(makeBin("loose", "01", "05", 10.0));
+        engine.upsertLocation(makeBin("tight", "01", "05", 1.2));
+
+        auto candidates = engine.suggest(kWarehouse, boxLoad(1.0), 2);
+        REQUIRE(candidates.size() == 2);
+        REQUIRE(candidates[0].locationId == "tight");
+    }
+
+    SECTION("Locations near receiving rank above distant ones") {
+        Location dock = makeBin("dock", "01", "01", 0.0);
+        dock.setType(LocationType::Receiving);
+        engine.upsertLocation(dock);
+        engine.upsertLocation(makeBin("near", "02", "02", 2.0));
+        engine.upsertLocation(makeBin("far", "30", "25", 2.0));
+
+        auto candidates = engine.suggest(kWarehouse, boxLoad(1.0), 2);
+        REQUIRE(candidates.size() == 2);
+        REQUIRE(candidates[0].locationId == "near");
+        REQUIRE(candidates[0].distance < candidates[1].distance);
+    }
+
+    SECTION("Preferred zone, weight limit and temperature rules apply") {
+        Location cold = makeBin("cold", "01", "01", 2.0);
+        cold.setTemperatureControlled(true);
+        engine.upsertLocation(cold);
+        engine.upsertLocation(makeBin("light", "01", "01", 2.0, 100.0));
+        Location zoneB = makeBin("zone-b", "01", "01", 2.0);
+        zoneB.setZone("B");
+        engine.upsertLocation(zoneB);
+
+        auto chilled = boxLoad(1.0);
+        chilled.requiresTemperatureControl = true;
+        auto candidates = engine.suggest(kWarehouse, chilled, 5);
+        REQUIRE(candidates.size() == 1);
+        REQUIRE(candidates[0].locationId == "cold");
+
+        auto heavy = engine.suggest(kWarehouse, boxLoad(1.0, 250.0), 5);
+        for (const auto& candidate : heavy) {
+            REQUIRE(candidate.locationId != "light");
+        }
+
+        auto zoned = boxLoad(1.0);
+        zoned.preferredZone = "B";
+        REQUIRE(engine.suggest(kWarehouse, zoned, 1)[0].locationId == "zone-b");
+    }
+
+    SECTION("Utilisation updates move locations in and out of consideration") {
+        engine.upsertLocation(makeBin("bin", "01", "01", 2.0, 1000.0));
+        REQUIRE(engine.adjustUtilisation("bin", 1.5, 10.0));
+        REQUIRE(engine.suggest(kWarehouse, boxLoad(1.0), 5).empty());
+
+        REQUIRE(engine.adjustUtilisation("bin", -1.0, -10.0));
+        REQUIRE(engine.suggest(kWarehouse, boxLoad(1.0), 5).size() == 1);
+
+        auto utilisation = engine.utilisationOf("bin");
+        REQUIRE(utilisation);
+        REQUIRE(utilisation->usedVolume == Catch::Approx(0.5));
+
+        // Refreshing the location keeps the stored utilisation
+        engine.upsertLocation(makeBin("bin", "01", "01", 2.0, 1000.0));
+        REQUIRE(engine.utilisationOf("bin")->usedVolume == Catch::Approx(0.5));
+
+        REQUIRE_FALSE(engine.adjustUtilisation("unknown", 1.0, 1.0));
+    }
+
+    SECTION("Inactive, non-receivable and removed locations are excluded") {
+        Location full = makeBin("full", "01", "01", 2.0);
+        full.setStatus(LocationStatus::Full);
+        Location noReceive = makeBin("no-receive", "01", "01", 2.0);
+        noReceive.setIsReceivable(false);
+        engine.upsertLocation(full);
+        engine.upsertLocation(noReceive);
+        engine.upsertLocation(makeBin("gone", "01", "01", 2.0));
+        engine.removeLocation("gone");
+
+        REQUIRE(engine.suggest(kWarehouse, boxLoad(0.5), 5).empty());
+        REQUIRE(engine.size() == 2);
+    }
+}
+
+TEST_CASE("Putaway engine benchmark", "[putaway][!benchmark]") {
+    PutawayEngine engine;
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> volume(0.05, 3.0);
+    for (int i = 0; i < 100000; ++i) {
+        engine.upsertLocation(makeBin("loc-" + std::to_string(i),
+                                      std::to_string(1 + i % 40),
+                                      std::to_string(1 + (i / 40) % 50),
+                                      volume(rng)));
+    }
+
+    BENCHMARK("suggest top 10 of 100k locations") {
+        return engine.suggest(kWarehouse, boxLoad(0.8, 50.0), 10);
+    };
+}
@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "warehouse/services/SlottingOptimizer.hpp"
+#include <random>
+#include <set>
+
+using namespace warehouse::services;
+
+namespace {
+
+SlotAssignment slotAt(const std::string& product, double x, double y, std::uint64_t picks,
+                      const std::string& zone = "A") {
+    SlotAssignment slot;
+    slot.productId = product;
+    slot.locationId = "loc-" + product;
+    slot.zone = zone;
+    slot.coordinate = FloorCoordinate{x, y, 0};
+    slot.velocity.picks = picks;
+    return slot;
+}
+
+std::vector<SlotAssignment> applySwaps(std::vector<SlotAssignment> slots, const std::vector<SlotSwap>& swaps) {
+    for (const auto& swap : swaps) {
+        std::swap(slots[swap.fastSlot].coordinate, slots[swap.slowSlot].coordinate);
+    }
+    return slots;
+}
+
+} // namespace
+
+TEST_CASE("Slotting velocity aggregation", "[slotting]") {
+    SlottingOptimizer optimizer(WarehouseLayout(), SlottingOptions{4, 500, false});
+
+    std::vector<PickEvent> events;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<std::uint32_t> slot(0, 99);
+    std::vector<SlotVelocity> expected(100);
+    for (int i = 0; i < 300000; ++i) {
+        PickEvent event{slot(rng), -(1 + i % 3)};
+        expected[event.slot].picks += 1;
+        expected[event.slot].units += static_cast<std::uint64_t>(1 + i % 3);
+        events.push_back(event);
+    }
+    events.push_back(PickEvent{1000, -1});   // outside the slot table, ignored
+
+    auto velocity = optimizer.computeVelocity(events, 100);
+    REQUIRE(velocity.size() == 100);
+    for (std::size_t i = 0; i < 100; ++i) {
+        REQUIRE(velocity[i].picks == expected[i].picks);
+        REQUIRE(velocity[i].units == expected[i].units);
+    }
+}
+
+TEST_CASE("Slotting swap proposals", "[slotting]") {
+    SlottingOptimizer optimizer;
+
+    SECTION("Fast mover at the back swaps with slow mover at the front") {
+        std::vector<SlotAssignment> slots = {
+            slotAt("slow", 3.0, 2.0, 1),
+            slotAt("fast", 90.0, 50.0, 100),
+        };
+
+        auto swaps = optimizer.proposeSwaps(slots);
+        REQUIRE(swaps.size() == 1);
+        REQUIRE(swaps[0].fastSlot == 1);
+        REQUIRE(swaps[0].slowSlot == 0);
+
+        double before = optimizer.expectedTravel(slots);
+        double after = optimizer.expectedTravel(applySwaps(slots, swaps));
+        REQUIRE(before - after == Catch::Approx(swaps[0].estimatedSaving));
+    }
+
+    SECTION("Well-slotted layouts produce no moves") {
+        std::vector<SlotAssignment> slots = {
+            slotAt("a", 3.0, 1.0, 50),
+            slotAt("b", 6.0, 1.0, 20),
+            slotAt("c", 9.0, 1.0, 5),
+        };
+        REQUIRE(optimizer.proposeSwaps(slots).empty());
+    }
+
+    SECTION("Swaps are disjoint, ranked, and their savings add up") {
+        std::vector<SlotAssignment> slots;
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<double> x(3.0, 120.0);
+        std::uniform_real_distribution<double> y(0.0, 60.0);
+        std::uniform_int_distribution<std::uint64_t> picks(0, 1000);
+        for (int i = 0; i < 500; ++i) {
+            slots.push_back(slotAt("p" + std::to_string(i), x(rng), y(rng), picks(rng)));
+        }
+
+        auto swaps = optimizer.proposeSwaps(slots);
+        REQUIRE_FALSE(swaps.empty());
+
+        std::set<std::size_t> used;
+        double totalSaving = 0.0;
+        for (std::size_t i = 0; i < swaps.size(); ++i) {
+            REQUIRE(used.insert(swaps[i].fastSlot).second);
+            REQUIRE(used.insert(swaps[i].slowSlot).second);
+            REQUIRE(swaps[i].estimatedSaving > 0.0);
+            if (i > 0) {
+                REQUIRE(swaps[i].estimatedSaving <= swaps[i - 1].estimatedSaving);
+            }
+            totalSaving += swaps[i].estimatedSaving;
+        }
+
+        double before = optimizer.expectedTravel(slots);
+        double after = optimizer.expectedTravel(applySwaps(slots, swaps));
+        REQUIRE(before - after == Catch::Approx(totalSaving));
+    }
+
+    SECTION("Same-zone option keeps products in their zone") {
+        SlottingOptimizer zoned(WarehouseLayout(), SlottingOptions{0, 500, true});
+        std::vector<SlotAssignment> slots = {
+            slotAt("slow-a", 3.0, 2.0, 1, "A"),
+            slotAt("fast-b", 90.0, 50.0, 100, "B"),
+        };
+        REQUIRE(zoned.proposeSwaps(slots).empty());
+    }
+}
+
+TEST_CASE("Slotting optimiser benchmark", "[slotting][!benchmark]") {
+    SlottingOptimizer optimizer;
+    constexpr std::size_t kSlots = 100000;
+
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<std::uint32_t> slot(0, kSlots - 1);
+    std::vector<PickEvent> events(5000000);
+    for (auto& event : events) {
+        event = PickEvent{slot(rng), -1};
+    }
+
+    std::uniform_real_distribution<double> x(3.0, 240.0);
+    std::uniform_real_distribution<double> y(0.0, 60.0);
+    std::vector<SlotAssignment> slots;
+    slots.reserve(kSlots);
+    for (std::size_t i = 0; i < kSlots; ++i) {
+        slots.push_back(slotAt("p" + std::to_string(i), x(rng), y(rng), 0));
+    }
+    auto velocity = optimizer.computeVelocity(events, kSlots);
+    for (std::size_t i = 0; i < kSlots; ++i) {
+        slots[i].velocity = velocity[i];
+    }
+
+    BENCHMARK("velocity over 5M picks, 100k slots") {
+        return optimizer.computeVelocity(events, kSlots);
+    };
+
+    BENCHMARK("swap proposals for 100k slots") {
+        return optimizer.proposeSwaps(slots);
+    };
+}